@@ -357,6 +357,111 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_deterministic(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_deterministic(
         dnnl_primitive_attr_t attr, int value);
 
+/// Returns the ragged batch primitive attribute value.
+///
+/// @param attr Primitive attributes.
+/// @param value Output ragged batch attribute value.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_ragged_batch(
+        const_dnnl_primitive_attr_t attr, int *value);
+
+/// Sets the ragged batch primitive attribute value.
+///
+/// When set, the primitive takes an s32 tensor with the number of valid rows
+/// of every entry of the outermost batch dimension as the
+/// #DNNL_ARG_ATTR_RAGGED_LENGTHS execution argument. The rows beyond the
+/// length are neither read nor computed, and the corresponding destination
+/// values are unspecified.
+///
+/// @param attr Primitive attributes.
+/// @param value Boolean value to set ragged batch attribute.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_ragged_batch(
+        dnnl_primitive_attr_t attr, int value);
+
+/// Returns the grouped batch primitive attribute value.
+///
+/// @param attr Primitive attributes.
+/// @param value Output grouped batch attribute value.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_grouped_batch(
+        const_dnnl_primitive_attr_t attr, int *value);
+
+/// Sets the grouped batch primitive attribute value.
+///
+/// When set, every entry of the outermost batch dimension computes only the
+/// rows from a range given by an s32 tensor of offsets passed as the
+/// #DNNL_ARG_ATTR_GROUPED_OFFSETS execution argument. The tensor has one
+/// more value than the number of entries, and entry `g` computes the rows
+/// from `offsets[g]` to `offsets[g + 1]`. Other rows are neither read nor
+/// written, so the entries may share the source and destination buffers by
+/// means of zero batch strides.
+///
+/// @param attr Primitive attributes.
+/// @param value Boolean value to set grouped batch attribute.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_grouped_batch(
+        dnnl_primitive_attr_t attr, int value);
+
+/// Returns the weights lookup table primitive attribute value.
+///
+/// @param attr Primitive attributes.
+/// @param group_size Output number of consecutive rows of the weights
+///     sharing a lookup table, or 0 if lookup tables are not used.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_weights_lut(
+        const_dnnl_primitive_attr_t attr, dnnl_dim_t *group_size);
+
+/// Sets the weights lookup table primitive attribute value.
+///
+/// When set, 4-bit weights are treated as indices into lookup tables of 16
+/// values (codebooks such as NF4). The tables are passed as an f32 tensor of
+/// dimensions `{K / group_size, 16}` with the
+/// #DNNL_ARG_ATTR_WEIGHTS_LUT execution argument, and every group of
+/// @p group_size consecutive rows of the weights (along the K dimension)
+/// uses its own table. Weights scales are applied to the looked up values.
+///
+/// @param attr Primitive attributes.
+/// @param group_size Number of consecutive rows of the weights sharing a
+///     lookup table. The value 0 disables lookup tables.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_weights_lut(
+        dnnl_primitive_attr_t attr, dnnl_dim_t group_size);
+
+/// Returns the source dynamic quantization primitive attribute value.
+///
+/// @param attr Primitive attributes.
+/// @param data_type Output data type the source is quantized to, or
+///     #dnnl_data_type_undef if the source is not quantized.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_src_dynamic_quantization(
+        const_dnnl_primitive_attr_t attr, dnnl_data_type_t *data_type);
+
+/// Sets the source dynamic quantization primitive attribute value.
+///
+/// When set, an f32 or bf16 source is quantized to @p data_type as a part of
+/// the primitive execution. Every row of the source (a token) gets its own
+/// scale, `max(|src(m, :)|) / 127` for #dnnl_s8 and `max(|src(m, :)|) / 255`
+/// for #dnnl_u8, and the source is multiplied by its inverse and rounded to
+/// the nearest integer. The scales of the rows are applied to the
+/// accumulated values together with the weights scales. Negative values
+/// saturate to zero for #dnnl_u8.
+///
+/// @param attr Primitive attributes.
+/// @param data_type Data type to quantize the source to, #dnnl_s8 or
+///     #dnnl_u8. The value #dnnl_data_type_undef disables quantization.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_src_dynamic_quantization(
+        dnnl_primitive_attr_t attr, dnnl_data_type_t data_type);
+
 /// Returns the accumulation mode primitive attribute.
 ///
 /// @param attr Primitive attributes.
@@ -965,6 +1070,37 @@ dnnl_status_t DNNL_API dnnl_memory_desc_create_with_coo_encoding(
         dnnl_data_type_t data_type, dnnl_dim_t nnz,
         dnnl_data_type_t indices_dt);
 
+/// Creates a memory descriptor for BSR encoding.
+///
+/// The tensor is split into dense blocks of @p block_dims and only the blocks
+/// that contain non-zero entries are stored. The created memory descriptor
+/// will describe a memory object that contains 3 buffers. The buffers have
+/// the following meaning and assigned numbers (index):
+///  - 0: values, the stored blocks one after another with every block in
+///       the row-major order
+///  - 1: indices, the block column of every stored block
+///  - 2: pointers, the position of the first stored block of every block
+///       row in the indices, with the total number of the stored blocks at
+///       the end
+///
+/// @param memory_desc Output memory descriptor.
+/// @param ndims Number of dimensions. Only 2 is supported.
+/// @param dims Array of dimensions. The dimensions must be divisible by the
+///     block dimensions.
+/// @param data_type Elements data type.
+/// @param nnz_blocks Number of stored (non-zero) blocks.
+/// @param block_dims Array of block dimensions.
+/// @param indices_dt Data type of indices.
+/// @param pointers_dt Data type of pointers.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+/// @sa @ref dev_guide_sparsity
+dnnl_status_t DNNL_API dnnl_memory_desc_create_with_bsr_encoding(
+        dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
+        dnnl_data_type_t data_type, dnnl_dim_t nnz_blocks,
+        const dnnl_dims_t block_dims, dnnl_data_type_t indices_dt,
+        dnnl_data_type_t pointers_dt);
+
 /// Creates a memory descriptor for packed sparse encoding.
 ///
 /// The created memory descriptor cannot be used to create a memory
@@ -3612,6 +3748,43 @@ dnnl_status_t DNNL_API dnnl_reduction_primitive_desc_create(
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_embedding_bag Embedding Bag
+/// @{
+
+/// Creates a primitive descriptor for an embedding bag forward propagation
+///     primitive.
+///
+/// @note
+///     Destination memory descriptor is allowed to be initialized with
+///     #dnnl_format_tag_any or with format_kind set to #dnnl_format_kind_any.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param prop_kind Propagation kind. Possible values are
+///     #dnnl_forward_training and #dnnl_forward_inference.
+/// @param alg_kind Embedding bag algorithm kind. Possible values:
+///     #dnnl_embedding_bag_sum, #dnnl_embedding_bag_mean,
+///     #dnnl_embedding_bag_max.
+/// @param src_desc Source (embedding table) memory descriptor.
+/// @param indices_desc Indices memory descriptor.
+/// @param offsets_desc Offsets memory descriptor.
+/// @param weights_desc Per-sample weights memory descriptor. Passing NULL
+///     or a zero memory descriptor disables the per-sample weights.
+/// @param dst_desc Destination memory descriptor.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_embedding_bag_forward_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_prop_kind_t prop_kind, dnnl_alg_kind_t alg_kind,
+        const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t indices_desc,
+        const_dnnl_memory_desc_t offsets_desc,
+        const_dnnl_memory_desc_t weights_desc,
+        const_dnnl_memory_desc_t dst_desc, const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_embedding_bag
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_primitive_cache
@@ -4014,6 +4187,264 @@ dnnl_status_t DNNL_API dnnl_gemm_s8s8s32(char transa, char transb, char offsetc,
         dnnl_dim_t lda, int8_t ao, const int8_t *B, dnnl_dim_t ldb, int8_t bo,
         float beta, int32_t *C, dnnl_dim_t ldc, const int32_t *co);
 
+/// Performs a batch of single-precision matrix-matrix multiplies of the same
+/// shape with matrices located at constant strides from each other.
+///
+/// For every `i` from 0 to `batch_size - 1` the operation is defined as:
+///
+/// `C_i := alpha * op( A_i ) * op( B_i ) + beta * C_i`
+///
+/// where `A_i = A + i * stride_a`, `B_i = B + i * stride_b`, and
+/// `C_i = C + i * stride_c`. See dnnl_sgemm() for the definition of the
+/// other parameters.
+///
+/// All the problems are computed within a single parallel region, which
+/// avoids the threading overhead of calling dnnl_sgemm() in a loop for small
+/// problems.
+///
+/// @param transa Transposition flag for matrices A.
+/// @param transb Transposition flag for matrices B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter.
+/// @param A A pointer to the first A matrix data.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance, in elements, between two A matrices.
+/// @param B A pointer to the first B matrix data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance, in elements, between two B matrices.
+/// @param beta The beta parameter.
+/// @param C A pointer to the first C matrix data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance, in elements, between two C matrices.
+/// @param batch_size The number of problems.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_batch_strided(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *A,
+        dnnl_dim_t lda, dnnl_dim_t stride_a, const float *B, dnnl_dim_t ldb,
+        dnnl_dim_t stride_b, float beta, float *C, dnnl_dim_t ldc,
+        dnnl_dim_t stride_c, dnnl_dim_t batch_size);
+
+/// Performs a batch of single-precision matrix-matrix multiplies of the same
+/// shape with matrices given by arrays of pointers.
+///
+/// For every `i` from 0 to `batch_size - 1` the operation is defined as:
+///
+/// `C[i] := alpha * op( A[i] ) * op( B[i] ) + beta * C[i]`
+///
+/// See dnnl_sgemm() for the definition of the other parameters.
+///
+/// @param transa Transposition flag for matrices A.
+/// @param transb Transposition flag for matrices B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter.
+/// @param A An array of @p batch_size pointers to the A matrices data.
+/// @param lda The leading dimension for the matrices A.
+/// @param B An array of @p batch_size pointers to the B matrices data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param beta The beta parameter.
+/// @param C An array of @p batch_size pointers to the C matrices data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param batch_size The number of problems.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_batch(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const float *const *A, dnnl_dim_t lda, const float *const *B,
+        dnnl_dim_t ldb, float beta, float *const *C, dnnl_dim_t ldc,
+        dnnl_dim_t batch_size);
+
+/// Performs groups of single-precision matrix-matrix multiplies. Problems
+/// within a group share their parameters, while the groups may have
+/// different shapes.
+///
+/// The problems of group `g` are the @p group_sizes[g] consecutive entries
+/// of the arrays of pointers @p A, @p B, and @p C following the problems of
+/// the previous groups. They are computed as with dnnl_sgemm() with the
+/// parameters @p transa[g], @p transb[g], @p M[g], and so on.
+///
+/// @param group_count The number of groups.
+/// @param group_sizes An array with the number of problems of every group.
+/// @param transa An array of transposition flags for matrices A.
+/// @param transb An array of transposition flags for matrices B.
+/// @param M An array of M dimensions.
+/// @param N An array of N dimensions.
+/// @param K An array of K dimensions.
+/// @param alpha An array of alpha parameters.
+/// @param A An array of pointers to the A matrices data of all the problems.
+/// @param lda An array of leading dimensions for the matrices A.
+/// @param B An array of pointers to the B matrices data of all the problems.
+/// @param ldb An array of leading dimensions for the matrices B.
+/// @param beta An array of beta parameters.
+/// @param C An array of pointers to the C matrices data of all the problems.
+/// @param ldc An array of leading dimensions for the matrices C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_batch_grouped(dnnl_dim_t group_count,
+        const dnnl_dim_t *group_sizes, const char *transa, const char *transb,
+        const dnnl_dim_t *M, const dnnl_dim_t *N, const dnnl_dim_t *K,
+        const float *alpha, const float *const *A, const dnnl_dim_t *lda,
+        const float *const *B, const dnnl_dim_t *ldb, const float *beta,
+        float *const *C, const dnnl_dim_t *ldc);
+
+/// Performs a batch of integer matrix-matrix multiplies on 8-bit unsigned
+/// matrices A, 8-bit signed matrices B, and 32-bit signed resulting
+/// matrices C located at constant strides from each other.
+///
+/// Problem `i` is computed as with dnnl_gemm_u8s8s32() with the matrices
+/// `A + i * stride_a`, `B + i * stride_b`, `C + i * stride_c`, and the
+/// offsets `co + i * stride_co`.
+///
+/// @param transa Transposition flag for matrices A.
+/// @param transb Transposition flag for matrices B.
+/// @param offsetc Flag specifying how offsets should be applied to matrices
+///     C.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter.
+/// @param A A pointer to the first A matrix data.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance, in elements, between two A matrices.
+/// @param ao The offset value for the matrices A.
+/// @param B A pointer to the first B matrix data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance, in elements, between two B matrices.
+/// @param bo The offset value for the matrices B.
+/// @param beta The beta parameter.
+/// @param C A pointer to the first C matrix data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance, in elements, between two C matrices.
+/// @param co A pointer to the offset values for the first matrix C.
+/// @param stride_co The distance, in elements, between the offset values of
+///     two matrices C.
+/// @param batch_size The number of problems.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_batch_strided(char transa,
+        char transb, char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        float alpha, const uint8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a,
+        uint8_t ao, const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b,
+        int8_t bo, float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t stride_co, dnnl_dim_t batch_size);
+
+/// Performs a batch of integer matrix-matrix multiplies on 8-bit unsigned
+/// matrices A, 8-bit signed matrices B, and 32-bit signed resulting
+/// matrices C given by arrays of pointers.
+///
+/// Problem `i` is computed as with dnnl_gemm_u8s8s32() with the matrices
+/// `A[i]`, `B[i]`, `C[i]`, and the offsets `co[i]`.
+///
+/// @param transa Transposition flag for matrices A.
+/// @param transb Transposition flag for matrices B.
+/// @param offsetc Flag specifying how offsets should be applied to matrices
+///     C.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter.
+/// @param A An array of @p batch_size pointers to the A matrices data.
+/// @param lda The leading dimension for the matrices A.
+/// @param ao The offset value for the matrices A.
+/// @param B An array of @p batch_size pointers to the B matrices data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param bo The offset value for the matrices B.
+/// @param beta The beta parameter.
+/// @param C An array of @p batch_size pointers to the C matrices data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param co An array of @p batch_size pointers to the offset values for the
+///     matrices C.
+/// @param batch_size The number of problems.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_batch(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint8_t *const *A, dnnl_dim_t lda, uint8_t ao,
+        const int8_t *const *B, dnnl_dim_t ldb, int8_t bo, float beta,
+        int32_t *const *C, dnnl_dim_t ldc, const int32_t *const *co,
+        dnnl_dim_t batch_size);
+
+/// Performs a batch of integer matrix-matrix multiplies on 8-bit signed
+/// matrices A, 8-bit signed matrices B, and 32-bit signed resulting
+/// matrices C located at constant strides from each other.
+///
+/// Problem `i` is computed as with dnnl_gemm_s8s8s32() with the matrices
+/// `A + i * stride_a`, `B + i * stride_b`, `C + i * stride_c`, and the
+/// offsets `co + i * stride_co`.
+///
+/// @param transa Transposition flag for matrices A.
+/// @param transb Transposition flag for matrices B.
+/// @param offsetc Flag specifying how offsets should be applied to matrices
+///     C.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter.
+/// @param A A pointer to the first A matrix data.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance, in elements, between two A matrices.
+/// @param ao The offset value for the matrices A.
+/// @param B A pointer to the first B matrix data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance, in elements, between two B matrices.
+/// @param bo The offset value for the matrices B.
+/// @param beta The beta parameter.
+/// @param C A pointer to the first C matrix data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance, in elements, between two C matrices.
+/// @param co A pointer to the offset values for the first matrix C.
+/// @param stride_co The distance, in elements, between the offset values of
+///     two matrices C.
+/// @param batch_size The number of problems.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_batch_strided(char transa,
+        char transb, char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        float alpha, const int8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a,
+        int8_t ao, const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b,
+        int8_t bo, float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t stride_co, dnnl_dim_t batch_size);
+
+/// Performs a batch of integer matrix-matrix multiplies on 8-bit signed
+/// matrices A, 8-bit signed matrices B, and 32-bit signed resulting
+/// matrices C given by arrays of pointers.
+///
+/// Problem `i` is computed as with dnnl_gemm_s8s8s32() with the matrices
+/// `A[i]`, `B[i]`, `C[i]`, and the offsets `co[i]`.
+///
+/// @param transa Transposition flag for matrices A.
+/// @param transb Transposition flag for matrices B.
+/// @param offsetc Flag specifying how offsets should be applied to matrices
+///     C.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter.
+/// @param A An array of @p batch_size pointers to the A matrices data.
+/// @param lda The leading dimension for the matrices A.
+/// @param ao The offset value for the matrices A.
+/// @param B An array of @p batch_size pointers to the B matrices data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param bo The offset value for the matrices B.
+/// @param beta The beta parameter.
+/// @param C An array of @p batch_size pointers to the C matrices data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param co An array of @p batch_size pointers to the offset values for the
+///     matrices C.
+/// @param batch_size The number of problems.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_batch(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const int8_t *const *A, dnnl_dim_t lda, int8_t ao,
+        const int8_t *const *B, dnnl_dim_t ldb, int8_t bo, float beta,
+        int32_t *const *C, dnnl_dim_t ldc, const int32_t *const *co,
+        dnnl_dim_t batch_size);
+
 /// @} dnnl_api_blas
 
 /// @} dnnl_api
@@ -151,6 +151,8 @@ struct primitive : public handle<dnnl_primitive_t> {
         layer_normalization = dnnl_layer_normalization,
         /// A group normalization primitive
         group_normalization = dnnl_group_normalization,
+        /// An embedding bag primitive.
+        embedding_bag = dnnl_embedding_bag,
     };
 
     using handle::handle;
@@ -501,6 +503,12 @@ enum class algorithm {
     softmax_accurate = dnnl_softmax_accurate,
     /// LogSoftmax, numerically stable
     softmax_log = dnnl_softmax_log,
+    /// Embedding bag using sum
+    embedding_bag_sum = dnnl_embedding_bag_sum,
+    /// Embedding bag using mean
+    embedding_bag_mean = dnnl_embedding_bag_mean,
+    /// Embedding bag using max
+    embedding_bag_max = dnnl_embedding_bag_max,
 };
 
 /// Converts algorithm kind enum value from C++ API to C API type.
@@ -952,6 +960,8 @@ struct memory : public handle<dnnl_memory_t> {
         packed = dnnl_packed,
         /// Coordinate Sparse (COO) encoding.
         coo = dnnl_coo,
+        /// Block Compressed Sparse Row (BSR) encoding.
+        bsr = dnnl_bsr,
     };
 
     /// Memory format tag specification.
@@ -2925,6 +2935,49 @@ struct memory : public handle<dnnl_memory_t> {
             return desc {md};
         }
 
+        /// Function for creating a memory descriptor for BSR sparse encoding.
+        ///
+        /// The tensor is split into dense blocks of @p block_dims and only
+        /// the blocks that contain non-zero entries are stored. The created
+        /// memory descriptor will describe a memory object that contains 3
+        /// buffers. The buffers have the following meaning and assigned
+        /// numbers (index):
+        ///  - 0: values, the stored blocks with every block in the row-major
+        ///       order
+        ///  - 1: indices, the block column of every stored block
+        ///  - 2: pointers, the position of the first stored block of every
+        ///       block row, with the number of the stored blocks at the end
+        ///
+        /// @param adims Tensor dimensions.
+        /// @param adata_type Data precision/type.
+        /// @param nnz_blocks Number of stored (non-zero) blocks.
+        /// @param block_dims Block dimensions.
+        /// @param index_dt Data type of indices.
+        /// @param pointer_dt Data type of pointers.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case a
+        ///     zero memory descriptor will be constructed. This flag is
+        ///     optional and defaults to false.
+        /// @sa @ref dev_guide_sparsity
+        static desc bsr(const dims &adims, data_type adata_type,
+                dim nnz_blocks, const dims &block_dims, data_type index_dt,
+                data_type pointer_dt, bool allow_empty = false) {
+            validate_dims(adims);
+            validate_container_size(block_dims,
+                    "block dimensions do not match the tensor dimensions",
+                    (int)adims.size(), (int)adims.size());
+            dnnl_memory_desc_t md = nullptr;
+            dnnl_status_t status = dnnl_memory_desc_create_with_bsr_encoding(
+                    &md, (int)adims.size(), adims.data(),
+                    convert_to_c(adata_type), nnz_blocks, block_dims.data(),
+                    convert_to_c(index_dt), convert_to_c(pointer_dt));
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a memory descriptor for BSR sparse "
+                        "encoding");
+            return desc {md};
+        }
+
         /// Function for creating a memory descriptor for packed sparse
         /// encoding.
         ///
@@ -4029,6 +4082,89 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set deterministic primitive attribute");
     }
 
+    /// Returns the ragged batch attribute value
+    bool get_ragged_batch() const {
+        int result;
+        error::wrap_c_api(dnnl_primitive_attr_get_ragged_batch(get(), &result),
+                "could not get ragged batch primitive attribute");
+        return static_cast<bool>(result);
+    }
+
+    /// Sets ragged batch attribute value. The lengths of the batch entries
+    /// are passed at execution time as #DNNL_ARG_ATTR_RAGGED_LENGTHS.
+    ///
+    /// @param value Specified ragged batch mode.
+    void set_ragged_batch(bool value) {
+        error::wrap_c_api(dnnl_primitive_attr_set_ragged_batch(
+                                  get(), static_cast<int>(value)),
+                "could not set ragged batch primitive attribute");
+    }
+
+    /// Returns the grouped batch attribute value
+    bool get_grouped_batch() const {
+        int result;
+        error::wrap_c_api(dnnl_primitive_attr_get_grouped_batch(get(), &result),
+                "could not get grouped batch primitive attribute");
+        return static_cast<bool>(result);
+    }
+
+    /// Sets grouped batch attribute value. The row offsets of the batch
+    /// entries are passed at execution time as
+    /// #DNNL_ARG_ATTR_GROUPED_OFFSETS.
+    ///
+    /// @param value Specified grouped batch mode.
+    void set_grouped_batch(bool value) {
+        error::wrap_c_api(dnnl_primitive_attr_set_grouped_batch(
+                                  get(), static_cast<int>(value)),
+                "could not set grouped batch primitive attribute");
+    }
+
+    /// Returns the number of consecutive rows of the weights sharing a
+    /// lookup table, or 0 if lookup tables are not used.
+    memory::dim get_weights_lut() const {
+        dnnl_dim_t result;
+        error::wrap_c_api(dnnl_primitive_attr_get_weights_lut(get(), &result),
+                "could not get weights lookup table primitive attribute");
+        return result;
+    }
+
+    /// Sets the weights lookup table attribute value. The 4-bit weights are
+    /// indices into f32 tables of 16 values passed at execution time as
+    /// #DNNL_ARG_ATTR_WEIGHTS_LUT.
+    ///
+    /// @param group_size Number of consecutive rows of the weights sharing
+    ///     a lookup table. The value 0 disables lookup tables.
+    void set_weights_lut(memory::dim group_size) {
+        error::wrap_c_api(
+                dnnl_primitive_attr_set_weights_lut(get(), group_size),
+                "could not set weights lookup table primitive attribute");
+    }
+
+    /// Returns the data type the source is dynamically quantized to, or
+    /// #dnnl::memory::data_type::undef if the source is not quantized.
+    memory::data_type get_src_dynamic_quantization() const {
+        dnnl_data_type_t result;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_src_dynamic_quantization(
+                        get(), &result),
+                "could not get src dynamic quantization primitive "
+                "attribute");
+        return static_cast<memory::data_type>(result);
+    }
+
+    /// Sets the source dynamic quantization attribute value. The source is
+    /// quantized with a scale computed for every row at execution time.
+    ///
+    /// @param data_type Data type to quantize the source to,
+    ///     #dnnl::memory::data_type::s8 or #dnnl::memory::data_type::u8.
+    ///     The value #dnnl::memory::data_type::undef disables quantization.
+    void set_src_dynamic_quantization(memory::data_type data_type) {
+        error::wrap_c_api(dnnl_primitive_attr_set_src_dynamic_quantization(
+                                  get(), memory::convert_to_c(data_type)),
+                "could not set src dynamic quantization primitive "
+                "attribute");
+    }
+
     /// Returns the rounding mode attribute value
     ///
     /// @param arg Argument for which rounding mode query applies.
@@ -13712,6 +13848,179 @@ struct reduction : public primitive {
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_embedding_bag Embedding Bag
+///
+/// A primitive to look up rows of an embedding table and to pool every bag
+/// of looked up rows using sum, mean or max operations.
+///
+/// @sa @ref dev_guide_embedding_bag in developer guide
+///
+/// @{
+
+/// Embedding bag forward propagation primitive.
+struct embedding_bag_forward : public primitive {
+    /// Primitive descriptor for an embedding bag forward propagation
+    /// primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for an embedding bag forward
+        ///     propagation primitive with per-sample weights.
+        ///
+        /// @note
+        ///     Destination memory descriptor may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training and
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param aalgorithm Embedding bag algorithm kind. Possible values:
+        ///     #dnnl::algorithm::embedding_bag_sum,
+        ///     #dnnl::algorithm::embedding_bag_mean,
+        ///     #dnnl::algorithm::embedding_bag_max.
+        /// @param src_desc Source (embedding table) memory descriptor.
+        /// @param indices_desc Indices memory descriptor.
+        /// @param offsets_desc Offsets memory descriptor.
+        /// @param weights_desc Per-sample weights memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, prop_kind aprop_kind,
+                algorithm aalgorithm, const memory::desc &src_desc,
+                const memory::desc &indices_desc,
+                const memory::desc &offsets_desc,
+                const memory::desc &weights_desc,
+                const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, aprop_kind, aalgorithm, src_desc,
+                    indices_desc, offsets_desc, &weights_desc, dst_desc, attr,
+                    allow_empty) {}
+
+        /// Constructs a primitive descriptor for an embedding bag forward
+        ///     propagation primitive without per-sample weights.
+        ///
+        /// @note
+        ///     Destination memory descriptor may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aprop_kind Propagation kind. Possible values are
+        ///     #dnnl::prop_kind::forward_training and
+        ///     #dnnl::prop_kind::forward_inference.
+        /// @param aalgorithm Embedding bag algorithm kind. Possible values:
+        ///     #dnnl::algorithm::embedding_bag_sum,
+        ///     #dnnl::algorithm::embedding_bag_mean,
+        ///     #dnnl::algorithm::embedding_bag_max.
+        /// @param src_desc Source (embedding table) memory descriptor.
+        /// @param indices_desc Indices memory descriptor.
+        /// @param offsets_desc Offsets memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, prop_kind aprop_kind,
+                algorithm aalgorithm, const memory::desc &src_desc,
+                const memory::desc &indices_desc,
+                const memory::desc &offsets_desc,
+                const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, aprop_kind, aalgorithm, src_desc,
+                    indices_desc, offsets_desc, nullptr, dst_desc, attr,
+                    allow_empty) {}
+
+        /// Constructs a primitive descriptor for an embedding bag forward
+        /// propagation primitive from a C API primitive descriptor that must
+        /// have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for an embedding bag forward
+        ///     propagation primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::embedding_bag,
+                    dnnl::prop_kind::forward_training,
+                    dnnl::prop_kind::forward_inference) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// Returns an indices memory descriptor.
+        /// @returns Indices memory descriptor.
+        memory::desc indices_desc() const { return base::src_desc(1); }
+
+        /// Returns an offsets memory descriptor.
+        /// @returns Offsets memory descriptor.
+        memory::desc offsets_desc() const { return base::src_desc(2); }
+
+        /// @copydoc dnnl::primitive_desc_base::weights_desc()const
+        memory::desc weights_desc() const { return base::weights_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_algorithm()const
+        algorithm get_algorithm() const { return base::get_algorithm(); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_prop_kind()const
+        prop_kind get_prop_kind() const { return base::get_prop_kind(); }
+
+    private:
+        primitive_desc(const engine &aengine, prop_kind aprop_kind,
+                algorithm aalgorithm, const memory::desc &src_desc,
+                const memory::desc &indices_desc,
+                const memory::desc &offsets_desc,
+                const memory::desc *weights_desc,
+                const memory::desc &dst_desc, const primitive_attr &attr,
+                bool allow_empty) {
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status
+                    = dnnl_embedding_bag_forward_primitive_desc_create(&pd,
+                            aengine.get(), dnnl::convert_to_c(aprop_kind),
+                            convert_to_c(aalgorithm), src_desc.get(),
+                            indices_desc.get(), offsets_desc.get(),
+                            optional_arg(weights_desc), dst_desc.get(),
+                            attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for "
+                        "the embedding bag forward propagation primitive. "
+                        "Run workload with environment variable "
+                        "ONEDNN_VERBOSE=all to get additional diagnostic "
+                        "information.");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    embedding_bag_forward() = default;
+
+    /// Constructs an embedding bag forward propagation primitive.
+    /// @param pd Primitive descriptor for an embedding bag forward
+    ///     propagation primitive.
+    embedding_bag_forward(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs an embedding bag forward propagation primitive from a cache
+    ///     blob.
+    /// @param pd Primitive descriptor for an embedding bag forward
+    ///     propagation primitive.
+    /// @param cache_blob Cache blob.
+    embedding_bag_forward(
+            const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_embedding_bag
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_service Service
@@ -13967,6 +14276,86 @@ inline status gemm_s8s8s32(char transa, char transb, char offsetc, dnnl_dim_t M,
             K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co));
 }
 
+/// @copydoc dnnl_sgemm_batch_strided()
+inline status sgemm_batch_strided(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *A,
+        dnnl_dim_t lda, dnnl_dim_t stride_a, const float *B, dnnl_dim_t ldb,
+        dnnl_dim_t stride_b, float beta, float *C, dnnl_dim_t ldc,
+        dnnl_dim_t stride_c, dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_sgemm_batch_strided(transa, transb, M, N,
+            K, alpha, A, lda, stride_a, B, ldb, stride_b, beta, C, ldc,
+            stride_c, batch_size));
+}
+
+/// @copydoc dnnl_sgemm_batch()
+inline status sgemm_batch(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *const *A,
+        dnnl_dim_t lda, const float *const *B, dnnl_dim_t ldb, float beta,
+        float *const *C, dnnl_dim_t ldc, dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_sgemm_batch(transa, transb, M, N, K, alpha,
+            A, lda, B, ldb, beta, C, ldc, batch_size));
+}
+
+/// @copydoc dnnl_sgemm_batch_grouped()
+inline status sgemm_batch_grouped(dnnl_dim_t group_count,
+        const dnnl_dim_t *group_sizes, const char *transa, const char *transb,
+        const dnnl_dim_t *M, const dnnl_dim_t *N, const dnnl_dim_t *K,
+        const float *alpha, const float *const *A, const dnnl_dim_t *lda,
+        const float *const *B, const dnnl_dim_t *ldb, const float *beta,
+        float *const *C, const dnnl_dim_t *ldc) {
+    return static_cast<status>(dnnl_sgemm_batch_grouped(group_count,
+            group_sizes, transa, transb, M, N, K, alpha, A, lda, B, ldb, beta,
+            C, ldc));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_batch_strided()
+inline status gemm_u8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a, uint8_t ao,
+        const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b, int8_t bo,
+        float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t stride_co, dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_batch_strided(transa, transb,
+            offsetc, M, N, K, alpha, A, lda, stride_a, ao, B, ldb, stride_b,
+            bo, beta, C, ldc, stride_c, co, stride_co, batch_size));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_batch()
+inline status gemm_u8s8s32_batch(char transa, char transb, char offsetc,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint8_t *const *A, dnnl_dim_t lda, uint8_t ao,
+        const int8_t *const *B, dnnl_dim_t ldb, int8_t bo, float beta,
+        int32_t *const *C, dnnl_dim_t ldc, const int32_t *const *co,
+        dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_batch(transa, transb, offsetc,
+            M, N, K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co,
+            batch_size));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_batch_strided()
+inline status gemm_s8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const int8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a, int8_t ao,
+        const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b, int8_t bo,
+        float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t stride_co, dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_batch_strided(transa, transb,
+            offsetc, M, N, K, alpha, A, lda, stride_a, ao, B, ldb, stride_b,
+            bo, beta, C, ldc, stride_c, co, stride_co, batch_size));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_batch()
+inline status gemm_s8s8s32_batch(char transa, char transb, char offsetc,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const int8_t *const *A, dnnl_dim_t lda, int8_t ao,
+        const int8_t *const *B, dnnl_dim_t ldb, int8_t bo, float beta,
+        int32_t *const *C, dnnl_dim_t ldc, const int32_t *const *co,
+        dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_batch(transa, transb, offsetc,
+            M, N, K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co,
+            batch_size));
+}
+
 /// @} dnnl_api_blas
 
 // implementation section
@@ -76,6 +76,8 @@ typedef enum {
     dnnl_packed,
     /// Coordinate Sparse Encoding (COO).
     dnnl_coo,
+    /// Block Compressed Sparse Row (BSR) encoding.
+    dnnl_bsr,
 } dnnl_sparse_encoding_t;
 
 #ifdef DNNL_EXPERIMENTAL_PROFILING
@@ -2048,6 +2050,8 @@ typedef enum {
     dnnl_layer_normalization,
     /// A group normalization primitive.
     dnnl_group_normalization,
+    /// An embedding bag primitive.
+    dnnl_embedding_bag,
 
     /// Parameter to allow internal only primitives without undefined behavior.
     /// This parameter is chosen to be valid for so long as sizeof(int) >= 2.
@@ -2206,6 +2210,12 @@ typedef enum {
     dnnl_softmax_accurate = 0x30000,
     /// Logsoftmax
     dnnl_softmax_log,
+    /// Embedding bag using sum
+    dnnl_embedding_bag_sum = 0x40000,
+    /// Embedding bag using mean
+    dnnl_embedding_bag_mean,
+    /// Embedding bag using max
+    dnnl_embedding_bag_max,
 } dnnl_alg_kind_t;
 
 /// Flags for normalization primitives.
@@ -2676,10 +2686,20 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// Dropout RNG seed value passed via a buffer.
 #define DNNL_ARG_ATTR_DROPOUT_SEED 511
 
+/// Number of valid rows of every batch entry for the ragged batch attribute.
+#define DNNL_ARG_ATTR_RAGGED_LENGTHS 512
+
 /// Output scaling factors provided at execution time.
 /// Deprecated value.
 #define DNNL_ARG_ATTR_OUTPUT_SCALES 513
 
+/// Row offsets of every batch entry for the grouped batch attribute.
+#define DNNL_ARG_ATTR_GROUPED_OFFSETS 514
+
+/// Lookup tables of the weights values for the weights lookup table
+/// attribute.
+#define DNNL_ARG_ATTR_WEIGHTS_LUT 515
+
 /// Starting index for source arguments for primitives that take a variable
 /// number of source arguments.
 #define DNNL_ARG_MULTIPLE_SRC 1024
@@ -144,6 +144,9 @@ const alg_kind_t reduction_norm_lp_power_p_sum
         = dnnl_reduction_norm_lp_power_p_sum;
 const alg_kind_t softmax_accurate = dnnl_softmax_accurate;
 const alg_kind_t softmax_log = dnnl_softmax_log;
+const alg_kind_t embedding_bag_sum = dnnl_embedding_bag_sum;
+const alg_kind_t embedding_bag_mean = dnnl_embedding_bag_mean;
+const alg_kind_t embedding_bag_max = dnnl_embedding_bag_max;
 // Internal only alg kinds.
 const alg_kind_t internal_only_start = (alg_kind_t)(1 << 12);
 // GPU only via jit_eltwise injector.
@@ -216,6 +219,7 @@ namespace sparse_encoding {
 const sparse_encoding_t undef = dnnl_sparse_encoding_undef;
 const sparse_encoding_t csr = dnnl_csr;
 const sparse_encoding_t coo = dnnl_coo;
+const sparse_encoding_t bsr = dnnl_bsr;
 const sparse_encoding_t packed = dnnl_packed;
 } // namespace sparse_encoding
 
@@ -1980,6 +1984,7 @@ const primitive_kind_t reduction = dnnl_reduction;
 const primitive_kind_t softmax = dnnl_softmax;
 const primitive_kind_t layer_normalization = dnnl_layer_normalization;
 const primitive_kind_t group_normalization = dnnl_group_normalization;
+const primitive_kind_t embedding_bag = dnnl_embedding_bag;
 
 // Internal only primitive kinds.
 const primitive_kind_t internal_only_start = (primitive_kind_t)(1 << 12);
@@ -2113,6 +2118,7 @@ struct deconvolution_pd_t;
 struct eltwise_bwd_pd_t;
 struct eltwise_fwd_pd_t;
 struct eltwise_pd_t;
+struct embedding_bag_pd_t;
 struct gemm_pd_t;
 struct group_normalization_bwd_pd_t;
 struct group_normalization_fwd_pd_t;
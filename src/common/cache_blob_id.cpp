@@ -25,6 +25,14 @@
 namespace dnnl {
 namespace impl {
 
+bool is_cache_blob_supported(const engine_t *engine) {
+    const auto engine_kind = engine->kind();
+    const auto runtime_kind = engine->runtime_kind();
+    return engine_kind == engine_kind::cpu
+            || (engine_kind == engine_kind::gpu
+                    && runtime_kind == runtime_kind::ocl);
+}
+
 const std::vector<uint8_t> &cache_blob_id_t::get(
         const engine_t *engine, const primitive_desc_t *pd) {
     if (is_initialized_) return sstream_.get_data();
@@ -32,17 +40,10 @@ const std::vector<uint8_t> &cache_blob_id_t::get(
     auto engine_kind = engine->kind();
     auto runtime_kind = engine->runtime_kind();
 
-    if (engine_kind != engine_kind::gpu
-            || (engine_kind == engine_kind::gpu
-                    && runtime_kind != runtime_kind::ocl)) {
-        return sstream_.get_data();
-    }
+    if (!is_cache_blob_supported(engine)) { return sstream_.get_data(); }
 
     if (pd->kind() == primitive_kind::zero_pad) { return sstream_.get_data(); }
 
-    assert(engine->kind() == engine_kind::gpu
-            && engine->runtime_kind() == runtime_kind::ocl);
-
     const auto init_id = [&]() {
         serialize_desc(sstream_, pd->op_desc());
         serialize(sstream_, *pd->attr());
@@ -29,6 +29,11 @@ namespace dnnl {
 namespace impl {
 
 struct primitive_desc_t;
+
+// Returns true if primitives created for the engine can be stored to and
+// restored from a cache blob.
+bool is_cache_blob_supported(const engine_t *engine);
+
 struct cache_blob_id_t {
     cache_blob_id_t() : is_initialized_ {false} {}
     cache_blob_id_t(const cache_blob_id_t &other)
@@ -22,6 +22,7 @@
 #include <memory>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "oneapi/dnnl/dnnl_config.h"
 
@@ -114,12 +115,15 @@ protected:
     virtual value_t get_or_add(const key_t &key, const value_t &value) = 0;
     virtual void remove_if_invalidated(const key_t &key) = 0;
     virtual void update_entry(const key_t &key, const object_t &p) = 0;
-    static utils::rw_mutex_t &rw_mutex() {
-        static utils::rw_mutex_t mutex;
-        return mutex;
-    }
+    utils::rw_mutex_t &rw_mutex() const { return rw_mutex_; }
+
+private:
+    mutable utils::rw_mutex_t rw_mutex_;
 };
 
+template <typename K, typename O, typename C, key_merge_t<K, O> key_merge>
+struct sharded_lru_cache_t;
+
 // The cache uses LRU replacement policy
 template <typename K, typename O, typename C,
         key_merge_t<K, O> key_merge = nullptr>
@@ -361,6 +365,95 @@ private:
     // element*, since it invokes the copy constructor of std::atomic, which is
     // deleted.
     std::unordered_map<key_t, timed_entry_t> cache_mapper_;
+
+    template <typename K1, typename O1, typename C1, key_merge_t<K1, O1> km>
+    friend struct sharded_lru_cache_t;
+};
+
+// The cache splits its entries between several independent LRU caches
+// (shards) by key hash. Each shard is guarded by its own lock, so threads
+// working with different keys don't contend on a single mutex. Eviction is
+// performed within a shard, therefore the LRU order is only maintained per
+// shard and the capacity is distributed between shards evenly.
+template <typename K, typename O, typename C,
+        key_merge_t<K, O> key_merge = nullptr>
+struct sharded_lru_cache_t final : public cache_t<K, O, C, key_merge> {
+    using base_t = cache_t<K, O, C, key_merge>;
+    using key_t = typename base_t::key_t;
+    using object_t = typename base_t::object_t;
+    using cache_object_t = typename base_t::cache_object_t;
+    using value_t = typename base_t::value_t;
+    using shard_t = lru_cache_t<K, O, C, key_merge>;
+
+    sharded_lru_cache_t(int capacity, int nshards)
+        : capacity_(capacity), nshards_(std::max(nshards, 1)) {
+        shards_.reserve(nshards_);
+        for (int i = 0; i < nshards_; i++)
+            shards_.emplace_back(utils::make_unique<shard_t>(
+                    get_shard_capacity(capacity, i)));
+    }
+
+    cache_object_t get(const key_t &key) override {
+        return get_shard(key).get(key);
+    }
+
+    int get_capacity() const override {
+        utils::lock_read_t lock_r(this->rw_mutex());
+        return capacity_;
+    }
+
+    status_t set_capacity(int capacity) override {
+        utils::lock_write_t lock_w(this->rw_mutex());
+        capacity_ = capacity;
+        for (int i = 0; i < get_nshards(); i++)
+            CHECK(shards_[i]->set_capacity(get_shard_capacity(capacity, i)));
+        return status::success;
+    }
+    void set_capacity_without_clearing(int capacity) {
+        utils::lock_write_t lock_w(this->rw_mutex());
+        capacity_ = capacity;
+        for (int i = 0; i < get_nshards(); i++)
+            shards_[i]->set_capacity_without_clearing(
+                    get_shard_capacity(capacity, i));
+    }
+
+    int get_size() const override {
+        int size = 0;
+        for (const auto &s : shards_)
+            size += s->get_size();
+        return size;
+    }
+
+    int get_nshards() const { return nshards_; }
+
+protected:
+    value_t get_or_add(const key_t &key, const value_t &value) override {
+        return get_shard(key).get_or_add(key, value);
+    }
+
+    void remove_if_invalidated(const key_t &key) override {
+        get_shard(key).remove_if_invalidated(key);
+    }
+
+    void update_entry(const key_t &key, const object_t &p) override {
+        get_shard(key).update_entry(key, p);
+    }
+
+private:
+    // The remainder is spread over the first shards so that the total
+    // capacity of the shards matches the requested one.
+    int get_shard_capacity(int capacity, int ishard) const {
+        return capacity / nshards_ + (ishard < capacity % nshards_);
+    }
+
+    shard_t &get_shard(const key_t &key) const {
+        if (nshards_ == 1) return *shards_[0];
+        return *shards_[std::hash<key_t>()(key) % nshards_];
+    }
+
+    int capacity_;
+    const int nshards_;
+    std::vector<std::unique_ptr<shard_t>> shards_;
 };
 
 } // namespace utils
@@ -18,6 +18,7 @@
 #define COMMON_DNNL_THREAD_HPP
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <mutex>
 
@@ -259,6 +260,12 @@ void balance2D(U nthr, U ithr, T ny, T &ny_start, T &ny_end, T nx, T &nx_start,
  *                                         calls for_nd
  *  - parallel_nd_ext(nthr, dims..., f)  - creates a parallel section and then
  *                                         calls for_nd_ext
+ *  - for_nd_dynamic(nthr, counter, dims..., f)
+ *                                       - multidimensional for loop for
+ *                                         already created threads that takes
+ *                                         chunks of work from a shared counter
+ *  - parallel_nd_dynamic(dims..., f)    - creates a parallel section and then
+ *                                         calls for_nd_dynamic
  */
 
 /* general parallelization */
@@ -641,6 +648,187 @@ static inline void parallel_nd(dim_t D0, dim_t D1, dim_t D2, dim_t D3, dim_t D4,
         });
 }
 
+/* dynamic scheduling section */
+// With static partitioning, the slowest thread determines the time of a
+// parallel section, e.g. when it is descheduled or shares a core with another
+// process. A dynamically scheduled loop instead hands out its work in chunks
+// taken from a counter shared by all the threads, so that the threads
+// finishing early take over the remaining work. Chunks are guided: their size
+// is a fraction of the remaining work per thread, which keeps the number of
+// atomic operations low while the work is plentiful and balances the end.
+using dynamic_work_counter_t = std::atomic<dim_t>;
+
+// Takes the next chunk [start, end) out of `work_amount` items. Returns false
+// once the work is exhausted.
+static inline bool dynamic_next_chunk(dynamic_work_counter_t &counter,
+        dim_t work_amount, int nthr, dim_t &start, dim_t &end) {
+    start = counter.load(std::memory_order_relaxed);
+    dim_t chunk {0};
+    do {
+        if (start >= work_amount) return false;
+        chunk = nstl::max<dim_t>(1, (work_amount - start) / (2 * nthr));
+    } while (!counter.compare_exchange_weak(
+            start, start + chunk, std::memory_order_relaxed));
+    end = start + chunk;
+    return true;
+}
+
+/* for_nd_dynamic section */
+static inline void for_nd_dynamic(const int nthr,
+        dynamic_work_counter_t &counter, dim_t D0,
+        const std::function<void(dim_t)> &f) {
+    const dim_t work_amount = D0;
+    dim_t start {0}, end {0};
+    while (dynamic_next_chunk(counter, work_amount, nthr, start, end)) {
+        dim_t d0 {0};
+        utils::nd_iterator_init(start, d0, D0);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            f(d0);
+            utils::nd_iterator_step(d0, D0);
+        }
+    }
+}
+static inline void for_nd_dynamic(const int nthr,
+        dynamic_work_counter_t &counter, dim_t D0, dim_t D1,
+        const std::function<void(dim_t, dim_t)> &f) {
+    const dim_t work_amount = D0 * D1;
+    dim_t start {0}, end {0};
+    while (dynamic_next_chunk(counter, work_amount, nthr, start, end)) {
+        dim_t d0 {0}, d1 {0};
+        utils::nd_iterator_init(start, d0, D0, d1, D1);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            f(d0, d1);
+            utils::nd_iterator_step(d0, D0, d1, D1);
+        }
+    }
+}
+static inline void for_nd_dynamic(const int nthr,
+        dynamic_work_counter_t &counter, dim_t D0, dim_t D1, dim_t D2,
+        const std::function<void(dim_t, dim_t, dim_t)> &f) {
+    const dim_t work_amount = D0 * D1 * D2;
+    dim_t start {0}, end {0};
+    while (dynamic_next_chunk(counter, work_amount, nthr, start, end)) {
+        dim_t d0 {0}, d1 {0}, d2 {0};
+        utils::nd_iterator_init(start, d0, D0, d1, D1, d2, D2);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            f(d0, d1, d2);
+            utils::nd_iterator_step(d0, D0, d1, D1, d2, D2);
+        }
+    }
+}
+static inline void for_nd_dynamic(const int nthr,
+        dynamic_work_counter_t &counter, dim_t D0, dim_t D1, dim_t D2, dim_t D3,
+        const std::function<void(dim_t, dim_t, dim_t, dim_t)> &f) {
+    const dim_t work_amount = D0 * D1 * D2 * D3;
+    dim_t start {0}, end {0};
+    while (dynamic_next_chunk(counter, work_amount, nthr, start, end)) {
+        dim_t d0 {0}, d1 {0}, d2 {0}, d3 {0};
+        utils::nd_iterator_init(start, d0, D0, d1, D1, d2, D2, d3, D3);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            f(d0, d1, d2, d3);
+            utils::nd_iterator_step(d0, D0, d1, D1, d2, D2, d3, D3);
+        }
+    }
+}
+static inline void for_nd_dynamic(const int nthr,
+        dynamic_work_counter_t &counter, dim_t D0, dim_t D1, dim_t D2,
+        dim_t D3, dim_t D4,
+        const std::function<void(dim_t, dim_t, dim_t, dim_t, dim_t)> &f) {
+    const dim_t work_amount = D0 * D1 * D2 * D3 * D4;
+    dim_t start {0}, end {0};
+    while (dynamic_next_chunk(counter, work_amount, nthr, start, end)) {
+        dim_t d0 {0}, d1 {0}, d2 {0}, d3 {0}, d4 {0};
+        utils::nd_iterator_init(start, d0, D0, d1, D1, d2, D2, d3, D3, d4, D4);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            f(d0, d1, d2, d3, d4);
+            utils::nd_iterator_step(d0, D0, d1, D1, d2, D2, d3, D3, d4, D4);
+        }
+    }
+}
+static inline void for_nd_dynamic(const int nthr,
+        dynamic_work_counter_t &counter, dim_t D0, dim_t D1, dim_t D2,
+        dim_t D3, dim_t D4, dim_t D5,
+        const std::function<void(dim_t, dim_t, dim_t, dim_t, dim_t, dim_t)>
+                &f) {
+    const dim_t work_amount = D0 * D1 * D2 * D3 * D4 * D5;
+    dim_t start {0}, end {0};
+    while (dynamic_next_chunk(counter, work_amount, nthr, start, end)) {
+        dim_t d0 {0}, d1 {0}, d2 {0}, d3 {0}, d4 {0}, d5 {0};
+        utils::nd_iterator_init(
+                start, d0, D0, d1, D1, d2, D2, d3, D3, d4, D4, d5, D5);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            f(d0, d1, d2, d3, d4, d5);
+            utils::nd_iterator_step(
+                    d0, D0, d1, D1, d2, D2, d3, D3, d4, D4, d5, D5);
+        }
+    }
+}
+
+/* parallel_nd_dynamic section */
+static inline void parallel_nd_dynamic(
+        dim_t D0, const std::function<void(dim_t)> &f) {
+    const dim_t work_amount = D0;
+    int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
+    dynamic_work_counter_t counter(0);
+    if (nthr)
+        parallel(nthr, [&](int, int nthr) {
+            for_nd_dynamic(nthr, counter, D0, f);
+        });
+}
+static inline void parallel_nd_dynamic(
+        dim_t D0, dim_t D1, const std::function<void(dim_t, dim_t)> &f) {
+    const dim_t work_amount = D0 * D1;
+    int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
+    dynamic_work_counter_t counter(0);
+    if (nthr)
+        parallel(nthr, [&](int, int nthr) {
+            for_nd_dynamic(nthr, counter, D0, D1, f);
+        });
+}
+static inline void parallel_nd_dynamic(dim_t D0, dim_t D1, dim_t D2,
+        const std::function<void(dim_t, dim_t, dim_t)> &f) {
+    const dim_t work_amount = D0 * D1 * D2;
+    int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
+    dynamic_work_counter_t counter(0);
+    if (nthr)
+        parallel(nthr, [&](int, int nthr) {
+            for_nd_dynamic(nthr, counter, D0, D1, D2, f);
+        });
+}
+static inline void parallel_nd_dynamic(dim_t D0, dim_t D1, dim_t D2, dim_t D3,
+        const std::function<void(dim_t, dim_t, dim_t, dim_t)> &f) {
+    const dim_t work_amount = D0 * D1 * D2 * D3;
+    int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
+    dynamic_work_counter_t counter(0);
+    if (nthr)
+        parallel(nthr, [&](int, int nthr) {
+            for_nd_dynamic(nthr, counter, D0, D1, D2, D3, f);
+        });
+}
+static inline void parallel_nd_dynamic(dim_t D0, dim_t D1, dim_t D2,
+        dim_t D3, dim_t D4,
+        const std::function<void(dim_t, dim_t, dim_t, dim_t, dim_t)> &f) {
+    const dim_t work_amount = D0 * D1 * D2 * D3 * D4;
+    int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
+    dynamic_work_counter_t counter(0);
+    if (nthr)
+        parallel(nthr, [&](int, int nthr) {
+            for_nd_dynamic(nthr, counter, D0, D1, D2, D3, D4, f);
+        });
+}
+static inline void parallel_nd_dynamic(dim_t D0, dim_t D1, dim_t D2,
+        dim_t D3, dim_t D4, dim_t D5,
+        const std::function<void(dim_t, dim_t, dim_t, dim_t, dim_t, dim_t)>
+                &f) {
+    const dim_t work_amount = D0 * D1 * D2 * D3 * D4 * D5;
+    int nthr = adjust_num_threads(dnnl_get_current_num_threads(), work_amount);
+    dynamic_work_counter_t counter(0);
+    if (nthr)
+        parallel(nthr, [&](int, int nthr) {
+            for_nd_dynamic(nthr, counter, D0, D1, D2, D3, D4, D5, f);
+        });
+}
+
 } // namespace impl
 } // namespace dnnl
 
@@ -0,0 +1,173 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+#include "opdesc.hpp"
+#include "primitive_desc_iface.hpp"
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::prop_kind;
+using namespace dnnl::impl::alg_kind;
+
+#define VCHECK_EMBEDDING_BAG(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, embedding_bag, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+#define VCHECK_EMBEDDING_BAG_UNIMPL(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, embedding_bag, (cond), \
+            status::unimplemented, msg, ##__VA_ARGS__);
+
+namespace {
+status_t embedding_bag_desc_init(embedding_bag_desc_t *desc,
+        prop_kind_t prop_kind, alg_kind_t alg_kind,
+        const memory_desc_t *src_desc, const memory_desc_t *indices_desc,
+        const memory_desc_t *offsets_desc, const memory_desc_t *weights_desc,
+        const memory_desc_t *dst_desc) {
+    VCHECK_EMBEDDING_BAG(
+            !any_null(desc, src_desc, indices_desc, offsets_desc, dst_desc),
+            VERBOSE_NULL_ARG);
+    VCHECK_EMBEDDING_BAG(one_of(prop_kind, forward_training, forward_inference),
+            VERBOSE_BAD_PROPKIND);
+    VCHECK_EMBEDDING_BAG(one_of(alg_kind, embedding_bag_sum,
+                                 embedding_bag_mean, embedding_bag_max),
+            VERBOSE_BAD_ALGORITHM);
+
+    const bool with_weights
+            = weights_desc != nullptr && !types::is_zero_md(weights_desc);
+
+    VCHECK_EMBEDDING_BAG(src_desc->ndims == 2, VERBOSE_BAD_NDIMS, "src",
+            src_desc->ndims);
+    VCHECK_EMBEDDING_BAG(indices_desc->ndims == 1, VERBOSE_BAD_NDIMS,
+            "indices", indices_desc->ndims);
+    VCHECK_EMBEDDING_BAG(offsets_desc->ndims == 1, VERBOSE_BAD_NDIMS,
+            "offsets", offsets_desc->ndims);
+    VCHECK_EMBEDDING_BAG(dst_desc->ndims == 2, VERBOSE_BAD_NDIMS, "dst",
+            dst_desc->ndims);
+    VCHECK_EMBEDDING_BAG(dst_desc->dims[0] == offsets_desc->dims[0],
+            VERBOSE_INCONSISTENT_DIM, "dst", 0, "offsets", 0);
+    VCHECK_EMBEDDING_BAG(dst_desc->dims[1] == src_desc->dims[1],
+            VERBOSE_INCONSISTENT_DIM, "dst", 1, "src", 1);
+    if (with_weights) {
+        VCHECK_EMBEDDING_BAG(weights_desc->ndims == 1, VERBOSE_BAD_NDIMS,
+                "weights", weights_desc->ndims);
+        VCHECK_EMBEDDING_BAG(weights_desc->dims[0] == indices_desc->dims[0],
+                VERBOSE_INCONSISTENT_DIM, "weights", 0, "indices", 0);
+        VCHECK_EMBEDDING_BAG(!memory_desc_wrapper(weights_desc).format_any(),
+                VERBOSE_UNSUPPORTED_TAG_S, "weights");
+        // Per-sample weights only make sense for a weighted sum.
+        VCHECK_EMBEDDING_BAG_UNIMPL(
+                alg_kind == embedding_bag_sum, VERBOSE_BAD_ALGORITHM);
+    }
+
+    VCHECK_EMBEDDING_BAG(indices_desc->data_type == data_type::s32,
+            VERBOSE_INVALID_DATATYPE, "indices");
+    VCHECK_EMBEDDING_BAG(offsets_desc->data_type == data_type::s32,
+            VERBOSE_INVALID_DATATYPE, "offsets");
+
+    VCHECK_EMBEDDING_BAG(!memory_desc_wrapper(src_desc).format_any(),
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VCHECK_EMBEDDING_BAG(!memory_desc_wrapper(indices_desc).format_any(),
+            VERBOSE_UNSUPPORTED_TAG_S, "indices");
+    VCHECK_EMBEDDING_BAG(!memory_desc_wrapper(offsets_desc).format_any(),
+            VERBOSE_UNSUPPORTED_TAG_S, "offsets");
+
+    bool runtime_dims_or_strides
+            = memory_desc_wrapper(src_desc).has_runtime_dims_or_strides()
+            || memory_desc_wrapper(indices_desc).has_runtime_dims_or_strides()
+            || memory_desc_wrapper(offsets_desc).has_runtime_dims_or_strides()
+            || memory_desc_wrapper(dst_desc).has_runtime_dims_or_strides();
+    if (with_weights)
+        runtime_dims_or_strides = runtime_dims_or_strides
+                || memory_desc_wrapper(weights_desc)
+                           .has_runtime_dims_or_strides();
+    VCHECK_EMBEDDING_BAG_UNIMPL(
+            !runtime_dims_or_strides, VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    auto ed = embedding_bag_desc_t();
+    ed.primitive_kind = primitive_kind::embedding_bag;
+    ed.prop_kind = prop_kind;
+    ed.alg_kind = alg_kind;
+
+    ed.src_desc = *src_desc;
+    ed.indices_desc = *indices_desc;
+    ed.offsets_desc = *offsets_desc;
+    if (with_weights) ed.weights_desc = *weights_desc;
+    ed.dst_desc = *dst_desc;
+
+    *desc = ed;
+    return success;
+}
+
+status_t embedding_bag_attr_check(const embedding_bag_desc_t &desc,
+        const engine_t *engine, const primitive_attr_t *attr) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    if (attr == nullptr) return status::success;
+    if (attr->has_default_values()) return status::success;
+
+    // Check attributes
+    const data_type_t src_dt = desc.src_desc.data_type;
+    const data_type_t dst_dt = desc.dst_desc.data_type;
+
+    auto attr_mask = smask_t::none;
+    // An int8 embedding table is dequantized with scales, one per table row
+    // or a common one.
+    const bool is_int8 = one_of(src_dt, data_type::s8, data_type::u8);
+    if (is_int8) attr_mask |= smask_t::scales;
+
+    VCHECK_EMBEDDING_BAG_UNIMPL(attr->has_default_values(attr_mask, dst_dt),
+            VERBOSE_UNSUPPORTED_ATTR);
+
+    // Check scales
+    if (!attr->scales_.has_default_values()) {
+        const auto &sc = attr->scales_;
+        static const std::vector<int> supported_args {DNNL_ARG_SRC};
+        VCHECK_EMBEDDING_BAG_UNIMPL(sc.has_default_values(supported_args),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        VCHECK_EMBEDDING_BAG_UNIMPL(one_of(sc.get_mask(DNNL_ARG_SRC), 0, 1),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        VCHECK_EMBEDDING_BAG_UNIMPL(sc.has_default_groups(DNNL_ARG_SRC),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        VCHECK_EMBEDDING_BAG_UNIMPL(sc.has_default_data_type(DNNL_ARG_SRC),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+    }
+
+    return status::success;
+}
+
+} // namespace
+
+status_t dnnl_embedding_bag_forward_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        prop_kind_t prop_kind, alg_kind_t alg_kind,
+        const memory_desc_t *src_desc, const memory_desc_t *indices_desc,
+        const memory_desc_t *offsets_desc, const memory_desc_t *weights_desc,
+        const memory_desc_t *dst_desc, const primitive_attr_t *attr) {
+    auto desc = embedding_bag_desc_t();
+    CHECK(embedding_bag_desc_init(&desc, prop_kind, alg_kind, src_desc,
+            indices_desc, offsets_desc, weights_desc, dst_desc));
+    CHECK(embedding_bag_attr_check(desc, engine, attr));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&desc, nullptr, attr);
+}
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,157 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#ifndef COMMON_EMBEDDING_BAG_PD_HPP
+#define COMMON_EMBEDDING_BAG_PD_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#define VDISPATCH_EMBEDDING_BAG(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, embedding_bag, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+#define VDISPATCH_EMBEDDING_BAG_SC(f, msg, ...) \
+    VCHECK(primitive, create, dispatch, embedding_bag, (f), "%s," msg, \
+            this->info(engine), ##__VA_ARGS__)
+
+namespace dnnl {
+namespace impl {
+
+// NOLINTBEGIN(google-default-arguments)
+struct embedding_bag_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::embedding_bag;
+
+    using base_class = embedding_bag_pd_t;
+    using hint_class = embedding_bag_pd_t;
+
+    const embedding_bag_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::prop_kind:
+                *(prop_kind_t *)result = desc()->prop_kind;
+                break;
+            case query::alg_kind:
+                *(alg_kind_t *)result = desc()->alg_kind;
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC_0:
+            case DNNL_ARG_SRC_1:
+            case DNNL_ARG_SRC_2: return arg_usage_t::input;
+            case DNNL_ARG_WEIGHTS:
+                return with_weights() ? arg_usage_t::input
+                                      : arg_usage_t::unused;
+            case DNNL_ARG_DST: return arg_usage_t::output;
+            default: return primitive_desc_t::arg_usage(arg);
+        }
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC_0: return src_md(0);
+            case DNNL_ARG_SRC_1: return src_md(1);
+            case DNNL_ARG_SRC_2: return src_md(2);
+            case DNNL_ARG_WEIGHTS: return weights_md(0);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    // Source memory descriptors are the embedding table, the indices and
+    // the offsets of the bags.
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        switch (index) {
+            case 0: return &desc_.src_desc;
+            case 1: return &desc_.indices_desc;
+            case 2: return &desc_.offsets_desc;
+            default: return &glob_zero_md;
+        }
+    }
+    const memory_desc_t *weights_md(
+            int index = 0, bool user_input = false) const override {
+        return index == 0 ? &desc_.weights_desc : &glob_zero_md;
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return user_input ? &desc()->dst_desc : &dst_md_;
+        return &glob_zero_md;
+    }
+
+    int n_inputs() const override { return 3 + with_weights(); }
+    int n_outputs() const override { return 1; }
+
+    dim_t num_embeddings() const { return desc_.src_desc.dims[0]; }
+    dim_t embedding_dim() const { return desc_.src_desc.dims[1]; }
+    dim_t num_indices() const { return desc_.indices_desc.dims[0]; }
+    dim_t num_bags() const { return desc_.offsets_desc.dims[0]; }
+
+    bool with_weights() const { return !types::is_zero_md(weights_md()); }
+
+    // Indices, offsets and per-sample weights are plain 1D arrays.
+    bool aux_formats_ok() const {
+        const bool ok = memory_desc_wrapper(src_md(1)).matches_tag(
+                                format_tag::a)
+                && memory_desc_wrapper(src_md(2)).matches_tag(format_tag::a);
+        return ok
+                && IMPLICATION(with_weights(),
+                        memory_desc_wrapper(weights_md()).matches_tag(
+                                format_tag::a));
+    }
+
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(dst_md()).has_zero_dim();
+    }
+
+protected:
+    embedding_bag_desc_t desc_;
+
+    memory_desc_t dst_md_;
+
+    embedding_bag_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*op_desc_t::to_desc<embedding_bag_desc_t>(adesc))
+        , dst_md_(desc_.dst_desc) {}
+
+    status_t set_default_params() {
+        if (dst_md_.format_kind != format_kind::any) return status::success;
+        return memory_desc_init_by_tag(dst_md_, format_tag::ab);
+    }
+};
+// NOLINTEND(google-default-arguments)
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <sstream>
+#include <vector>
 
 #include "oneapi/dnnl/dnnl.h"
 
@@ -46,6 +47,17 @@ const char *c2f_offsetC(const char *offC) {
     return offC;
 }
 
+// Converts a row-major problem of a batch into the column-major convention
+// of the cpu gemm functions, where A and B are swapped.
+template <typename ua_t, typename ub_t, typename c_t>
+cpu::gemm_batch_problem_t<ub_t, ua_t, c_t> make_batch_problem(char transa,
+        char transb, char offsetc, dim_t M, dim_t N, dim_t K, float alpha,
+        const ua_t *A, dim_t lda, ua_t ao, const ub_t *B, dim_t ldb, ub_t bo,
+        float beta, c_t *C, dim_t ldc, const c_t *co) {
+    return {transb, transa, *c2f_offsetC(&offsetc), N, M, K, alpha, B, ldb, bo,
+            A, lda, ao, beta, C, ldc, co};
+}
+
 std::string get_descriptor(dim_t M, dim_t N, dim_t K) {
     std::string s_ = std::to_string(M);
     s_ += "x";
@@ -157,6 +169,167 @@ extern "C" dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32(char transa,
 #endif
 }
 
+dnnl_status_t dnnl_sgemm_batch_strided(char transa, char transb, dim_t M,
+        dim_t N, dim_t K, float alpha, const float *A, dim_t lda,
+        dim_t stride_a, const float *B, dim_t ldb, dim_t stride_b, float beta,
+        float *C, dim_t ldc, dim_t stride_c, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (batch_size < 0) return status::invalid_arguments;
+    if (batch_size > 0 && utils::any_null(A, B, C))
+        return status::invalid_arguments;
+
+    std::vector<cpu::gemm_batch_problem_t<float, float, float>> problems;
+    problems.reserve(batch_size);
+    for (dim_t i = 0; i < batch_size; i++)
+        problems.push_back(make_batch_problem(transa, transb, '\0', M, N, K,
+                alpha, A + i * stride_a, lda, 0.f, B + i * stride_b, ldb, 0.f,
+                beta, C + i * stride_c, ldc, (const float *)nullptr));
+    return cpu::extended_sgemm_batch(batch_size, problems.data());
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_batch(char transa, char transb, dim_t M, dim_t N,
+        dim_t K, float alpha, const float *const *A, dim_t lda,
+        const float *const *B, dim_t ldb, float beta, float *const *C,
+        dim_t ldc, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (batch_size < 0) return status::invalid_arguments;
+    if (batch_size > 0 && utils::any_null(A, B, C))
+        return status::invalid_arguments;
+
+    std::vector<cpu::gemm_batch_problem_t<float, float, float>> problems;
+    problems.reserve(batch_size);
+    for (dim_t i = 0; i < batch_size; i++)
+        problems.push_back(make_batch_problem(transa, transb, '\0', M, N, K,
+                alpha, A[i], lda, 0.f, B[i], ldb, 0.f, beta, C[i], ldc,
+                (const float *)nullptr));
+    return cpu::extended_sgemm_batch(batch_size, problems.data());
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_batch_grouped(dim_t group_count,
+        const dim_t *group_sizes, const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const float *const *A, const dim_t *lda, const float *const *B,
+        const dim_t *ldb, const float *beta, float *const *C,
+        const dim_t *ldc) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (group_count < 0) return status::invalid_arguments;
+    if (group_count == 0) return status::success;
+    if (utils::any_null(group_sizes, transa, transb, M, N, K, alpha, A, lda, B,
+                ldb, beta, C, ldc))
+        return status::invalid_arguments;
+
+    dim_t batch_size = 0;
+    for (dim_t g = 0; g < group_count; g++) {
+        if (group_sizes[g] < 0) return status::invalid_arguments;
+        batch_size += group_sizes[g];
+    }
+
+    std::vector<cpu::gemm_batch_problem_t<float, float, float>> problems;
+    problems.reserve(batch_size);
+    for (dim_t g = 0, i = 0; g < group_count; g++)
+        for (dim_t j = 0; j < group_sizes[g]; j++, i++)
+            problems.push_back(make_batch_problem(transa[g], transb[g], '\0',
+                    M[g], N[g], K[g], alpha[g], A[i], lda[g], 0.f, B[i],
+                    ldb[g], 0.f, beta[g], C[i], ldc[g],
+                    (const float *)nullptr));
+    return cpu::extended_sgemm_batch(batch_size, problems.data());
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, float alpha, const uint8_t *A,
+        dim_t lda, dim_t stride_a, uint8_t ao, const int8_t *B, dim_t ldb,
+        dim_t stride_b, int8_t bo, float beta, int32_t *C, dim_t ldc,
+        dim_t stride_c, const int32_t *co, dim_t stride_co, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (batch_size < 0) return status::invalid_arguments;
+    if (batch_size > 0 && utils::any_null(A, B, C, co))
+        return status::invalid_arguments;
+
+    std::vector<cpu::gemm_batch_problem_t<int8_t, uint8_t, int32_t>> problems;
+    problems.reserve(batch_size);
+    for (dim_t i = 0; i < batch_size; i++)
+        problems.push_back(make_batch_problem(transa, transb, offsetc, M, N, K,
+                alpha, A + i * stride_a, lda, ao, B + i * stride_b, ldb, bo,
+                beta, C + i * stride_c, ldc, co + i * stride_co));
+    return cpu::gemm_s8u8s32_batch(batch_size, problems.data());
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_batch(char transa, char transb, char offsetc,
+        dim_t M, dim_t N, dim_t K, float alpha, const uint8_t *const *A,
+        dim_t lda, uint8_t ao, const int8_t *const *B, dim_t ldb, int8_t bo,
+        float beta, int32_t *const *C, dim_t ldc, const int32_t *const *co,
+        dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (batch_size < 0) return status::invalid_arguments;
+    if (batch_size > 0 && utils::any_null(A, B, C, co))
+        return status::invalid_arguments;
+
+    std::vector<cpu::gemm_batch_problem_t<int8_t, uint8_t, int32_t>> problems;
+    problems.reserve(batch_size);
+    for (dim_t i = 0; i < batch_size; i++)
+        problems.push_back(make_batch_problem(transa, transb, offsetc, M, N, K,
+                alpha, A[i], lda, ao, B[i], ldb, bo, beta, C[i], ldc, co[i]));
+    return cpu::gemm_s8u8s32_batch(batch_size, problems.data());
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, float alpha, const int8_t *A,
+        dim_t lda, dim_t stride_a, int8_t ao, const int8_t *B, dim_t ldb,
+        dim_t stride_b, int8_t bo, float beta, int32_t *C, dim_t ldc,
+        dim_t stride_c, const int32_t *co, dim_t stride_co, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (batch_size < 0) return status::invalid_arguments;
+    if (batch_size > 0 && utils::any_null(A, B, C, co))
+        return status::invalid_arguments;
+
+    std::vector<cpu::gemm_batch_problem_t<int8_t, int8_t, int32_t>> problems;
+    problems.reserve(batch_size);
+    for (dim_t i = 0; i < batch_size; i++)
+        problems.push_back(make_batch_problem(transa, transb, offsetc, M, N, K,
+                alpha, A + i * stride_a, lda, ao, B + i * stride_b, ldb, bo,
+                beta, C + i * stride_c, ldc, co + i * stride_co));
+    return cpu::gemm_s8s8s32_batch(batch_size, problems.data());
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_batch(char transa, char transb, char offsetc,
+        dim_t M, dim_t N, dim_t K, float alpha, const int8_t *const *A,
+        dim_t lda, int8_t ao, const int8_t *const *B, dim_t ldb, int8_t bo,
+        float beta, int32_t *const *C, dim_t ldc, const int32_t *const *co,
+        dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (batch_size < 0) return status::invalid_arguments;
+    if (batch_size > 0 && utils::any_null(A, B, C, co))
+        return status::invalid_arguments;
+
+    std::vector<cpu::gemm_batch_problem_t<int8_t, int8_t, int32_t>> problems;
+    problems.reserve(batch_size);
+    for (dim_t i = 0; i < batch_size; i++)
+        problems.push_back(make_batch_problem(transa, transb, offsetc, M, N, K,
+                alpha, A[i], lda, ao, B[i], ldb, bo, beta, C[i], ldc, co[i]));
+    return cpu::gemm_s8s8s32_batch(batch_size, problems.data());
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
 dnnl_status_t dnnl_threadpool_interop_sgemm(char transa, char transb, dim_t M,
         dim_t N, dim_t K, float alpha, const float *A, dim_t lda,
@@ -38,7 +38,7 @@ struct iface_t::cache_t {
     using result_t = iface_t::result_t;
     using create_func_t = iface_t::create_func_t;
 
-    cache_t(int capacity) : cache_(capacity) {};
+    cache_t(int capacity, int nshards) : cache_(capacity, nshards) {};
 
     ~cache_t() = default;
 
@@ -54,7 +54,7 @@ struct iface_t::cache_t {
     }
 
 private:
-    utils::lru_cache_t<key_t, value_t, result_t> cache_;
+    utils::sharded_lru_cache_t<key_t, value_t, result_t> cache_;
 };
 
 iface_t get() {
@@ -64,7 +64,11 @@ iface_t get() {
 #else
     static const int capacity = 0;
 #endif
-    static iface_t::cache_t cache(capacity);
+    // There is at least one shard and no more shards than entries, so that
+    // every shard can hold an entry.
+    static const int nshards = std::max(1,
+            std::min(getenv_int_user("PRIMITIVE_CACHE_SHARDS", 1), capacity));
+    static iface_t::cache_t cache(capacity, nshards);
     return cache;
 }
 
@@ -75,9 +75,50 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
     // Matmul supports fpmath mode and accumulation mode
     attr_mask |= smask_t::fpmath_mode | smask_t::accumulation_mode;
 
+    // Matmul supports ragged and grouped batch
+    attr_mask |= smask_t::ragged_batch | smask_t::grouped_batch;
+
+    // Matmul supports lookup tables for 4-bit weights
+    if (wei_dt == data_type::u4) attr_mask |= smask_t::weights_lut;
+
+    // Matmul supports dynamic quantization of a floating point source for
+    // int8 weights
+    if (utils::one_of(src_dt, data_type::f32, data_type::bf16)
+            && wei_dt == data_type::s8)
+        attr_mask |= smask_t::src_dyn_quant;
+
     VCHECK_MATMUL_UNIMPL(attr->has_default_values(attr_mask, dst_dt),
             VERBOSE_UNSUPPORTED_ATTR);
 
+    // The lengths of a ragged batch are indexed by the outermost batch
+    // dimension, which must exist.
+    VCHECK_MATMUL(IMPLICATION(attr->ragged_batch_, desc.dst_desc.ndims >= 3),
+            VERBOSE_BAD_NDIMS, "dst", desc.dst_desc.ndims);
+
+    // The entries of a grouped batch are the weights of the groups, so the
+    // batch is a single dimension which weights don't broadcast over.
+    VCHECK_MATMUL_UNIMPL(!(attr->ragged_batch_ && attr->grouped_batch_),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VCHECK_MATMUL(IMPLICATION(attr->grouped_batch_, desc.dst_desc.ndims == 3),
+            VERBOSE_BAD_NDIMS, "dst", desc.dst_desc.ndims);
+    VCHECK_MATMUL(IMPLICATION(attr->grouped_batch_,
+                          desc.weights_desc.dims[0] == desc.dst_desc.dims[0]),
+            VERBOSE_INCONSISTENT_DIM, "weights", 0, "dst", 0);
+
+    // The source quantization parameters are computed by the primitive, and
+    // the quantized source is not decompressed back. The products are
+    // accumulated in integers over the whole reduction, so weights may only
+    // be scaled along N.
+    if (attr->src_dyn_quant_dt_ != data_type::undef) {
+        VCHECK_MATMUL_UNIMPL(attr->scales_.has_default_values(DNNL_ARG_SRC)
+                        && attr->scales_.has_default_groups(DNNL_ARG_WEIGHTS),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        VCHECK_MATMUL_UNIMPL(attr->zero_points_.has_default_values(),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+        VCHECK_MATMUL_UNIMPL(
+                !attr->fpmath_.apply_to_int_, VERBOSE_UNSUPPORTED_FPMATH_MODE);
+    }
+
     const int ndims_src = desc.src_desc.ndims;
     const int ndims_wei = desc.weights_desc.ndims;
     const int m_idx = ndims_src - 2;
@@ -86,6 +127,19 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
     const dim_t K = desc.weights_desc.dims[k_idx_wei];
     const dim_t N = desc.weights_desc.dims[n_idx];
 
+    // Weights are looked up as a part of weights decompression and replace
+    // zero points. The groups must split K evenly.
+    const dim_t lut_group = attr->weights_lut_group_;
+    if (lut_group > 0) {
+        VCHECK_MATMUL_UNIMPL(attr->fpmath_.apply_to_int_,
+                VERBOSE_UNSUPPORTED_FPMATH_MODE);
+        VCHECK_MATMUL_UNIMPL(attr->zero_points_.has_default_values(),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+        VCHECK_MATMUL(IMPLICATION(!is_runtime_value(K), K % lut_group == 0),
+                VERBOSE_INCONSISTENT_DIM, "weights_lut", 0, "weights",
+                k_idx_wei);
+    }
+
     assert(ndims_src >= 2);
     assert(ndims_wei >= 2);
     int src_qmask_M = 1 << (ndims_src - 2);
@@ -209,12 +209,22 @@ struct matmul_pd_t : public primitive_desc_t {
                                         && wei_n_group_ok);
 
                 // Mask over K dim is allowed for decompression feature only.
+                // fp8 and fp4 weights are decompressed into a 16-bit source
+                // type without an fpmath mode (MX formats).
+                const bool is_fp_decompression
+                        = utils::one_of(weights_md(0)->data_type,
+                                  data_type::f8_e5m2, data_type::f8_e4m3,
+                                  data_type::f4_e2m1)
+                        && utils::one_of(src_md()->data_type, data_type::bf16,
+                                data_type::f16);
                 const bool is_decompression_or_dynquant
-                        = utils::one_of(weights_md(0)->data_type, data_type::s8,
-                                  data_type::u8, data_type::s4, data_type::u4)
-                        && IMPLICATION(
-                                !types::is_integral_dt(src_md()->data_type),
-                                attr()->fpmath_.apply_to_int_);
+                        = (utils::one_of(weights_md(0)->data_type,
+                                   data_type::s8, data_type::u8, data_type::s4,
+                                   data_type::u4)
+                                  && IMPLICATION(!types::is_integral_dt(
+                                                         src_md()->data_type),
+                                          attr()->fpmath_.apply_to_int_))
+                        || is_fp_decompression;
                 ok = ok
                         && IMPLICATION((mask & wei_qmask_K()),
                                 is_decompression_or_dynquant);
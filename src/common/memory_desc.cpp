@@ -140,6 +140,50 @@ status_t memory_desc_init_by_csr_encoding(memory_desc_t &memory_desc, int ndims,
     return success;
 }
 
+status_t memory_desc_init_by_bsr_encoding(memory_desc_t &memory_desc, int ndims,
+        const dims_t dims, data_type_t data_type, dim_t nnz_blocks,
+        const dims_t block_dims, data_type_t indices_dt,
+        data_type_t pointers_dt) {
+    if (ndims == 0) {
+        memory_desc = types::zero_md();
+        return success;
+    }
+
+    // This is the only number of dims that is supported at this point.
+    VCHECK_MEMORY(ndims == 2, unimplemented, VERBOSE_BAD_NDIMS, "", ndims);
+
+    bool args_ok = memory_desc_sanity_check(
+            ndims, dims, data_type, format_kind::undef);
+    VCHECK_MEMORY(args_ok, invalid_arguments, VERBOSE_MEM_DESC_CHECK_FAIL);
+    VCHECK_MEMORY(block_dims && nnz_blocks >= 0, invalid_arguments,
+            VERBOSE_MEM_DESC_CHECK_FAIL);
+
+    // Blocks cover the tensor exactly.
+    dim_t block_size = 1;
+    for (int d = 0; d < ndims; d++) {
+        VCHECK_MEMORY(block_dims[d] > 0 && !is_runtime_value(dims[d])
+                        && dims[d] % block_dims[d] == 0,
+                invalid_arguments, VERBOSE_BAD_DIM, "", d);
+        block_size *= block_dims[d];
+    }
+
+    auto md = memory_desc_t();
+    md.ndims = ndims;
+    array_copy(md.dims, dims, ndims);
+    md.data_type = data_type;
+    array_copy(md.padded_dims, dims, ndims);
+    md.format_kind = format_kind::sparse;
+    md.format_desc.sparse_desc.encoding = sparse_encoding::bsr;
+    md.format_desc.sparse_desc.nnz = nnz_blocks * block_size;
+    md.format_desc.sparse_desc.metadata_types[0] = indices_dt;
+    md.format_desc.sparse_desc.metadata_types[1] = pointers_dt;
+    array_copy(md.format_desc.sparse_desc.block_dims, block_dims, ndims);
+
+    memory_desc = md;
+
+    return success;
+}
+
 status_t memory_desc_init_by_coo_encoding(memory_desc_t &memory_desc, int ndims,
         const dims_t dims, data_type_t data_type, dim_t nnz,
         data_type_t indices_dt) {
@@ -627,6 +671,20 @@ status_t dnnl_memory_desc_create_with_csr_encoding(memory_desc_t **memory_desc,
     return success;
 }
 
+status_t dnnl_memory_desc_create_with_bsr_encoding(memory_desc_t **memory_desc,
+        int ndims, const dims_t dims, data_type_t data_type, dim_t nnz_blocks,
+        const dims_t block_dims, data_type_t indices_dt,
+        data_type_t pointers_dt) {
+    if (any_null(memory_desc)) return invalid_arguments;
+
+    auto md = utils::make_unique<memory_desc_t>();
+    if (!md) return out_of_memory;
+    CHECK(memory_desc_init_by_bsr_encoding(*md, ndims, dims, data_type,
+            nnz_blocks, block_dims, indices_dt, pointers_dt));
+    (*memory_desc) = md.release();
+    return success;
+}
+
 status_t dnnl_memory_desc_create_with_coo_encoding(memory_desc_t **memory_desc,
         int ndims, const dims_t dims, data_type_t data_type, dim_t nnz,
         data_type_t indices_dt) {
@@ -790,6 +848,7 @@ status_t dnnl_memory_desc_query_v2(
                     case sparse_encoding::coo:
                         *(int *)result = md->ndims + 1;
                         break;
+                    case sparse_encoding::bsr:
                     case sparse_encoding::packed: *(int *)result = 3; break;
                     default: assert(!"unknown encoding"); *(int *)result = 0;
                 }
@@ -38,7 +38,13 @@ enum class wino_memory_format_t {
     // Tensor of weights for 4x3 convolution.
     //
     // Internal weights format for 4x3 Winograd.
-    wino_wei_OBaaIBOIio
+    wino_wei_OBaaIBOIio,
+    // Tensor of weights for 4x3 and 6x3 convolutions computed with brgemm.
+    //
+    // Internal weights format for brgemm-based Winograd: blocks of output
+    // channels of every transform point with pairs of input channels
+    // interleaved for bf16.
+    wino_wei_aaOBio
 };
 
 enum class rnn_packed_memory_format_t { undef, ldigo_p, ldgoi_p, ldio_p };
@@ -176,6 +182,11 @@ struct sparse_desc_t {
     //  - 1: indices
     //  - 2: pointers
     //
+    // BSR: Number of handles is 3:
+    //  - 0: values (stored blocks, each block in the row-major order)
+    //  - 1: block column indices
+    //  - 2: block row pointers
+    //
     // packed: Number of handles is 3:
     //  - 0: values
     //  - 1: offsets
@@ -186,11 +197,15 @@ struct sparse_desc_t {
     dnnl_dim_t nnz;
 
     // Metadata types. Each encoding defines how to interpret these.
-    // - CSR: 0th - index data type
-    //        1st - pointer data type
+    // - CSR, BSR: 0th - index data type
+    //             1st - pointer data type
     // - packed: N/A
     dnnl_data_type_t metadata_types[max_metadata_types];
 
+    // Dimensions of the dense blocks of the BSR encoding. The number of
+    // non-zero entries `nnz` counts all the elements of the stored blocks.
+    dnnl_dims_t block_dims;
+
     // The packed sparse encoding is described with `blocking_desc_t` and
     // can only be initialized by the implementation. The special encoding
     // `packed` will instruct the implementation to do that.
@@ -111,6 +111,17 @@ struct memory_desc_wrapper : public c_compatible {
         return sparse_desc().nnz;
     }
 
+    const dims_t &block_dims() const {
+        assert(is_sparse_desc() && encoding() == sparse_encoding::bsr);
+        return sparse_desc().block_dims;
+    }
+
+    // Number of the stored blocks of the BSR encoding.
+    dim_t nnz_blocks() const {
+        const auto &bd = block_dims();
+        return nnz() / (bd[0] * bd[1]);
+    }
+
     const dims_t &strides() const { return blocking_desc().strides; }
 
     const memory_extra_desc_t &extra() const { return md_->extra; }
@@ -296,6 +307,23 @@ struct memory_desc_wrapper : public c_compatible {
                     }
                     default: assert(!"unknown index"); return 0;
                 }
+            } else if (sparse_desc().encoding == sparse_encoding::bsr) {
+                switch (index) {
+                    // Return size for values.
+                    case 0: return nnz() * data_type_size();
+                    // Return size for block column indices.
+                    case 1: {
+                        const auto idx_dt = metadata_type(0);
+                        return nnz_blocks() * types::data_type_size(idx_dt);
+                    }
+                    // Return size for block row pointers.
+                    case 2: {
+                        const auto ptr_dt = metadata_type(1);
+                        return (dims()[0] / block_dims()[0] + 1)
+                                * types::data_type_size(ptr_dt);
+                    }
+                    default: assert(!"unknown index"); return 0;
+                }
             } else if (sparse_desc().encoding == sparse_encoding::coo) {
                 // Return size for values.
                 if (index == 0) {
@@ -166,6 +166,7 @@ enum {
     key_brgemm_primitive_buffer_d,
     key_brgemm_primitive_zp_comp_a,
     key_brgemm_primitive_zp_comp_b,
+    key_brgemm_primitive_src_scales,
     key_brgemm_primitive_buffer_reduce,
     key_concat_iptrs,
     key_concat_istrides,
@@ -272,6 +273,12 @@ enum {
     key_matmul_dst_trans,
     key_matmul_dst_cast_acc,
     key_matmul_sparse_tmp_ptr,
+    key_matmul_sparse_tmp_idx,
+    key_matmul_grouped_acc,
+    key_matmul_grouped_amx_wsp,
+    key_matmul_grouped_wei_packed,
+    key_matmul_wei_lut,
+    key_matmul_rnd_bias,
     key_pool_dst_bf16cvt,
     key_pool_dst_plain2blocked_cvt,
     key_pool_ind_plain2blocked_cvt,
@@ -317,6 +324,13 @@ enum {
     key_rnn_ptrs_wei_layer,
     key_rnn_ptrs_wei_iter,
     key_rnn_ptrs_wei_projection,
+    key_sdpa_acc,
+    key_sdpa_amx_wsp,
+    key_sdpa_keys_packed,
+    key_sdpa_probs,
+    key_sdpa_row_stats,
+    key_sdpa_scores,
+    key_sdpa_values_packed,
     key_softmax_reduction,
     key_softmax_interim_store,
     key_sum_reduction,
@@ -501,6 +501,36 @@ struct reduction_desc_t : public op_desc_t {
     float eps {};
 };
 
+// A descriptor of an embedding bag operation.
+//
+// dst[b, :] = pool(weights[i] * src[indices[i], :]), where i goes over
+// [offsets[b], offsets[b + 1]) and the last bag ends at the number of
+// indices.
+struct embedding_bag_desc_t : public op_desc_t {
+    embedding_bag_desc_t() : op_desc_t(primitive_kind::embedding_bag) {}
+
+    DECLARE_COMMON_OP_DESC_CLONE(embedding_bag_desc_t);
+
+    // The kind of propagation. Possible values: #dnnl_forward_training and
+    // #dnnl_forward_inference.
+    prop_kind_t prop_kind {};
+    // The kind of pooling algorithm. Possible values:
+    // #dnnl_embedding_bag_sum, #dnnl_embedding_bag_mean,
+    // #dnnl_embedding_bag_max.
+    alg_kind_t alg_kind {};
+    // Source (embedding table) memory descriptor, [num_embeddings, dim].
+    memory_desc_t src_desc;
+    // Indices memory descriptor, [num_indices].
+    memory_desc_t indices_desc;
+    // Offsets memory descriptor, [num_bags].
+    memory_desc_t offsets_desc;
+    // Per-sample weights memory descriptor, [num_indices]. Zero when the
+    // weights are not used.
+    memory_desc_t weights_desc;
+    // Destination memory descriptor, [num_bags, dim].
+    memory_desc_t dst_desc;
+};
+
 /// A descriptor of a Softmax operation.
 struct softmax_desc_t : public op_desc_t {
     softmax_desc_t() : op_desc_t(primitive_kind::softmax) {}
@@ -62,15 +62,15 @@ struct primitive_t : public c_compatible {
     primitive_kind_t kind() const { return pd_->kind(); }
     virtual status_t execute(const exec_ctx_t &ctx) const = 0;
 
+    // Implementations that can't be restored from a cache blob keep the
+    // defaults.
     virtual status_t get_cache_blob(
             engine_t *engine, cache_blob_t &cache_blob) const {
-        assert(!"unexpected");
-        return status::runtime_error;
+        return status::unimplemented;
     }
 
     virtual status_t get_cache_blob_size(engine_t *engine, size_t *size) const {
-        assert(!"unexpected");
-        return status::runtime_error;
+        return status::unimplemented;
     }
 
     virtual status_t create_resource(
@@ -122,6 +122,14 @@ bool primitive_attr_t::has_default_values(dnnl_primitive_attr::skip_mask_t mask,
             (bool)(~mask & smask_t::dropout), dropout_.has_default_values()));
     CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::rounding_mode),
             rounding_mode_.has_default_values()));
+    CHECK_ARG(IMPLICATION(
+            (bool)(~mask & smask_t::ragged_batch), !ragged_batch_));
+    CHECK_ARG(IMPLICATION(
+            (bool)(~mask & smask_t::grouped_batch), !grouped_batch_));
+    CHECK_ARG(IMPLICATION(
+            (bool)(~mask & smask_t::weights_lut), weights_lut_group_ == 0));
+    CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::src_dyn_quant),
+            src_dyn_quant_dt_ == data_type::undef));
     CHECK_ARG(this->defined(smask_t::none));
     bool fpmath_mode_ok = IMPLICATION(
             (bool)(~mask & smask_t::fpmath_mode) && fpmath_.apply_to_int_,
@@ -549,6 +557,62 @@ status_t dnnl_primitive_attr_set_deterministic(primitive_attr_t *attr, int d) {
     return success;
 }
 
+status_t dnnl_primitive_attr_get_ragged_batch(
+        const primitive_attr_t *attr, int *r) {
+    if (any_null(attr, r)) return invalid_arguments;
+    *r = attr->ragged_batch_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_ragged_batch(primitive_attr_t *attr, int r) {
+    if (any_null(attr)) return invalid_arguments;
+    attr->ragged_batch_ = r;
+    return success;
+}
+
+status_t dnnl_primitive_attr_get_grouped_batch(
+        const primitive_attr_t *attr, int *g) {
+    if (any_null(attr, g)) return invalid_arguments;
+    *g = attr->grouped_batch_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_grouped_batch(primitive_attr_t *attr, int g) {
+    if (any_null(attr)) return invalid_arguments;
+    attr->grouped_batch_ = g;
+    return success;
+}
+
+status_t dnnl_primitive_attr_get_weights_lut(
+        const primitive_attr_t *attr, dim_t *group_size) {
+    if (any_null(attr, group_size)) return invalid_arguments;
+    *group_size = attr->weights_lut_group_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_weights_lut(
+        primitive_attr_t *attr, dim_t group_size) {
+    if (any_null(attr) || group_size < 0) return invalid_arguments;
+    attr->weights_lut_group_ = group_size;
+    return success;
+}
+
+status_t dnnl_primitive_attr_get_src_dynamic_quantization(
+        const primitive_attr_t *attr, data_type_t *data_type) {
+    if (any_null(attr, data_type)) return invalid_arguments;
+    *data_type = attr->src_dyn_quant_dt_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_src_dynamic_quantization(
+        primitive_attr_t *attr, data_type_t data_type) {
+    if (any_null(attr)) return invalid_arguments;
+    if (!one_of(data_type, data_type::undef, data_type::s8, data_type::u8))
+        return invalid_arguments;
+    attr->src_dyn_quant_dt_ = data_type;
+    return success;
+}
+
 status_t dnnl_primitive_attr_get_scratchpad_mode(
         const primitive_attr_t *attr, scratchpad_mode_t *scratchpad_mode) {
     if (any_null(attr, scratchpad_mode)) return invalid_arguments;
@@ -535,7 +535,11 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         : scratchpad_mode_(dnnl::impl::scratchpad_mode::library)
         , fpmath_(dnnl::impl::get_fpmath_mode(), false)
         , acc_mode_(dnnl::impl::accumulation_mode::strict)
-        , deterministic_(false) {}
+        , deterministic_(false)
+        , ragged_batch_(false)
+        , grouped_batch_(false)
+        , weights_lut_group_(0)
+        , src_dyn_quant_dt_(dnnl::impl::data_type::undef) {}
 
     ~dnnl_primitive_attr() = default;
 
@@ -559,6 +563,10 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         fpmath_ = other.fpmath_;
         acc_mode_ = other.acc_mode_;
         deterministic_ = other.deterministic_;
+        ragged_batch_ = other.ragged_batch_;
+        grouped_batch_ = other.grouped_batch_;
+        weights_lut_group_ = other.weights_lut_group_;
+        src_dyn_quant_dt_ = other.src_dyn_quant_dt_;
         post_ops_ = other.post_ops_;
         rnn_data_qparams_ = other.rnn_data_qparams_;
         CHECK(rnn_weights_qparams_.copy_from(other.rnn_weights_qparams_));
@@ -592,6 +600,10 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         fpmath_mode = 1u << 15,
         dropout = 1u << 16,
         rounding_mode = 1u << 17,
+        ragged_batch = 1u << 18,
+        grouped_batch = 1u << 19,
+        weights_lut = 1u << 20,
+        src_dyn_quant = 1u << 21,
     };
 
     /** Returns true if the attributes have default values.
@@ -607,6 +619,10 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         bool ret = scratchpad_mode_ == rhs.scratchpad_mode_
                 && fpmath_ == rhs.fpmath_ && acc_mode_ == rhs.acc_mode_
                 && deterministic_ == rhs.deterministic_
+                && ragged_batch_ == rhs.ragged_batch_
+                && grouped_batch_ == rhs.grouped_batch_
+                && weights_lut_group_ == rhs.weights_lut_group_
+                && src_dyn_quant_dt_ == rhs.src_dyn_quant_dt_
                 && scales_ == rhs.scales_ && zero_points_ == rhs.zero_points_
                 && post_ops_ == rhs.post_ops_
                 && rnn_data_qparams_ == rhs.rnn_data_qparams_
@@ -687,6 +703,18 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl::impl::fpmath_t fpmath_;
     dnnl::impl::accumulation_mode_t acc_mode_;
     bool deterministic_;
+    // Rows of every batch entry beyond the length passed at execution time
+    // with DNNL_ARG_ATTR_RAGGED_LENGTHS are not computed.
+    bool ragged_batch_;
+    // Every batch entry computes only the rows between its offset and the
+    // offset of the next entry passed with DNNL_ARG_ATTR_GROUPED_OFFSETS.
+    bool grouped_batch_;
+    // Number of consecutive rows of the weights sharing a lookup table passed
+    // with DNNL_ARG_ATTR_WEIGHTS_LUT, 0 if weights are not looked up.
+    dnnl::impl::dim_t weights_lut_group_;
+    // Data type the source is quantized to with per-row scales computed at
+    // execution time, undef if the source is not quantized.
+    dnnl::impl::data_type_t src_dyn_quant_dt_;
     dnnl::impl::post_ops_t post_ops_;
     dnnl::impl::rnn_data_qparams_t rnn_data_qparams_;
     dnnl::impl::rnn_create_time_scales_t rnn_weights_qparams_;
@@ -32,7 +32,8 @@ struct primitive_cache_t {
     using result_t = primitive_cache_iface_t::result_t;
     using create_func_t = result_t (&)(void *);
 
-    primitive_cache_t(int capacity) : cache_(capacity) {};
+    primitive_cache_t(int capacity, int nshards)
+        : cache_(capacity, nshards) {};
 
     ~primitive_cache_t() = default;
 
@@ -65,7 +66,8 @@ private:
         cache_.set_capacity_without_clearing(capacity);
     }
 
-    utils::lru_cache_t<key_t, primitive_t, result_t, update_key> cache_;
+    utils::sharded_lru_cache_t<key_t, primitive_t, result_t, update_key>
+            cache_;
 };
 
 primitive_cache_t &global_primitive_cache() {
@@ -75,7 +77,11 @@ primitive_cache_t &global_primitive_cache() {
 #else
     static const int capacity = 0;
 #endif
-    static primitive_cache_t cache(capacity);
+    // There is at least one shard and no more shards than entries, so that
+    // every shard can hold an entry.
+    static const int nshards = std::max(1,
+            std::min(getenv_int_user("PRIMITIVE_CACHE_SHARDS", 1), capacity));
+    static primitive_cache_t cache(capacity, nshards);
     return cache;
 }
 
@@ -184,6 +184,15 @@ struct primitive_desc_t : public c_compatible {
             return !attr()->rounding_mode_.has_default_values()
                     ? arg_usage_t::input
                     : arg_usage_t::unused;
+        if (arg == DNNL_ARG_ATTR_RAGGED_LENGTHS)
+            return attr()->ragged_batch_ ? arg_usage_t::input
+                                         : arg_usage_t::unused;
+        if (arg == DNNL_ARG_ATTR_GROUPED_OFFSETS)
+            return attr()->grouped_batch_ ? arg_usage_t::input
+                                          : arg_usage_t::unused;
+        if (arg == DNNL_ARG_ATTR_WEIGHTS_LUT)
+            return attr()->weights_lut_group_ > 0 ? arg_usage_t::input
+                                                  : arg_usage_t::unused;
 
         for (int idx = 0; idx < attr()->post_ops_.len(); ++idx) {
             using namespace primitive_kind;
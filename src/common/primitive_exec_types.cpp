@@ -64,7 +64,10 @@ status_t cvt_primitive_args(const primitive_desc_t *pd, int nargs,
                                         | DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST))
                         || (arg == DNNL_ARG_ATTR_DROPOUT_PROBABILITY)
                         || (arg == DNNL_ARG_ATTR_DROPOUT_SEED)
-                        || (arg == DNNL_ARG_ATTR_ROUNDING_SEED);
+                        || (arg == DNNL_ARG_ATTR_ROUNDING_SEED)
+                        || (arg == DNNL_ARG_ATTR_RAGGED_LENGTHS)
+                        || (arg == DNNL_ARG_ATTR_GROUPED_OFFSETS)
+                        || (arg == DNNL_ARG_ATTR_WEIGHTS_LUT);
                 break;
             case primitive_desc_t::arg_usage_t::output:
                 args[arg] = {mem, false};
@@ -83,6 +83,7 @@ bool key_t::operator==(const key_t &rhs) const {
             break;
             CASE(deconvolution)
             CASE(eltwise)
+            CASE(embedding_bag)
             CASE(gemm)
             CASE(group_normalization)
             CASE(inner_product)
@@ -181,6 +182,8 @@ size_t get_md_hash(const memory_desc_t &md) {
             seed = get_array_hash(seed,
                     md.format_desc.sparse_desc.metadata_types,
                     sparse_desc_t::max_metadata_types);
+            seed = get_array_hash(seed, md.format_desc.sparse_desc.block_dims,
+                    DNNL_MAX_NDIMS);
             // User cannot initialize `packed_desc` therefore `packed_desc`
             // is always zero initialized.
             break;
@@ -227,6 +230,14 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
     seed = hash_combine(seed, static_cast<size_t>(attr.fpmath_.apply_to_int_));
     // deterministic
     seed = hash_combine(seed, static_cast<size_t>(attr.deterministic_));
+    // ragged_batch
+    seed = hash_combine(seed, static_cast<size_t>(attr.ragged_batch_));
+    // grouped_batch
+    seed = hash_combine(seed, static_cast<size_t>(attr.grouped_batch_));
+    // weights_lut
+    seed = hash_combine(seed, attr.weights_lut_group_);
+    // src_dyn_quant
+    seed = hash_combine(seed, static_cast<size_t>(attr.src_dyn_quant_dt_));
     // acc_mode
     seed = hash_combine(seed, static_cast<size_t>(attr.acc_mode_));
     // rounding_mode
@@ -423,6 +434,22 @@ size_t get_desc_hash(const eltwise_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const embedding_bag_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.prop_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.indices_desc));
+    seed = hash_combine(seed, get_md_hash(desc.offsets_desc));
+    seed = hash_combine(seed, get_md_hash(desc.weights_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    // Combined hash for embedding_bag desc
+    return seed;
+}
+
 size_t get_desc_hash(const gemm_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -740,6 +767,7 @@ size_t get_desc_hash(const sdpa_desc_t &desc) {
     seed = hash_combine(seed, desc.vs_zero_points.get_hash());
     seed = hash_combine(seed, get_md_hash(desc.dst_desc));
     seed = hash_combine(seed, get_md_hash(desc.attn_mask_desc));
+    seed = hash_combine(seed, get_md_hash(desc.kv_block_table_desc));
     // Scale type
     seed = hash_combine(seed, static_cast<size_t>(desc.scale_dt));
     seed = hash_combine(seed, desc.invert_scale);
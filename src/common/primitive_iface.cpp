@@ -171,13 +171,8 @@ status_t dnnl_primitive_create_from_cache_blob(
             || size == 0) {
         return invalid_arguments;
     }
-    const auto ekind = primitive_desc_iface->engine()->kind();
-    const auto runtime_kind = primitive_desc_iface->engine()->runtime_kind();
-    if (ekind != engine_kind::gpu
-            || (ekind == engine_kind::gpu
-                    && runtime_kind != runtime_kind::ocl)) {
+    if (!is_cache_blob_supported(primitive_desc_iface->engine()))
         return status::unimplemented;
-    }
 
     cache_blob_t cb(const_cast<uint8_t *>(cache_blob), size);
     return dnnl::impl::primitive_create(
@@ -230,13 +225,8 @@ status_t dnnl_primitive_get_cache_blob(const primitive_iface_t *primitive_iface,
         return status::invalid_arguments;
     }
 
-    const auto ekind = primitive_iface->engine()->kind();
-    const auto runtime_kind = primitive_iface->engine()->runtime_kind();
-    if (ekind != engine_kind::gpu
-            || (ekind == engine_kind::gpu
-                    && runtime_kind != runtime_kind::ocl)) {
+    if (!is_cache_blob_supported(primitive_iface->engine()))
         return status::unimplemented;
-    }
 
     if (!cache_blob) {
         size_t sz = 0;
@@ -336,6 +326,10 @@ status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
     return status;
 }
 
+const memory_storage_t *dnnl_primitive::scratchpad_memory_storage() const {
+    return scratchpad_ ? scratchpad_->get_memory_storage() : nullptr;
+}
+
 status_t dnnl_primitive::get_cache_blob_size(size_t *size) const {
     return primitive_->get_cache_blob_size(engine(), size);
 }
@@ -65,6 +65,8 @@ struct dnnl_primitive : public dnnl::impl::c_compatible {
     dnnl::impl::status_t get_cache_blob(
             dnnl::impl::cache_blob_t cache_blob) const;
     dnnl::impl::status_t execute(dnnl::impl::exec_ctx_t &ctx) const;
+    // Returns the storage of the scratchpad managed by the library, if any.
+    const dnnl::impl::memory_storage_t *scratchpad_memory_storage() const;
 
     void retain() { counter_++; }
 
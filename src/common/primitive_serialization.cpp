@@ -35,6 +35,7 @@ status_t serialize_desc(
         CASE(convolution)
         CASE(deconvolution)
         CASE(eltwise)
+        CASE(embedding_bag)
         CASE(gemm)
         CASE(group_normalization)
         CASE(inner_product)
@@ -183,6 +184,14 @@ void serialize(serialization_stream_t &sstream, const primitive_attr_t &attr) {
     sstream.append(attr.fpmath_.apply_to_int_);
     // deterministic
     sstream.append(attr.deterministic_);
+    // ragged_batch
+    sstream.append(attr.ragged_batch_);
+    // grouped_batch
+    sstream.append(attr.grouped_batch_);
+    // weights_lut
+    sstream.append(attr.weights_lut_group_);
+    // src_dyn_quant
+    sstream.append(attr.src_dyn_quant_dt_);
     // acc_mode
     sstream.append(attr.acc_mode_);
 
@@ -319,6 +328,20 @@ void serialize(serialization_stream_t &sstream, const eltwise_desc_t &desc) {
     sstream.append(desc.beta);
 }
 
+void serialize(
+        serialization_stream_t &sstream, const embedding_bag_desc_t &desc) {
+    // Kinds
+    sstream.append(desc.primitive_kind);
+    sstream.append(desc.prop_kind);
+    sstream.append(desc.alg_kind);
+    // Memory descriptors
+    serialize(sstream, desc.src_desc);
+    serialize(sstream, desc.indices_desc);
+    serialize(sstream, desc.offsets_desc);
+    serialize(sstream, desc.weights_desc);
+    serialize(sstream, desc.dst_desc);
+}
+
 void serialize(serialization_stream_t &sstream, const gemm_desc_t &desc) {
     // Kind
     sstream.append(desc.primitive_kind);
@@ -583,6 +606,7 @@ void serialize(serialization_stream_t &sstream, const sdpa_desc_t &desc) {
     desc.vs_zero_points.serialize(sstream);
     serialize(sstream, desc.dst_desc);
     serialize(sstream, desc.attn_mask_desc);
+    serialize(sstream, desc.kv_block_table_desc);
     sstream.append(desc.scale_dt);
     sstream.append(desc.invert_scale);
     sstream.append(desc.kv_head_number);
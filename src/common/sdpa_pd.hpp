@@ -53,7 +53,8 @@ struct sdpa_pd_t : public primitive_desc_t {
         // memories unconditionally but the primitive desc is not set up for
         // quantization.
         if (utils::one_of(arg, DNNL_ARG_QUERIES, DNNL_ARG_KEYS, DNNL_ARG_VALUES,
-                    DNNL_ARG_ATTN_MASK, DNNL_ARG_SCALE,
+                    DNNL_ARG_ATTN_MASK, DNNL_ARG_KV_BLOCK_TABLE,
+                    DNNL_ARG_SCALE,
                     DNNL_ARG_ATTR_SCALES | DNNL_ARG_KEYS,
                     DNNL_ARG_ATTR_SCALES | DNNL_ARG_VALUES,
                     DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_KEYS,
@@ -72,6 +73,7 @@ struct sdpa_pd_t : public primitive_desc_t {
             case DNNL_ARG_KEYS: return src_md(1);
             case DNNL_ARG_VALUES: return src_md(2);
             case DNNL_ARG_ATTN_MASK: return src_md(3);
+            case DNNL_ARG_KV_BLOCK_TABLE: return src_md(4);
             case DNNL_ARG_DST: return dst_md(0, user_input);
             default: return primitive_desc_t::arg_md(arg);
         }
@@ -84,6 +86,7 @@ struct sdpa_pd_t : public primitive_desc_t {
             case 1: return &desc_.k_desc;
             case 2: return &desc_.v_desc;
             case 3: return &desc_.attn_mask_desc;
+            case 4: return &desc_.kv_block_table_desc;
             default: return &glob_zero_md;
         }
     }
@@ -96,9 +99,13 @@ struct sdpa_pd_t : public primitive_desc_t {
     const memory_desc_t *key_md() const { return &desc_.k_desc; }
     const memory_desc_t *val_md() const { return &desc_.v_desc; }
     const memory_desc_t *attn_mask_md() const { return &desc_.attn_mask_desc; }
+    const memory_desc_t *kv_block_table_md() const {
+        return &desc_.kv_block_table_desc;
+    }
 
     int n_inputs() const override {
-        return 3 + int(with_attn_mask()) + int(with_attn_scale());
+        return 3 + int(with_attn_mask()) + int(with_attn_scale())
+                + int(with_kv_block_table());
     }
     int n_outputs() const override { return 1; }
 
@@ -110,6 +117,9 @@ struct sdpa_pd_t : public primitive_desc_t {
         return (attn_mask_md()->data_type != data_type::undef);
     }
 
+    /// If true, keys and values are paged and looked up in a block table
+    bool with_kv_block_table() const { return desc_.is_paged(); }
+
     /// If true, the attention mask is a causal mask
     bool with_causal_mask() const {
         return desc_.mask_type == attn_mask_type::top_left
@@ -32,6 +32,7 @@ namespace impl {
 #define DNNL_ARG_KEYS DNNL_ARG_SRC_1
 #define DNNL_ARG_VALUES DNNL_ARG_SRC_2
 #define DNNL_ARG_ATTN_MASK DNNL_ARG_SHIFT
+#define DNNL_ARG_KV_BLOCK_TABLE DNNL_ARG_SRC_3
 
 // NOLINTBEGIN(modernize-use-using)
 /// Types of attention mask
@@ -79,6 +80,10 @@ struct sdpa_desc_t : public op_desc_t {
 
     memory_desc_t dst_desc;
     memory_desc_t attn_mask_desc;
+    // Block table of paged keys and values. When it's set, `k_desc` and
+    // `v_desc` describe pools of blocks of tokens shared by all sequences,
+    // and each row of the table holds the blocks of one sequence in order.
+    memory_desc_t kv_block_table_desc;
     data_type_t scale_dt {};
     // invert_scale = false: multiply by scale
     // invert_scale = true:  divide by scale
@@ -93,7 +98,14 @@ struct sdpa_desc_t : public op_desc_t {
     // Head size.
     dnnl_dim_t head_size() const { return q_desc.dims[q_desc.ndims - 1]; }
     // Number of keys.
-    dnnl_dim_t keys() const { return k_desc.dims[k_desc.ndims - 1]; }
+    dnnl_dim_t keys() const {
+        const dnnl_dim_t k = k_desc.dims[k_desc.ndims - 1];
+        return is_paged() ? kv_block_table_desc.dims[1] * k : k;
+    }
+    // Whether keys and values are split into blocks.
+    bool is_paged() const { return kv_block_table_desc.ndims != 0; }
+    // Number of tokens in a block of paged keys and values.
+    dnnl_dim_t kv_block_size() const { return k_desc.dims[k_desc.ndims - 1]; }
     // Number of values.
     dnnl_dim_t values() const { return v_desc.dims[v_desc.ndims - 1]; }
     // Total batch size.
@@ -77,6 +77,24 @@ static inline status_t sdpa_desc_check(const memory_desc_t *q_desc,
     return status::success;
 }
 
+static inline status_t sdpa_block_table_check(const memory_desc_t *dst_desc,
+        const memory_desc_t *kv_block_table_desc) {
+    if (!kv_block_table_desc || kv_block_table_desc->ndims == 0)
+        return status::success;
+
+    VCHECK_SDPA_COND(kv_block_table_desc->ndims == 2,
+            "block table must be 2D, got: %d", kv_block_table_desc->ndims);
+    VCHECK_SDPA_COND(kv_block_table_desc->data_type == data_type::s32,
+            VERBOSE_INVALID_DATATYPE, "block table");
+    VCHECK_SDPA_COND(kv_block_table_desc->dims[0] == dst_desc->dims[0],
+            "kv_block_table_desc->dims[0](%s) must match "
+            "dst_desc->dims[0](%s)",
+            md2dim_str(kv_block_table_desc).c_str(),
+            md2dim_str(dst_desc).c_str());
+
+    return status::success;
+}
+
 static inline status_t sdpa_attr_check(const memory_desc_t *q_desc,
         const memory_desc_t *k_desc, const memory_desc_t *v_desc,
         const engine_t *engine, const primitive_attr_t *attr,
@@ -137,7 +155,8 @@ static inline sdpa_desc_t create_sdpa_desc(const memory_desc_t *q_md,
         const memory_desc_t *dst_md, const memory_desc_t *attn_mask_md,
         data_type_t scale_dt, bool invert_scale, dim_t kv_head_number,
         attn_mask_type_t attn_mask_type, alg_kind_t softmax_alg,
-        const primitive_attr_t *kq_attr, const primitive_attr_t *vs_attr) {
+        const primitive_attr_t *kq_attr, const primitive_attr_t *vs_attr,
+        const memory_desc_t *kv_block_table_md = nullptr) {
     auto sdpa_desc = sdpa_desc_t();
     sdpa_desc.primitive_kind = primitive_kind::sdpa;
     sdpa_desc.q_desc = *q_md;
@@ -153,6 +172,7 @@ static inline sdpa_desc_t create_sdpa_desc(const memory_desc_t *q_md,
     sdpa_desc.v_desc = *v_md;
     sdpa_desc.dst_desc = *dst_md;
     if (attn_mask_md) sdpa_desc.attn_mask_desc = *attn_mask_md;
+    if (kv_block_table_md) sdpa_desc.kv_block_table_desc = *kv_block_table_md;
     sdpa_desc.scale_dt = scale_dt;
     sdpa_desc.invert_scale = invert_scale;
     sdpa_desc.kv_head_number = kv_head_number;
@@ -169,14 +189,16 @@ static inline status_t create_sdpa_pd(
         bool invert_scale, dim_t kv_head_number,
         attn_mask_type_t attn_mask_type, alg_kind_t softmax_alg,
         const primitive_attr_t *attr, const primitive_attr_t *kq_attr = nullptr,
-        const primitive_attr_t *vs_attr = nullptr) {
+        const primitive_attr_t *vs_attr = nullptr,
+        const memory_desc_t *kv_block_table_md = nullptr) {
     CHECK(sdpa_attr_check(q_md, k_md, v_md, engine, attr, kq_attr, vs_attr));
     CHECK(sdpa_desc_check(q_md, k_md, v_md, dst_md, attn_mask_md, engine, attr,
             kq_attr, vs_attr));
+    CHECK(sdpa_block_table_check(dst_md, kv_block_table_md));
 
     auto sdpa_desc = create_sdpa_desc(q_md, k_md, v_md, dst_md, attn_mask_md,
             scale_dt, invert_scale, kv_head_number, attn_mask_type, softmax_alg,
-            kq_attr, vs_attr);
+            kq_attr, vs_attr, kv_block_table_md);
 
     primitive_attr_t sdpa_attr = attr ? *attr : default_attr();
 
@@ -44,7 +44,9 @@ status_t dnnl_stream_create(
     bool args_ok = !utils::any_null(stream, engine);
     if (!args_ok) return invalid_arguments;
 
-    if (engine->kind() != engine_kind::gpu
+    // CPU profiling is only supported for native CPU runtimes.
+    if (engine->kind() == engine_kind::cpu
+            && engine->runtime_kind() == runtime_kind::sycl
             && (flags & stream_flags::profiling)) {
         return status::unimplemented;
     }
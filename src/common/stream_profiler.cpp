@@ -32,10 +32,17 @@ using namespace dnnl::impl::status;
 #define INTERNAL_API_ATTRIBUTE(rtype) extern "C" rtype DNNL_API
 #endif
 
+namespace {
+bool is_profiling_supported(const stream_t *stream) {
+    const auto *engine = stream->engine();
+    return engine->kind() == engine_kind::gpu
+            || engine->runtime_kind() != runtime_kind::sycl;
+}
+} // namespace
+
 INTERNAL_API_ATTRIBUTE(status_t) dnnl_reset_profiling(stream_t *stream) {
-    const auto eng_kind = stream->engine()->kind();
-    if (eng_kind != engine_kind::gpu) {
-        VERROR(common, common, "CPU engine does not support profiling");
+    if (!is_profiling_supported(stream)) {
+        VERROR(common, common, "CPU SYCL engine does not support profiling");
         return status::unimplemented;
     }
     return stream->reset_profiling();
@@ -44,9 +51,8 @@ INTERNAL_API_ATTRIBUTE(status_t) dnnl_reset_profiling(stream_t *stream) {
 INTERNAL_API_ATTRIBUTE(status_t)
 dnnl_query_profiling_data(stream_t *stream, profiling_data_kind_t data_kind,
         int *num_entries, uint64_t *data) {
-    const auto eng_kind = stream->engine()->kind();
-    if (eng_kind != engine_kind::gpu) {
-        VERROR(common, common, "CPU engine does not support profiling");
+    if (!is_profiling_supported(stream)) {
+        VERROR(common, common, "CPU SYCL engine does not support profiling");
         return status::unimplemented;
     }
     return stream->get_profiling_data(data_kind, num_entries, data);
@@ -54,9 +60,8 @@ dnnl_query_profiling_data(stream_t *stream, profiling_data_kind_t data_kind,
 
 extern "C" status_t DNNL_API dnnl_impl_notify_profiling_complete(
         stream_t *stream) {
-    const auto eng_kind = stream->engine()->kind();
-    if (eng_kind != engine_kind::gpu) {
-        VERROR(common, common, "CPU engine does not support profiling");
+    if (!is_profiling_supported(stream)) {
+        VERROR(common, common, "CPU SYCL engine does not support profiling");
         return status::unimplemented;
     }
     return stream->notify_profiling_complete();
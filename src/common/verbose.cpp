@@ -41,6 +41,7 @@
 #include "convolution_pd.hpp"
 #include "deconvolution_pd.hpp"
 #include "eltwise_pd.hpp"
+#include "embedding_bag_pd.hpp"
 #include "gemm_pd.hpp"
 #include "group_normalization_pd.hpp"
 #include "inner_product_pd.hpp"
@@ -231,6 +232,7 @@ uint32_t get_verbose(verbose_t::flag_kind verbosity_kind,
                 REGEX_SEARCH(k, softmax, regexp);
                 REGEX_SEARCH(k, layer_normalization, regexp);
                 REGEX_SEARCH(k, group_normalization, regexp);
+                REGEX_SEARCH(k, embedding_bag, regexp);
                 REGEX_SEARCH(k, graph, regexp);
                 REGEX_SEARCH(k, gemm_api, regexp);
                 REGEX_SEARCH(k, ukernel, regexp);
@@ -727,6 +729,14 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
         ss << field_delim() << "attr-deterministic:" << deterministic;
     }
 
+    if (attr->ragged_batch_) ss << field_delim() << "attr-ragged-batch:1";
+    if (attr->grouped_batch_) ss << field_delim() << "attr-grouped-batch:1";
+    if (attr->weights_lut_group_ > 0)
+        ss << field_delim() << "attr-weights-lut:" << attr->weights_lut_group_;
+    if (attr->src_dyn_quant_dt_ != data_type::undef)
+        ss << field_delim() << "attr-src-dyn-quant:"
+           << dnnl_dt2str(attr->src_dyn_quant_dt_);
+
     // Fast exit if rest attributes were not specified.
     if (attr->has_default_values()) return ss;
 
@@ -1058,6 +1068,29 @@ std::string init_info_gemm(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+std::string init_info_embedding_bag(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << ","
+       << pd->desc()->prop_kind << ",";
+
+    auto src_md = pd->src_md(0);
+    auto dst_md = pd->invariant_dst_md();
+    ss << md2fmt_str("src", src_md, src_md->format_kind) << " ";
+    if (pd->with_weights())
+        ss << md2fmt_str("wei", pd->weights_md(0),
+                pd->weights_md(0)->format_kind)
+           << " ";
+    ss << md2fmt_str("dst", dst_md, pd->invariant_dst_user_format_kind());
+
+    ss << "," << pd->attr() << ",";
+    ss << "alg:" << pd->desc()->alg_kind << ",";
+    ss << md2dim_str(src_md) << ":" << md2dim_str(pd->src_md(1)) << ":"
+       << md2dim_str(dst_md);
+
+    return ss.str();
+}
+
 template <typename pd_t>
 std::string init_info_group_normalization(const engine_t *e, const pd_t *pd) {
     std::stringstream ss;
@@ -1576,6 +1609,10 @@ std::string init_info_sdpa(const engine_t *e, const pd_t *pd) {
         ss << md2fmt_str("msk", pd->attn_mask_md(),
                 pd->invariant_src_user_format_kind(3))
            << " ";
+    if (pd->with_kv_block_table())
+        ss << md2fmt_str("blk", pd->kv_block_table_md(),
+                pd->invariant_src_user_format_kind(4))
+           << " ";
     ss << md2fmt_str("dst", pd->dst_md(), pd->invariant_dst_user_format_kind())
        << ",";
 
@@ -1754,6 +1791,7 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(embedding_bag);
             CASE(gemm);
             CASE(group_normalization);
             CASE(inner_product);
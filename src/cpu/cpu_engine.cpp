@@ -49,6 +49,17 @@ status_t cpu_engine_t::create_stream(
     return safe_ptr_assign(*stream, new cpu_stream_t(this, stream_impl));
 }
 
+status_t cpu_engine_t::serialize_device(
+        serialization_stream_t &sstream) const {
+    // Code generated by CPU implementations depends on the instruction set
+    // and, through blocking heuristics, on the cache hierarchy.
+    sstream.append(platform::get_effective_cpu_isa());
+    sstream.append(platform::get_cpu_isa_hints());
+    for (int level = 1; level <= 3; level++)
+        sstream.append(platform::get_per_core_cache_size(level));
+    return status::success;
+}
+
 engine_t *get_service_engine() {
     static std::unique_ptr<engine_t, engine_deleter_t> cpu_engine;
     static std::once_flag initialized;
@@ -0,0 +1,265 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_SDPA_PD_HPP
+#define CPU_CPU_SDPA_PD_HPP
+
+#include <assert.h>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/sdpa_pd.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+#include "cpu/cpu_engine.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Loads elements of a 4D plain tensor converting them to f32. Integer keys and
+// values are dequantized on the fly. Quantization parameters are stored as a
+// dense tensor over the dimensions set in the mask, where the last two
+// dimensions can be reduced by groups. Paged keys and values are addressed by
+// sequence and token, which are mapped to a block of the pool and a token
+// within the block through the block table.
+struct sdpa_loader_t {
+    sdpa_loader_t(const memory_desc_t &md, const void *data,
+            const quant_entry_t &scales = default_quant_entry(),
+            const void *scales_ptr = nullptr,
+            const quant_entry_t &zero_points = default_quant_entry(),
+            const void *zero_points_ptr = nullptr)
+        : dt_(md.data_type)
+        , data_(data)
+        , sc_(scales, md, scales_ptr)
+        , zp_(zero_points, md, zero_points_ptr) {
+        // An optional tensor may be absent.
+        if (md.ndims != 4) return;
+        const memory_desc_wrapper mdw(md);
+        for (int d = 0; d < 4; d++) {
+            // Broadcast dimensions don't move the pointer.
+            strides_[d] = md.dims[d] == 1 ? 0 : mdw.blocking_desc().strides[d];
+            dims_[d] = md.dims[d];
+        }
+        off0_ = mdw.offset0();
+    }
+
+    // Enables the block table lookup. `token_dim` is the dimension of the
+    // tokens, which is also the block size in the pool.
+    void set_block_table(
+            const memory_desc_t &md, const void *table, int token_dim) {
+        if (md.ndims != 2) return;
+        const memory_desc_wrapper mdw(md);
+        table_ = static_cast<const int32_t *>(table) + mdw.offset0();
+        table_strides_[0] = mdw.blocking_desc().strides[0];
+        table_strides_[1] = mdw.blocking_desc().strides[1];
+        token_dim_ = token_dim;
+    }
+
+    dim_t off(dim_t d0, dim_t d1, dim_t d2, dim_t d3) const {
+        return off0_ + d0 * strides_[0] + d1 * strides_[1] + d2 * strides_[2]
+                + d3 * strides_[3];
+    }
+
+    float operator()(dim_t d0, dim_t d1, dim_t d2, dim_t d3) const {
+        if (table_) {
+            dim_t &tok = token_dim_ == 2 ? d2 : d3;
+            const dim_t bs = dims_[token_dim_];
+            d0 = table_[d0 * table_strides_[0] + tok / bs * table_strides_[1]];
+            tok %= bs;
+        }
+        float v = io::load_float_value(dt_, data_, off(d0, d1, d2, d3));
+        if (zp_.ptr_)
+            v -= io::load_int_value(zp_.dt_, zp_.ptr_, zp_.off(d0, d1, d2, d3));
+        if (sc_.ptr_)
+            v *= io::load_float_value(
+                    sc_.dt_, sc_.ptr_, sc_.off(d0, d1, d2, d3));
+        return v;
+    }
+
+private:
+    struct quant_t {
+        quant_t(const quant_entry_t &entry, const memory_desc_t &md,
+                const void *ptr)
+            : dt_(entry.get_data_type()), ptr_(ptr) {
+            if (entry.has_default_values()) {
+                ptr_ = nullptr;
+                return;
+            }
+            const int mask = entry.get_mask();
+            dim_t stride = 1;
+            for (int d = md.ndims - 1; d >= 0; d--) {
+                if (!(mask & (1 << d))) continue;
+                const int gd = d - (md.ndims - 2);
+                groups_[d] = gd >= 0 ? entry.get_group(gd) : 1;
+                strides_[d] = stride;
+                stride *= md.dims[d] / groups_[d];
+            }
+        }
+
+        dim_t off(dim_t d0, dim_t d1, dim_t d2, dim_t d3) const {
+            return d0 / groups_[0] * strides_[0] + d1 / groups_[1] * strides_[1]
+                    + d2 / groups_[2] * strides_[2]
+                    + d3 / groups_[3] * strides_[3];
+        }
+
+        data_type_t dt_;
+        const void *ptr_;
+        dim_t strides_[4] = {0, 0, 0, 0};
+        dim_t groups_[4] = {1, 1, 1, 1};
+    };
+
+    data_type_t dt_;
+    const void *data_;
+    quant_t sc_, zp_;
+    dim_t strides_[4] = {0, 0, 0, 0};
+    dim_t dims_[4] = {0, 0, 0, 0};
+    dim_t off0_ = 0;
+    const int32_t *table_ = nullptr;
+    dim_t table_strides_[2] = {0, 0};
+    int token_dim_ = 3;
+};
+
+struct cpu_sdpa_pd_t : public sdpa_pd_t {
+    using sdpa_pd_t::sdpa_pd_t;
+
+    // Batch, query heads and key-value heads.
+    dim_t MB() const { return dst_md()->dims[0]; }
+    dim_t H() const { return dst_md()->dims[1]; }
+    dim_t KV_H() const { return key_md()->dims[1]; }
+
+    // Returns the number of valid queries and keys of the batch `mb`, which
+    // may be less than the full dimensions for a ragged batch.
+    dim_t valid_queries(const int32_t *ragged_lengths, dim_t mb) const {
+        const dim_t Q = desc()->queries();
+        return ragged_lengths
+                ? nstl::max<dim_t>(0, nstl::min<dim_t>(Q, ragged_lengths[mb]))
+                : Q;
+    }
+    dim_t valid_keys(const int32_t *ragged_lengths, dim_t mb) const {
+        const dim_t K = desc()->keys();
+        return ragged_lengths
+                ? nstl::max<dim_t>(0, nstl::min<dim_t>(K, ragged_lengths[mb]))
+                : K;
+    }
+
+    // Index of the key-value head shared by the query head `h`.
+    dim_t kv_head(dim_t h) const { return h / (H() / KV_H()); }
+
+    // Index passed to the loader of keys or values for the batch `mb`. Paged
+    // keys and values are looked up by sequence.
+    dim_t kv_mb(const memory_desc_t *md, dim_t mb) const {
+        return with_kv_block_table() ? mb : mb % md->dims[0];
+    }
+
+    // Returns the number of keys visible for the query `q` with a causal mask.
+    // The result may be non-positive if the query doesn't see any key.
+    // `Q` and `K` are the numbers of valid queries and keys.
+    dim_t causal_keys_end(dim_t q, dim_t Q, dim_t K) const {
+        if (desc()->mask_type == attn_mask_type::top_left)
+            return nstl::min(K, q + 1);
+        if (desc()->mask_type == attn_mask_type::bottom_right)
+            return nstl::min(K, q + 1 + K - Q);
+        return K;
+    }
+    dim_t causal_keys_end(dim_t q) const {
+        return causal_keys_end(q, desc()->queries(), desc()->keys());
+    }
+
+protected:
+    // Checks shared by all CPU implementations: plain 4D tensors with
+    // floating-point queries and destination, and keys and values either of
+    // the queries data type or integer with scales and zero points.
+    status_t init_common(engine_t *engine) {
+        using namespace data_type;
+        using smask_t = primitive_attr_t::skip_mask_t;
+
+        VDISPATCH_SDPA(attr()->has_default_values(
+                               smask_t::fpmath_mode | smask_t::ragged_batch),
+                VERBOSE_UNSUPPORTED_ATTR);
+        VDISPATCH_SDPA(utils::everyone_is(4, qry_md()->ndims, key_md()->ndims,
+                               val_md()->ndims, dst_md()->ndims),
+                VERBOSE_UNSUPPORTED_TAG);
+        VDISPATCH_SDPA(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+        for (const auto *md : {qry_md(), key_md(), val_md(), dst_md()})
+            VDISPATCH_SDPA(memory_desc_wrapper(md).is_plain(),
+                    VERBOSE_UNSUPPORTED_TAG);
+
+        const auto q_dt = qry_md()->data_type;
+        VDISPATCH_SDPA(utils::one_of(q_dt, f32, bf16, f16),
+                VERBOSE_UNSUPPORTED_DT);
+        VDISPATCH_SDPA(utils::one_of(dst_md()->data_type, f32, bf16, f16),
+                VERBOSE_UNSUPPORTED_DT);
+        for (const auto *md : {key_md(), val_md()})
+            VDISPATCH_SDPA(md->data_type == q_dt
+                            || utils::one_of(md->data_type, s8, u8, s4, u4),
+                    VERBOSE_UNSUPPORTED_DT);
+        VDISPATCH_SDPA(IMPLICATION(with_key_scales() || with_key_zp(),
+                               key_md()->data_type != q_dt),
+                VERBOSE_UNSUPPORTED_ATTR);
+        VDISPATCH_SDPA(IMPLICATION(with_value_scales() || with_value_zp(),
+                               val_md()->data_type != q_dt),
+                VERBOSE_UNSUPPORTED_ATTR);
+
+        // Keys and values may be broadcast over the batch and shared by
+        // several query heads. Paged ones are pools of blocks instead.
+        for (const auto *md : {key_md(), val_md()}) {
+            VDISPATCH_SDPA(with_kv_block_table()
+                            || utils::one_of(md->dims[0], 1, MB()),
+                    VERBOSE_INVALID_BROADCAST, "kv", 0);
+            VDISPATCH_SDPA(md->dims[1] == KV_H() && H() % KV_H() == 0,
+                    VERBOSE_INVALID_BROADCAST, "kv", 1);
+        }
+        VDISPATCH_SDPA(utils::one_of(qry_md()->dims[0], 1, MB())
+                        && qry_md()->dims[1] == H(),
+                VERBOSE_INCONSISTENT_DIM, "queries", 0, "dst", 0);
+
+        if (with_kv_block_table()) {
+            VDISPATCH_SDPA(memory_desc_wrapper(kv_block_table_md()).is_plain(),
+                    VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_SDPA(key_md()->dims[0] == val_md()->dims[0],
+                    VERBOSE_INCONSISTENT_DIM, "keys", 0, "values", 0);
+        }
+
+        if (with_attn_mask()) {
+            const auto *msk = attn_mask_md();
+            VDISPATCH_SDPA(msk->ndims == 4, VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_SDPA(memory_desc_wrapper(msk).is_plain(),
+                    VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_SDPA(utils::one_of(msk->data_type, f32, bf16, f16),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_SDPA(utils::one_of(msk->dims[0], 1, MB()),
+                    VERBOSE_INVALID_BROADCAST, "attn_mask", 0);
+            VDISPATCH_SDPA(utils::one_of(msk->dims[1], 1, H()),
+                    VERBOSE_INVALID_BROADCAST, "attn_mask", 1);
+            VDISPATCH_SDPA(utils::one_of(msk->dims[2], 1, desc()->queries()),
+                    VERBOSE_INVALID_BROADCAST, "attn_mask", 2);
+            VDISPATCH_SDPA(msk->dims[3] == desc()->keys(),
+                    VERBOSE_INVALID_BROADCAST, "attn_mask", 3);
+        }
+
+        return status::success;
+    }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,71 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "cpu/cpu_stream.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+void cpu_stream_t::init_executor() {
+    // Every worker runs one primitive at a time, which is parallelized
+    // with the threading runtime as usual.
+    const int nworkers = nstl::max(1, getenv_int_user("CPU_STREAM_WORKERS", 2));
+    executor_ = utils::make_unique<cpu_stream_executor_t>(nworkers,
+            [this](const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
+                before_exec_hook();
+                status_t status = execute_primitive(primitive_iface, ctx);
+                after_exec_hook();
+                return status;
+            });
+}
+
+status_t cpu_stream_t::enqueue_primitive(
+        const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
+    if (executor_) return executor_->submit(primitive_iface, ctx);
+    return execute_primitive(primitive_iface, ctx);
+}
+
+status_t cpu_stream_t::execute_primitive(
+        const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
+    if (!profiler_) return stream_t::enqueue_primitive(primitive_iface, ctx);
+
+    auto entry = cpu_stream_profiler_t::start();
+    status_t status = stream_t::enqueue_primitive(primitive_iface, ctx);
+    if (status == status::success) profiler_->stop(entry);
+    return status;
+}
+
+status_t cpu_stream_t::reset_profiling() {
+    if (!is_profiling_enabled()) return status::invalid_arguments;
+    profiler_->reset();
+    return status::success;
+}
+
+status_t cpu_stream_t::get_profiling_data(profiling_data_kind_t data_kind,
+        int *num_entries, uint64_t *data) const {
+    if (!is_profiling_enabled()) return status::invalid_arguments;
+    return profiler_->get_info(data_kind, num_entries, data);
+}
+
+status_t cpu_stream_t::notify_profiling_complete() const {
+    if (!is_profiling_enabled()) return status::invalid_arguments;
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -27,20 +27,38 @@
 #include "common/dnnl_thread.hpp"
 #include "common/stream.hpp"
 
+#include "cpu/cpu_stream_executor.hpp"
+#include "cpu/cpu_stream_profiler.hpp"
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
 
 struct cpu_stream_t : public stream_t {
     cpu_stream_t(engine_t *engine, impl::stream_impl_t *stream_impl)
-        : stream_t(engine, stream_impl) {}
+        : stream_t(engine, stream_impl) {
+        if (is_profiling_enabled())
+            profiler_ = utils::make_unique<cpu_stream_profiler_t>();
+        if (flags() & stream_flags::out_of_order) init_executor();
+    }
     ~cpu_stream_t() override = default;
 
     dnnl::impl::status_t wait() override {
-        // CPU execution is synchronous so return immediately
-        return dnnl::impl::status::success;
+        // In-order CPU execution is synchronous so return immediately
+        if (!executor_) return dnnl::impl::status::success;
+        return executor_->wait();
     }
 
+    dnnl::impl::status_t enqueue_primitive(
+            const primitive_iface_t *primitive_iface,
+            dnnl::impl::exec_ctx_t &ctx) override;
+
+    dnnl::impl::status_t reset_profiling() override;
+    dnnl::impl::status_t get_profiling_data(
+            dnnl::impl::profiling_data_kind_t data_kind, int *num_entries,
+            uint64_t *data) const override;
+    dnnl::impl::status_t notify_profiling_complete() const override;
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     cpu_stream_t(engine_t *engine,
             dnnl::threadpool_interop::threadpool_iface *threadpool)
@@ -56,6 +74,18 @@ struct cpu_stream_t : public stream_t {
         threadpool_utils::deactivate_threadpool();
     }
 #endif
+
+private:
+    void init_executor();
+    // Executes the primitive on the calling thread.
+    dnnl::impl::status_t execute_primitive(
+            const primitive_iface_t *primitive_iface,
+            dnnl::impl::exec_ctx_t &ctx);
+
+    std::unique_ptr<cpu_stream_profiler_t> profiler_;
+    // The executor is declared last so that it is destroyed first, after
+    // the pending primitives complete.
+    std::unique_ptr<cpu_stream_executor_t> executor_;
 };
 
 } // namespace cpu
@@ -0,0 +1,152 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "common/memory.hpp"
+#include "common/memory_storage.hpp"
+#include "common/primitive_iface.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_stream_executor.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+const void *get_handle(const memory_storage_t *storage) {
+    void *handle = nullptr;
+    if (storage) storage->get_data_handle(&handle);
+    return handle;
+}
+
+bool contains(const std::vector<const void *> &v, const void *handle) {
+    return std::find(v.begin(), v.end(), handle) != v.end();
+}
+} // namespace
+
+cpu_stream_executor_t::task_t::task_t(
+        const primitive_iface_t *primitive_iface, const exec_ctx_t &ctx)
+    : primitive_iface(primitive_iface)
+    , ctx(ctx, exec_args_t(ctx.args()))
+    , is_running(false) {
+    for (const auto &arg : ctx.args()) {
+        const memory_t *mem = arg.second.mem;
+        if (!mem) continue;
+        auto &handles = arg.second.is_const ? reads : writes;
+        for (int i = 0; i < (int)mem->get_num_handles(); i++) {
+            const void *handle = get_handle(mem->memory_storage(i));
+            if (handle) handles.push_back(handle);
+        }
+    }
+    // A scratchpad managed by the library may be shared by several
+    // primitives, so it is treated as one more output.
+    const void *scratchpad
+            = get_handle(primitive_iface->scratchpad_memory_storage());
+    if (scratchpad) writes.push_back(scratchpad);
+}
+
+bool cpu_stream_executor_t::task_t::conflicts_with(const task_t &other) const {
+    for (const void *handle : writes)
+        if (contains(other.reads, handle) || contains(other.writes, handle))
+            return true;
+    for (const void *handle : reads)
+        if (contains(other.writes, handle)) return true;
+    return false;
+}
+
+cpu_stream_executor_t::cpu_stream_executor_t(
+        int nworkers, const execute_func_t &execute)
+    : execute_(execute) {
+    for (int i = 0; i < nworkers; i++)
+        workers_.emplace_back([this] { worker_loop(); });
+}
+
+cpu_stream_executor_t::~cpu_stream_executor_t() {
+    wait();
+    {
+        std::lock_guard<std::mutex> guard(m_);
+        is_stopped_ = true;
+    }
+    worker_cv_.notify_all();
+    for (auto &w : workers_)
+        w.join();
+}
+
+status_t cpu_stream_executor_t::submit(
+        const primitive_iface_t *primitive_iface, const exec_ctx_t &ctx) {
+    auto task = utils::make_unique<task_t>(primitive_iface, ctx);
+    {
+        std::lock_guard<std::mutex> guard(m_);
+        tasks_.push_back(std::move(task));
+    }
+    worker_cv_.notify_one();
+    return status::success;
+}
+
+status_t cpu_stream_executor_t::wait() {
+    std::unique_lock<std::mutex> lock(m_);
+    wait_cv_.wait(lock, [this] { return tasks_.empty(); });
+    const status_t status = status_;
+    status_ = status::success;
+    return status;
+}
+
+cpu_stream_executor_t::task_t *cpu_stream_executor_t::get_ready_task() {
+    // Tasks are checked in the submission order, so a task never overtakes
+    // an earlier one it conflicts with.
+    for (auto it = tasks_.begin(); it != tasks_.end(); ++it) {
+        task_t &task = **it;
+        if (task.is_running) continue;
+        bool is_ready = true;
+        for (auto prev = tasks_.begin(); prev != it && is_ready; ++prev)
+            is_ready = !task.conflicts_with(**prev);
+        if (is_ready) return &task;
+    }
+    return nullptr;
+}
+
+void cpu_stream_executor_t::worker_loop() {
+    std::unique_lock<std::mutex> lock(m_);
+    while (true) {
+        task_t *task = nullptr;
+        worker_cv_.wait(lock, [&] {
+            task = get_ready_task();
+            return task || is_stopped_;
+        });
+        if (!task) return;
+
+        task->is_running = true;
+        lock.unlock();
+        const status_t status = execute_(task->primitive_iface, task->ctx);
+        lock.lock();
+
+        if (status_ == status::success) status_ = status;
+        tasks_.remove_if([&](const std::unique_ptr<task_t> &t) {
+            return t.get() == task;
+        });
+        // The completed task may have been the last one blocking others.
+        worker_cv_.notify_all();
+        if (tasks_.empty()) wait_cv_.notify_all();
+    }
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
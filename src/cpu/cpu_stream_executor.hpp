@@ -0,0 +1,91 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_STREAM_EXECUTOR_HPP
+#define CPU_CPU_STREAM_EXECUTOR_HPP
+
+#include <condition_variable>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_exec_types.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Executes primitives submitted to an out-of-order CPU stream on a pool of
+// worker threads. A primitive starts as soon as it doesn't conflict with any
+// earlier primitive which is not completed yet. Two primitives conflict when
+// one of them writes a buffer the other one reads or writes. Buffers are
+// identified by their base pointers, so views of the same buffer conflict
+// even if they don't overlap.
+struct cpu_stream_executor_t {
+    using execute_func_t
+            = std::function<status_t(const primitive_iface_t *, exec_ctx_t &)>;
+
+    cpu_stream_executor_t(int nworkers, const execute_func_t &execute);
+    ~cpu_stream_executor_t();
+
+    // Enqueues the primitive. The context is copied, so the caller doesn't
+    // have to keep it alive.
+    status_t submit(
+            const primitive_iface_t *primitive_iface, const exec_ctx_t &ctx);
+
+    // Blocks until all the submitted primitives are completed. Returns the
+    // first failure status since the previous call.
+    status_t wait();
+
+private:
+    struct task_t {
+        task_t(const primitive_iface_t *primitive_iface, const exec_ctx_t &ctx);
+
+        bool conflicts_with(const task_t &other) const;
+
+        const primitive_iface_t *primitive_iface;
+        exec_ctx_t ctx;
+        std::vector<const void *> reads;
+        std::vector<const void *> writes;
+        bool is_running;
+    };
+
+    // Returns the first task which can be started or nullptr.
+    task_t *get_ready_task();
+    void worker_loop();
+
+    execute_func_t execute_;
+
+    std::mutex m_;
+    std::condition_variable worker_cv_;
+    std::condition_variable wait_cv_;
+    std::list<std::unique_ptr<task_t>> tasks_;
+    std::vector<std::thread> workers_;
+    bool is_stopped_ = false;
+    status_t status_ = status::success;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(cpu_stream_executor_t);
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,85 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <chrono>
+
+#include "cpu/cpu_stream_profiler.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+uint64_t get_nsec() {
+    return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch())
+                    .count());
+}
+} // namespace
+
+cpu_stream_profiler_t::entry_t cpu_stream_profiler_t::start() {
+    entry_t entry {};
+    entry.beg_nsec = get_nsec();
+    entry.beg_cycles = platform::get_timestamp();
+    return entry;
+}
+
+void cpu_stream_profiler_t::stop(entry_t &entry) {
+    entry.end_cycles = platform::get_timestamp();
+    entry.end_nsec = get_nsec();
+    std::lock_guard<std::mutex> guard(m_);
+    entries_.push_back(entry);
+}
+
+void cpu_stream_profiler_t::reset() {
+    std::lock_guard<std::mutex> guard(m_);
+    entries_.clear();
+}
+
+status_t cpu_stream_profiler_t::get_info(profiling_data_kind_t data_kind,
+        int *num_entries, uint64_t *data) const {
+    if (!num_entries) return status::invalid_arguments;
+
+    std::lock_guard<std::mutex> guard(m_);
+    if (!data) {
+        *num_entries = (int)entries_.size();
+        return status::success;
+    }
+
+    // Each primitive execution is a single entry, so the per kernel data
+    // matches the per primitive one.
+    int idx = 0;
+    for (const auto &e : entries_) {
+        switch ((int)data_kind) {
+            case profiling_data_kind::time:
+            case profiling_data_kind::time_per_kernel:
+                data[idx] = e.end_nsec - e.beg_nsec;
+                break;
+            case profiling_data_kind::cycles:
+                data[idx] = e.end_cycles - e.beg_cycles;
+                break;
+            default: return status::invalid_arguments;
+        }
+        idx++;
+    }
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
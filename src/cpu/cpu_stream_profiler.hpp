@@ -0,0 +1,60 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_STREAM_PROFILER_HPP
+#define CPU_CPU_STREAM_PROFILER_HPP
+
+#include <mutex>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Collects the execution time of each primitive executed on a CPU stream.
+// An entry is recorded right after the primitive returns on the thread that
+// executed it, so no events have to be tracked.
+struct cpu_stream_profiler_t {
+    struct entry_t {
+        uint64_t beg_nsec;
+        uint64_t end_nsec;
+        // Timestamp counter values (rdtsc on x64).
+        uint64_t beg_cycles;
+        uint64_t end_cycles;
+    };
+
+    // Captures the begin timestamps of an execution.
+    static entry_t start();
+    // Captures the end timestamps of an execution and records the entry.
+    void stop(entry_t &entry);
+
+    void reset();
+
+    status_t get_info(profiling_data_kind_t data_kind, int *num_entries,
+            uint64_t *data) const;
+
+private:
+    mutable std::mutex m_;
+    std::vector<entry_t> entries_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -273,6 +273,106 @@ dnnl_status_t gemm_s8s8s32(const char *transa, const char *transb,
             B, LDB, bo, beta, C, LDC, co);
 }
 
+namespace {
+// Checks the problems of a batch. Packed matrices are not supported.
+template <typename a_type, typename b_type, typename c_type>
+dnnl_status_t check_gemm_batch_input(dim_t batch,
+        const gemm_batch_problem_t<a_type, b_type, c_type> *problems,
+        bool is_int8) {
+    if (batch < 0 || (batch > 0 && problems == nullptr))
+        return dnnl_invalid_arguments;
+
+    for (dim_t ib = 0; ib < batch; ib++) {
+        const auto &p = problems[ib];
+        if (utils::one_of(p.transa, 'P', 'p')
+                || utils::one_of(p.transb, 'P', 'p'))
+            return dnnl_invalid_arguments;
+        dnnl_status_t status = is_int8
+                ? check_gemm_x8x8x32_input(&p.offsetc, &p.transa, &p.transb,
+                        &p.m, &p.n, &p.k, p.a, &p.lda, p.b, &p.ldb, p.c,
+                        &p.ldc, &p.alpha, &p.beta, false)
+                : check_gemm_input(&p.transa, &p.transb, &p.m, &p.n, &p.k, p.a,
+                        &p.lda, p.b, &p.ldb, p.c, &p.ldc, &p.alpha, &p.beta,
+                        false);
+        if (status != dnnl_success) return status;
+    }
+    return dnnl_success;
+}
+
+// Computes the problems of a batch one after another when no batched
+// implementation is available.
+template <typename a_type, typename b_type, typename c_type, typename F>
+dnnl_status_t gemm_batch_loop(dim_t batch,
+        const gemm_batch_problem_t<a_type, b_type, c_type> *problems,
+        const F &gemm) {
+    for (dim_t ib = 0; ib < batch; ib++) {
+        dnnl_status_t status = gemm(problems[ib]);
+        if (status != dnnl_success) return status;
+    }
+    return dnnl_success;
+}
+} // namespace
+
+dnnl_status_t extended_sgemm_batch(dim_t batch,
+        const gemm_batch_problem_t<float, float, float> *problems) {
+    dnnl_status_t status = check_gemm_batch_input(batch, problems, false);
+    if (status != dnnl_success) return status;
+
+#if !defined(USE_CBLAS) && DNNL_X64 && !__BUILD_GEMM_NONE
+    if (mayiuse(sse41)) {
+        auto status = gemm_batch_driver(batch, problems);
+        if (status != status::unimplemented) return status;
+    }
+#endif
+
+    return gemm_batch_loop(batch, problems,
+            [](const gemm_batch_problem_t<float, float, float> &p) {
+                return extended_sgemm(&p.transa, &p.transb, &p.m, &p.n, &p.k,
+                        &p.alpha, p.a, &p.lda, p.b, &p.ldb, &p.beta, p.c,
+                        &p.ldc, nullptr, false);
+            });
+}
+
+dnnl_status_t gemm_s8u8s32_batch(dim_t batch,
+        const gemm_batch_problem_t<int8_t, uint8_t, int32_t> *problems) {
+    dnnl_status_t status = check_gemm_batch_input(batch, problems, true);
+    if (status != dnnl_success) return status;
+
+#if !USE_MKL_IGEMM && DNNL_X64 && !__BUILD_GEMM_NONE
+    if (mayiuse(sse41)) {
+        auto status = gemm_batch_driver(batch, problems);
+        if (status != status::unimplemented) return status;
+    }
+#endif
+
+    return gemm_batch_loop(batch, problems,
+            [](const gemm_batch_problem_t<int8_t, uint8_t, int32_t> &p) {
+                return gemm_s8u8s32(&p.transa, &p.transb, &p.offsetc, &p.m,
+                        &p.n, &p.k, &p.alpha, p.a, &p.lda, &p.ao, p.b, &p.ldb,
+                        &p.bo, &p.beta, p.c, &p.ldc, p.co);
+            });
+}
+
+dnnl_status_t gemm_s8s8s32_batch(dim_t batch,
+        const gemm_batch_problem_t<int8_t, int8_t, int32_t> *problems) {
+    dnnl_status_t status = check_gemm_batch_input(batch, problems, true);
+    if (status != dnnl_success) return status;
+
+#if DNNL_X64 && !__BUILD_GEMM_NONE
+    if (mayiuse(avx512_core) && __BUILD_GEMM_AVX512) {
+        auto status = gemm_batch_driver(batch, problems);
+        if (status != status::unimplemented) return status;
+    }
+#endif
+
+    return gemm_batch_loop(batch, problems,
+            [](const gemm_batch_problem_t<int8_t, int8_t, int32_t> &p) {
+                return gemm_s8s8s32(&p.transa, &p.transb, &p.offsetc, &p.m,
+                        &p.n, &p.k, &p.alpha, p.a, &p.lda, &p.ao, p.b, &p.ldb,
+                        &p.bo, &p.beta, p.c, &p.ldc, p.co);
+            });
+}
+
 dnnl_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
         const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
         const bfloat16_t *A, const dim_t *lda, const bfloat16_t *B,
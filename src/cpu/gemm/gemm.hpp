@@ -74,6 +74,36 @@ dnnl_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
         const bfloat16_t *A, const dim_t *lda, const bfloat16_t *B,
         const dim_t *ldb, const float *beta, float *C, const dim_t *ldc);
 
+// A single problem of a batch of gemm problems. The fields follow the
+// column-major convention of the functions above.
+template <typename a_type, typename b_type, typename c_type>
+struct gemm_batch_problem_t {
+    char transa, transb, offsetc;
+    dim_t m, n, k;
+    float alpha;
+    const a_type *a;
+    dim_t lda;
+    a_type ao;
+    const b_type *b;
+    dim_t ldb;
+    b_type bo;
+    float beta;
+    c_type *c;
+    dim_t ldc;
+    const c_type *co;
+};
+
+// Batched versions of the functions above. All the problems are computed
+// within a single parallel region when possible.
+dnnl_status_t extended_sgemm_batch(
+        dim_t batch, const gemm_batch_problem_t<float, float, float> *problems);
+
+dnnl_status_t gemm_s8u8s32_batch(dim_t batch,
+        const gemm_batch_problem_t<int8_t, uint8_t, int32_t> *problems);
+
+dnnl_status_t gemm_s8s8s32_batch(dim_t batch,
+        const gemm_batch_problem_t<int8_t, int8_t, int32_t> *problems);
+
 #if defined(USE_CBLAS)
 #define GEMM_IMPL_STR "x64:gemm:blas"
 #elif DNNL_X64
@@ -26,6 +26,8 @@
 #include "cpu/matmul/ref_sparse_matmul.hpp"
 
 #if DNNL_X64
+#include "cpu/x64/matmul/brgemm_bsr_matmul.hpp"
+#include "cpu/x64/matmul/brgemm_grouped_matmul.hpp"
 #include "cpu/x64/matmul/brgemm_matmul.hpp"
 #include "cpu/x64/matmul/jit_uni_sparse_matmul.hpp"
 using namespace dnnl::impl::cpu::x64::matmul;
@@ -59,6 +61,7 @@ constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         CPU_INSTANCE_AARCH64_ACL(acl_matmul_t)
         CPU_INSTANCE_AARCH64(brgemm_matmul_t<sve_256>)
         CPU_INSTANCE_AARCH64(jit_int8_matmul_t)
+        CPU_INSTANCE_AVX2(brgemm_grouped_matmul_t)
         CPU_INSTANCE_AMX(brgemm_matmul_t<avx10_2_512_amx_2>)
         CPU_INSTANCE_AMX(brgemm_matmul_t<avx512_core_amx_fp16>)
         CPU_INSTANCE_AMX(brgemm_matmul_t<avx512_core_amx>)
@@ -76,6 +79,7 @@ constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         CPU_INSTANCE_AVX2(brgemm_matmul_t<avx2>)
         CPU_INSTANCE(ref_matmul_t)
         CPU_INSTANCE(ref_matmul_int8_t)
+        CPU_INSTANCE_AVX512(brgemm_bsr_matmul_t)
         CPU_INSTANCE_X64(jit_uni_sparse_matmul_t)
         CPU_INSTANCE(ref_sparse_matmul_t)
         /* eol */
@@ -18,6 +18,8 @@
 #ifndef CPU_MATMUL_MATMUL_UTILS_HPP
 #define CPU_MATMUL_MATMUL_UTILS_HPP
 
+#include <float.h>
+
 #include "common/memory_desc_wrapper.hpp"
 #include "common/tag_traits.hpp"
 #include "common/utils.hpp"
@@ -30,6 +32,13 @@ namespace cpu {
 
 namespace matmul {
 
+// Returns the scale of a row of the source quantized on the fly, so that the
+// largest magnitude of the row maps to the largest value of `dt`.
+inline float src_dyn_quant_scale(float absmax, data_type_t dt) {
+    const float qmax = dt == data_type::s8 ? 127.f : 255.f;
+    return nstl::max(absmax / qmax, FLT_MIN);
+}
+
 struct matmul_helper_t {
     using mdw_t = const memory_desc_wrapper;
 
@@ -26,6 +26,7 @@
 
 #include "cpu/cpu_primitive.hpp"
 #include "cpu/ref_io_helper.hpp"
+#include "cpu/simple_q10n.hpp"
 
 #include "cpu/matmul/matmul_utils.hpp"
 #include "cpu/matmul/ref_matmul.hpp"
@@ -45,6 +46,11 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
     const auto seed = CTX_IN_MEM(const uint32_t *, DNNL_ARG_ATTR_DROPOUT_SEED);
     const auto rnd_seed
             = CTX_IN_MEM(const uint32_t *, DNNL_ARG_ATTR_ROUNDING_SEED);
+    const auto ragged_lengths
+            = CTX_IN_MEM(const int32_t *, DNNL_ARG_ATTR_RAGGED_LENGTHS);
+    const auto grouped_offsets
+            = CTX_IN_MEM(const int32_t *, DNNL_ARG_ATTR_GROUPED_OFFSETS);
+    const auto wei_lut = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_WEIGHTS_LUT);
     auto dropout_mask = CTX_OUT_CLEAN_MEM(
             unsigned char *, DNNL_ARG_ATTR_DROPOUT_MASK, status);
     CHECK(status);
@@ -79,12 +85,19 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
     const dim_t N = helper.N();
     const dim_t K = helper.K();
     const dim_t batch = helper.batch();
+    // Number of flattened batch entries sharing a length of a ragged batch.
+    const dim_t ragged_inner_batch = batch / dst_d.dims()[0];
 
-    // Weights decompression
+    // Weights decompression. Floating point weights of a smaller type than
+    // the source are decompressed as well, so that the scales of groups along
+    // K (as in MX formats) apply to the weights.
     const bool with_wei_decompression
-            = utils::one_of(weights_d.data_type(), data_type::s8, data_type::u8,
-                      data_type::s4, data_type::u4)
-            && pd()->attr()->fpmath_.apply_to_int_;
+            = (utils::one_of(weights_d.data_type(), data_type::s8,
+                       data_type::u8, data_type::s4, data_type::u4)
+                      && pd()->attr()->fpmath_.apply_to_int_)
+            || (utils::one_of(weights_d.data_type(), data_type::f8_e5m2,
+                        data_type::f8_e4m3, data_type::f4_e2m1)
+                    && weights_d.data_type() != src_d.data_type());
     const auto &attr_zps = pd()->attr()->zero_points_;
     const bool with_wei_zero_points
             = !attr_zps.has_default_values(DNNL_ARG_WEIGHTS);
@@ -92,6 +105,7 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
     const auto &wei_zp_dt = attr_zps.get_data_type(DNNL_ARG_WEIGHTS);
     const auto wei_zp_group_k = attr_zps.get_group(DNNL_ARG_WEIGHTS, 0);
     const auto wei_zp_group_n = attr_zps.get_group(DNNL_ARG_WEIGHTS, 1);
+    const dim_t wei_lut_group = pd()->attr()->weights_lut_group_;
     // Initialize a memory desc for quant entries for easier offset calculation.
     memory_desc_t wei_zp_md {};
     CHECK(matmul_helper_t::get_quant_md(wei_zp_md, ndims, weights_d.dims(),
@@ -126,6 +140,10 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
 
     auto dst_rnd_mode = pd()->attr()->rounding_mode_.get(DNNL_ARG_DST);
 
+    // Source quantized on the fly with a scale per row.
+    const data_type_t src_dyn_quant_dt = pd()->attr()->src_dyn_quant_dt_;
+    const bool with_src_dyn_quant = src_dyn_quant_dt != data_type::undef;
+
     // mm kernel
     auto ker = [&](const dims_t dst_dims_idx, dim_t m, dim_t n) {
         float acc = 0;
@@ -137,17 +155,39 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
         weights_dims_idx[ndims - 1] = n;
         auto &src_k_dim = src_dims_idx[ndims - 1];
         auto &wei_k_dim = weights_dims_idx[ndims - 2];
+
+        float src_row_scale = 1.f;
+        if (with_src_dyn_quant) {
+            float absmax = 0.f;
+            for (dim_t k = 0; k < K; ++k) {
+                src_k_dim = k;
+                const float s = io::load_float_value(
+                        src_d.data_type(), src, src_d.off_v(src_dims_idx));
+                absmax = nstl::max(absmax, std::fabs(s));
+            }
+            src_row_scale = src_dyn_quant_scale(absmax, src_dyn_quant_dt);
+        }
+        const float src_row_inv_scale = 1.f / src_row_scale;
+
         for (dim_t k = 0; k < K; ++k) {
             src_k_dim = k;
             wei_k_dim = k;
             const auto src_off = src_d.off_v(src_dims_idx);
             const auto weights_off = weights_d.off_v(weights_dims_idx);
-            const float s
-                    = io::load_float_value(src_d.data_type(), src, src_off);
+            float s = io::load_float_value(src_d.data_type(), src, src_off);
+            if (with_src_dyn_quant)
+                s = src_dyn_quant_dt == data_type::s8
+                        ? (float)q10n::saturate_and_round<int8_t>(
+                                s * src_row_inv_scale)
+                        : (float)q10n::saturate_and_round<uint8_t>(
+                                s * src_row_inv_scale);
             float w = io::load_float_value(
                     weights_d.data_type(), weights, weights_off);
             // weights decompression should happen before the operation
             if (with_wei_decompression) {
+                // The weights value is an index into a 16-entry table.
+                if (wei_lut_group > 0)
+                    w = wei_lut[(k / wei_lut_group) * 16 + (dim_t)w];
                 if (with_wei_zero_points) {
                     const dim_t wei_zp_offset = matmul_helper_t::get_quant_off(
                             weights_dims_idx, ndims, wei_zp_mask,
@@ -171,7 +211,7 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
             }
             acc += s * w;
         }
-        return acc;
+        return acc * src_row_scale;
     };
 
     // bias section
@@ -188,9 +228,22 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
     // computations Note: If dst type is < 8 bits, we cannot split a
     // byte during store or we get a race condition. To simplify
     // logic, we limit parallelization on M and N by a factor of 2.
-    parallel_nd(batch, utils::div_up(M, 2), utils::div_up(N, 2),
+    // Work is scheduled dynamically as the rows of a ragged batch may be
+    // skipped, which leaves the static partitioning unbalanced.
+    parallel_nd_dynamic(batch, utils::div_up(M, 2), utils::div_up(N, 2),
             [&](dim_t mb, dim_t m_, dim_t n_) {
-                for_(int m = 2 * m_; m < std::min<int>(2 * (m_ + 1), M); m++)
+                // Rows of a ragged batch entry beyond its length and rows of
+                // a grouped batch entry outside of its range are skipped.
+                dim_t M_begin = 0, M_end = M;
+                if (ragged_lengths)
+                    M_end = nstl::min<dim_t>(
+                            M, ragged_lengths[mb / ragged_inner_batch]);
+                if (grouped_offsets) {
+                    M_begin = nstl::max<dim_t>(0, grouped_offsets[mb]);
+                    M_end = nstl::min<dim_t>(M, grouped_offsets[mb + 1]);
+                }
+                for_(int m = std::max<int>(2 * m_, M_begin);
+                        m < std::min<int>(2 * (m_ + 1), M_end); m++)
                 for (int n = 2 * n_; n < std::min<int>(2 * (n_ + 1), N); n++) {
                     dims_t dst_dims_idx;
                     // account for M, N dims for index calculations
@@ -62,11 +62,18 @@ struct ref_matmul_t : public primitive_t {
                     VERBOSE_UNSUPPORTED_DT);
             VDISPATCH_MATMUL((src_type == wei_type
                                      || utils::one_of(wei_type, bf16, f16, u8,
-                                             s8, u4, s4, f4_e3m0)),
+                                             s8, u4, s4, f4_e3m0)
+                                     /* fp8 and fp4 weights decompression */
+                                     || (utils::one_of(wei_type, f8_e5m2,
+                                                 f8_e4m3, f4_e2m1)
+                                             && attr_.mayiconvert(
+                                                     wei_type, src_type))),
                     VERBOSE_UNSUPPORTED_DT);
-            /* int8 weights decompression support */
+            /* int8 weights decompression or dynamic quantization support */
             VDISPATCH_MATMUL(IMPLICATION(utils::one_of(wei_type, u8, s8),
-                                     attr_.mayiconvert(wei_type, src_type)),
+                                     attr_.mayiconvert(wei_type, src_type)
+                                             || attr_.src_dyn_quant_dt_
+                                                     != undef),
                     VERBOSE_UNSUPPORTED_DT);
             VDISPATCH_MATMUL(IMPLICATION(src_type == f32, dst_type == f32),
                     VERBOSE_UNSUPPORTED_DT);
@@ -100,7 +107,11 @@ struct ref_matmul_t : public primitive_t {
                                     | smask_t::zero_points_groups
                                     | smask_t::post_ops | smask_t::sum_dt
                                     | smask_t::fpmath_mode | smask_t::dropout
-                                    | smask_t::rounding_mode,
+                                    | smask_t::rounding_mode
+                                    | smask_t::ragged_batch
+                                    | smask_t::grouped_batch
+                                    | smask_t::weights_lut
+                                    | smask_t::src_dyn_quant,
                             dst_type),
                     VERBOSE_UNSUPPORTED_ATTR);
             VDISPATCH_MATMUL(attr_.post_ops_.check_sum_consistency(dst_type,
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <vector>
+
 #include "common/dnnl_thread.hpp"
 #include "common/math_utils.hpp"
 #include "common/type_helpers.hpp"
@@ -43,6 +45,16 @@ status_t ref_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
     const data_type_t mm_dt = src_d.data_type();
     auto scratchpad = ctx.get_scratchpad_grantor();
 
+    if (weights_d.is_sparse_desc()
+            && weights_d.encoding() == sparse_encoding::bsr) {
+        const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+        const auto wei_values = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS, 0);
+        auto wei_indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 1);
+        auto wei_pointers = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 2);
+        run_bsr_kernel(ctx, src, wei_values, wei_indices, wei_pointers, dst);
+        return status::success;
+    }
+
     parallel_nd(M, N, [&](dim_t i, dim_t j) {
         const dim_t dst_idx = i * N + j;
         io::store_float_value(dst_d.data_type(), 0.0f, dst, dst_idx);
@@ -197,6 +209,43 @@ void ref_sparse_matmul_t::run_csr_kernel(const void *dmat, const void *values,
     }
 }
 
+void ref_sparse_matmul_t::run_bsr_kernel(const exec_ctx_t &ctx,
+        const void *src, const void *values, const int32_t *indices,
+        const int32_t *pointers, void *dst) const {
+    const auto src_d = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
+    const auto wei_d = ctx.memory_mdw(DNNL_ARG_WEIGHTS, pd()->weights_md());
+    const auto dst_d = ctx.memory_mdw(DNNL_ARG_DST, pd()->dst_md());
+
+    const dim_t M = dst_d.dims()[0];
+    const dim_t N = dst_d.dims()[1];
+    const dim_t K = src_d.dims()[1];
+    const dim_t R = wei_d.block_dims()[0];
+    const dim_t C = wei_d.block_dims()[1];
+    const dim_t nb_k = K / R;
+
+    // The weights are K x N, so block rows go along the reduction and the
+    // stored blocks of a block row update C consecutive destination columns.
+    parallel_nd(M, [&](dim_t m) {
+        std::vector<float> acc(N, 0.f);
+        for (dim_t kb = 0; kb < nb_k; kb++) {
+            for (dim_t p = pointers[kb]; p < pointers[kb + 1]; p++) {
+                const dim_t n0 = indices[p] * C;
+                for (dim_t r = 0; r < R; r++) {
+                    const float a = io::load_float_value(
+                            src_d.data_type(), src, m * K + kb * R + r);
+                    for (dim_t c = 0; c < C; c++) {
+                        const float b = io::load_float_value(wei_d.data_type(),
+                                values, (p * R + r) * C + c);
+                        acc[n0 + c] += a * b;
+                    }
+                }
+            }
+        }
+        for (dim_t n = 0; n < N; n++)
+            io::store_float_value(dst_d.data_type(), acc[n], dst, m * N + n);
+    });
+}
+
 } // namespace matmul
 } // namespace cpu
 } // namespace impl
@@ -57,13 +57,24 @@ struct ref_sparse_matmul_t : public primitive_t {
             VDISPATCH_MATMUL(IMPLICATION(wei_d.is_sparse_desc(),
                                      utils::one_of(wei_d.encoding(),
                                              sparse_encoding::csr,
-                                             sparse_encoding::coo)),
+                                             sparse_encoding::coo,
+                                             sparse_encoding::bsr)),
                     VERBOSE_UNSUPPORTED_SPARSE_CFG);
 
+            // BSR weights are also supported with bf16 and int8 data.
+            const bool is_bsr = wei_d.is_sparse_desc()
+                    && wei_d.encoding() == sparse_encoding::bsr;
             VDISPATCH_MATMUL(
                     utils::everyone_is(f16, src_type, wei_type, dst_type)
                             || utils::everyone_is(
-                                    f32, src_type, wei_type, dst_type),
+                                    f32, src_type, wei_type, dst_type)
+                            || (is_bsr
+                                    && (utils::everyone_is(bf16, src_type,
+                                                wei_type, dst_type)
+                                            || (utils::one_of(src_type, u8, s8)
+                                                    && wei_type == s8
+                                                    && utils::one_of(dst_type,
+                                                            f32, s32, bf16)))),
                     VERBOSE_UNSUPPORTED_DT_CFG);
 
             if (src_d.is_sparse_desc()) {
@@ -86,7 +97,9 @@ struct ref_sparse_matmul_t : public primitive_t {
                         VERBOSE_UNSUPPORTED_SPARSE_CFG);
 
                 VDISPATCH_MATMUL(
-                        IMPLICATION(sparse_mem_encoding == sparse_encoding::csr,
+                        IMPLICATION(utils::one_of(sparse_mem_encoding,
+                                            sparse_encoding::csr,
+                                            sparse_encoding::bsr),
                                 utils::everyone_is(s32, wei_d.metadata_type(0),
                                         wei_d.metadata_type(1))),
                         VERBOSE_UNSUPPORTED_SPARSE_CFG);
@@ -148,6 +161,12 @@ struct ref_sparse_matmul_t : public primitive_t {
             const dim_t M, const dim_t N, const dim_t K,
             const data_type_t mm_dt, bool is_src_sparse) const;
 
+    // Executes the matrix multiplication with BSR weights. Every row of the
+    // destination is accumulated over the stored blocks of the weights.
+    void run_bsr_kernel(const exec_ctx_t &ctx, const void *src,
+            const void *values, const int32_t *indices,
+            const int32_t *pointers, void *dst) const;
+
     status_t execute(const exec_ctx_t &ctx) const override;
 
 private:
@@ -0,0 +1,89 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cfloat>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/ref_embedding_bag.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t ref_embedding_bag_t::execute_forward(const exec_ctx_t &ctx) const {
+    using namespace alg_kind;
+
+    status_t status = status::success;
+    const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC_0);
+    const auto indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC_1);
+    const auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC_2);
+    const auto weights = pd()->with_weights()
+            ? CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS)
+            : nullptr;
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+    const int src_scales_mask = pd()->attr()->scales_.get_mask(DNNL_ARG_SRC);
+
+    const memory_desc_wrapper src_d(pd()->src_md(0));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const auto alg = pd()->desc()->alg_kind;
+    const dim_t D = pd()->embedding_dim();
+    const dim_t nindices = pd()->num_indices();
+    const dim_t nbags = pd()->num_bags();
+
+    parallel_nd(nbags, D, [&](dim_t b, dim_t d) {
+        const dim_t begin = offsets[b];
+        const dim_t end = b + 1 < nbags ? offsets[b + 1] : nindices;
+
+        float acc = alg == embedding_bag_max ? -FLT_MAX : 0.f;
+        for (dim_t i = begin; i < end; i++) {
+            const dim_t row = indices[i];
+            float s = io::load_float_value(
+                    src_d.data_type(), src, src_d.off(row, d));
+            s *= src_scales[src_scales_mask ? row : 0];
+            if (weights) s *= weights[i];
+
+            if (alg == embedding_bag_max)
+                acc = nstl::max(acc, s);
+            else
+                acc += s;
+        }
+        // An empty bag produces zeros for every algorithm.
+        if (end <= begin)
+            acc = 0.f;
+        else if (alg == embedding_bag_mean)
+            acc /= (float)(end - begin);
+
+        io::store_float_value(dst_d.data_type(), acc, dst, dst_d.off(b, d));
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,86 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REF_EMBEDDING_BAG_HPP
+#define CPU_REF_EMBEDDING_BAG_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/cpu_embedding_bag_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct ref_embedding_bag_t : public primitive_t {
+    struct pd_t : public cpu_embedding_bag_pd_t {
+        using cpu_embedding_bag_pd_t::cpu_embedding_bag_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_embedding_bag_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+            const auto src_dt = src_md()->data_type;
+            const auto dst_dt = dst_md()->data_type;
+
+            VDISPATCH_EMBEDDING_BAG(
+                    utils::one_of(src_dt, f32, bf16, f16, s8, u8)
+                            && platform::has_data_type_support(src_dt),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_EMBEDDING_BAG(utils::one_of(dst_dt, f32, bf16, f16)
+                            && platform::has_data_type_support(dst_dt),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_EMBEDDING_BAG(
+                    IMPLICATION(with_weights(),
+                            weights_md()->data_type == f32),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_EMBEDDING_BAG(
+                    attr()->has_default_values(skip_mask_t::scales),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_EMBEDDING_BAG(
+                    set_default_params() == status::success,
+                    VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_EMBEDDING_BAG(aux_formats_ok(), VERBOSE_UNSUPPORTED_TAG);
+
+            return status::success;
+        }
+    };
+
+    ref_embedding_bag_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,150 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include <math.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/ref_sdpa.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t ref_sdpa_t::execute_ref(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    auto qry = CTX_IN_MEM(const void *, DNNL_ARG_QUERIES);
+    auto key = CTX_IN_MEM(const void *, DNNL_ARG_KEYS);
+    auto val = CTX_IN_MEM(const void *, DNNL_ARG_VALUES);
+    auto msk = CTX_IN_MEM(const void *, DNNL_ARG_ATTN_MASK);
+    auto scale = CTX_IN_MEM(const void *, DNNL_ARG_SCALE);
+    auto key_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_KEYS);
+    auto key_zp = CTX_IN_MEM(
+            const void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_KEYS);
+    auto val_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_VALUES);
+    auto val_zp = CTX_IN_MEM(
+            const void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_VALUES);
+    auto blk = CTX_IN_MEM(const void *, DNNL_ARG_KV_BLOCK_TABLE);
+    auto ragged_lengths
+            = CTX_IN_MEM(const int32_t *, DNNL_ARG_ATTR_RAGGED_LENGTHS);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+
+    const auto *d = pd()->desc();
+    const sdpa_loader_t load_qry(*pd()->qry_md(), qry);
+    sdpa_loader_t load_key(*pd()->key_md(), key, d->kq_scales, key_scales,
+            d->kq_zero_points, key_zp);
+    sdpa_loader_t load_val(*pd()->val_md(), val, d->vs_scales, val_scales,
+            d->vs_zero_points, val_zp);
+    load_key.set_block_table(*pd()->kv_block_table_md(), blk, 3);
+    load_val.set_block_table(*pd()->kv_block_table_md(), blk, 2);
+    const sdpa_loader_t load_msk(*pd()->attn_mask_md(), msk);
+    const sdpa_loader_t dst_off(*pd()->dst_md(), dst);
+
+    float attn_scale = 1.f;
+    if (pd()->with_attn_scale()) {
+        attn_scale = io::load_float_value(d->scale_dt, scale, 0);
+        if (d->invert_scale) attn_scale = 1.f / attn_scale;
+    }
+    const bool with_mask = pd()->with_attn_mask();
+    const bool inf_as_zero
+            = d->softmax_alg == alg_kind::softmax_accurate_inf_as_zero;
+    const auto dst_dt = pd()->dst_md()->data_type;
+
+    const dim_t MB = pd()->MB(), H = pd()->H();
+    const dim_t Q = d->queries(), D = d->head_size(), DV = d->values();
+    const dim_t k_blk = pd()->k_blk_;
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    float *scores_base = scratchpad.template get<float>(key_sdpa_scores);
+    float *acc_base = scratchpad.template get<float>(key_sdpa_acc);
+
+    parallel_nd_ext(pd()->nthr_, MB, H, Q,
+            [&](int ithr, int, dim_t mb, dim_t h, dim_t q) {
+        float *s = scores_base + ithr * k_blk;
+        float *acc = acc_base + ithr * DV;
+        const dim_t kh = pd()->kv_head(h);
+        const dim_t kmb = pd()->kv_mb(pd()->key_md(), mb);
+        const dim_t vmb = pd()->kv_mb(pd()->val_md(), mb);
+        // Queries beyond the length of a ragged batch are not computed.
+        const dim_t q_valid = pd()->valid_queries(ragged_lengths, mb);
+        if (q >= q_valid) return;
+        const dim_t k_end = pd()->causal_keys_end(
+                q, q_valid, pd()->valid_keys(ragged_lengths, mb));
+
+        float row_max = -INFINITY, row_sum = 0.f;
+        for (dim_t v = 0; v < DV; v++)
+            acc[v] = 0.f;
+
+        for (dim_t k0 = 0; k0 < k_end; k0 += k_blk) {
+            const dim_t kb = nstl::min(k_blk, k_end - k0);
+            float blk_max = -INFINITY;
+            for (dim_t k = 0; k < kb; k++) {
+                float sc = 0.f;
+                for (dim_t i = 0; i < D; i++)
+                    sc += load_qry(mb, h, q, i)
+                            * load_key(kmb, kh, i, k0 + k);
+                sc *= attn_scale;
+                if (with_mask) sc += load_msk(mb, h, q, k0 + k);
+                s[k] = sc;
+                blk_max = nstl::max(blk_max, sc);
+            }
+
+            // Skip blocks while every key seen so far is masked out.
+            const float new_max = nstl::max(row_max, blk_max);
+            if (new_max == -INFINITY) continue;
+
+            // Rescale the accumulated values to the new running maximum.
+            const float alpha = expf(row_max - new_max);
+            row_sum *= alpha;
+            for (dim_t v = 0; v < DV; v++)
+                acc[v] *= alpha;
+
+            for (dim_t k = 0; k < kb; k++) {
+                const float p = expf(s[k] - new_max);
+                row_sum += p;
+                for (dim_t v = 0; v < DV; v++)
+                    acc[v] += p * load_val(vmb, kh, k0 + k, v);
+            }
+            row_max = new_max;
+        }
+
+        // A row without visible keys is either zeroed or left undefined
+        // depending on the softmax algorithm.
+        const float inv_sum = row_sum > 0.f ? 1.f / row_sum
+                : inf_as_zero                ? 0.f
+                                             : NAN;
+        for (dim_t v = 0; v < DV; v++)
+            io::store_float_value(
+                    dst_dt, acc[v] * inv_sum, dst, dst_off.off(mb, h, q, v));
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
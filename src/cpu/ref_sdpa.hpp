@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REF_SDPA_HPP
+#define CPU_REF_SDPA_HPP
+
+#include <assert.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/cpu_sdpa_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Reference implementation. Each query row walks over the keys in blocks
+// keeping a running maximum and sum of the scores (online softmax), so the
+// memory used doesn't depend on the number of keys.
+struct ref_sdpa_t : public primitive_t {
+    struct pd_t : public cpu_sdpa_pd_t {
+        using cpu_sdpa_pd_t::cpu_sdpa_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_sdpa_t);
+
+        status_t init(engine_t *engine) {
+            CHECK(init_common(engine));
+            for (const auto *md : {qry_md(), key_md(), val_md(), dst_md()})
+                VDISPATCH_SDPA(platform::has_data_type_support(md->data_type),
+                        VERBOSE_UNSUPPORTED_DT);
+
+            k_blk_ = nstl::min<dim_t>(desc()->keys(), 64);
+            nthr_ = dnnl_get_max_threads();
+            init_scratchpad();
+
+            return status::success;
+        }
+
+        dim_t k_blk_ = 0;
+        int nthr_ = 0; // To not exceed the limit in execute used for set up.
+
+    private:
+        void init_scratchpad() {
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.template book<float>(
+                    memory_tracking::names::key_sdpa_scores, nthr_ * k_blk_);
+            scratchpad.template book<float>(
+                    memory_tracking::names::key_sdpa_acc,
+                    nthr_ * desc()->values());
+        }
+    };
+
+    ref_sdpa_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_ref(ctx);
+    }
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    status_t execute_ref(const exec_ctx_t &ctx) const;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -21,6 +21,7 @@
 #include <type_traits>
 
 #include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
 #include "common/memory_desc_wrapper.hpp"
 #include "common/primitive.hpp"
 #include "common/utils.hpp"
@@ -410,6 +411,8 @@ struct rnn_conf_t {
 
     bool diff_weights_overwrite = false;
     bool use_matmul = false;
+    // Executes independent cells of different layers concurrently.
+    bool use_wavefront = false;
 
     inline bool is_int8_conf() const {
         return is_signed_int8_conf() || is_unsigned_int8_conf();
@@ -918,6 +921,20 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
     rnn.merge_gemm_iter = !(rnn.is_brgemm || rnn.use_matmul)
             ? rnn.dst_layer_is_trivial_stride && !(rnn.is_fwd || is_gru)
             : false;
+
+    // A small batch can't keep all the threads busy within a single cell, so
+    // the cells of different layers that don't depend on each other are
+    // executed concurrently instead. The layer GEMM of each cell is computed
+    // separately then, since the inputs of a layer become available one
+    // iteration at a time. Cells using intermediate scratchpads other than
+    // gates are not executed this way.
+    rnn.use_wavefront = !(rnn.is_brgemm || rnn.use_matmul) && rnn.is_fwd
+            && is_f32 && rnn.n_layer > 1 && rnn.n_iter > 1 && rnn.mb < 16
+            && dnnl_get_max_threads() > 1
+            && utils::one_of(rd.cell_kind, alg_kind::vanilla_rnn,
+                    alg_kind::vanilla_lstm)
+            && !rnn.is_lstm_projection;
+    if (rnn.use_wavefront) rnn.merge_gemm_layer = false;
     rnn.force_nocopy = false;
 #if DNNL_X64
     rnn.force_nocopy = x64::mayiuse(x64::avx)
@@ -1162,8 +1179,10 @@ void set_workspace_sizes(rnn_conf_t &rnn, const rnn_desc_t &rd) {
             ? (size_t)rnn.n_layer * rnn.n_dir * rnn.n_iter * rnn.ws_ht_nld
                     * rnn.ws_ht_ld * sizeof(typename T::dst_iter_t)
             : (size_t)0;
-    rnn.n_iter_scratch_gates
-            = (rnn.merge_gemm_layer || rnn.merge_gemm_iter) ? rnn.n_iter : 1;
+    rnn.n_iter_scratch_gates = (rnn.merge_gemm_layer || rnn.merge_gemm_iter
+                                       || rnn.use_wavefront)
+            ? rnn.n_iter
+            : 1;
     rnn.scratch_gates_size = sizeof(typename T::scratch_t)
             * rnn.n_iter_scratch_gates * rnn.scratch_gates_nld
             * rnn.scratch_gates_ld;
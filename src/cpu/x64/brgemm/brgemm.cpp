@@ -165,6 +165,10 @@ void brgemm_kernel_execute_postops(const brgemm_kernel_t *brg_kernel, int bs,
     brgemm_p.b_zp_compensations = post_ops_data.b_zp_compensations;
     brgemm_p.c_zp_values = post_ops_data.c_zp_values;
     brgemm_p.ptr_dst_scales = post_ops_data.dst_scales;
+    brgemm_p.ptr_src_scales = post_ops_data.src_scales;
+    brgemm_p.ptr_dropout_mask = post_ops_data.dropout_mask;
+    brgemm_p.ptr_dropout_inv_q = post_ops_data.dropout_inv_q;
+    brgemm_p.ptr_rnd_bias = post_ops_data.rnd_bias;
     if (dynamic_values) {
         brgemm_p.dynamic_LDA = dynamic_values->dynamic_LDA;
         brgemm_p.dynamic_LDB = dynamic_values->dynamic_LDB;
@@ -208,6 +212,10 @@ void brgemm_kernel_execute_postops(const brgemm_kernel_t *brg_kernel, int bs,
     brgemm_p.a_zp_values = post_ops_data.a_zp_values;
     brgemm_p.c_zp_values = post_ops_data.c_zp_values;
     brgemm_p.ptr_dst_scales = post_ops_data.dst_scales;
+    brgemm_p.ptr_src_scales = post_ops_data.src_scales;
+    brgemm_p.ptr_dropout_mask = post_ops_data.dropout_mask;
+    brgemm_p.ptr_dropout_inv_q = post_ops_data.dropout_inv_q;
+    brgemm_p.ptr_rnd_bias = post_ops_data.rnd_bias;
     if (dynamic_values) {
         brgemm_p.dynamic_LDA = dynamic_values->dynamic_LDA;
         brgemm_p.dynamic_LDB = dynamic_values->dynamic_LDB;
@@ -748,6 +756,9 @@ int brgemm_cmp(const brgemm_desc_t &lhs, const brgemm_desc_t &rhs) {
 
     CMP_BRGEMM_FIELD(is_oc_scale);
     CMP_BRGEMM_FIELD(with_dst_scales);
+    CMP_BRGEMM_FIELD(with_src_scales);
+    CMP_BRGEMM_FIELD(with_dropout);
+    CMP_BRGEMM_FIELD(with_stochastic_round);
     CMP_BRGEMM_FIELD(bs_group);
 
     // Compare all non-pointer parameters of brgemm_attr_t except derived
@@ -818,6 +829,114 @@ bool brgemm_desc_t::operator<(const brgemm_desc_t &rhs) const {
     return (brgemm_cmp(*this, rhs) < 0);
 }
 
+size_t brgemm_desc_t::hash() const {
+    // The fields follow the ones compared in brgemm_cmp(), so descriptors
+    // equal within a brgemm primitive have the same hash.
+    size_t seed = 0;
+#define HASH_BRGEMM_FIELD(x) seed = hash_combine(seed, (x))
+
+    // Hash all non-pointer parameters of brgemm_desc_t except derived
+    HASH_BRGEMM_FIELD(bcast_dim);
+    HASH_BRGEMM_FIELD(load_dim);
+    HASH_BRGEMM_FIELD(reduce_dim);
+    HASH_BRGEMM_FIELD(LDA);
+    HASH_BRGEMM_FIELD(LDB);
+    HASH_BRGEMM_FIELD(LDC);
+    HASH_BRGEMM_FIELD(LDD);
+    HASH_BRGEMM_FIELD(isa_user);
+    HASH_BRGEMM_FIELD(isa_impl);
+    HASH_BRGEMM_FIELD(alpha);
+    HASH_BRGEMM_FIELD(beta);
+    HASH_BRGEMM_FIELD(dt_a);
+    HASH_BRGEMM_FIELD(dt_b);
+    HASH_BRGEMM_FIELD(dt_c);
+    HASH_BRGEMM_FIELD(dt_d);
+    HASH_BRGEMM_FIELD(dt_bias);
+    HASH_BRGEMM_FIELD(stride_a);
+    HASH_BRGEMM_FIELD(stride_b);
+    HASH_BRGEMM_FIELD(layout);
+    HASH_BRGEMM_FIELD(type);
+    HASH_BRGEMM_FIELD(is_dgmm);
+    HASH_BRGEMM_FIELD(with_sum);
+    HASH_BRGEMM_FIELD(req_cal_comp_pads);
+
+    HASH_BRGEMM_FIELD(sum_scale);
+    HASH_BRGEMM_FIELD(sum_zp);
+    HASH_BRGEMM_FIELD(sum_dt);
+    HASH_BRGEMM_FIELD(with_eltwise);
+    HASH_BRGEMM_FIELD(with_binary);
+    HASH_BRGEMM_FIELD(with_scales);
+
+    HASH_BRGEMM_FIELD(zp_type_a);
+    HASH_BRGEMM_FIELD(zp_type_b);
+    HASH_BRGEMM_FIELD(zp_type_c);
+
+    HASH_BRGEMM_FIELD(is_oc_scale);
+    HASH_BRGEMM_FIELD(with_dst_scales);
+    HASH_BRGEMM_FIELD(with_src_scales);
+    HASH_BRGEMM_FIELD(with_dropout);
+    HASH_BRGEMM_FIELD(with_stochastic_round);
+    HASH_BRGEMM_FIELD(bs_group);
+
+    // Hash all non-pointer parameters of brgemm_attr_t except derived
+    HASH_BRGEMM_FIELD(brgattr.max_bs);
+    HASH_BRGEMM_FIELD(brgattr.max_top_vpad);
+    HASH_BRGEMM_FIELD(brgattr.max_bottom_vpad);
+    HASH_BRGEMM_FIELD(brgattr.max_top_bpad);
+    HASH_BRGEMM_FIELD(brgattr.max_bottom_bpad);
+    HASH_BRGEMM_FIELD(brgattr.hint_expected_A_size);
+    HASH_BRGEMM_FIELD(brgattr.hint_expected_B_size);
+    HASH_BRGEMM_FIELD(brgattr.hint_expected_C_size);
+    HASH_BRGEMM_FIELD(brgattr.hint_innermost_loop);
+    HASH_BRGEMM_FIELD(brgattr.hint_loop_order);
+    HASH_BRGEMM_FIELD(brgattr.hint_prefetching);
+    HASH_BRGEMM_FIELD(brgattr.hint_prfA.dist1);
+    HASH_BRGEMM_FIELD(brgattr.hint_prfA.dist2);
+    HASH_BRGEMM_FIELD(brgattr.hint_prfB.dist1);
+    HASH_BRGEMM_FIELD(brgattr.hint_prfB.dist2);
+    HASH_BRGEMM_FIELD(brgattr.hint_prfC.dist1);
+    HASH_BRGEMM_FIELD(brgattr.hint_prfC.dist2);
+    HASH_BRGEMM_FIELD(brgattr.wary_A_k_tail_read);
+    HASH_BRGEMM_FIELD(brgattr.extendable_k);
+    HASH_BRGEMM_FIELD(brgattr.generate_skip_accumulation);
+    HASH_BRGEMM_FIELD(brgattr.bd_mask_level);
+    HASH_BRGEMM_FIELD(brgattr.use_uker);
+    HASH_BRGEMM_FIELD(brgattr.use_interleave_stores);
+    HASH_BRGEMM_FIELD(brgattr.b_is_vnni);
+    HASH_BRGEMM_FIELD(brgattr.fpmath_mode);
+    HASH_BRGEMM_FIELD(brgattr.LDA2);
+    HASH_BRGEMM_FIELD(brgattr.LDB2);
+    HASH_BRGEMM_FIELD(brgattr.LDC2_M);
+    HASH_BRGEMM_FIELD(brgattr.LDC2_N);
+    HASH_BRGEMM_FIELD(brgattr.var_bs);
+    HASH_BRGEMM_FIELD(brgattr.postops_only);
+    HASH_BRGEMM_FIELD(brgattr.hint_bs_group);
+
+    HASH_BRGEMM_FIELD(brgattr.hint_bd_block);
+    HASH_BRGEMM_FIELD(brgattr.hint_ld_block);
+    HASH_BRGEMM_FIELD(brgattr.hint_bd_block2);
+    HASH_BRGEMM_FIELD(brgattr.hint_ld_block2);
+    HASH_BRGEMM_FIELD(brgattr.hint_ununroll_bd_loop);
+
+    HASH_BRGEMM_FIELD(brgattr.hint_load_nt_A);
+    HASH_BRGEMM_FIELD(brgattr.hint_load_nt_B);
+    HASH_BRGEMM_FIELD(brgattr.K_koef);
+
+    if (brgattr.bd_mask_level > 0)
+        for (int i = 0; i < bcast_dim; i++) {
+            HASH_BRGEMM_FIELD(brgattr.bd_mask[i]);
+        }
+
+    if (type == brgemm_static_offs)
+        for (int i = 0; i < brgattr.max_bs; i++) {
+            HASH_BRGEMM_FIELD(brgattr.static_offsets[i].offset.A);
+            HASH_BRGEMM_FIELD(brgattr.static_offsets[i].offset.B);
+        }
+
+#undef HASH_BRGEMM_FIELD
+    return seed;
+}
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
@@ -294,6 +294,16 @@ struct brgemm_desc_t {
 
     int is_oc_scale = 0;
     bool with_dst_scales = false;
+    // Per-row scales of matrix A, applied to the accumulators together with
+    // the scales of matrix B.
+    bool with_src_scales = false;
+    // Dropout of the accumulators by a precomputed mask with the layout of
+    // matrix D, applied after bias and before the post-ops.
+    bool with_dropout = false;
+    // Stochastic rounding of the results to the data type of matrix D with
+    // precomputed random bias bytes in the layout of matrix D, applied after
+    // the destination scales.
+    bool with_stochastic_round = false;
     // Grouping in batch used by brdgmm kernel
     int bs_group {0};
 
@@ -496,7 +506,8 @@ struct brgemm_desc_t {
                 brgemm_broadcast_t::none, zp_type_a, zp_type_b, zp_type_c);
         return dt_c != dt_d || with_eltwise || with_binary || with_scales
                 || with_bias || with_sum || req_s8s8_compensation
-                || has_zero_points || with_dst_scales;
+                || has_zero_points || with_dst_scales || with_src_scales
+                || with_dropout || with_stochastic_round;
     }
 
     bool is_xf16() const noexcept { return is_bf16 || is_f16; }
@@ -536,6 +547,8 @@ struct brgemm_desc_t {
 
     bool operator==(const brgemm_desc_t &rhs) const;
     bool operator<(const brgemm_desc_t &rhs) const;
+    // Returns a hash of the fields compared by the operators above.
+    size_t hash() const;
 
 private:
     primitive_attr_t *attr_ {nullptr};
@@ -602,6 +615,10 @@ struct brgemm_kernel_params_t {
     size_t skip_accm = 0;
     int32_t zp_a_val = 1;
     const void *ptr_dst_scales = nullptr;
+    const void *ptr_src_scales = nullptr;
+    const void *ptr_dropout_mask = nullptr;
+    const void *ptr_dropout_inv_q = nullptr;
+    const void *ptr_rnd_bias = nullptr;
     dim_t dynamic_LDA = 0;
     dim_t dynamic_LDB = 0;
     dim_t dynamic_LDC = 0;
@@ -628,6 +645,10 @@ struct jit_base_brgemm_kernel_t : public jit_generator_t {
     jit_base_brgemm_kernel_t(const char *impl_name, cpu_isa_t isa_impl)
         : jit_generator_t(impl_name, isa_impl) {}
     virtual const brgemm_desc_t &get_brg() const = 0;
+
+    size_t config_hash() const override {
+        return hash_combine(jit_generator_t::config_hash(), get_brg().hash());
+    }
 };
 
 template <typename Vmm>
@@ -712,6 +733,15 @@ private:
 /// @param dst_scales - Vector of inverted scale factor values for matix C,
 ///     common scale vector type only is supported, it must be broadcasted to
 ///     vector of simd width length.
+/// @param a_zp_values - A matrix zero point values.
+/// @param src_scales - Vector of scale factor values for rows of matrix A.
+/// @param dropout_mask - Dropout mask element of the first element of matrix
+///     D, the mask has the layout of matrix D with u8 elements.
+/// @param dropout_inv_q - Scale factor for the kept elements,
+///     1 / (1 - probability).
+/// @param rnd_bias - Random bias of the stochastic rounding of the first
+///     element of matrix D, the bias has the layout of matrix D with
+///     elements of jit_avx512_core_philox_t::rnd_bias_size() bytes.
 ///
 struct brgemm_post_ops_data_t {
     brgemm_post_ops_data_t() = default;
@@ -725,7 +755,11 @@ struct brgemm_post_ops_data_t {
             const void *c_zp_values = nullptr, bool skip_accumulation = false,
             int32_t zp_a_val = 1, bool do_only_comp = false,
             bool do_only_zp_a_val = false, const float *dst_scales = nullptr,
-            const void *a_zp_values = nullptr)
+            const void *a_zp_values = nullptr,
+            const float *src_scales = nullptr,
+            const void *dropout_mask = nullptr,
+            const float *dropout_inv_q = nullptr,
+            const void *rnd_bias = nullptr)
         : bias(bias)
         , scales(scales)
         , binary_post_ops_rhs(binary_post_ops_rhs)
@@ -741,7 +775,11 @@ struct brgemm_post_ops_data_t {
         , do_only_comp {do_only_comp}
         , do_only_zp_a_val {do_only_zp_a_val}
         , dst_scales(dst_scales)
-        , a_zp_values(a_zp_values) {}
+        , a_zp_values(a_zp_values)
+        , src_scales(src_scales)
+        , dropout_mask(dropout_mask)
+        , dropout_inv_q(dropout_inv_q)
+        , rnd_bias(rnd_bias) {}
 
     const void *bias = nullptr;
     const float *scales = nullptr;
@@ -759,6 +797,10 @@ struct brgemm_post_ops_data_t {
     const bool do_only_zp_a_val = false;
     const float *dst_scales = nullptr;
     const void *a_zp_values = nullptr;
+    const float *src_scales = nullptr;
+    const void *dropout_mask = nullptr;
+    const float *dropout_inv_q = nullptr;
+    const void *rnd_bias = nullptr;
 };
 
 } // namespace x64
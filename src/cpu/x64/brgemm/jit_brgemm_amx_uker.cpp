@@ -26,6 +26,7 @@
 #include "cpu/x64/cpu_isa_traits.hpp"
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/jit_avx512_core_fp8cvt.hpp"
+#include "cpu/x64/jit_avx512_core_philox.hpp"
 
 #define GET_OFF(field) offsetof(brgemm_kernel_params_t, field)
 #define GET_OFF_BATCH_ELEMENT(field) offsetof(brgemm_batch_element_t, field)
@@ -175,6 +176,9 @@ private:
     const reg64_t reg_bias = rbx;
     const reg64_t reg_scales = rbx;
     const reg64_t reg_dst_scales = rbx;
+    const reg64_t reg_src_scales = rbx;
+    const reg64_t reg_dropout_mask = rbx;
+    const reg64_t reg_rnd_bias = rbx;
 
     const reg64_t reg_stride_ld_block = rdx;
     const reg64_t reg_do_post_ops = rbx;
@@ -199,7 +203,8 @@ private:
     constexpr static int reg_zp_c_values_offs_ = 24;
     constexpr static int reg_iter_labels_list_offs_ = 32;
     constexpr static int reg_zp_a_values_offs_ = 40;
-    constexpr static int stack_space_needed_ = 48;
+    constexpr static int rnd_consts_offs_ = 48;
+    constexpr static int stack_space_needed_ = 72;
 
     bool are_post_ops_applicable_ = false;
     bool need_to_apply_alpha_beta_ = false;
@@ -411,6 +416,9 @@ private:
     Xbyak::Opmask ld_tail_mask = Xbyak::Opmask(3);
     Xbyak::Opmask fp_col_mask = Xbyak::Opmask(4);
     Xbyak::Opmask rd_tail_mask = Xbyak::Opmask(5);
+    Xbyak::Opmask kmask_dropout = Xbyak::Opmask(7);
+    // Shared with the eltwise injector, the rounding follows the post-ops.
+    Xbyak::Opmask kmask_rnd = Xbyak::Opmask(1);
 
     // Zmm map below
     const Xbyak::Zmm &zmm_tmp_1() const noexcept { return this->zmm0; }
@@ -467,6 +475,10 @@ private:
             int idx, const Address &addr, bool is_ld_tail);
     void apply_post_ops_to_range(brgemm_iteration_t &bi, int bd_start,
             int bd_finish, int bdb, int ldb);
+    void apply_dropout_to_range(brgemm_iteration_t &bi, int bd_start,
+            int bd_finish, int bdb, int ldb);
+    void apply_stochastic_round_to_range(brgemm_iteration_t &bi,
+            int bd_start, int bd_finish, int bdb, int ldb);
     void store_vector_with_post_ops(
             int idx, const Address &addr, bool is_ld_tail);
     void prepare_post_ops_registers_ldb(brgemm_iteration_t &bi, int ldb);
@@ -1281,6 +1293,83 @@ void jit_brgemm_amx_uker_base_t::apply_comp_pad_to_vector(
     vaddps(zmm_masked, zmm, zmm_zp_comp_a);
 }
 
+void jit_brgemm_amx_uker_base_t::apply_dropout_to_range(
+        brgemm_iteration_t &bi, int bd_start, int bd_finish, int bdb, int ldb) {
+    const auto k_mask = bi.ldi->is_tail(ldb) ? ld_tail_mask : ld_full_mask;
+    const auto zmm_keep = zmm_tmp_1();
+    const auto zmm_inv_q = zmm_tmp_2();
+
+    mov(reg_dropout_mask, ptr[param1 + GET_OFF(ptr_dropout_inv_q)]);
+    vbroadcastss(zmm_inv_q, ptr[reg_dropout_mask]);
+
+    // The mask has the layout of D with byte elements.
+    mov(reg_dropout_mask, reg_D);
+    sub(reg_dropout_mask, ptr[param1 + GET_OFF(ptr_D)]);
+    if (brg.typesize_D > 1) shr(reg_dropout_mask, brg.typesize_D >> 1);
+    add(reg_dropout_mask, ptr[param1 + GET_OFF(ptr_dropout_mask)]);
+
+    for (auto bd = bd_start; bd < bd_finish; bd++) {
+        if (!is_out_bd(bi.bdi, bdb, bd)) continue;
+
+        auto zmm = accm(bd);
+        const auto mask_off
+                = D_offset(bi, bdb, bd, bi.ldi->pos(ldb)) / brg.typesize_D;
+        vpmovzxbd(zmm_keep | k_mask | T_z,
+                EVEX_compress_addr_safe(
+                        reg_dropout_mask, mask_off, reg_long_offt));
+        vptestmd(kmask_dropout, zmm_keep, zmm_keep);
+        vmulps(zmm | kmask_dropout | T_z, zmm, zmm_inv_q);
+    }
+}
+
+void jit_brgemm_amx_uker_base_t::apply_stochastic_round_to_range(
+        brgemm_iteration_t &bi, int bd_start, int bd_finish, int bdb, int ldb) {
+    const auto k_mask = bi.ldi->is_tail(ldb) ? ld_tail_mask : ld_full_mask;
+    const auto zmm_bias = zmm_tmp_1();
+    const auto zmm_abs = zmm_tmp_2();
+    const int bias_size = jit_avx512_core_philox_t::rnd_bias_size(brg.dt_d);
+    const auto rnd_const = [&](int i) {
+        return ptr_b[rsp + rnd_consts_offs_ + i * sizeof(uint32_t)];
+    };
+    using consts_t = stochastic_round_consts_t;
+
+    // The bias has the layout of D with elements of bias_size bytes.
+    mov(reg_rnd_bias, reg_D);
+    sub(reg_rnd_bias, ptr[param1 + GET_OFF(ptr_D)]);
+    if (brg.typesize_D == 2)
+        shr(reg_rnd_bias, 1);
+    else
+        shl(reg_rnd_bias, 1);
+    add(reg_rnd_bias, ptr[param1 + GET_OFF(ptr_rnd_bias)]);
+
+    for (auto bd = bd_start; bd < bd_finish; bd++) {
+        if (!is_out_bd(bi.bdi, bdb, bd)) continue;
+
+        auto zmm = accm(bd);
+        const auto bias_off = D_offset(bi, bdb, bd, bi.ldi->pos(ldb))
+                / brg.typesize_D * bias_size;
+        const auto addr = EVEX_compress_addr_safe(
+                reg_rnd_bias, bias_off, reg_long_offt);
+        if (bias_size == 1)
+            vpmovzxbd(zmm_bias | k_mask | T_z, addr);
+        else
+            vpmovzxwd(zmm_bias | k_mask | T_z, addr);
+
+        // The bias is not wider than the truncated part of the mantissa,
+        // so it's added as is. NaN values are kept.
+        vfpclassps(kmask_rnd, zmm, 0x81);
+        knotw(kmask_rnd, kmask_rnd);
+        vpaddd(zmm | kmask_rnd, zmm, zmm_bias);
+        vpandd(zmm | kmask_rnd, zmm, rnd_const(consts_t::trunc_mask));
+        vmaxps(zmm | kmask_rnd, zmm, rnd_const(consts_t::lowest));
+        vminps(zmm | kmask_rnd, zmm, rnd_const(consts_t::max));
+        vpandd(zmm_abs, zmm, rnd_const(consts_t::abs_mask));
+        vcmpps(kmask_rnd, zmm_abs, rnd_const(consts_t::min), _cmp_lt_os);
+        vptestmd(kmask_rnd | kmask_rnd, zmm_abs, zmm_abs);
+        vpxord(zmm | kmask_rnd, zmm, zmm);
+    }
+}
+
 void jit_brgemm_amx_uker_base_t::process_output_range(
         brgemm_iteration_t &bi, int bd_start, int bd_finish, int bdb, int ldb) {
 
@@ -1360,6 +1449,21 @@ void jit_brgemm_amx_uker_base_t::process_output_range(
         }
     }
 
+    if (brg.with_src_scales) {
+        mov(reg_src_scales, ptr[param1 + GET_OFF(ptr_src_scales)]);
+        auto zmm_src_scale = zmm_tmp_1();
+        for (auto bd = bd_start; bd < bd_finish; bd++) {
+            if (!is_out_bd(bi.bdi, bdb, bd)) continue;
+
+            auto zmm = accm(bd);
+            const auto src_scales_off
+                    = sizeof(float) * get_out_bd(bi.bdi, bdb, bd);
+            vbroadcastss(zmm_src_scale,
+                    EVEX_compress_addr(reg_src_scales, src_scales_off));
+            vmulps(zmm, zmm, zmm_src_scale);
+        }
+    }
+
     if (brg.with_scales) {
         for (auto bd = bd_start; bd < bd_finish; bd++) {
             if (!is_out_bd(bi.bdi, bdb, bd)) continue;
@@ -1379,6 +1483,9 @@ void jit_brgemm_amx_uker_base_t::process_output_range(
         }
     }
 
+    if (brg.with_dropout)
+        apply_dropout_to_range(bi, bd_start, bd_finish, bdb, ldb);
+
     if (postops_injector_) {
         apply_post_ops_to_range(bi, bd_start, bd_finish, bdb, ldb);
     }
@@ -1403,6 +1510,9 @@ void jit_brgemm_amx_uker_base_t::process_output_range(
             vaddps(zmm, zmm, zmm_zp_c);
         }
     }
+
+    if (brg.with_stochastic_round)
+        apply_stochastic_round_to_range(bi, bd_start, bd_finish, bdb, ldb);
 }
 
 void jit_brgemm_amx_uker_base_t::store_vector_with_post_ops(
@@ -2648,6 +2758,13 @@ void jit_brgemm_amx_uker_base_t::generate() {
     mov(reg_mask, tail_mask);
     kmovq(ld_tail_mask, reg_mask);
 
+    if (brg.with_stochastic_round) {
+        const stochastic_round_consts_t consts(brg.dt_d);
+        for (int i = 0; i < stochastic_round_consts_t::n_consts; i++)
+            mov(dword[rsp + rnd_consts_offs_ + i * sizeof(uint32_t)],
+                    consts.vals[i]);
+    }
+
     LDA_size_ = brg.typesize_A * brg.LDA;
     LDB_size_ = brg.typesize_B * brg.LDB;
     LDC_size_ = brg.typesize_C * brg.LDC;
@@ -28,6 +28,7 @@
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
 #include "cpu/x64/jit_avx512_core_fp8cvt.hpp"
+#include "cpu/x64/jit_avx512_core_philox.hpp"
 #include "cpu/x64/jit_generator.hpp"
 
 #define GET_OFF(field) offsetof(brgemm_kernel_params_t, field)
@@ -204,6 +205,8 @@ private:
     const reg64_t reg_aux_zp_comp_a = reg_rdb_loop;
     const reg64_t reg_zp_comp_b = reg_rdb_loop;
     const reg64_t reg_aux_zp_comp_b = reg_rdb_loop;
+    const reg64_t reg_src_scales = reg_rdb_loop;
+    const reg64_t reg_aux_src_scales = reg_rdb_loop;
     const reg64_t reg_zp_c_values = reg_rdb_loop;
     const reg64_t reg_aux_zp_c_values = reg_rdb_loop;
     const reg64_t reg_tmp_read_values = reg_rdb_loop;
@@ -273,7 +276,13 @@ private:
     // these are used for FP8 as temporary push/pop spaces
     constexpr static int reg_val_tmp_1_ = 256;
     constexpr static int reg_val_tmp_2_ = 264;
-    constexpr static int stack_space_needed_ = 272;
+    constexpr static int reg_src_scales_offs_ = 272;
+    constexpr static int reg_aux_src_scales_offs_ = 280;
+    constexpr static int reg_dropout_mask_shift_offs_ = 288;
+    constexpr static int reg_dropout_inv_q_offs_ = 296;
+    constexpr static int reg_rnd_bias_shift_offs_ = 304;
+    constexpr static int rnd_consts_offs_ = 312;
+    constexpr static int stack_space_needed_ = 336;
 
     bool is_ldb_loop_ = false;
     bool with_binary_non_scalar_bcast_ = false;
@@ -284,6 +293,9 @@ private:
     Xbyak::Opmask fp8_col_mask = Xbyak::Opmask(4);
     Xbyak::Opmask kmask_fp8_aux = Xbyak::Opmask(5);
     Xbyak::Opmask rd_tail_mask = Xbyak::Opmask(6);
+    Xbyak::Opmask kmask_dropout = Xbyak::Opmask(7);
+    // Shared with the eltwise injector, the rounding follows the post-ops.
+    Xbyak::Opmask kmask_rnd = Xbyak::Opmask(1);
 
     static int get_max_effective_vregs(const brgemm_desc_t &brg) {
         auto used_vregs = 0;
@@ -424,6 +436,9 @@ private:
     void apply_alpha_beta(dim_t bd_block, dim_t ld_block, bool is_ld_tail);
     void apply_post_ops(dim_t bd_block, dim_t ld_block2,
             dim_t ldb_and_bdb_offset, bool is_ld_tail);
+    void apply_dropout(dim_t bd_block, dim_t ld_block2, bool is_ld_tail);
+    void apply_stochastic_round(
+            dim_t bd_block, dim_t ld_block2, bool is_ld_tail);
     void restore_A_B_matrices();
     void set_A_B_matrices();
 
@@ -484,6 +499,8 @@ private:
     dim_t bdb_zp_comp_a_offset(dim_t bd_block2) const noexcept;
     dim_t zp_comp_b_offset(dim_t bd) const noexcept;
     dim_t bdb_zp_comp_b_offset(dim_t bd_block2) const noexcept;
+    dim_t src_scales_offset(dim_t bd) const noexcept;
+    dim_t bdb_src_scales_offset(dim_t bd_block2) const noexcept;
     dim_t zp_c_values_offset(dim_t ld, bool is_tail = false) const noexcept;
 
     bool vpad_exist = false;
@@ -654,6 +671,17 @@ dim_t jit_brgemm_kernel_t<Wmm>::bdb_zp_comp_b_offset(
     return zp_comp_b_offset(bd_block2 * brg.bd_block);
 }
 
+template <typename Wmm>
+dim_t jit_brgemm_kernel_t<Wmm>::src_scales_offset(dim_t bd) const noexcept {
+    return sizeof(float) * bd;
+}
+
+template <typename Wmm>
+dim_t jit_brgemm_kernel_t<Wmm>::bdb_src_scales_offset(
+        dim_t bd_block2) const noexcept {
+    return src_scales_offset(bd_block2 * brg.bd_block);
+}
+
 template <typename Wmm>
 dim_t jit_brgemm_kernel_t<Wmm>::zp_c_values_offset(
         dim_t ld, bool is_tail) const noexcept {
@@ -766,6 +794,11 @@ void jit_brgemm_kernel_t<Wmm>::advance_bdb_post_op_regs(dim_t adj_bd_block) {
         add(reg_aux_zp_comp_b, bdb_zp_comp_b_offset(1));
         mov(ptr[rsp + reg_aux_zp_comp_b_offs_], reg_aux_zp_comp_b);
     }
+    if (brg.with_src_scales) {
+        mov(reg_aux_src_scales, ptr[rsp + reg_aux_src_scales_offs_]);
+        add(reg_aux_src_scales, bdb_src_scales_offset(1));
+        mov(ptr[rsp + reg_aux_src_scales_offs_], reg_aux_src_scales);
+    }
     if (brg.req_comp_pads_with_bcast
             && brg.zp_type_a != brgemm_broadcast_t::none) {
         mov(reg_aux_zp_comp_a, ptr[rsp + reg_aux_zp_comp_a_offs_]);
@@ -784,6 +817,12 @@ void jit_brgemm_kernel_t<Wmm>::restore_bdb_post_op_regs(dim_t bd_block2) {
             sub(reg_aux_zp_comp_b, bdb_zp_comp_b_offset(bd_block2 - 1));
             mov(ptr[rsp + reg_aux_zp_comp_b_offs_], reg_aux_zp_comp_b);
         }
+        if (brg.with_src_scales) {
+            post_processed = true;
+            mov(reg_aux_src_scales, ptr[rsp + reg_aux_src_scales_offs_]);
+            sub(reg_aux_src_scales, bdb_src_scales_offset(bd_block2 - 1));
+            mov(ptr[rsp + reg_aux_src_scales_offs_], reg_aux_src_scales);
+        }
         if (brg.req_comp_pads_with_bcast
                 && brg.zp_type_a != brgemm_broadcast_t::none) {
             mov(reg_aux_zp_comp_a, ptr[rsp + reg_aux_zp_comp_a_offs_]);
@@ -861,6 +900,12 @@ void jit_brgemm_kernel_t<Wmm>::advance_bd_block2_post_op_regs(dim_t bd_block2) {
         add(reg_zp_comp_b, bdb_zp_comp_b_offset(bd_block2));
         mov(ptr[rsp + reg_zp_comp_b_offs_], reg_zp_comp_b);
     }
+
+    if (brg.with_src_scales) {
+        mov(reg_src_scales, ptr[rsp + reg_src_scales_offs_]);
+        add(reg_src_scales, bdb_src_scales_offset(bd_block2));
+        mov(ptr[rsp + reg_src_scales_offs_], reg_src_scales);
+    }
 }
 
 template <typename Wmm>
@@ -897,6 +942,10 @@ void jit_brgemm_kernel_t<Wmm>::copy_post_ops_stack_values_to_aux(
         mov(reg_zp_comp_b, ptr[rsp + reg_zp_comp_b_offs_]);
         mov(ptr[rsp + reg_aux_zp_comp_b_offs_], reg_zp_comp_b);
     }
+    if (brg.with_src_scales) {
+        mov(reg_src_scales, ptr[rsp + reg_src_scales_offs_]);
+        mov(ptr[rsp + reg_aux_src_scales_offs_], reg_src_scales);
+    }
 }
 
 template <typename Wmm>
@@ -929,6 +978,37 @@ void jit_brgemm_kernel_t<Wmm>::read_params() {
     mov(reg_D, ptr[param1 + GET_OFF(ptr_D)]);
     mov(reg_BS, ptr[param1 + GET_OFF(BS)]);
 
+    if (brg.with_dropout) {
+        // The mask has the layout of D with byte elements, its address is
+        // (D address) / typesize_D + shift.
+        mov(reg_tmp_read_values, reg_D);
+        if (brg.typesize_D > 1) shr(reg_tmp_read_values, brg.typesize_D >> 1);
+        neg(reg_tmp_read_values);
+        add(reg_tmp_read_values, ptr[param1 + GET_OFF(ptr_dropout_mask)]);
+        mov(ptr[rsp + reg_dropout_mask_shift_offs_], reg_tmp_read_values);
+        mov(reg_tmp_read_values, ptr[param1 + GET_OFF(ptr_dropout_inv_q)]);
+        mov(ptr[rsp + reg_dropout_inv_q_offs_], reg_tmp_read_values);
+    }
+
+    if (brg.with_stochastic_round) {
+        // The random bias has the layout of D with elements of
+        // rnd_bias_size() bytes, 1 for 2-byte D and 2 for 1-byte D. Its
+        // address is (D address) * rnd_bias_size() / typesize_D + shift.
+        mov(reg_tmp_read_values, reg_D);
+        if (brg.typesize_D == 2)
+            shr(reg_tmp_read_values, 1);
+        else
+            shl(reg_tmp_read_values, 1);
+        neg(reg_tmp_read_values);
+        add(reg_tmp_read_values, ptr[param1 + GET_OFF(ptr_rnd_bias)]);
+        mov(ptr[rsp + reg_rnd_bias_shift_offs_], reg_tmp_read_values);
+
+        const stochastic_round_consts_t consts(brg.dt_d);
+        for (int i = 0; i < stochastic_round_consts_t::n_consts; i++)
+            mov(dword[rsp + rnd_consts_offs_ + i * sizeof(uint32_t)],
+                    consts.vals[i]);
+    }
+
     // ptr_buf is re-used for passing compensations for
     // brg.req_s8s8_compensation case
     if (brg.is_tmm || brg.req_s8s8_compensation) {
@@ -955,6 +1035,11 @@ void jit_brgemm_kernel_t<Wmm>::read_params() {
         mov(ptr[rsp + reg_zp_comp_b_offs_], reg_zp_comp_b);
     }
 
+    if (brg.with_src_scales) {
+        mov(reg_src_scales, ptr[param1 + GET_OFF(ptr_src_scales)]);
+        mov(ptr[rsp + reg_src_scales_offs_], reg_src_scales);
+    }
+
     if (brg.zp_type_c != brgemm_broadcast_t::none) {
         mov(reg_zp_c_values, ptr[param1 + GET_OFF(c_zp_values)]);
         mov(ptr[rsp + reg_zp_c_values_offs_], reg_zp_c_values);
@@ -1289,6 +1374,79 @@ void jit_brgemm_kernel_t<Wmm>::apply_post_ops(dim_t bd_block, dim_t ld_block2,
         mov(reg_aux_D, ptr[rsp + reg_aux_D_backup_offs_]);
 }
 
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::apply_dropout(
+        dim_t bd_block, dim_t ld_block2, bool is_ld_tail) {
+    assert(isa_has_masks(brg.isa_impl) && !brg.is_runtime_ldd);
+    const auto k_mask = is_ld_tail ? ld_tail_mask : ld_full_mask;
+    const auto vmm_keep = vmm_tmp(0);
+    const auto vmm_inv_q = vmm_tmp(1);
+
+    mov(reg_tmp_gpr, ptr[rsp + reg_dropout_inv_q_offs_]);
+    vbroadcastss(vmm_inv_q, ptr[reg_tmp_gpr]);
+    mov(reg_tmp_gpr, reg_aux_D);
+    if (brg.typesize_D > 1) shr(reg_tmp_gpr, brg.typesize_D >> 1);
+    add(reg_tmp_gpr, ptr[rsp + reg_dropout_mask_shift_offs_]);
+
+    for_(dim_t bd = 0; bd < bd_block; bd++)
+    for (dim_t ld = 0; ld < ld_block2; ld++) {
+        const bool is_tail = is_ld_tail && ld + 1 == ld_block2;
+        const auto vmm = accm(ld_block2, bd, ld);
+        vpmovzxbd(vmm_mask(vmm_keep, is_tail, false, k_mask),
+                ptr[reg_tmp_gpr + D_offset(bd, ld) / brg.typesize_D]);
+        vptestmd(kmask_dropout, vmm_keep, vmm_keep);
+        vmulps(vmm | kmask_dropout | T_z, vmm, vmm_inv_q);
+    }
+}
+
+template <typename Wmm>
+void jit_brgemm_kernel_t<Wmm>::apply_stochastic_round(
+        dim_t bd_block, dim_t ld_block2, bool is_ld_tail) {
+    assert(isa_has_masks(brg.isa_impl) && !brg.is_runtime_ldd);
+    assert(one_of(brg.typesize_D, 1, 2));
+    const auto k_mask = is_ld_tail ? ld_tail_mask : ld_full_mask;
+    const auto vmm_bias = vmm_tmp(0);
+    const auto vmm_abs = vmm_tmp(1);
+    const int bias_size = jit_avx512_core_philox_t::rnd_bias_size(brg.dt_d);
+    const auto rnd_const = [&](int i) {
+        return ptr_b[rsp + rnd_consts_offs_ + i * sizeof(uint32_t)];
+    };
+    using consts_t = stochastic_round_consts_t;
+
+    mov(reg_tmp_gpr, reg_aux_D);
+    if (brg.typesize_D == 2)
+        shr(reg_tmp_gpr, 1);
+    else
+        shl(reg_tmp_gpr, 1);
+    add(reg_tmp_gpr, ptr[rsp + reg_rnd_bias_shift_offs_]);
+
+    for_(dim_t bd = 0; bd < bd_block; bd++)
+    for (dim_t ld = 0; ld < ld_block2; ld++) {
+        const bool is_tail = is_ld_tail && ld + 1 == ld_block2;
+        const auto vmm = accm(ld_block2, bd, ld);
+        const Vmm vmm_bias_masked = vmm_mask(vmm_bias, is_tail, false, k_mask);
+        const auto addr = ptr[reg_tmp_gpr
+                + D_offset(bd, ld) / brg.typesize_D * bias_size];
+        if (bias_size == 1)
+            vpmovzxbd(vmm_bias_masked, addr);
+        else
+            vpmovzxwd(vmm_bias_masked, addr);
+
+        // The bias is not wider than the truncated part of the mantissa,
+        // so it's added as is. NaN values are kept.
+        vfpclassps(kmask_rnd, vmm, 0x81);
+        knotw(kmask_rnd, kmask_rnd);
+        vpaddd(vmm | kmask_rnd, vmm, vmm_bias);
+        vpandd(vmm | kmask_rnd, vmm, rnd_const(consts_t::trunc_mask));
+        vmaxps(vmm | kmask_rnd, vmm, rnd_const(consts_t::lowest));
+        vminps(vmm | kmask_rnd, vmm, rnd_const(consts_t::max));
+        vpandd(vmm_abs, vmm, rnd_const(consts_t::abs_mask));
+        vcmpps(kmask_rnd, vmm_abs, rnd_const(consts_t::min), _cmp_lt_os);
+        vptestmd(kmask_rnd | kmask_rnd, vmm_abs, vmm_abs);
+        vpxord(vmm | kmask_rnd, vmm, vmm);
+    }
+}
+
 template <typename Wmm>
 void jit_brgemm_kernel_t<Wmm>::store_accumulators_apply_post_ops(dim_t bd_block,
         dim_t ld_block2, dim_t ldb_and_bdb_offset, bool is_ld_tail) {
@@ -1324,6 +1482,21 @@ void jit_brgemm_kernel_t<Wmm>::store_accumulators_apply_post_ops(dim_t bd_block,
         }
     }
 
+    if (brg.with_src_scales) {
+        mov(reg_aux_src_scales, ptr[rsp + reg_aux_src_scales_offs_]);
+        for (dim_t bd = 0; bd < bd_block; bd++) {
+            auto vmm_src_scale = vmm_tmp(0);
+            uni_vbroadcastss(vmm_src_scale,
+                    ptr[reg_aux_src_scales + src_scales_offset(bd)]);
+            for (dim_t ld = 0; ld < ld_block2; ld++) {
+                auto vmm = accm(ld_block2, bd, ld);
+                if (dq2ps_required && !brg.with_scales)
+                    uni_vcvtdq2ps(vmm, vmm);
+                uni_vmulps(vmm, vmm, vmm_src_scale);
+            }
+        }
+    }
+
     if (brg.with_bias) { mov(reg_aux_bias, ptr[rsp + reg_aux_bias_offs_]); }
 
     if (brg.is_fp8_via_convert()) mov(ptr[rsp + reg_val_tmp_1_], reg64_fp8_aux);
@@ -1337,12 +1510,15 @@ void jit_brgemm_kernel_t<Wmm>::store_accumulators_apply_post_ops(dim_t bd_block,
         }
         for (dim_t bd = 0; bd < bd_block; bd++) {
             auto vmm = accm(ld_block2, bd, ld);
-            if (dq2ps_required && !brg.with_scales) uni_vcvtdq2ps(vmm, vmm);
+            if (dq2ps_required && !brg.with_scales && !brg.with_src_scales)
+                uni_vcvtdq2ps(vmm, vmm);
             if (brg.with_bias) uni_vaddps(vmm, vmm, vmm_bias);
         }
     }
     if (brg.is_fp8_via_convert()) mov(reg64_fp8_aux, ptr[rsp + reg_val_tmp_1_]);
 
+    if (brg.with_dropout) apply_dropout(bd_block, ld_block2, is_ld_tail);
+
     if (postops_injector_)
         apply_post_ops(bd_block, ld_block2, ldb_and_bdb_offset, is_ld_tail);
 
@@ -1398,6 +1574,9 @@ void jit_brgemm_kernel_t<Wmm>::store_accumulators_apply_post_ops(dim_t bd_block,
             mov(reg64_fp8_aux, ptr[rsp + reg_val_tmp_1_]);
     }
 
+    if (brg.with_stochastic_round)
+        apply_stochastic_round(bd_block, ld_block2, is_ld_tail);
+
     const bool dt_requires_saturation
             = one_of(brg.dt_d, data_type::u8, data_type::s8, data_type::s32);
     const bool use_sat_cvt
@@ -1757,6 +1936,7 @@ void jit_brgemm_kernel_t<Wmm>::store_accumulators(dim_t bd_block2,
                         advance_bdb_post_op_regs(adj_bd_block);
                         post_processed |= utils::one_of(true,
                                 brg.zp_type_b != brgemm_broadcast_t::none,
+                                brg.with_src_scales,
                                 brg.req_comp_pads_with_bcast
                                         && brg.zp_type_a
                                                 != brgemm_broadcast_t::none);
@@ -68,14 +68,19 @@ namespace x64 {
 struct reduce_balancer_t {
     reduce_balancer_t() { init(1, 1, 1, 1, 0); } /* trivial balance */
     reduce_balancer_t(int nthr, int job_size, int njobs, int reduction_size,
-            size_t max_buffer_size, bool lock_free = false) {
-        init(nthr, job_size, njobs, reduction_size, max_buffer_size, lock_free);
+            size_t max_buffer_size, bool lock_free = false,
+            bool deterministic = false) {
+        init(nthr, job_size, njobs, reduction_size, max_buffer_size, lock_free,
+                deterministic);
     }
 
+    /** with `deterministic` a job is reduced by a single thread, so the
+     * order of the reduction doesn't depend on the number of threads */
     reduce_balancer_t &init(int nthr, int job_size, int njobs,
-            int reduction_size, size_t max_buffer_size,
-            bool lock_free = false) {
-        allow_nthr_in_group_ = lock_free ? true : dnnl_thr_syncable();
+            int reduction_size, size_t max_buffer_size, bool lock_free = false,
+            bool deterministic = false) {
+        allow_nthr_in_group_ = !deterministic
+                && (lock_free ? true : dnnl_thr_syncable());
         nthr_ = nthr;
         job_size_ = job_size;
         njobs_ = njobs;
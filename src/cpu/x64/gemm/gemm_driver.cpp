@@ -2095,6 +2095,98 @@ dnnl_status_t gemm_driver(const char *transA, const char *transB,
     return gemm_threading_driver(&args);
 }
 
+template <typename a_type, typename b_type, typename c_type>
+dnnl_status_t gemm_batch_driver(dim_t batch,
+        const gemm_batch_problem_t<a_type, b_type, c_type> *problems) {
+    constexpr bool is_int8 = utils::one_of(
+            data_traits_t<a_type>::data_type, data_type::s8, data_type::u8);
+
+    if (batch <= 0) return dnnl_success;
+
+    // Check if copy algorithm kernels were generated on supported ISAs.
+    {
+        const auto &p = problems[0];
+        gemm_info_t<a_type, b_type, c_type> args(&p.transa, &p.transb,
+                p.offsetc ? &p.offsetc : nullptr, &p.m, &p.n, &p.k, &p.alpha,
+                p.a, &p.lda, &p.ao, p.b, &p.ldb, &p.bo, &p.beta, p.c, &p.ldc,
+                p.co, false, pack_type::none, nullptr, false);
+        if (!args.hasKernels()) return dnnl_unimplemented;
+    }
+
+    const int nthr = dnnl_get_current_num_threads();
+    dim_t max_m = 0, max_n = 0;
+    for (dim_t ib = 0; ib < batch; ib++) {
+        max_m = nstl::max(max_m, problems[ib].m);
+        max_n = nstl::max(max_n, problems[ib].n);
+    }
+
+    gemm_batch_threading_t thread_info;
+    thread_info.init(nthr, batch, max_m, max_n);
+    std::vector<dim_t> task_begin;
+    thread_info.balance(
+            batch,
+            [&](dim_t ib) {
+                const auto &p = problems[ib];
+                // Scaling C by beta still costs something when k is zero.
+                return (double)p.m * p.n * (p.k + 1);
+            },
+            task_begin);
+    const int nslices = thread_info.nslices();
+
+    std::vector<dnnl_status_t> results(nthr, dnnl_success);
+    parallel(nthr, [&](int ithr, int nthr_spawn) {
+        for (int ithr_eff = ithr; ithr_eff < nthr; ithr_eff += nthr_spawn)
+            for (dim_t task = task_begin[ithr_eff];
+                    task < task_begin[ithr_eff + 1]; task++) {
+                const auto &p = problems[task / nslices];
+                const auto slice = thread_info.get_slice(
+                        (int)(task % nslices), p.m, p.n, p.k);
+                if (slice.m <= 0 || slice.n <= 0) continue;
+                // 8-bit integer gemm leaves C untouched when k is zero.
+                if (is_int8 && slice.k <= 0) continue;
+
+                // Submatrices of the slice, see decompose_matrices().
+                const bool is_trans_a = utils::one_of(p.transa, 'T', 't');
+                const bool is_trans_b = utils::one_of(p.transb, 'T', 't');
+                const a_type *a = p.a + slice.off_m * (is_trans_a ? p.lda : 1);
+                const b_type *b = p.b + slice.off_n * (is_trans_b ? 1 : p.ldb);
+                c_type *c = p.c + slice.off_m + slice.off_n * p.ldc;
+                const c_type *co = p.co;
+                if (co && utils::one_of(p.offsetc, 'R', 'r'))
+                    co += slice.off_n;
+                else if (co && utils::one_of(p.offsetc, 'C', 'c'))
+                    co += slice.off_m;
+
+                // The parallel region is already open, so the slice is
+                // computed by the calling thread only.
+                const auto status = gemm_driver(&p.transa, &p.transb,
+                        p.offsetc ? &p.offsetc : nullptr, &slice.m, &slice.n,
+                        &slice.k, &p.alpha, a, &p.lda, &p.ao, b, &p.ldb, &p.bo,
+                        &p.beta, c, &p.ldc, co, false);
+                if (status != dnnl_success) results[ithr_eff] = status;
+            }
+    });
+
+    for (auto status : results)
+        if (status != dnnl_success) return status;
+    return dnnl_success;
+}
+
+template // Instantiate gemm_batch_s8s8s32
+        dnnl_status_t
+        gemm_batch_driver<int8_t, int8_t, int32_t>(dim_t batch,
+                const gemm_batch_problem_t<int8_t, int8_t, int32_t> *problems);
+
+template // Instantiate gemm_batch_s8u8s32
+        dnnl_status_t
+        gemm_batch_driver<int8_t, uint8_t, int32_t>(dim_t batch,
+                const gemm_batch_problem_t<int8_t, uint8_t, int32_t> *problems);
+
+template // Instantiate sgemm_batch
+        dnnl_status_t
+        gemm_batch_driver<float, float, float>(dim_t batch,
+                const gemm_batch_problem_t<float, float, float> *problems);
+
 template // Instantiate gemm_bf16bf16f32
         dnnl_status_t
         gemm_driver<bfloat16_t, bfloat16_t, float>(const char *transA,
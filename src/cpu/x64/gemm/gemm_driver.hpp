@@ -21,6 +21,8 @@
 
 #include "common/c_types_map.hpp"
 
+#include "cpu/gemm/gemm.hpp"
+
 #include "cpu/x64/gemm/gemm_info.hpp"
 #include "cpu/x64/gemm/gemm_pack_storage.hpp"
 
@@ -38,6 +40,13 @@ dnnl_status_t gemm_driver(const char *transA, const char *transB,
         const bool force_jit_nocopy_gemm, pack_type packing = pack_type::none,
         gemm_pack_storage_t *pack_dst = nullptr, bool measure_only = false);
 
+// Computes a batch of problems within a single parallel region. Each problem
+// is split into slices according to the batch-aware partition, and every
+// slice is computed by a single thread.
+template <typename a_type, typename b_type, typename c_type>
+dnnl_status_t gemm_batch_driver(dim_t batch,
+        const gemm_batch_problem_t<a_type, b_type, c_type> *problems);
+
 void prep_ref_gemm_s8u8s32_pack(
         bool do_a, dim_t rows, dim_t cols, gemm_pack_storage_t *pack_dst);
 
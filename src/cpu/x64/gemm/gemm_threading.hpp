@@ -18,8 +18,10 @@
 #define CPU_X64_GEMM_GEMM_THREADING_HPP
 
 #include <cstdint>
+#include <vector>
 
 #include "common/c_types_map.hpp"
+#include "common/utils.hpp"
 
 #include "cpu/x64/gemm/gemm_partition.hpp"
 
@@ -116,6 +118,73 @@ struct gemm_threading_t {
     int thr_k_stride() const { return nthrs_m * nthrs_n; }
 };
 
+// Batch-aware partition. Every problem of a batch is split into the same
+// nthrs_m x nthrs_n grid of slices, and the slices of all the problems are
+// dealt out to the threads in contiguous ranges of roughly equal cost. A batch
+// of small problems is then computed within a single parallel region, and a
+// batch smaller than the number of threads still keeps all of them busy.
+struct gemm_batch_threading_t {
+    int nthrs = 1;
+    int nthrs_m = 1, nthrs_n = 1;
+
+    // Chooses the grid of slices for a batch of problems of at most m x n
+    // elements of C.
+    void init(int nthr, dim_t batch, dim_t m, dim_t n) {
+        // Slices thinner than this are not worth a thread of their own.
+        constexpr dim_t min_slice = 16;
+
+        nthrs = nthr;
+        nthrs_m = nthrs_n = 1;
+        if (batch >= nthr) return;
+
+        const dim_t nslices = utils::div_up(nthr, batch);
+        nthrs_n = (int)nstl::max<dim_t>(
+                1, nstl::min<dim_t>(nslices, n / min_slice));
+        nthrs_m = (int)nstl::max<dim_t>(1,
+                nstl::min<dim_t>(
+                        utils::div_up(nslices, nthrs_n), m / min_slice));
+    }
+
+    int nslices() const { return nthrs_m * nthrs_n; }
+
+    gemm_slice_t get_slice(int islice, dim_t m, dim_t n, dim_t k) const {
+        const int ithr_m = islice % nthrs_m;
+        const int ithr_n = islice / nthrs_m;
+
+        dim_t off_m = 0, off_n = 0, size_m = m, size_n = n;
+        partition_1d(ithr_m, nthrs_m, m, off_m, size_m);
+        partition_1d(ithr_n, nthrs_n, n, off_n, size_n);
+
+        return {off_m, off_n, 0, size_m, size_n, k, ithr_m, ithr_n, 0};
+    }
+
+    // Thread ithr computes the tasks from task_begin[ithr] to
+    // task_begin[ithr + 1], where task t is the slice t % nslices() of the
+    // problem t / nslices(). The cost of a problem is shared evenly by its
+    // slices, and a task goes to the thread owning the middle of its cost.
+    template <typename F>
+    void balance(dim_t batch, const F &problem_cost,
+            std::vector<dim_t> &task_begin) const {
+        const dim_t ntasks = batch * nslices();
+        task_begin.assign(nthrs + 1, ntasks);
+        task_begin[0] = 0;
+
+        double total = 0;
+        for (dim_t b = 0; b < batch; b++)
+            total += problem_cost(b);
+
+        double acc = 0;
+        int ithr = 1;
+        for (dim_t t = 0; t < ntasks; t++) {
+            const double cost = problem_cost(t / nslices()) / nslices();
+            const double mid = acc + cost / 2;
+            while (ithr < nthrs && mid >= total * ithr / nthrs)
+                task_begin[ithr++] = t;
+            acc += cost;
+        }
+    }
+};
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
@@ -573,12 +573,14 @@ struct jit_avx2_1x1_convolution_bwd_weights_t : public primitive_t {
 
             if (with_bias()) {
                 reducer_bia_conf_.init(reduce_balancer_t(max_threads, oc_block,
-                        jcp_.ngroups * nb_oc, jcp_.mb, max_buffer_size, true));
+                        jcp_.ngroups * nb_oc, jcp_.mb, max_buffer_size, true,
+                        attr()->deterministic_));
             }
 
             reducer_wei_conf_.init(
                     reduce_balancer_t(max_threads, job_size, njobs_y * njobs_x,
-                            jcp_.mb * jcp_.nb_reduce, max_buffer_size, true),
+                            jcp_.mb * jcp_.nb_reduce, max_buffer_size, true,
+                            attr()->deterministic_),
                     job_size / nb_oc_blocking, nb_oc_blocking, ic_block,
                     nb_ic * ic_block * oc_block, nb_oc);
         }
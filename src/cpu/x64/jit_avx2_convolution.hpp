@@ -308,13 +308,13 @@ struct jit_avx2_convolution_bwd_weights_t : public primitive_t {
             if (with_bias()) {
                 reducer_bia_conf_.init(reduce_balancer_t(max_threads,
                         jcp_.oc_block, jcp_.ngroups * jcp_.nb_oc, jcp_.mb,
-                        max_buffer_size, true));
+                        max_buffer_size, true, attr()->deterministic_));
             }
 
             reducer_wei_conf_.init(reduce_balancer_t(max_threads,
                     jcp_.kd * jcp_.kh * jcp_.kw * jcp_.ic_block * jcp_.oc_block,
                     jcp_.ngroups * jcp_.nb_ic * jcp_.nb_oc, jcp_.mb * jcp_.od,
-                    max_buffer_size, true));
+                    max_buffer_size, true, attr()->deterministic_));
         }
     };
 
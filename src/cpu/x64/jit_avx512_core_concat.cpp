@@ -0,0 +1,512 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
+#include "cpu/x64/jit_avx512_core_concat.hpp"
+
+#define GET_OFF(field) offsetof(jit_concat_call_t, field)
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+
+namespace {
+constexpr int simd_w = 16;
+// Pixels are unrolled when an input is copied segment by segment.
+constexpr int unroll = 4;
+
+// Copies the channels of all the inputs for a range of pixels of one image.
+// Every segment is a single masked load and store, so the channels of an
+// input may start in the middle of a destination block. The data is copied
+// as is when the data types match and is converted through f32 otherwise.
+struct jit_avx512_core_concat_kernel_t : public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_concat_kernel_t)
+
+    jit_avx512_core_concat_kernel_t(const jit_concat_conf_t &jcp, bool use_nt)
+        : jit_generator_t(jit_name())
+        , jcp_(jcp)
+        , use_nt_(use_nt)
+        , dst_dsz_((int)types::data_type_size(jcp.dst_dt)) {
+        const bool need_bf16_cvt = jcp_.dst_dt == bf16
+                && std::any_of(jcp_.src_dt.begin(), jcp_.src_dt.end(),
+                        [](data_type_t dt) { return dt != bf16; });
+        if (need_bf16_cvt && !mayiuse(avx512_core_bf16))
+            bf16_emu_ = utils::make_unique<bf16_emulation_t>(this,
+                    bf16_emu_reserv_1, bf16_emu_reserv_2, bf16_emu_reserv_3,
+                    reg_bf16_scratch, bf16_emu_reserv_4);
+    }
+
+private:
+    const jit_concat_conf_t jcp_;
+    const bool use_nt_;
+    const int dst_dsz_;
+    std::unique_ptr<bf16_emulation_t> bf16_emu_;
+
+    const Reg64 reg_param = abi_param1;
+    const Reg64 reg_srcs = r8;
+    const Reg64 reg_outer = r9;
+    const Reg64 reg_sp = r10;
+    const Reg64 reg_nsp = r11;
+    const Reg64 reg_src = r12;
+    const Reg64 reg_dst = r13;
+    const Reg64 reg_src_ptr = r14;
+    const Reg64 reg_dst_ptr = r15;
+    const Reg64 reg_cnt = rax;
+    const Reg64 reg_tmp = rbx;
+    const Reg64 reg_bf16_scratch = rdx;
+
+    const Opmask k_tail = k1;
+
+    const Zmm vmm_zero = Zmm(24);
+    const Zmm vmm_lbound = Zmm(25);
+    const Zmm vmm_ubound = Zmm(26);
+    const Zmm bf16_emu_reserv_1 = Zmm(27);
+    const Zmm bf16_emu_reserv_2 = Zmm(28);
+    const Zmm bf16_emu_reserv_3 = Zmm(29);
+    const Zmm bf16_emu_reserv_4 = Zmm(30);
+
+    // Returns the register of `idx` wide enough for `bytes`.
+    static Xmm vreg(int idx, int bytes) {
+        if (bytes > 32) return Zmm(idx);
+        if (bytes > 16) return Ymm(idx);
+        return Xmm(idx);
+    }
+
+    // Moves `reg` to the first pixel of the call.
+    void add_offset(const Reg64 &reg, data_type_t dt, dim_t outer_stride,
+            dim_t pixel_stride) {
+        const dim_t dsz = types::data_type_size(dt);
+        mov(reg_tmp, outer_stride * dsz);
+        imul(reg_tmp, reg_outer);
+        add(reg, reg_tmp);
+        mov(reg_tmp, pixel_stride * dsz);
+        imul(reg_tmp, reg_sp);
+        add(reg, reg_tmp);
+    }
+
+    // Full blocks may be written with non-temporal stores. The destination
+    // is 64-byte aligned when such kernel is used.
+    bool use_nt_store(const jit_concat_segment_t &s) const {
+        if (!use_nt_ || s.input < 0) return false;
+        const dim_t bytes = s.len * dst_dsz_;
+        return utils::one_of(bytes, 16, 32, 64)
+                && (s.dst_off * dst_dsz_) % bytes == 0
+                && (jcp_.dst_pixel_stride * dst_dsz_) % bytes == 0
+                && (jcp_.dst_outer_stride * dst_dsz_) % bytes == 0;
+    }
+
+    void load_raw(const Xmm &v, const Address &addr, int dsz, bool is_tail) {
+        const Xmm vm = is_tail ? v | k_tail | T_z : v;
+        switch (dsz) {
+            case 4: vmovdqu32(vm, addr); break;
+            case 2: vmovdqu16(vm, addr); break;
+            case 1: vmovdqu8(vm, addr); break;
+            default: assert(!"unsupported data type size");
+        }
+    }
+
+    void store_raw(const Xmm &v, const Address &addr, int len, bool is_nt) {
+        if (is_nt) {
+            vmovntdq(addr, vreg(v.getIdx(), len * dst_dsz_));
+            return;
+        }
+        const Address am = len < simd_w ? addr | k_tail : addr;
+        switch (dst_dsz_) {
+            case 4: vmovdqu32(am, v); break;
+            case 2: vmovdqu16(am, v); break;
+            case 1: vmovdqu8(am, v); break;
+            default: assert(!"unsupported data type size");
+        }
+    }
+
+    void load_f32(const Zmm &v, const Address &addr, data_type_t dt,
+            bool is_tail) {
+        const Zmm vm = is_tail ? v | k_tail | T_z : v;
+        switch (dt) {
+            case f32: vmovups(vm, addr); break;
+            case bf16:
+                vpmovzxwd(vm, addr);
+                vpslld(v, v, 16);
+                break;
+            case f16: vcvtph2ps(vm, addr); break;
+            case s8:
+                vpmovsxbd(vm, addr);
+                vcvtdq2ps(v, v);
+                break;
+            case u8:
+                vpmovzxbd(vm, addr);
+                vcvtdq2ps(v, v);
+                break;
+            default: assert(!"unsupported data type");
+        }
+    }
+
+    // Converts f32 values of `v` to the destination data type. Returns the
+    // register with the converted values.
+    Xmm cvt_to_dst(const Zmm &v, const Zmm &v_tmp) {
+        switch (jcp_.dst_dt) {
+            case f32: return v;
+            case bf16:
+                if (bf16_emu_)
+                    bf16_emu_->vcvtneps2bf16(Ymm(v_tmp.getIdx()), v);
+                else
+                    vcvtneps2bf16(Ymm(v_tmp.getIdx()), v);
+                return Ymm(v_tmp.getIdx());
+            case f16:
+                vcvtps2ph(Ymm(v_tmp.getIdx()), v, _op_mxcsr);
+                return Ymm(v_tmp.getIdx());
+            case s8:
+            case u8:
+                saturate_f32(v, vmm_lbound, vmm_ubound, jcp_.dst_dt);
+                vcvtps2dq(v, v);
+                if (jcp_.dst_dt == s8)
+                    vpmovsdb(Xmm(v_tmp.getIdx()), v);
+                else
+                    vpmovusdb(Xmm(v_tmp.getIdx()), v);
+                return Xmm(v_tmp.getIdx());
+            default: assert(!"unsupported data type");
+        }
+        return v;
+    }
+
+    void copy_segment(const jit_concat_segment_t &s, int slot,
+            const Address &src, const Address &dst) {
+        const bool is_tail = s.len < simd_w;
+        if (s.input < 0) {
+            store_raw(vreg(vmm_zero.getIdx(), simd_w * dst_dsz_), dst, s.len,
+                    false);
+            return;
+        }
+
+        const data_type_t src_dt = jcp_.src_dt[s.input];
+        const bool is_nt = use_nt_store(s);
+        if (src_dt == jcp_.dst_dt) {
+            const Xmm v = vreg(slot, simd_w * dst_dsz_);
+            load_raw(v, src, dst_dsz_, is_tail);
+            store_raw(v, dst, s.len, is_nt);
+        } else {
+            const Zmm v(slot);
+            load_f32(v, src, src_dt, is_tail);
+            store_raw(cvt_to_dst(v, Zmm(unroll + slot)), dst, s.len, is_nt);
+        }
+    }
+
+    // Copies the segments of one input for all the pixels of the call. A
+    // single segment is copied for several pixels at once, otherwise the
+    // segments of a pixel are independent already.
+    void copy_pixels(const std::vector<jit_concat_segment_t> &segs) {
+        const int input = segs[0].input;
+        const dim_t src_dsz = input >= 0
+                ? types::data_type_size(jcp_.src_dt[input])
+                : dst_dsz_;
+        const dim_t src_pixel
+                = input >= 0 ? jcp_.src_pixel_stride[input] * src_dsz : 0;
+        const dim_t dst_pixel = jcp_.dst_pixel_stride * dst_dsz_;
+        const bool is_single = segs.size() == 1;
+        const int ur = is_single ? unroll : 1;
+
+        // At most one segment of an input is shorter than a vector.
+        for (const auto &s : segs) {
+            if (s.len == simd_w) continue;
+            mov(reg_tmp.cvt32(), (1 << s.len) - 1);
+            kmovw(k_tail, reg_tmp.cvt32());
+        }
+
+        // Offsets of a single segment may be large, so they are applied to
+        // the pointers.
+        mov(reg_src_ptr, reg_src);
+        mov(reg_dst_ptr, reg_dst);
+        if (is_single) {
+            mov(reg_tmp, segs[0].src_off * src_dsz);
+            add(reg_src_ptr, reg_tmp);
+            mov(reg_tmp, segs[0].dst_off * dst_dsz_);
+            add(reg_dst_ptr, reg_tmp);
+        }
+        mov(reg_cnt, reg_nsp);
+
+        auto copy = [&](int u) {
+            for (size_t i = 0; i < segs.size(); i++) {
+                const auto &s = segs[i];
+                const dim_t src_off = u * src_pixel
+                        + (is_single ? 0 : s.src_off * src_dsz);
+                const dim_t dst_off = u * dst_pixel
+                        + (is_single ? 0 : s.dst_off * dst_dsz_);
+                copy_segment(s, (u + (int)i) % unroll,
+                        ptr[reg_src_ptr + src_off], ptr[reg_dst_ptr + dst_off]);
+            }
+        };
+
+        Label l_unrolled, l_single, l_end;
+        if (ur > 1) {
+            L(l_unrolled);
+            cmp(reg_cnt, ur);
+            jl(l_single, T_NEAR);
+            for (int u = 0; u < ur; u++)
+                copy(u);
+            add(reg_src_ptr, ur * src_pixel);
+            add(reg_dst_ptr, ur * dst_pixel);
+            sub(reg_cnt, ur);
+            jmp(l_unrolled, T_NEAR);
+        }
+        L(l_single);
+        cmp(reg_cnt, 0);
+        jle(l_end, T_NEAR);
+        copy(0);
+        add(reg_src_ptr, src_pixel);
+        add(reg_dst_ptr, dst_pixel);
+        dec(reg_cnt);
+        jmp(l_single, T_NEAR);
+        L(l_end);
+    }
+
+    void generate() override {
+        preamble();
+
+        mov(reg_srcs, ptr[reg_param + GET_OFF(srcs)]);
+        mov(reg_outer, ptr[reg_param + GET_OFF(outer)]);
+        mov(reg_sp, ptr[reg_param + GET_OFF(sp)]);
+        mov(reg_nsp, ptr[reg_param + GET_OFF(nsp)]);
+        mov(reg_dst, ptr[reg_param + GET_OFF(dst)]);
+        add_offset(reg_dst, jcp_.dst_dt, jcp_.dst_outer_stride,
+                jcp_.dst_pixel_stride);
+
+        if (bf16_emu_) bf16_emu_->init_vcvtneps2bf16();
+        init_saturate_f32(vmm_lbound, vmm_ubound, reg_tmp, f32, jcp_.dst_dt);
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+
+        const int n_inputs = (int)jcp_.src_dt.size();
+        for (int i = 0; i < n_inputs; i++) {
+            std::vector<jit_concat_segment_t> segs;
+            for (const auto &s : jcp_.segments)
+                if (s.input == i) segs.push_back(s);
+            if (segs.empty()) continue;
+
+            mov(reg_src, ptr[reg_srcs + i * sizeof(void *)]);
+            add_offset(reg_src, jcp_.src_dt[i], jcp_.src_outer_stride[i],
+                    jcp_.src_pixel_stride[i]);
+            // Blocks of an input are separate streams, which are read one
+            // by one. A pixel of a channels-last input is contiguous.
+            if (jcp_.is_blocked) {
+                for (const auto &s : segs)
+                    copy_pixels({s});
+            } else
+                copy_pixels(segs);
+        }
+
+        for (const auto &s : jcp_.segments)
+            if (s.input < 0) copy_pixels({s});
+
+        if (use_nt_) sfence();
+        postamble();
+    }
+};
+
+bool is_supported_dt(data_type_t dt) {
+    return utils::one_of(dt, f32, bf16, f16, s8, u8)
+            && platform::has_data_type_support(dt);
+}
+} // namespace
+
+status_t jit_avx512_core_concat_t::pd_t::init(engine_t *engine) {
+    using namespace format_tag;
+
+    VDISPATCH_CONCAT(mayiuse(avx512_core), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_CONCAT(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_CONCAT(concat_dim() == 1, VERBOSE_BAD_AXIS);
+    const int ndims = dst_md_.ndims;
+    VDISPATCH_CONCAT(
+            utils::one_of(ndims, 3, 4, 5), VERBOSE_BAD_NDIMS, "dst", ndims);
+    VDISPATCH_CONCAT_SC(init_dst_md(), VERBOSE_UNSUPPORTED_TAG);
+
+    const memory_desc_wrapper dst_d(dst_md());
+    const format_tag_t tag = dst_d.matches_one_of_tag(
+            utils::pick(ndims - 3, nCw16c, nChw16c, nCdhw16c),
+            utils::pick(ndims - 3, nCw8c, nChw8c, nCdhw8c),
+            utils::pick(ndims - 3, nwc, nhwc, ndhwc));
+    VDISPATCH_CONCAT(tag != format_tag::undef, VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONCAT(
+            is_supported_dt(dst_d.data_type()), VERBOSE_UNSUPPORTED_DT);
+    for (int i = 0; i < n_inputs(); i++) {
+        const memory_desc_wrapper src_d(src_md(i));
+        VDISPATCH_CONCAT(src_d.matches_tag(tag), VERBOSE_UNSUPPORTED_TAG);
+        VDISPATCH_CONCAT(
+                is_supported_dt(src_d.data_type()), VERBOSE_UNSUPPORTED_DT);
+    }
+
+    CHECK(init_conf());
+    init_scratchpad();
+
+    return status::success;
+}
+
+status_t jit_avx512_core_concat_t::pd_t::init_dst_md() {
+    if (dst_md_.format_kind != format_kind::any) return status::success;
+
+    // Unlike the default heuristic, keep the blocked format of the inputs
+    // even if their channels are not aligned with the blocks.
+    for (const auto &md : src_mds_) {
+        const memory_desc_wrapper src_d(md);
+        if (src_d.is_blocking_desc() && !src_d.is_plain())
+            return memory_desc_init_by_blocking_desc(
+                    dst_md_, src_d.blocking_desc());
+    }
+    return set_default_params();
+}
+
+status_t jit_avx512_core_concat_t::pd_t::init_conf() {
+    const memory_desc_wrapper dst_d(dst_md());
+    const int ndims = dst_d.ndims();
+    const auto &dst_blk = dst_d.blocking_desc();
+    const dim_t blk = dst_blk.inner_nblks ? dst_blk.inner_blks[0] : 0;
+
+    jcp_.is_blocked = blk > 0;
+    jcp_.outer_size = dst_d.dims()[0];
+    jcp_.nspatial = 1;
+    for (int d = 2; d < ndims; d++)
+        jcp_.nspatial *= dst_d.dims()[d];
+
+    jcp_.dst_dt = dst_d.data_type();
+    jcp_.dst_outer_stride = dst_blk.strides[0];
+    jcp_.dst_pixel_stride = dst_blk.strides[ndims - 1];
+
+    jcp_.src_dt.clear();
+    jcp_.src_outer_stride.clear();
+    jcp_.src_pixel_stride.clear();
+    jcp_.segments.clear();
+
+    dim_t c_off = 0;
+    for (int i = 0; i < n_inputs(); i++) {
+        const memory_desc_wrapper src_d(src_md(i));
+        const auto &src_blk = src_d.blocking_desc();
+        jcp_.src_dt.push_back(src_d.data_type());
+        jcp_.src_outer_stride.push_back(src_blk.strides[0]);
+        jcp_.src_pixel_stride.push_back(src_blk.strides[ndims - 1]);
+
+        // A segment may cross neither a block of the input nor a block of
+        // the destination.
+        const dim_t C = src_d.dims()[1];
+        for (dim_t c = 0; c < C;) {
+            const dim_t dst_c = c_off + c;
+            dim_t len = nstl::min<dim_t>(simd_w, C - c);
+            dim_t src_off = c, dst_off = dst_c;
+            if (jcp_.is_blocked) {
+                len = nstl::min(len, blk - c % blk);
+                len = nstl::min(len, blk - dst_c % blk);
+                src_off = c / blk * src_blk.strides[1] + c % blk;
+                dst_off = dst_c / blk * dst_blk.strides[1] + dst_c % blk;
+            }
+            jcp_.segments.push_back({i, src_off, dst_off, (int)len});
+            c += len;
+        }
+        c_off += C;
+    }
+
+    // Channels in the padded area of the destination must be zero.
+    const dim_t C = dst_d.dims()[1];
+    const dim_t C_padded = dst_d.padded_dims()[1];
+    if (jcp_.is_blocked && C_padded > C)
+        jcp_.segments.push_back({-1, 0,
+                C / blk * dst_blk.strides[1] + C % blk, (int)(C_padded - C)});
+
+    // Every task copies at least 16 KB if the image is large enough.
+    const dim_t npixels = jcp_.outer_size * jcp_.nspatial;
+    const dim_t pixel_size
+            = nstl::max<dim_t>(1, dst_d.size() / nstl::max<dim_t>(1, npixels));
+    jcp_.sp_block = nstl::max<dim_t>(1,
+            nstl::min<dim_t>(jcp_.nspatial, utils::div_up(16384, pixel_size)));
+
+    // Bypass the cache when the destination wouldn't fit anyway and would
+    // only evict the data of the next layer.
+    const size_t llc_size = platform::get_per_core_cache_size(3)
+            * dnnl_get_max_threads();
+    jcp_.use_nt = dst_d.size() > llc_size;
+
+    return status::success;
+}
+
+void jit_avx512_core_concat_t::pd_t::init_scratchpad() {
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<const void *>(key_concat_iptrs, n_inputs());
+}
+
+status_t jit_avx512_core_concat_t::init(engine_t *engine) {
+    const auto &jcp = pd()->jcp_;
+    CHECK(safe_ptr_assign(
+            kernel_, new jit_avx512_core_concat_kernel_t(jcp, false)));
+    CHECK(kernel_->create_kernel());
+    if (jcp.use_nt) {
+        CHECK(safe_ptr_assign(
+                kernel_nt_, new jit_avx512_core_concat_kernel_t(jcp, true)));
+        CHECK(kernel_nt_->create_kernel());
+    }
+    return status::success;
+}
+
+status_t jit_avx512_core_concat_t::execute(const exec_ctx_t &ctx) const {
+    const auto &jcp = pd()->jcp_;
+
+    auto srcs = ctx.get_scratchpad_grantor().template get<const void *>(
+            key_concat_iptrs);
+    for (int i = 0; i < pd()->n_inputs(); i++) {
+        const memory_desc_wrapper src_d(pd()->src_md(i));
+        const auto *src = CTX_IN_MEM(const char *, DNNL_ARG_MULTIPLE_SRC + i);
+        srcs[i] = src ? src + src_d.offset0() * src_d.data_type_size()
+                      : nullptr;
+    }
+
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+    if (dst == nullptr) return status::success;
+    dst += dst_d.offset0() * dst_d.data_type_size();
+
+    const bool is_aligned = reinterpret_cast<uintptr_t>(dst) % 64 == 0;
+    const auto *kernel
+            = kernel_nt_ && is_aligned ? kernel_nt_.get() : kernel_.get();
+
+    const dim_t nsp_blocks = utils::div_up(jcp.nspatial, jcp.sp_block);
+    parallel_nd(jcp.outer_size, nsp_blocks, [&](dim_t n, dim_t spb) {
+        jit_concat_call_t args;
+        args.srcs = srcs;
+        args.dst = dst;
+        args.outer = n;
+        args.sp = spb * jcp.sp_block;
+        args.nsp = nstl::min(jcp.sp_block, jcp.nspatial - args.sp);
+        (*kernel)(&args);
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
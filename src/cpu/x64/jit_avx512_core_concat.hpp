@@ -0,0 +1,117 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_AVX512_CORE_CONCAT_HPP
+#define CPU_X64_JIT_AVX512_CORE_CONCAT_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_concat_pd.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// A contiguous piece of channels copied from an input to the destination.
+// The offsets are in elements relative to the first pixel of the image and
+// the length doesn't exceed a vector of 16 elements. A segment with a
+// negative input index fills padded channels of the destination with zeros.
+struct jit_concat_segment_t {
+    int input;
+    dim_t src_off;
+    dim_t dst_off;
+    int len;
+};
+
+// Every tensor is viewed as [outer][channel blocks][pixels][block], where
+// the outer dimension is the batch and pixels are the spatial points. The
+// channels-last layout is a single block of all the channels.
+struct jit_concat_conf_t {
+    bool is_blocked;
+    dim_t outer_size;
+    dim_t nspatial;
+    dim_t sp_block;
+    bool use_nt;
+
+    data_type_t dst_dt;
+    dim_t dst_outer_stride;
+    dim_t dst_pixel_stride;
+
+    std::vector<data_type_t> src_dt;
+    std::vector<dim_t> src_outer_stride;
+    std::vector<dim_t> src_pixel_stride;
+
+    std::vector<jit_concat_segment_t> segments;
+};
+
+struct jit_concat_call_t {
+    const void *const *srcs;
+    void *dst;
+    dim_t outer;
+    dim_t sp;
+    dim_t nsp;
+};
+
+// Concatenation over channels of nC[d][h]w16c, nC[d][h]w8c or channels-last
+// tensors. Channels of the inputs don't have to be aligned with the blocks
+// of the destination and the inputs may have different data types.
+struct jit_avx512_core_concat_t : public primitive_t {
+    struct pd_t : public cpu_concat_pd_t {
+        using cpu_concat_pd_t::cpu_concat_pd_t;
+
+        DECLARE_CONCAT_PD_T(JIT_IMPL_NAME_HELPER("jit:", avx512_core, ""),
+                jit_avx512_core_concat_t);
+
+        status_t init(engine_t *engine);
+
+        jit_concat_conf_t jcp_;
+
+    private:
+        status_t init_dst_md();
+        status_t init_conf();
+        void init_scratchpad();
+    };
+
+    jit_avx512_core_concat_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_generator_t> kernel_;
+    // The same kernel with non-temporal stores of full blocks. Used when the
+    // destination is aligned.
+    std::unique_ptr<jit_generator_t> kernel_nt_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
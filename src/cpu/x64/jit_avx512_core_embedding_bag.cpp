@@ -0,0 +1,446 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cfloat>
+#include <climits>
+#include <cstring>
+
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/x64/jit_avx512_core_embedding_bag.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+#define GET_OFF(field) offsetof(call_params_t, field)
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::alg_kind;
+
+namespace {
+constexpr int simd_w = 16;
+// Accumulators of a chunk are kept in zmm0..zmm23.
+constexpr int max_acc_vecs = 24;
+// Rows looked up ahead of the accumulated one.
+constexpr int prefetch_distance = 8;
+constexpr int cache_line_size = 64;
+} // namespace
+
+struct jit_avx512_core_embedding_bag_kernel_t : public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_embedding_bag_kernel_t)
+
+    struct call_params_t {
+        // The embedding table and the destination row, both shifted to the
+        // first column of the chunk.
+        const void *src;
+        void *dst;
+        // Indices and per-sample weights of the bag.
+        const int32_t *indices;
+        const float *weights;
+        const float *scales;
+        // Rows in the bag, at least one.
+        dim_t nindices;
+        // Leading rows of the bag for which the row `prefetch_distance`
+        // indices ahead is prefetched.
+        dim_t nprefetch;
+        // Multiplier of the pooled values, covers the mean and the common
+        // scale for linear algorithms.
+        float out_scale;
+    };
+
+    jit_avx512_core_embedding_bag_kernel_t(
+            const jit_avx512_core_embedding_bag_t::pd_t *pd, dim_t width)
+        : jit_generator_t(jit_name())
+        , alg_(pd->desc()->alg_kind)
+        , src_dt_(pd->src_md(0)->data_type)
+        , dst_dt_(pd->dst_md()->data_type)
+        , src_dsz_((int)types::data_type_size(src_dt_))
+        , dst_dsz_((int)types::data_type_size(dst_dt_))
+        , row_stride_(memory_desc_wrapper(pd->src_md(0))
+                                      .blocking_desc()
+                                      .strides[0]
+                  * src_dsz_)
+        , with_weights_(pd->with_weights())
+        , nvecs_((int)utils::div_up(width, simd_w))
+        , tail_((int)(width % simd_w))
+        , nlines_((int)utils::div_up(width * src_dsz_, cache_line_size)) {
+        const auto &scales = pd->attr()->scales_;
+        if (!scales.has_default_values(DNNL_ARG_SRC))
+            scale_mode_ = scales.get_mask(DNNL_ARG_SRC) ? per_row : common;
+    }
+
+    void operator()(const call_params_t *p) const {
+        jit_generator_t::operator()(p);
+    }
+
+private:
+    using Vmm = Zmm;
+    enum scale_mode_t { none, common, per_row };
+
+    const alg_kind_t alg_;
+    const data_type_t src_dt_;
+    const data_type_t dst_dt_;
+    const int src_dsz_;
+    const int dst_dsz_;
+    const dim_t row_stride_;
+    const bool with_weights_;
+    const int nvecs_;
+    const int tail_;
+    const int nlines_;
+    scale_mode_t scale_mode_ = none;
+
+    const Reg64 reg_param = abi_param1;
+    const Reg64 reg_src = r8;
+    const Reg64 reg_dst = r9;
+    const Reg64 reg_indices = r10;
+    const Reg64 reg_weights = r11;
+    const Reg64 reg_scales = r12;
+    const Reg64 reg_n = r13;
+    const Reg64 reg_npf = r14;
+    const Reg64 reg_row = r15;
+    const Reg64 reg_pf_row = rax;
+    const Reg64 reg_idx = rbx;
+    const Reg64 reg_tmp = rdx;
+
+    const Opmask k_tail = k2;
+
+    static Vmm vmm_acc(int j) { return Vmm(j); }
+    const Vmm vmm_mul = Vmm(max_acc_vecs);
+    const Vmm vmm_val = Vmm(max_acc_vecs + 1);
+    const Ymm ymm_cvt = Ymm(max_acc_vecs + 2);
+
+    // Rows are multiplied by a per-row scale, a per-sample weight, or a
+    // common scale that can't be applied after a max.
+    bool with_row_mul() const {
+        return scale_mode_ == per_row || with_weights_
+                || (scale_mode_ == common && alg_ == embedding_bag_max);
+    }
+    bool with_out_scale() const {
+        return alg_ == embedding_bag_mean
+                || (scale_mode_ == common && alg_ != embedding_bag_max);
+    }
+    bool is_tail(int j) const { return tail_ > 0 && j == nvecs_ - 1; }
+
+    void load(const Vmm &v, const Address &addr, bool is_tail) {
+        const Vmm vm = is_tail ? v | k_tail | T_z : v;
+        switch (src_dt_) {
+            case f32: vmovups(vm, addr); break;
+            case bf16:
+                vpmovzxwd(vm, addr);
+                vpslld(v, v, 16);
+                break;
+            case f16: vcvtph2ps(vm, addr); break;
+            case s8:
+                vpmovsxbd(vm, addr);
+                vcvtdq2ps(v, v);
+                break;
+            case u8:
+                vpmovzxbd(vm, addr);
+                vcvtdq2ps(v, v);
+                break;
+            default: assert(!"unsupported data type");
+        }
+    }
+
+    void store(const Address &addr, const Vmm &v, bool is_tail) {
+        const Address am = is_tail ? addr | k_tail : addr;
+        switch (dst_dt_) {
+            case f32: vmovups(am, v); break;
+            case bf16:
+                vcvtneps2bf16(ymm_cvt, v);
+                vmovdqu16(am, ymm_cvt);
+                break;
+            case f16:
+                vcvtps2ph(ymm_cvt, v, _op_mxcsr);
+                vmovdqu16(am, ymm_cvt);
+                break;
+            default: assert(!"unsupported data type");
+        }
+    }
+
+    void prefetch_row() {
+        movsxd(reg_pf_row,
+                dword[reg_indices + prefetch_distance * sizeof(int32_t)]);
+        imul(reg_pf_row, reg_pf_row, (int)row_stride_);
+        for (int l = 0; l < nlines_; l++)
+            prefetcht0(ptr[reg_src + reg_pf_row + l * cache_line_size]);
+    }
+
+    void accumulate_row() {
+        movsxd(reg_idx, dword[reg_indices]);
+        imul(reg_row, reg_idx, (int)row_stride_);
+
+        if (scale_mode_ == per_row)
+            vbroadcastss(vmm_mul, ptr[reg_scales + reg_idx * sizeof(float)]);
+        if (with_weights_) {
+            if (scale_mode_ == per_row)
+                vmulps(vmm_mul, vmm_mul, ptr_b[reg_weights]);
+            else
+                vbroadcastss(vmm_mul, ptr[reg_weights]);
+        }
+
+        for (int j = 0; j < nvecs_; j++) {
+            load(vmm_val, ptr[reg_src + reg_row + j * simd_w * src_dsz_],
+                    is_tail(j));
+            const Vmm acc = vmm_acc(j);
+            if (alg_ == embedding_bag_max) {
+                if (with_row_mul()) vmulps(vmm_val, vmm_val, vmm_mul);
+                vmaxps(acc, acc, vmm_val);
+            } else if (with_row_mul()) {
+                vfmadd231ps(acc, vmm_val, vmm_mul);
+            } else {
+                vaddps(acc, acc, vmm_val);
+            }
+        }
+    }
+
+    void advance() {
+        add(reg_indices, sizeof(int32_t));
+        if (with_weights_) add(reg_weights, sizeof(float));
+    }
+
+    void generate() override {
+        preamble();
+
+        mov(reg_src, ptr[reg_param + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_param + GET_OFF(dst)]);
+        mov(reg_indices, ptr[reg_param + GET_OFF(indices)]);
+        if (with_weights_) mov(reg_weights, ptr[reg_param + GET_OFF(weights)]);
+        if (scale_mode_ != none)
+            mov(reg_scales, ptr[reg_param + GET_OFF(scales)]);
+        mov(reg_n, ptr[reg_param + GET_OFF(nindices)]);
+        mov(reg_npf, ptr[reg_param + GET_OFF(nprefetch)]);
+
+        if (tail_ > 0) {
+            mov(reg_tmp.cvt32(), (1 << tail_) - 1);
+            kmovw(k_tail, reg_tmp.cvt32());
+        }
+
+        if (alg_ == embedding_bag_max) {
+            mov(reg_tmp.cvt32(), float2int(-FLT_MAX));
+            vpbroadcastd(vmm_acc(0), reg_tmp.cvt32());
+            for (int j = 1; j < nvecs_; j++)
+                vmovaps(vmm_acc(j), vmm_acc(0));
+        } else {
+            for (int j = 0; j < nvecs_; j++)
+                vpxord(vmm_acc(j), vmm_acc(j), vmm_acc(j));
+        }
+        if (scale_mode_ == common && alg_ == embedding_bag_max)
+            vbroadcastss(vmm_mul, ptr[reg_scales]);
+
+        // nprefetch never exceeds nindices, so the first loop either ends
+        // the bag or hands the remaining rows over to the second one.
+        Label l_pf_loop, l_loop, l_end;
+        L(l_pf_loop);
+        {
+            cmp(reg_npf, 0);
+            jle(l_loop, T_NEAR);
+            prefetch_row();
+            accumulate_row();
+            advance();
+            dec(reg_npf);
+            dec(reg_n);
+            jnz(l_pf_loop, T_NEAR);
+            jmp(l_end, T_NEAR);
+        }
+        L(l_loop);
+        {
+            accumulate_row();
+            advance();
+            dec(reg_n);
+            jnz(l_loop, T_NEAR);
+        }
+        L(l_end);
+
+        if (with_out_scale()) {
+            vbroadcastss(vmm_val, ptr[reg_param + GET_OFF(out_scale)]);
+            for (int j = 0; j < nvecs_; j++)
+                vmulps(vmm_acc(j), vmm_acc(j), vmm_val);
+        }
+        for (int j = 0; j < nvecs_; j++)
+            store(ptr[reg_dst + j * simd_w * dst_dsz_], vmm_acc(j),
+                    is_tail(j));
+
+        postamble();
+    }
+};
+
+bool jit_avx512_core_embedding_bag_t::pd_t::formats_ok() const {
+    // Rows of the table and of the destination are contiguous, the tables
+    // are allowed to have padded rows.
+    auto rows_ok = [](const memory_desc_t *md) {
+        const memory_desc_wrapper mdw(md);
+        return mdw.is_plain() && mdw.blocking_desc().strides[1] == 1
+                && mdw.blocking_desc().strides[0] * mdw.data_type_size()
+                < INT_MAX;
+    };
+    return rows_ok(src_md(0)) && rows_ok(dst_md()) && aux_formats_ok();
+}
+
+status_t jit_avx512_core_embedding_bag_t::pd_t::init(engine_t *engine) {
+    const auto src_dt = src_md(0)->data_type;
+    const auto dst_dt = dst_md()->data_type;
+
+    VDISPATCH_EMBEDDING_BAG(mayiuse(avx512_core), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_EMBEDDING_BAG(utils::one_of(src_dt, f32, bf16, f16, s8, u8),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_EMBEDDING_BAG(
+            utils::one_of(dst_dt, f32, bf16, f16), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_EMBEDDING_BAG(
+            IMPLICATION(dst_dt == bf16, mayiuse(avx512_core_bf16)),
+            VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_EMBEDDING_BAG(
+            IMPLICATION(with_weights(), weights_md()->data_type == f32),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_EMBEDDING_BAG(
+            attr()->has_default_values(primitive_attr_t::skip_mask_t::scales),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_EMBEDDING_BAG(
+            set_default_params() == status::success, VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_EMBEDDING_BAG(formats_ok(), VERBOSE_UNSUPPORTED_TAG);
+
+    chunk_ = nstl::min(embedding_dim(), (dim_t)max_acc_vecs * simd_w);
+    nthr_ = dnnl_get_max_threads();
+
+    return status::success;
+}
+
+jit_avx512_core_embedding_bag_t::jit_avx512_core_embedding_bag_t(
+        const pd_t *apd)
+    : primitive_t(apd) {}
+jit_avx512_core_embedding_bag_t::~jit_avx512_core_embedding_bag_t() = default;
+
+status_t jit_avx512_core_embedding_bag_t::init(engine_t *engine) {
+    const dim_t D = pd()->embedding_dim();
+    const dim_t chunk = pd()->chunk_;
+    if (chunk == 0) return status::success;
+
+    CHECK(safe_ptr_assign(kernel_,
+            new jit_avx512_core_embedding_bag_kernel_t(pd(), chunk)));
+    CHECK(kernel_->create_kernel());
+    if (D % chunk != 0) {
+        CHECK(safe_ptr_assign(tail_kernel_,
+                new jit_avx512_core_embedding_bag_kernel_t(
+                        pd(), D % chunk)));
+        CHECK(tail_kernel_->create_kernel());
+    }
+    return status::success;
+}
+
+status_t jit_avx512_core_embedding_bag_t::execute(
+        const exec_ctx_t &ctx) const {
+    using call_params_t = jit_avx512_core_embedding_bag_kernel_t::call_params_t;
+
+    status_t status = status::success;
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC_0);
+    const auto indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC_1);
+    const auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC_2);
+    const auto weights = pd()->with_weights()
+            ? CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS)
+            : nullptr;
+    auto dst = CTX_OUT_CLEAN_MEM(char *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+    const auto &scales = pd()->attr()->scales_;
+    const bool with_common_scale = !scales.has_default_values(DNNL_ARG_SRC)
+            && scales.get_mask(DNNL_ARG_SRC) == 0;
+
+    const memory_desc_wrapper src_d(pd()->src_md(0));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const auto alg = pd()->desc()->alg_kind;
+    const dim_t D = pd()->embedding_dim();
+    const dim_t chunk = pd()->chunk_;
+    const dim_t nindices = pd()->num_indices();
+    const dim_t nbags = pd()->num_bags();
+    const dim_t src_dsz = src_d.data_type_size();
+    const dim_t dst_dsz = dst_d.data_type_size();
+    const dim_t dst_row_stride = dst_d.blocking_desc().strides[0] * dst_dsz;
+    if (D == 0 || nbags == 0) return status::success;
+
+    // The end of the indices of the bag, the last bag ends with the indices.
+    auto bag_end = [&](dim_t b) { return b < nbags ? offsets[b] : nindices; };
+    // A bag costs its rows plus the store of the destination row.
+    auto cost = [&](dim_t b) { return bag_end(b) + b; };
+    auto find_bag = [&](dim_t work) {
+        dim_t lo = 0, hi = nbags;
+        while (lo < hi) {
+            const dim_t mid = (lo + hi) / 2;
+            if (cost(mid) < work)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo;
+    };
+
+    parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
+        const dim_t total = cost(nbags);
+        const dim_t start = find_bag(total * ithr / nthr);
+        const dim_t end = find_bag(total * (ithr + 1) / nthr);
+        if (start >= end) return;
+
+        // Rows are prefetched up to the last index of the thread.
+        const dim_t pf_end = bag_end(end) - prefetch_distance;
+
+        for (dim_t b = start; b < end; b++) {
+            char *dst_row = dst + b * dst_row_stride;
+            const dim_t begin = offsets[b];
+            const dim_t n = bag_end(b + 1) - begin;
+            if (n <= 0) {
+                // Zero bits are zero in all destination data types.
+                std::memset(dst_row, 0, D * dst_dsz);
+                continue;
+            }
+
+            call_params_t p;
+            p.indices = indices + begin;
+            p.weights = weights ? weights + begin : nullptr;
+            p.scales = src_scales;
+            p.nindices = n;
+            p.nprefetch = nstl::max((dim_t)0, nstl::min(n, pf_end - begin));
+            p.out_scale = 1.f;
+            if (alg == embedding_bag_mean) p.out_scale /= (float)n;
+            if (with_common_scale && alg != embedding_bag_max)
+                p.out_scale *= src_scales[0];
+
+            for (dim_t d = 0; d < D; d += chunk) {
+                p.src = src + d * src_dsz;
+                p.dst = dst_row + d * dst_dsz;
+                const bool is_tail = D - d < chunk;
+                (*(is_tail ? tail_kernel_ : kernel_))(&p);
+            }
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
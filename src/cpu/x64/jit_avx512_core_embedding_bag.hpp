@@ -0,0 +1,82 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_AVX512_CORE_EMBEDDING_BAG_HPP
+#define CPU_X64_JIT_AVX512_CORE_EMBEDDING_BAG_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_embedding_bag_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct jit_avx512_core_embedding_bag_kernel_t;
+
+// Embedding bag over a row-major embedding table.
+//
+// The bags are distributed between the threads by the number of looked up
+// rows, so threads get about the same amount of memory traffic. A kernel
+// call pools the rows of one bag for a chunk of the embedding dimension in
+// registers and writes the chunk of the destination row once. The lookups
+// are latency bound, so while a row is accumulated the kernel prefetches the
+// row looked up a few indices ahead, across the bag boundaries.
+struct jit_avx512_core_embedding_bag_t : public primitive_t {
+    struct pd_t : public cpu_embedding_bag_pd_t {
+        using cpu_embedding_bag_pd_t::cpu_embedding_bag_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", avx512_core, ""),
+                jit_avx512_core_embedding_bag_t);
+
+        status_t init(engine_t *engine);
+
+        // Columns of the embedding dimension handled by a kernel call.
+        dim_t chunk_ = 0;
+        int nthr_ = 0;
+
+    private:
+        bool formats_ok() const;
+    };
+
+    jit_avx512_core_embedding_bag_t(const pd_t *apd);
+    ~jit_avx512_core_embedding_bag_t() override;
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    // Kernels for a full chunk and for the chunk at the end of a row.
+    std::unique_ptr<jit_avx512_core_embedding_bag_kernel_t> kernel_;
+    std::unique_ptr<jit_avx512_core_embedding_bag_kernel_t> tail_kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
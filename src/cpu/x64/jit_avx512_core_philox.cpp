@@ -0,0 +1,276 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <limits>
+
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+
+#include "cpu/x64/jit_avx512_core_philox.hpp"
+
+#define GET_OFF(field) offsetof(jit_avx512_core_philox_t::call_params_t, field)
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+
+namespace {
+// Offsets of the constants in the table of the kernel.
+enum {
+    table_iota = 0, // {0, 4, ..., 60}, first elements of the Philox blocks
+    table_one = 64,
+    table_two = 68,
+    table_three = 72,
+    table_step = 76,
+    table_m0 = 80,
+    table_m1 = 84,
+    table_byte1 = 88,
+    table_byte2 = 92,
+    table_byte3 = 96,
+};
+
+constexpr uint32_t philox_m0 = 0xD2511F53;
+constexpr uint32_t philox_m1 = 0xCD9E8D57;
+constexpr uint32_t philox_w0 = 0x9E3779B9;
+constexpr uint32_t philox_w1 = 0xBB67AE85;
+} // namespace
+
+uint32_t jit_avx512_core_philox_t::get_threshold(float p) {
+    p = nstl::max(nstl::min(p, 1.f), 0.f);
+    return static_cast<uint32_t>(
+            double(std::numeric_limits<uint32_t>::max()) * p);
+}
+
+void jit_avx512_core_philox_t::generate_dropout_mask(
+        uint8_t *mask, dim_t nelems, float p, uint32_t seed) const {
+    assert(kind_ == kind_t::dropout_mask);
+    constexpr dim_t block = 64 * elems_per_vec;
+    const uint32_t threshold = get_threshold(p);
+    parallel_nd(utils::div_up(nelems, block), [&](dim_t ib) {
+        const dim_t off = ib * block;
+        call_params_t params;
+        params.dst = mask + off;
+        params.offset = static_cast<size_t>(off);
+        params.size = static_cast<size_t>(nstl::min(block, nelems - off));
+        params.seed = seed;
+        params.threshold = threshold;
+        (*this)(&params);
+    });
+}
+
+void jit_avx512_core_philox_t::generate_random_bits(
+        uint8_t *bits, dim_t size, uint32_t seed) const {
+    assert(kind_ == kind_t::random_bits);
+    constexpr dim_t block = 64 * bytes_per_vec;
+    parallel_nd(utils::div_up(size, block), [&](dim_t ib) {
+        const dim_t off = ib * block;
+        call_params_t params;
+        params.dst = bits + off;
+        // A block of 16 bytes takes 4 values of the counter.
+        params.offset = static_cast<size_t>(off / 4);
+        params.size = static_cast<size_t>(
+                utils::rnd_up(nstl::min(block, size - off), bytes_per_vec));
+        params.seed = seed;
+        params.threshold = 0;
+        (*this)(&params);
+    });
+}
+
+stochastic_round_consts_t::stochastic_round_consts_t(data_type_t dt) {
+    using namespace types;
+    assert(digits<uint32_t>(data_type::f32) >= digits<uint32_t>(dt));
+    vals[trunc_mask] = 0xffffffffu
+            << (digits<uint32_t>(data_type::f32) - digits<uint32_t>(dt));
+    vals[lowest] = utils::bit_cast<uint32_t>(lowest_value<float>(dt));
+    vals[max] = utils::bit_cast<uint32_t>(max_value<float>(dt));
+    vals[min] = utils::bit_cast<uint32_t>(min_value<float>(dt));
+    vals[abs_mask] = 0x7fffffffu;
+}
+
+// hi:lo = a * m for unsigned 32-bit lanes. The products of the even and odd
+// lanes are computed separately as 64-bit values.
+void jit_avx512_core_philox_t::mulhilo(
+        const Vmm &hi, const Vmm &lo, const Vmm &a, const Vmm &m) {
+    vpmuludq(vmm_prod_even, a, m);
+    vpsrlq(vmm_odd, a, 32);
+    vpmuludq(vmm_prod_odd, vmm_odd, m);
+    vpsrlq(hi, vmm_prod_even, 32);
+    vpblendmd(hi | k_odd, hi, vmm_prod_odd);
+    vpsllq(lo, vmm_prod_odd, 32);
+    vpblendmd(lo | k_odd, vmm_prod_even, lo);
+}
+
+// Output i of the block of lane l goes to byte i of dword l.
+void jit_avx512_core_philox_t::store_mask(const int *ctr, bool is_tail) {
+    static const int byte_off[4]
+            = {table_one, table_byte1, table_byte2, table_byte3};
+    vpxord(vmm_res, vmm_res, vmm_res);
+    for (int i = 0; i < 4; i++) {
+        vpcmpud(k_keep, Vmm(ctr[i]), vmm_thr, _cmp_nle_us);
+        vpord(vmm_res | k_keep, vmm_res, ptr_b[reg_table + byte_off[i]]);
+    }
+    vmovdqu8(is_tail ? ptr[reg_dst] | k_tail : ptr[reg_dst], vmm_res);
+}
+
+// Output i of the block of lane l goes to dword 4 * l + i. The 4 x 4 dwords
+// of every 128-bit lane are transposed first, then the 128-bit lanes.
+void jit_avx512_core_philox_t::store_bits(const int *ctr, const int *spare) {
+    const Vmm o0(ctr[0]), o1(ctr[1]), o2(ctr[2]), o3(ctr[3]);
+    const Vmm t0(spare[0]), t1(spare[1]), t2(spare[2]), t3(spare[3]);
+    vpunpckldq(t0, o0, o1);
+    vpunpckhdq(t1, o0, o1);
+    vpunpckldq(t2, o2, o3);
+    vpunpckhdq(t3, o2, o3);
+    // Lane j of register i holds block 4 * j + i.
+    vpunpcklqdq(o0, t0, t2);
+    vpunpckhqdq(o1, t0, t2);
+    vpunpcklqdq(o2, t1, t3);
+    vpunpckhqdq(o3, t1, t3);
+    vshufi32x4(t0, o0, o1, 0x44);
+    vshufi32x4(t1, o0, o1, 0xee);
+    vshufi32x4(t2, o2, o3, 0x44);
+    vshufi32x4(t3, o2, o3, 0xee);
+    vshufi32x4(o0, t0, t2, 0x88);
+    vshufi32x4(o1, t0, t2, 0xdd);
+    vshufi32x4(o2, t1, t3, 0x88);
+    vshufi32x4(o3, t1, t3, 0xdd);
+    for (int i = 0; i < 4; i++)
+        vmovdqu32(ptr[reg_dst + i * bytes_per_vec / 4], Vmm(ctr[i]));
+}
+
+void jit_avx512_core_philox_t::compute(bool is_tail) {
+    int ctr[4], spare[4];
+    for (int i = 0; i < 4; i++) {
+        ctr[i] = ctr_idx_start + i;
+        spare[i] = ctr_idx_start + 4 + i;
+    }
+
+    vmovdqa32(Vmm(ctr[0]), vmm_x);
+    vpaddd(Vmm(ctr[1]), vmm_x, ptr_b[reg_table + table_one]);
+    vpaddd(Vmm(ctr[2]), vmm_x, ptr_b[reg_table + table_two]);
+    vpaddd(Vmm(ctr[3]), vmm_x, ptr_b[reg_table + table_three]);
+
+    for (int r = 0; r < n_rounds; r++) {
+        const Vmm hi0(spare[0]), lo0(spare[1]), hi1(spare[2]), lo1(spare[3]);
+        mulhilo(hi0, lo0, Vmm(ctr[0]), vmm_m0);
+        mulhilo(hi1, lo1, Vmm(ctr[2]), vmm_m1);
+        vpternlogd(hi1, Vmm(ctr[1]), key(r, 0), 0x96);
+        vpternlogd(hi0, Vmm(ctr[3]), key(r, 1), 0x96);
+
+        const int next[4] = {hi1.getIdx(), lo1.getIdx(), hi0.getIdx(),
+                lo0.getIdx()};
+        for (int i = 0; i < 4; i++) {
+            spare[i] = ctr[i];
+            ctr[i] = next[i];
+        }
+    }
+
+    if (kind_ == kind_t::dropout_mask)
+        store_mask(ctr, is_tail);
+    else
+        store_bits(ctr, spare);
+}
+
+void jit_avx512_core_philox_t::generate() {
+    constexpr int keys_size = 2 * n_rounds * sizeof(uint32_t);
+    const bool is_mask = kind_ == kind_t::dropout_mask;
+    const int step = is_mask ? elems_per_vec : bytes_per_vec;
+
+    preamble();
+    sub(rsp, keys_size);
+
+    mov(reg_dst, ptr[reg_param + GET_OFF(dst)]);
+    mov(reg_size, ptr[reg_param + GET_OFF(size)]);
+    mov(reg_table, l_table);
+
+    // The key schedule only depends on the seed.
+    const Reg32 reg_key0 = reg_tmp.cvt32(), reg_key1 = r11d;
+    mov(reg_key0, dword[reg_param + GET_OFF(seed)]);
+    mov(reg_key1, reg_key0);
+    for (int r = 0; r < n_rounds; r++) {
+        mov(dword[rsp + (2 * r) * sizeof(uint32_t)], reg_key0);
+        mov(dword[rsp + (2 * r + 1) * sizeof(uint32_t)], reg_key1);
+        if (r + 1 == n_rounds) break;
+        add(reg_key0, philox_w0);
+        add(reg_key1, philox_w1);
+    }
+
+    if (is_mask) vpbroadcastd(vmm_thr, dword[reg_param + GET_OFF(threshold)]);
+    vpbroadcastd(vmm_x, dword[reg_param + GET_OFF(offset)]);
+    vpaddd(vmm_x, vmm_x, ptr[reg_table + table_iota]);
+    vpbroadcastd(vmm_m0, ptr[reg_table + table_m0]);
+    vpbroadcastd(vmm_m1, ptr[reg_table + table_m1]);
+    mov(reg_tmp.cvt32(), 0xaaaa);
+    kmovw(k_odd, reg_tmp.cvt32());
+
+    // The random bits are always stored by full vectors.
+    Label l_loop, l_tail, l_done;
+    L(l_loop);
+    {
+        if (is_mask) {
+            cmp(reg_size, step);
+            jl(l_tail, T_NEAR);
+        } else {
+            test(reg_size, reg_size);
+            jle(l_done, T_NEAR);
+        }
+        compute(false);
+        add(reg_dst, step);
+        vpaddd(vmm_x, vmm_x, ptr_b[reg_table + table_step]);
+        sub(reg_size, step);
+        jmp(l_loop, T_NEAR);
+    }
+    L(l_tail);
+    if (is_mask) {
+        test(reg_size, reg_size);
+        jz(l_done, T_NEAR);
+        mov(reg_tail, reg_size);
+        mov(reg_tmp, 1);
+        shl(reg_tmp, reg_tail.cvt8());
+        sub(reg_tmp, 1);
+        kmovq(k_tail, reg_tmp);
+        compute(true);
+    }
+    L(l_done);
+
+    add(rsp, keys_size);
+    postamble();
+
+    align(64);
+    L(l_table);
+    for (int l = 0; l < 16; l++)
+        dd(4 * l);
+    dd(1);
+    dd(2);
+    dd(3);
+    dd(4 * 16);
+    dd(philox_m0);
+    dd(philox_m1);
+    dd(1u << 8);
+    dd(1u << 16);
+    dd(1u << 24);
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
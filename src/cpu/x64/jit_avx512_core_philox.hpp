@@ -0,0 +1,152 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#ifndef CPU_X64_JIT_AVX512_CORE_PHILOX_HPP
+#define CPU_X64_JIT_AVX512_CORE_PHILOX_HPP
+
+#include <stdint.h>
+
+#include "common/c_types_map.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Vectorized Philox4x32-10 generator of the random values used by the
+// dropout attribute and by the stochastic rounding mode.
+//
+// A lane of the kernel runs the 10 rounds of one Philox block, so a vector
+// computes the 16 blocks with counters {x, x + 4, ..., x + 60}. The outputs
+// are the same as the ones of math::philox4x32() for the same seed.
+//
+// - `dropout_mask`: the element at offset i is kept when philox4x32(i, seed)
+//   is above UINT32_MAX * p, which gives the same mask as ref_dropout(). A
+//   vector produces 64 elements of the mask.
+// - `random_bits`: the blocks are stored as they are, block b at byte 16 * b
+//   of the buffer. Byte i of the buffer is then the bias of element i of
+//   math::philox16x8(), and bytes 2 * i and 2 * i + 1 are the bias of element
+//   i of math::philox8x16(). A vector produces 256 bytes.
+struct jit_avx512_core_philox_t : public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx512_core_philox_t)
+
+    enum class kind_t { dropout_mask, random_bits };
+
+    struct call_params_t {
+        uint8_t *dst;
+        // Counter of the first block, must be a multiple of 4 * 16.
+        size_t offset;
+        // Number of mask elements or of random bytes.
+        size_t size;
+        uint32_t seed;
+        uint32_t threshold;
+    };
+
+    jit_avx512_core_philox_t(kind_t kind)
+        : jit_generator_t(jit_name()), kind_(kind) {}
+
+    void operator()(call_params_t *params) const {
+        jit_generator_t::operator()(params);
+        msan_unpoison(params->dst, params->size);
+    }
+
+    // Fills the mask of elements [0, nelems) in parallel.
+    void generate_dropout_mask(
+            uint8_t *mask, dim_t nelems, float p, uint32_t seed) const;
+    // Fills bytes [0, size) of the random bits in parallel. The buffer must
+    // be padded to a multiple of bytes_per_vec.
+    void generate_random_bits(uint8_t *bits, dim_t size, uint32_t seed) const;
+
+    // Elements with a random value above the threshold are kept.
+    static uint32_t get_threshold(float p);
+    // Scale of the kept elements.
+    static float get_inv_q(float p) { return p != 1.f ? 1.f / (1.f - p) : 0.f; }
+
+    // Size of the random bias of an element rounded to `dt`.
+    static int rnd_bias_size(data_type_t dt) {
+        return types::data_type_size(dt) == 2 ? 1 : 2;
+    }
+
+    static constexpr int elems_per_vec = 64;
+    static constexpr int bytes_per_vec = 256;
+
+private:
+    using Vmm = Xbyak::Zmm;
+    static constexpr int n_rounds = 10;
+
+    const kind_t kind_;
+
+    const Xbyak::Reg64 reg_param = abi_param1;
+    const Xbyak::Reg64 reg_dst = r8;
+    const Xbyak::Reg64 reg_size = r9;
+    const Xbyak::Reg64 reg_table = r10;
+    const Xbyak::Reg64 reg_tmp = rax;
+    const Xbyak::Reg64 reg_tail = rcx;
+
+    const Xbyak::Opmask k_tail = Xbyak::Opmask(1);
+    const Xbyak::Opmask k_odd = Xbyak::Opmask(2);
+    const Xbyak::Opmask k_keep = Xbyak::Opmask(3);
+
+    const Vmm vmm_x = Vmm(0);
+    const Vmm vmm_thr = Vmm(1);
+    const Vmm vmm_m0 = Vmm(2);
+    const Vmm vmm_m1 = Vmm(3);
+    const Vmm vmm_prod_even = Vmm(4);
+    const Vmm vmm_prod_odd = Vmm(5);
+    const Vmm vmm_odd = Vmm(6);
+    const Vmm vmm_res = Vmm(7);
+    // Counters and products of a round take turns in these registers.
+    static constexpr int ctr_idx_start = 8;
+
+    Xbyak::Label l_table;
+
+    Xbyak::Address key(int round, int i) {
+        return ptr_b[rsp + (2 * round + i) * sizeof(uint32_t)];
+    }
+    void mulhilo(const Vmm &hi, const Vmm &lo, const Vmm &a, const Vmm &m);
+    void store_mask(const int *ctr, bool is_tail);
+    void store_bits(const int *ctr, const int *spare);
+    void compute(bool is_tail);
+    void generate() override;
+};
+
+// Constants of the stochastic rounding of f32 values to `dt`, see
+// math::stochastic_round_fwd(). The rounding adds the random bias to the
+// bits of the value, truncates the mantissa to the precision of `dt`, then
+// saturates the result and flushes the values below the smallest normal
+// number of `dt` to zero. The converted value is then exact.
+struct stochastic_round_consts_t {
+    enum { trunc_mask, lowest, max, min, abs_mask, n_consts };
+
+    stochastic_round_consts_t(data_type_t dt);
+
+    uint32_t vals[n_consts];
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
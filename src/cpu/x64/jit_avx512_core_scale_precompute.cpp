@@ -119,6 +119,14 @@ void jit_avx512_core_scale_precompute_t::cvt2ps(data_type_t type_in,
             vpmovzxwd(vmm, op);
             vpslld(vmm_in, vmm_in, 0x10);
             break;
+        case data_type::e8m0:
+            // The biased exponent goes straight to the f32 exponent, and
+            // 0xff, which becomes inf, is turned into NaN as inf - inf.
+            vpmovzxbd(vmm, op);
+            vpslld(vmm_in, vmm_in, 23);
+            vfpclassps(knan_mask_, vmm_in, 0x18);
+            vsubps(vmm_in | knan_mask_, vmm_in, vmm_in);
+            break;
         default: assert(!"unsupported data type");
     }
 }
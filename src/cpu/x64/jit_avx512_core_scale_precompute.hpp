@@ -110,6 +110,7 @@ private:
     Xbyak::Reg32 reg_mask_ = eax;
 
     const Xbyak::Opmask ktail_f32_mask_ = Xbyak::Opmask(1);
+    const Xbyak::Opmask knan_mask_ = Xbyak::Opmask(2);
 
     const Vmm vmm_dst_ = Vmm(0);
     const Vmm vmm_wei_scales_ = Vmm(1);
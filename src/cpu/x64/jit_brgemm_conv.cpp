@@ -849,6 +849,7 @@ inline int brgemm_convolution_fwd_t<isa>::get_comp_offset(const int g,
 
 template <cpu_isa_t isa>
 status_t brgemm_convolution_fwd_t<isa>::init(engine_t *engine) {
+    jit_code_blob_t::scope_t jit_code_blob_scope(jit_code_blob_, cache_blob());
 
     const auto _pd = pd();
     const auto &jcp = _pd->jcp_;
@@ -144,6 +144,15 @@ struct brgemm_convolution_fwd_t : public primitive_t {
 
     status_t execute(const exec_ctx_t &ctx) const override;
 
+    status_t get_cache_blob_size(
+            engine_t *engine, size_t *size) const override {
+        return jit_code_blob_.get_cache_blob_size(size);
+    }
+    status_t get_cache_blob(
+            engine_t *engine, cache_blob_t &cache_blob) const override {
+        return jit_code_blob_.get_cache_blob(cache_blob);
+    }
+
 protected:
     status_t init(engine_t *engine) override;
 
@@ -237,6 +246,8 @@ private:
 
     std::unique_ptr<jit_avx512_core_scale_precompute_t> jit_scale_precompute_;
 
+    jit_code_blob_t jit_code_blob_;
+
     size_t acc_dsz, bia_dsz, src_dsz, wei_dsz, dst_dsz;
 
     const memory_desc_wrapper bias_d;
@@ -268,7 +268,7 @@ status_t brgemm_convolution_bwd_weights_t::init(engine_t *engine) {
         CHECK(diff_bias_kernel_->create_kernel());
     }
 
-    if (jcp.nthr_mb > 1) {
+    if (jcp.nb_red_blk > 1) {
         CHECK(safe_ptr_assign(
                 acc_ker_, new cpu_accumulator_1d_t<data_type::f32>()));
         CHECK(acc_ker_->create_kernel());
@@ -336,6 +336,8 @@ struct brgemm_convolution_bwd_weights_t::thread_info_t {
     int ithr_but_oc = 0;
     int ithr_but_ic = 0;
 
+    // Blocks of the reduction owned by the thread and the one being computed
+    int red_blk_start = 0, red_blk_end = 0, red_blk = 0;
     int img_start = 0, img_end = 0, img_work = 0;
     int g_start = 0, g_end = 0, g_work = 0;
     int oc_b_start = 0, oc_b_end = 0, oc_b_work = 0;
@@ -385,8 +387,8 @@ struct brgemm_convolution_bwd_weights_t::thread_info_t {
             const size_t wei_size = jcp.ngroups * jcp.nb_oc * jcp.oc_block
                     * jcp.nb_ic * jcp.ic_block * jcp.kh * jcp.kw * jcp.kd;
             const int num_wei_buffers = jcp.wei_dt != data_type::f32
-                    ? jcp.nthr_mb
-                    : jcp.nthr_mb - 1;
+                    ? jcp.nb_red_blk
+                    : jcp.nb_red_blk - 1;
             bia_reduction = wei_bia_reduction + wei_size * num_wei_buffers;
         }
 
@@ -404,10 +406,10 @@ struct brgemm_convolution_bwd_weights_t::thread_info_t {
         ithr_but_ic
                 = (ithr_mb * jcp.nthr_g + ithr_g) * jcp.nthr_oc_b + ithr_oc_b;
 
-        int work_amount = jcp.nthr_mb_work;
         /* reduction dimension */
-        balance211(work_amount, jcp.nthr_mb, ithr_mb, img_start, img_end);
-        img_work = img_end - img_start;
+        balance211(jcp.nb_red_blk, jcp.nthr_mb, ithr_mb, red_blk_start,
+                red_blk_end);
+        set_red_blk(red_blk_start);
 
         /* independent dimensions */
         balance211(jcp.ngroups, jcp.nthr_g, ithr_g, g_start, g_end);
@@ -450,6 +452,13 @@ struct brgemm_convolution_bwd_weights_t::thread_info_t {
 
     const pd_t *pd() const { return self->pd(); }
 
+    void set_red_blk(int blk) {
+        red_blk = blk;
+        balance211(jcp.nthr_mb_work, jcp.nb_red_blk, red_blk, img_start,
+                img_end);
+        img_work = img_end - img_start;
+    }
+
     inline int get_inp_start(int out_s, int pad, int str) const {
         return nstl::max(0, -pad + out_s * str);
     }
@@ -868,20 +877,20 @@ void brgemm_convolution_bwd_weights_t::compute_diff_weights_2d(
 
     float *diff_wei;
     if (diff_weights_d.data_type() != data_type::f32)
-        diff_wei = ti->wei_bia_reduction + (ti->ithr_mb) * wei_size;
+        diff_wei = ti->wei_bia_reduction + (ti->red_blk) * wei_size;
     else
-        diff_wei = ti->ithr_mb == 0
+        diff_wei = ti->red_blk == 0
                 ? (float *)ti->diff_weights
-                : ti->wei_bia_reduction + (ti->ithr_mb - 1) * wei_size;
+                : ti->wei_bia_reduction + (ti->red_blk - 1) * wei_size;
 
     float *diff_bias = nullptr;
     if (jcp.with_bias) {
         if (jcp.bia_dt != data_type::f32)
-            diff_bias = ti->bia_reduction + (ti->ithr_mb) * bias_buf_size;
+            diff_bias = ti->bia_reduction + (ti->red_blk) * bias_buf_size;
         else
-            diff_bias = ti->ithr_mb == 0
+            diff_bias = ti->red_blk == 0
                     ? (float *)ti->diff_bias
-                    : ti->bia_reduction + (ti->ithr_mb - 1) * bias_buf_size;
+                    : ti->bia_reduction + (ti->red_blk - 1) * bias_buf_size;
     }
 
     int img {0}, oh_s {0};
@@ -1041,20 +1050,20 @@ void brgemm_convolution_bwd_weights_t::compute_diff_weights_3d(
 
     float *diff_wei;
     if (diff_weights_d.data_type() != data_type::f32)
-        diff_wei = ti->wei_bia_reduction + (ti->ithr_mb) * wei_size;
+        diff_wei = ti->wei_bia_reduction + (ti->red_blk) * wei_size;
     else
-        diff_wei = ti->ithr_mb == 0
+        diff_wei = ti->red_blk == 0
                 ? (float *)ti->diff_weights
-                : ti->wei_bia_reduction + (ti->ithr_mb - 1) * wei_size;
+                : ti->wei_bia_reduction + (ti->red_blk - 1) * wei_size;
 
     float *diff_bias = nullptr;
     if (jcp.with_bias) {
         if (jcp.bia_dt != data_type::f32)
-            diff_bias = ti->bia_reduction + (ti->ithr_mb) * bias_buf_size;
+            diff_bias = ti->bia_reduction + (ti->red_blk) * bias_buf_size;
         else
-            diff_bias = ti->ithr_mb == 0
+            diff_bias = ti->red_blk == 0
                     ? (float *)ti->diff_bias
-                    : ti->bia_reduction + (ti->ithr_mb - 1) * bias_buf_size;
+                    : ti->bia_reduction + (ti->red_blk - 1) * bias_buf_size;
     }
 
     int img {0}, od_s {0};
@@ -1292,7 +1301,7 @@ void brgemm_convolution_bwd_weights_t::reduce_and_convert_diff_weights_and_bias(
     const bool is_f32_out = wei_dt == data_type::f32;
     const bool is_f32_bias = bia_dt == data_type::f32;
 
-    if (jcp.nthr_mb == 1) {
+    if (jcp.nb_red_blk == 1) {
         if (!is_f32_out) {
             // reduction is not required, only conversion
             if (jcp.transform_to_vnni) {
@@ -1331,7 +1340,7 @@ void brgemm_convolution_bwd_weights_t::reduce_and_convert_diff_weights_and_bias(
         return;
     }
 
-    /* diff_weights[:] += sum(wei_reduction_[thr_mb][:]) */
+    /* diff_weights[:] += sum(wei_reduction_[red_blk][:]) */
     if (jcp.global_transpose)
         simple_barrier::barrier(ti->wei_bia_reduction_bctx, jcp.nthr);
 
@@ -1351,8 +1360,9 @@ void brgemm_convolution_bwd_weights_t::reduce_and_convert_diff_weights_and_bias(
     balance211(work, jcp.nthr_mb, ti->ithr_mb, start, end);
     if (!jcp.transform_to_vnni && start == end) return;
 
-    const int _start_nthr_mb = 1;
-    for (int thr_mb = _start_nthr_mb; thr_mb < jcp.nthr_mb; ++thr_mb) {
+    // Partial sum `dst_blk` += partial sum `src_blk`, the partial sum 0 is the
+    // result. The last step also converts it to the destination data type.
+    auto reduce_blk = [&](int dst_blk, int src_blk, bool is_last) {
         int w = start;
         int sub_g_start {0}, sub_oc_b_start {0}, sub_ic_b_kh_start {0};
         nd_iterator_init(w, sub_g_start, ti->g_work, sub_oc_b_start,
@@ -1375,16 +1385,15 @@ void brgemm_convolution_bwd_weights_t::reduce_and_convert_diff_weights_and_bias(
                     ? wei_offset_int(g, oc_b, ic_b, kX)
                     : off_ext;
 
-            float *wei_reduced = is_f32_out
+            float *wei_reduced = is_f32_out && dst_blk == 0
                     ? (float *)(ti->diff_weights) + off_ext
-                    : ti->wei_bia_reduction + off_int;
+                    : ti->wei_bia_reduction
+                            + (dst_blk - is_f32_out) * wei_size + off_int;
 
-            int thr_mb_buffer_idx = is_f32_out ? thr_mb - 1 : thr_mb;
             float *wei_to_reduce = ti->wei_bia_reduction
-                    + thr_mb_buffer_idx * wei_size + off_int;
+                    + (src_blk - is_f32_out) * wei_size + off_int;
 
-            if (!jcp.transform_to_vnni && !is_f32_out
-                    && thr_mb == jcp.nthr_mb - 1) {
+            if (!jcp.transform_to_vnni && !is_f32_out && is_last) {
                 // the last iteration for bfloat16 requires conversion and
                 // store to diff_weights array
                 if (wei_dt == bf16)
@@ -1412,18 +1421,19 @@ void brgemm_convolution_bwd_weights_t::reduce_and_convert_diff_weights_and_bias(
         if (jcp.with_bias && ti->ithr_ic_b == 0 && ti->ic_b_work > 0
                 && ti->ithr_mb == 0 && ti->img_work > 0) {
             for (int g = ti->g_start; g < ti->g_end; g++) {
-                float *bias_reduced = is_f32_bias ? (float *)(ti->diff_bias)
-                                                  : ti->bia_reduction;
-                int thr_mb_buffer_idx = is_f32_bias ? thr_mb - 1 : thr_mb;
                 int bias_buf_size = jcp.ngroups * jcp.nb_oc * jcp.oc_block;
-                float *bias_to_reduce
-                        = ti->bia_reduction + thr_mb_buffer_idx * bias_buf_size;
+                float *bias_reduced = is_f32_bias && dst_blk == 0
+                        ? (float *)(ti->diff_bias)
+                        : ti->bia_reduction
+                                + (dst_blk - is_f32_bias) * bias_buf_size;
+                float *bias_to_reduce = ti->bia_reduction
+                        + (src_blk - is_f32_bias) * bias_buf_size;
                 const size_t acc_size
                         = nstl::min(jcp.oc, ti->oc_b_end * jcp.oc_block)
                         - ti->oc_b_start * jcp.oc_block;
                 int idx = g * rnd_up(jcp.oc, jcp.oc_block)
                         + ti->oc_b_start * jcp.oc_block;
-                if (!is_f32_bias && thr_mb == jcp.nthr_mb - 1) {
+                if (!is_f32_bias && is_last) {
                     // the last iteration for bfloat16 requires conversion and
                     // store to diff_weights array
                     int diff_bias_idx
@@ -1456,6 +1466,18 @@ void brgemm_convolution_bwd_weights_t::reduce_and_convert_diff_weights_and_bias(
                 }
             }
         }
+    };
+
+    if (jcp.deterministic) {
+        // Pairwise tree over the fixed blocks, so the order of summation
+        // doesn't depend on the number of threads
+        const int nb_blk = jcp.nb_red_blk;
+        for (int step = 1; step < nb_blk; step *= 2)
+            for (int blk = 0; blk + step < nb_blk; blk += 2 * step)
+                reduce_blk(blk, blk + step, 2 * step >= nb_blk);
+    } else {
+        for (int thr_mb = 1; thr_mb < jcp.nthr_mb; ++thr_mb)
+            reduce_blk(0, thr_mb, thr_mb == jcp.nthr_mb - 1);
     }
 
     if (jcp.transform_to_vnni && jcp.global_transpose) {
@@ -1515,7 +1537,7 @@ void brgemm_convolution_bwd_weights_t::prepare_scratchpad_data(
         }
     }
 
-    if (jcp.nthr_mb > 1
+    if (jcp.nb_red_blk > 1
             || pd()->diff_weights_md(0)->data_type != data_type::f32) {
         // TODO: don't use barrier for case
         // diff_weights_type != data_type::f32 && nthr_mb_ == 1
@@ -1535,19 +1557,23 @@ void brgemm_convolution_bwd_weights_t::execute_backward_weights(
         assert(utils::one_of(pd()->ndims(), 3, 4, 5));
 
         thread_info_t thread_info(this, ctx, ithr);
-        switch (jcp.harness) {
-            case harness_2d_reduction:
-                compute_diff_weights_2d(&thread_info);
-                if (jcp.global_transpose)
-                    reduce_and_convert_diff_weights_and_bias(&thread_info);
-                break;
-            case harness_3d_reduction:
-                compute_diff_weights_3d(&thread_info);
-                if (jcp.global_transpose)
-                    reduce_and_convert_diff_weights_and_bias(&thread_info);
-                break;
-            default: assert(!"Invalid harness type");
+        // A thread owns several blocks of the reduction only in the
+        // deterministic mode
+        for (int blk = thread_info.red_blk_start;
+                blk < thread_info.red_blk_end; blk++) {
+            thread_info.set_red_blk(blk);
+            switch (jcp.harness) {
+                case harness_2d_reduction:
+                    compute_diff_weights_2d(&thread_info);
+                    break;
+                case harness_3d_reduction:
+                    compute_diff_weights_3d(&thread_info);
+                    break;
+                default: assert(!"Invalid harness type");
+            }
         }
+        if (jcp.global_transpose)
+            reduce_and_convert_diff_weights_and_bias(&thread_info);
 
         amx_tile_release();
     });
@@ -2736,6 +2736,9 @@ void balance_bwd_w(jit_brgemm_conv_conf_t &jcp) {
     const auto os_chunks = jcp.nthr_mb_work;
     const auto oc_chunks = div_up(jcp.nb_oc, jcp.nb_oc_blocking);
     const auto ic_chunks = div_up(jcp.nb_ic, jcp.nb_ic_blocking);
+    // The deterministic reduction is not split finer than its fixed blocks
+    const int max_nthr_mb
+            = jcp.deterministic ? jcp.nb_red_blk : jcp.nthr_mb_work;
 
     auto calc_mem_cost = [&jcp, os_chunks, oc_chunks, ic_chunks](int nthr_mb,
                                  int nthr_g, int nthr_oc_b, int nthr_ic_b) {
@@ -2783,7 +2786,10 @@ void balance_bwd_w(jit_brgemm_conv_conf_t &jcp) {
         const float dst_coef = get_dst_coef();
         const float wei_coef = get_wei_coef();
 
-        const auto thr_mb = div_up(os_chunks, nthr_mb);
+        const auto thr_mb = jcp.deterministic
+                ? div_up(jcp.nb_red_blk, nthr_mb)
+                        * div_up(os_chunks, jcp.nb_red_blk)
+                : div_up(os_chunks, nthr_mb);
         const auto nb_oc_job = jcp.oc_block * jcp.nb_oc_blocking;
         const auto nb_ic_job = jcp.ic_block * jcp.nb_ic_blocking;
 
@@ -2810,8 +2816,9 @@ void balance_bwd_w(jit_brgemm_conv_conf_t &jcp) {
         return src_v + dst_v + wei_v;
     };
 
-    auto balance = [&jcp, calc_mem_cost, oc_chunks](int &nthr_, int &nthr_mb_,
-                           int &nthr_g_, int &nthr_oc_b_, int &nthr_ic_b_) {
+    auto balance = [&jcp, calc_mem_cost, oc_chunks, max_nthr_mb](int &nthr_,
+                           int &nthr_mb_, int &nthr_g_, int &nthr_oc_b_,
+                           int &nthr_ic_b_) {
         nthr_ = nthr_mb_ = nthr_g_ = nthr_oc_b_ = nthr_ic_b_ = 1;
 
         if (jcp.nthr < jcp.ngroups) {
@@ -2828,7 +2835,7 @@ void balance_bwd_w(jit_brgemm_conv_conf_t &jcp) {
 
         /* find the best thread distribution with lowest memory cost */
 
-        const int nthr_mb_max = nstl::min(nthr, jcp.nthr_mb_work);
+        const int nthr_mb_max = nstl::min(nthr, max_nthr_mb);
         for (int nthr_mb = 1; nthr_mb <= nthr_mb_max; ++nthr_mb) {
             const int nthr_par = nthr / nthr_mb;
             const int nthr_oc_b_max = nstl::min(nthr_par,
@@ -2849,7 +2856,7 @@ void balance_bwd_w(jit_brgemm_conv_conf_t &jcp) {
         }
 
         if (nthr_mb_ > nthr / 2 && nthr_mb_ < nthr)
-            nthr_mb_ = nstl::min(jcp.nthr_mb_work, nthr);
+            nthr_mb_ = nstl::min(max_nthr_mb, nthr);
         nthr_ = nthr_mb_ * nthr_g_ * nthr_oc_b_ * nthr_ic_b_;
 
         assert(nthr_ <= jcp.nthr);
@@ -3057,11 +3064,17 @@ void balance_bwd_w(jit_brgemm_conv_conf_t &jcp) {
         nthr = nthr_mb * nthr_g * nthr_oc_b * nthr_ic_b;
     }
 
+    // The empiric distributions above don't respect the fixed blocks of the
+    // deterministic reduction
+    if (jcp.deterministic && nthr_mb > max_nthr_mb)
+        balance(nthr, nthr_mb, nthr_g, nthr_oc_b, nthr_ic_b);
+
     jcp.nthr = nthr;
     jcp.nthr_mb = nthr_mb;
     jcp.nthr_g = nthr_g;
     jcp.nthr_oc_b = nthr_oc_b;
     jcp.nthr_ic_b = nthr_ic_b;
+    if (!jcp.deterministic) jcp.nb_red_blk = nthr_mb;
 }
 
 status_t init_conf_bwd_w(jit_brgemm_conv_conf_t &jcp,
@@ -3279,6 +3292,23 @@ status_t init_conf_bwd_w(jit_brgemm_conv_conf_t &jcp,
         default: assert(!"Invalid harness"); jcp.nthr_mb_work = jcp.mb;
     }
 
+    jcp.deterministic = attr.deterministic_;
+    if (jcp.deterministic) {
+        // To make the result independent of the number of threads the
+        // reduction is split into a fixed number of blocks. Every block is
+        // reduced into its own buffer, and the buffers are then combined by
+        // a pairwise tree. The number of blocks depends on the problem only
+        // and is limited by the memory for the partial sums.
+        constexpr int max_red_blk = 64;
+        constexpr size_t max_red_size = (size_t)256 << 20;
+        const size_t wei_size = sizeof(float) * jcp.ngroups * jcp.nb_oc
+                * jcp.oc_block * jcp.nb_ic * jcp.ic_block * jcp.kd * jcp.kh
+                * jcp.kw;
+        const int max_red_blk_by_size
+                = (int)nstl::min<size_t>(max_red_blk, max_red_size / wei_size);
+        jcp.nb_red_blk = saturate(1, jcp.nthr_mb_work, max_red_blk_by_size);
+    }
+
     balance_bwd_w(jcp);
 
     if (one_of(jcp.harness, harness_2d_reduction, harness_3d_reduction)) {
@@ -3433,7 +3463,7 @@ status_t init_scratchpad_bwd_w(memory_tracking::registrar_t &scratchpad,
                 key_conv_tr_diff_dst_bctx, tr_diff_dst_bctx_size);
     }
 
-    if (IMPLICATION(jcp.nthr_mb == 1,
+    if (IMPLICATION(jcp.nb_red_blk == 1,
                 (jcp.with_bias && jcp.bia_dt != data_type::f32)
                         || jcp.wei_dt != data_type::f32)) {
         const size_t wei_size = static_cast<size_t>(jcp.ngroups) * jcp.nb_oc
@@ -3442,10 +3472,12 @@ status_t init_scratchpad_bwd_w(memory_tracking::registrar_t &scratchpad,
         const size_t bia_size
                 = jcp.with_bias * jcp.ngroups * jcp.nb_oc * jcp.oc_block;
 
-        const int num_wei_buffers
-                = jcp.wei_dt != data_type::f32 ? jcp.nthr_mb : jcp.nthr_mb - 1;
+        const int num_wei_buffers = jcp.wei_dt != data_type::f32
+                ? jcp.nb_red_blk
+                : jcp.nb_red_blk - 1;
         const int num_bia_buffers = jcp.with_bias
-                ? (jcp.bia_dt != data_type::f32 ? jcp.nthr_mb : jcp.nthr_mb - 1)
+                ? (jcp.bia_dt != data_type::f32 ? jcp.nb_red_blk
+                                                : jcp.nb_red_blk - 1)
                 : 0;
 
         const size_t wei_bia_reduction_size
@@ -1090,7 +1090,11 @@ void jit_brgemm_ip_bwd_w_conf_t::thread_balance(int &nb_os_blocking_,
 
     /* find the best thread distribution with lowest memory cost */
     const int min_osb_chunk = is_f32 ? 32 : is_xf16 ? 8 : 1;
-    const int nthr_mb_max = nstl::min(nthr, div_up(j.nb_os, min_osb_chunk));
+    // The deterministic mode keeps the whole reduction by minibatch within a
+    // thread, so its order doesn't depend on the number of threads
+    const int nthr_mb_max = j.deterministic
+            ? 1
+            : nstl::min(nthr, div_up(j.nb_os, min_osb_chunk));
     for (int nthr_mb = 1; nthr_mb <= nthr_mb_max; ++nthr_mb) {
         int nb_os_blocking = j.nb_os_blocking;
         int os_chunks = div_up(j.nb_os, nb_os_blocking);
@@ -1215,6 +1219,8 @@ status_t jit_brgemm_ip_bwd_w_conf_t::init_conf(cpu_isa_t isa,
             ? harness_mb_reduction
             : harness_2d_reduction;
 
+    jbgp.deterministic = attr.deterministic_;
+
     int nb_os_blocking, nb_oc_blocking, nb_ic_blocking, nthr, nthr_mb, nthr_oc,
             nthr_ic;
     // Caution: thread_balance requires `use_buffer_a` and `use_buffer_b`
@@ -112,6 +112,7 @@ struct jit_brgemm_ip_bwd_w_conf_t : jit_brgemm_ip_conf_t {
             = occ_icc_osc;
 
     bool local_buffers_for_input_tensors;
+    bool deterministic = false;
 
     status_t init_conf(cpu_isa_t isa, const inner_product_desc_t &ipd,
             memory_desc_t &src_md, memory_desc_t &weights_md,
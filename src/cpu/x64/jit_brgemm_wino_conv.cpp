@@ -0,0 +1,469 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <climits>
+#include <cstring>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/amx_tile_configure.hpp"
+#include "cpu/x64/jit_brgemm_wino_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+using namespace brgemm_wino_utils;
+
+status_t brgemm_wino_convolution_fwd_t::pd_t::init(engine_t *engine) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+    const auto src_type = invariant_src_md()->data_type;
+    const auto wei_type = invariant_wei_md()->data_type;
+    const auto bia_type = invariant_bia_md()->data_type;
+    const auto dst_type = invariant_dst_md()->data_type;
+
+    VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_CONV(one_of(desc()->alg_kind, alg_kind::convolution_auto,
+                           alg_kind::convolution_winograd),
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_CONV(
+            impl::is_dense_format_kind({src_md(0), weights_md(0), dst_md(0)}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+    VDISPATCH_CONV(one_of(src_type, f32, bf16) && wei_type == src_type,
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_CONV(one_of(dst_type, f32, src_type), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_CONV(IMPLICATION(with_bias(), one_of(bia_type, f32, src_type)),
+            VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_CONV(desc()->accum_data_type == f32, VERBOSE_UNSUPPORTED_DT);
+
+    VDISPATCH_CONV(attr()->has_default_values(smask_t::post_ops, dst_type),
+            VERBOSE_UNSUPPORTED_ATTR);
+    const auto &po = attr()->post_ops_;
+    for (int i = 0; i < po.len(); i++)
+        VDISPATCH_CONV(po.entry_[i].is_eltwise(), VERBOSE_UNSUPPORTED_POSTOP);
+
+    // Only 3x3 filters with unit strides are supported. The padding may not
+    // exceed one point, so the input tile of the output tile touching the
+    // border always overlaps the image.
+    VDISPATCH_CONV(ndims() == 4, VERBOSE_BAD_NDIMS, "src", ndims());
+    VDISPATCH_CONV(!with_groups(), VERBOSE_UNSUPPORTED_FEATURE, "groups");
+    VDISPATCH_CONV(KH() == wino_r && KW() == wino_r, VERBOSE_BAD_PARAM,
+            "kernel");
+    VDISPATCH_CONV(KSH() == 1 && KSW() == 1, VERBOSE_BAD_PARAM, "stride");
+    VDISPATCH_CONV(KDH() == 0 && KDW() == 0, VERBOSE_BAD_PARAM, "dilation");
+    VDISPATCH_CONV(
+            everyone_is(true, padT() <= 1, padB() <= 1, padL() <= 1,
+                    padR() <= 1),
+            VERBOSE_UNSUPPORTED_PAD_FEATURE, "large padding");
+
+    // The transforms work on channels-last tensors.
+    VDISPATCH_CONV(set_default_formats_common(format_tag::nhwc,
+                           format_tag::any, format_tag::nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV(memory_desc_matches_tag(src_md_, format_tag::nhwc)
+                    && memory_desc_matches_tag(dst_md_, format_tag::nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV(attr_.set_default_formats(&dst_md_) == status::success,
+            VERBOSE_UNSUPPORTED_POSTOP);
+
+    isa_ = src_type == f32              ? avx512_core
+            : mayiuse(avx512_core_amx) ? avx512_core_amx
+                                       : avx512_core_bf16;
+    VDISPATCH_CONV(mayiuse(isa_), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_CONV(
+            platform::has_data_type_support(src_type), VERBOSE_UNSUPPORTED_DT);
+
+    // Transforms amplify the rounding errors of the transformed operands,
+    // which are kept in bf16 for bf16 convolution. Such precision loss is
+    // accepted only when Winograd is requested explicitly.
+    VDISPATCH_CONV(IMPLICATION(desc()->alg_kind == alg_kind::convolution_auto,
+                           src_type == f32),
+            VERBOSE_IMPL_HEURISTIC_FAIL, "precision guard");
+
+    init_wino_wei_layout(wl_, select_tile_size(), IC(), OC(), src_type);
+    CHECK(init_wei_md(engine));
+    init_tiles();
+
+    VDISPATCH_CONV(IMPLICATION(desc()->alg_kind == alg_kind::convolution_auto,
+                           is_profitable()),
+            VERBOSE_IMPL_HEURISTIC_FAIL, "direct convolution is preferred");
+    VDISPATCH_CONV(set_default_alg_kind(alg_kind::convolution_winograd),
+            VERBOSE_BAD_ALGORITHM);
+
+    init_trans_confs();
+    // Transform points are addressed by 32-bit displacements.
+    const dim_t npoints = wl_.alpha * wl_.alpha;
+    VDISPATCH_CONV(npoints * src_trans_.point_stride <= INT_MAX
+                    && npoints * dst_trans_.point_stride <= INT_MAX,
+            VERBOSE_LARGE_SHAPES);
+
+    CHECK(init_brgemm(engine));
+    init_scratchpad();
+
+    return status::success;
+}
+
+// F(6x6, 3x3) needs 1.8 times fewer multiplications than F(4x4, 3x3), but
+// its transforms amplify the rounding errors several times more, and the
+// error accumulates along the reduction. It's used only in f32, for moderate
+// numbers of input channels and for images covered mostly by full tiles.
+//
+// The transformed operands of bf16 convolution are rounded to bf16, and the
+// F(4x4, 3x3) output transform amplifies that rounding well beyond the error
+// of direct convolution, especially for sparse sources. F(2x2, 3x3)
+// transforms only add and subtract the elements, so bf16 uses it.
+int brgemm_wino_convolution_fwd_t::pd_t::select_tile_size() const {
+    if (invariant_src_md()->data_type == bf16) return 2;
+    const bool use_f6x6 = IC() <= 256 && OH() >= 12 && OW() >= 12;
+    return use_f6x6 ? 6 : 4;
+}
+
+// Winograd pays off when the transforms are amortized over enough channels
+// and there are enough tiles for all the threads.
+bool brgemm_wino_convolution_fwd_t::pd_t::is_profitable() const {
+    return IC() >= 64 && OC() >= 64 && ntiles_ >= nthr_;
+}
+
+status_t brgemm_wino_convolution_fwd_t::pd_t::init_wei_md(
+        engine_t *engine) {
+    if (weights_md_.format_kind == format_kind::any) {
+        CHECK(init_wino_wei_md(weights_md_, weights_md_, wl_));
+        wei_is_wino_ = true;
+    } else if (weights_md_.format_kind == format_kind::wino) {
+        wino_wei_layout_t l;
+        const bool ok = wino_wei_layout_from_md(l, weights_md_)
+                && l.m == wl_.m && l.dt == wl_.dt && l.ic == wl_.ic
+                && l.oc == wl_.oc;
+        VDISPATCH_CONV(ok, VERBOSE_UNSUPPORTED_TAG_S, "weights");
+        wei_is_wino_ = true;
+    } else {
+        VDISPATCH_CONV(memory_desc_wrapper(weights_md_).is_blocking_desc(),
+                VERBOSE_UNSUPPORTED_TAG_S, "weights");
+        wei_is_wino_ = false;
+    }
+    return status::success;
+}
+
+void brgemm_wino_convolution_fwd_t::pd_t::init_tiles() {
+    const int m = wl_.m;
+    oh_ = OH();
+    ow_ = OW();
+    t_pad_ = padT();
+    l_pad_ = padL();
+    nb_tile_h_ = div_up(oh_, m);
+    nb_tile_w_ = div_up(ow_, m);
+    ntiles_ = MB() * nb_tile_h_ * nb_tile_w_;
+    nthr_ = dnnl_get_max_threads();
+
+    // Transformed source and brgemm results of a block of tiles should stay
+    // in L2. A block also shouldn't be so large that threads run out of work.
+    const dim_t npoints = wl_.alpha * wl_.alpha;
+    const dim_t tile_size = npoints
+            * (wl_.ic_pad * (dim_t)types::data_type_size(wl_.dt)
+                    + wl_.oc_pad * (dim_t)sizeof(float));
+    const dim_t l2 = platform::get_per_core_cache_size(2);
+    tile_block_ = saturate<dim_t>(8, 64, l2 / 2 / tile_size);
+    tile_block_ = nstl::max<dim_t>(
+            1, nstl::min(tile_block_, div_up(ntiles_, nthr_)));
+    // AMX tiles hold 16 rows.
+    if (is_superset(isa_, avx512_core_amx) && tile_block_ > 16)
+        tile_block_ = rnd_dn(tile_block_, 16);
+    nb_tile_blocks_ = div_up(ntiles_, tile_block_);
+}
+
+void brgemm_wino_convolution_fwd_t::pd_t::init_trans_confs() {
+    const wino_matrices_t mat(wl_.m);
+    const int alpha = wl_.alpha;
+    const auto src_type = invariant_src_md()->data_type;
+
+    auto &s = src_trans_;
+    s.is_output = false;
+    s.n_in = alpha;
+    s.n_out = alpha;
+    for_(int i = 0; i < max_alpha; i++)
+    for (int j = 0; j < max_alpha; j++)
+        s.L[i][j] = mat.BT[i][j];
+    s.nchannels = IC();
+    s.nchannels_pad = wl_.ic_pad;
+    s.point_stride
+            = tile_block_ * wl_.ic_pad * (dim_t)types::data_type_size(wl_.dt);
+    s.src_dt = src_type;
+    s.dst_dt = wl_.dt;
+    s.bia_dt = data_type::undef;
+    s.with_bias = false;
+
+    auto &d = dst_trans_;
+    d.is_output = true;
+    d.n_in = alpha;
+    d.n_out = wl_.m;
+    for_(int i = 0; i < max_alpha; i++)
+    for (int j = 0; j < max_alpha; j++)
+        d.L[i][j] = mat.AT[i][j];
+    d.nchannels = OC();
+    d.nchannels_pad = wl_.oc_pad;
+    d.point_stride = tile_block_ * wl_.oc_pad * (dim_t)sizeof(float);
+    d.src_dt = f32;
+    d.dst_dt = invariant_dst_md()->data_type;
+    d.bia_dt = with_bias() ? invariant_bia_md()->data_type : data_type::undef;
+    d.with_bias = with_bias();
+    d.post_ops = attr()->post_ops_;
+}
+
+status_t brgemm_wino_convolution_fwd_t::pd_t::init_brgemm(engine_t *engine) {
+    const bool is_amx = is_superset(isa_, avx512_core_amx);
+    const dim_t tiles_tail = ntiles_ % tile_block_;
+    const dim_t oc_tail = wl_.oc_pad % wl_.oc_block;
+
+    brgs_.resize(num_brg_kernels);
+    for_(int i_tiles = 0; i_tiles < 2; i_tiles++)
+    for (int i_oc = 0; i_oc < 2; i_oc++) {
+        const dim_t M = i_tiles ? tiles_tail : tile_block_;
+        const dim_t N = i_oc ? oc_tail : wl_.oc_block;
+        if (M == 0 || N == 0) continue;
+
+        auto &brg = brgs_[get_brg_idx(i_tiles, i_oc)];
+        CHECK(brgemm_desc_init(&brg, isa_, brgemm_addr, wl_.dt, wl_.dt,
+                /* transA = */ false, /* transB = */ false, brgemm_row_major,
+                /* alpha = */ 1.f, /* beta = */ 0.f, wl_.ic_pad, wl_.oc_block,
+                wl_.oc_pad, M, N, wl_.ic_pad));
+
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = 1;
+        if (is_amx) {
+            brgattr.use_uker = true;
+            brgattr.use_interleave_stores = true;
+        }
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+        CHECK(brgemm_desc_finalize(&brg));
+        wsp_size_ = nstl::max(wsp_size_, (size_t)brg.get_wsp_buffer_size());
+
+        const bool is_vnni = brgemm_desc_t::is_b_data_layout_vnni(wl_.dt,
+                wl_.dt, /* attr_b_is_vnni = */ false, brg.isa_impl);
+        const int vnni = is_vnni ? data_type_vnni_granularity(wl_.dt) : 1;
+        VDISPATCH_CONV(vnni == wl_.vnni, VERBOSE_UNSUPPORTED_ISA);
+    }
+
+    return status::success;
+}
+
+void brgemm_wino_convolution_fwd_t::pd_t::init_scratchpad() {
+    const dim_t npoints = wl_.alpha * wl_.alpha;
+    const size_t wino_dsz = types::data_type_size(wl_.dt);
+    const size_t src_dsz = types::data_type_size(invariant_src_md()->data_type);
+
+    auto scratchpad = scratchpad_registry().registrar();
+    if (!wei_is_wino_) scratchpad.book(key_wino_U, wl_.nelems(), wino_dsz);
+    scratchpad.book(key_wino_V, nthr_ * npoints * tile_block_ * wl_.ic_pad,
+            wino_dsz);
+    scratchpad.template book<float>(
+            key_wino_M, nthr_ * npoints * tile_block_ * wl_.oc_pad);
+    // Copies of the input tiles crossing the image border.
+    scratchpad.book(key_conv_brgemm_inp_buffer, nthr_ * npoints * IC(),
+            src_dsz);
+    if (wsp_size_ > 0)
+        scratchpad.book(
+                key_conv_amx_wsp_buffer, nthr_ * wsp_size_, sizeof(char));
+}
+
+status_t brgemm_wino_convolution_fwd_t::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(src_trans_kernel_,
+            new jit_brgemm_wino_trans_kernel_t(pd()->src_trans_)));
+    CHECK(src_trans_kernel_->create_kernel());
+    CHECK(safe_ptr_assign(dst_trans_kernel_,
+            new jit_brgemm_wino_trans_kernel_t(pd()->dst_trans_)));
+    CHECK(dst_trans_kernel_->create_kernel());
+
+    const auto &brgs = pd()->brgs_;
+    brg_kernels_.resize(brgs.size());
+    for (size_t idx = 0; idx < brgs.size(); idx++) {
+        const auto &brg = brgs[idx];
+        if (brg.bcast_dim == 0) continue;
+
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, brg));
+        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+        if (is_superset(brg.isa_impl, avx512_core_amx))
+            brgemm_palettes_.insert((int)idx, brg);
+    }
+
+    return status::success;
+}
+
+status_t brgemm_wino_convolution_fwd_t::execute(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const auto weights = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS);
+    const auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper wei_d(pd()->weights_md(0));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const auto &wl = pd()->wl_;
+    const int m = wl.m, alpha = wl.alpha;
+    const dim_t npoints = alpha * alpha;
+    const dim_t IC = pd()->IC(), IH = pd()->IH(), IW = pd()->IW();
+    const dim_t OH = pd()->oh_, OW = pd()->ow_;
+    const dim_t nb_tile_h = pd()->nb_tile_h_, nb_tile_w = pd()->nb_tile_w_;
+    const dim_t ntiles = pd()->ntiles_, tile_block = pd()->tile_block_;
+    const dim_t ic_pad = wl.ic_pad, oc_pad = wl.oc_pad;
+    const dim_t oc_block = wl.oc_block, nb_oc = wl.nb_oc;
+    const size_t wsp_size = pd()->wsp_size_;
+    const bool is_amx = is_superset(pd()->isa_, avx512_core_amx);
+
+    const dim_t src_dsz = src_d.data_type_size();
+    const dim_t dst_dsz = dst_d.data_type_size();
+    const dim_t wino_dsz = types::data_type_size(wl.dt);
+    const auto &src_str = src_d.blocking_desc().strides;
+    const auto &dst_str = dst_d.blocking_desc().strides;
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    const char *wino_wei = static_cast<const char *>(weights);
+    if (!pd()->wei_is_wino_) {
+        auto U = scratchpad.template get<char>(key_wino_U);
+        transform_weights(wl, weights, wei_d, U);
+        wino_wei = U;
+    }
+    auto V_base = scratchpad.template get<char>(key_wino_V);
+    auto M_base = scratchpad.template get<float>(key_wino_M);
+    auto tile_base = scratchpad.template get<char>(key_conv_brgemm_inp_buffer);
+    auto wsp_base = scratchpad.template get<char>(key_conv_amx_wsp_buffer);
+
+    const int nthr = pd()->nthr_;
+    parallel(nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(pd()->nb_tile_blocks_, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        char *V = V_base + ithr * npoints * tile_block * ic_pad * wino_dsz;
+        float *M = M_base + ithr * npoints * tile_block * oc_pad;
+        char *tile = tile_base + ithr * npoints * IC * src_dsz;
+        char *wsp = wsp_size > 0 ? wsp_base + ithr * wsp_size : nullptr;
+
+        // Position of the tile `t` in the destination.
+        auto tile_pos = [&](dim_t t, dim_t &n, dim_t &oh0, dim_t &ow0) {
+            n = t / (nb_tile_h * nb_tile_w);
+            oh0 = (t / nb_tile_w) % nb_tile_h * m;
+            ow0 = t % nb_tile_w * m;
+        };
+
+        int prev_ker_idx = -1;
+        brgemm_batch_element_t batch;
+        jit_wino_trans_call_t p;
+
+        for (dim_t tb = start; tb < end; tb++) {
+            const dim_t t0 = tb * tile_block;
+            const dim_t nt = nstl::min(tile_block, ntiles - t0);
+
+            for (dim_t i = 0; i < nt; i++) {
+                dim_t n, oh0, ow0;
+                tile_pos(t0 + i, n, oh0, ow0);
+                const dim_t ih0 = oh0 - pd()->t_pad_;
+                const dim_t iw0 = ow0 - pd()->l_pad_;
+
+                p = jit_wino_trans_call_t();
+                p.dst = V + i * ic_pad * wino_dsz;
+                if (ih0 >= 0 && ih0 + alpha <= IH && iw0 >= 0
+                        && iw0 + alpha <= IW) {
+                    p.src = src
+                            + (n * src_str[0] + ih0 * src_str[2]
+                                      + iw0 * src_str[3])
+                                    * src_dsz;
+                    p.row_stride = src_str[2] * src_dsz;
+                    p.col_stride = src_str[3] * src_dsz;
+                } else {
+                    // The tile crosses the border and is copied with the
+                    // padding zeroed.
+                    const dim_t pixel = IC * src_dsz;
+                    for_(int r = 0; r < alpha; r++)
+                    for (int c = 0; c < alpha; c++) {
+                        char *to = tile + (r * alpha + c) * pixel;
+                        const dim_t ih = ih0 + r, iw = iw0 + c;
+                        if (ih < 0 || ih >= IH || iw < 0 || iw >= IW)
+                            std::memset(to, 0, pixel);
+                        else
+                            std::memcpy(to,
+                                    src
+                                            + (n * src_str[0] + ih * src_str[2]
+                                                      + iw * src_str[3])
+                                                    * src_dsz,
+                                    pixel);
+                    }
+                    p.src = tile;
+                    p.row_stride = alpha * pixel;
+                    p.col_stride = pixel;
+                }
+                (*src_trans_kernel_)(&p);
+            }
+
+            // Element-wise products for every transform point.
+            const bool is_tiles_tail = nt < tile_block;
+            for_(dim_t pt = 0; pt < npoints; pt++)
+            for (dim_t ocb = 0; ocb < nb_oc; ocb++) {
+                const bool is_oc_tail = (ocb + 1) * oc_block > oc_pad;
+                const int idx = pd_t::get_brg_idx(is_tiles_tail, is_oc_tail);
+                brgemm_palettes_.maybe_tile_configure(
+                        is_amx, prev_ker_idx, idx);
+                batch.ptr.A = V + pt * tile_block * ic_pad * wino_dsz;
+                batch.ptr.B = wino_wei
+                        + (pt * nb_oc + ocb) * ic_pad * oc_block * wino_dsz;
+                brgemm_kernel_execute(brg_kernels_[idx].get(), 1, &batch,
+                        M + pt * tile_block * oc_pad + ocb * oc_block, wsp);
+            }
+
+            for (dim_t i = 0; i < nt; i++) {
+                dim_t n, oh0, ow0;
+                tile_pos(t0 + i, n, oh0, ow0);
+
+                p = jit_wino_trans_call_t();
+                p.src = M + i * oc_pad;
+                p.dst = dst
+                        + (n * dst_str[0] + oh0 * dst_str[2]
+                                  + ow0 * dst_str[3])
+                                * dst_dsz;
+                p.bias = bias;
+                p.row_stride = dst_str[2] * dst_dsz;
+                p.col_stride = dst_str[3] * dst_dsz;
+                p.rows = nstl::min<dim_t>(m, OH - oh0);
+                p.cols = nstl::min<dim_t>(m, OW - ow0);
+                (*dst_trans_kernel_)(&p);
+            }
+        }
+
+        if (is_amx) amx_tile_release();
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_WINO_CONV_HPP
+#define CPU_X64_JIT_BRGEMM_WINO_CONV_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/brgemm/brgemm_containers.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_brgemm_wino_conv_trans_kernel.hpp"
+#include "cpu/x64/jit_brgemm_wino_conv_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Winograd F(2x2, 3x3), F(4x4, 3x3) and F(6x6, 3x3) forward convolution over
+// channels-last tensors.
+//
+// The output is split into m x m tiles, and blocks of tiles are processed
+// independently by the threads. The input transform of a block writes, for
+// every of the alpha^2 transform points, a [tiles][ic] matrix. The
+// element-wise products of the transformed source and weights are then
+// alpha^2 independent [tiles][ic] x [ic][oc] matrix multiplications done by
+// brgemm kernels. The output transform reads their results back and writes
+// the destination tiles.
+//
+// Weights are transformed by the primitive on every call when passed in a
+// plain layout. With `any` weights format the primitive asks for weights
+// transformed in advance by a reorder into an opaque layout.
+struct brgemm_wino_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_wino:", isa_, ""),
+                brgemm_wino_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        // Kernels are indexed by 2 * is_tiles_tail + is_oc_tail.
+        static constexpr int num_brg_kernels = 4;
+        static int get_brg_idx(bool is_tiles_tail, bool is_oc_tail) {
+            return 2 * is_tiles_tail + is_oc_tail;
+        }
+
+        cpu_isa_t isa_ = isa_undef;
+        brgemm_wino_utils::wino_wei_layout_t wl_ = {};
+        // Weights are passed already transformed.
+        bool wei_is_wino_ = false;
+
+        dim_t oh_ = 0, ow_ = 0, t_pad_ = 0, l_pad_ = 0;
+        dim_t nb_tile_h_ = 0, nb_tile_w_ = 0, ntiles_ = 0;
+        dim_t tile_block_ = 0, nb_tile_blocks_ = 0;
+        int nthr_ = 0;
+        size_t wsp_size_ = 0;
+        std::vector<brgemm_desc_t> brgs_;
+        jit_wino_trans_conf_t src_trans_ = {};
+        jit_wino_trans_conf_t dst_trans_ = {};
+
+    private:
+        int select_tile_size() const;
+        bool is_profitable() const;
+        status_t init_wei_md(engine_t *engine);
+        void init_tiles();
+        void init_trans_confs();
+        status_t init_brgemm(engine_t *engine);
+        void init_scratchpad();
+    };
+
+    brgemm_wino_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_brgemm_wino_trans_kernel_t> src_trans_kernel_;
+    std::unique_ptr<jit_brgemm_wino_trans_kernel_t> dst_trans_kernel_;
+    std::vector<std::unique_ptr<brgemm_kernel_t>> brg_kernels_;
+    brgemm_containers::brgemm_palette_container_t brgemm_palettes_ {
+            pd_t::num_brg_kernels};
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,263 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_brgemm_wino_conv_trans_kernel.hpp"
+
+#define GET_OFF(field) offsetof(jit_wino_trans_call_t, field)
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::utils;
+
+jit_brgemm_wino_trans_kernel_t::jit_brgemm_wino_trans_kernel_t(
+        const jit_wino_trans_conf_t &jcp)
+    : jit_generator_t(jit_name())
+    , jcp_(jcp)
+    , src_dsz_((int)types::data_type_size(jcp.src_dt))
+    , dst_dsz_((int)types::data_type_size(jcp.dst_dt))
+    , bia_dsz_(jcp.with_bias ? (int)types::data_type_size(jcp.bia_dt) : 0) {
+    for (int i = 0; i < jcp_.post_ops.len(); i++) {
+        const auto &e = jcp_.post_ops.entry_[i];
+        assert(e.is_eltwise());
+        eltwise_injectors_.emplace_back(
+                new jit_uni_eltwise_injector_t<avx512_core>(this, e.eltwise));
+    }
+}
+
+// out = sum_k L[o][k] * vmm_in(k). Unit coefficients, which are common in
+// the transforms, don't load the table.
+void jit_brgemm_wino_trans_kernel_t::lin_comb(const Vmm &out, int o) {
+    bool is_first = true;
+    for (int k = 0; k < jcp_.n_in; k++) {
+        const float c = jcp_.L[o][k];
+        if (c == 0.f) continue;
+
+        const Vmm in = vmm_in(k);
+        const auto coef = zword_b[reg_table
+                + (o * brgemm_wino_utils::max_alpha + k) * sizeof(float)];
+        if (is_first) {
+            if (c == 1.f)
+                vmovups(out, in);
+            else if (c == -1.f)
+                vsubps(out, vmm_zero, in);
+            else
+                vmulps(out, in, coef);
+            is_first = false;
+        } else {
+            if (c == 1.f)
+                vaddps(out, out, in);
+            else if (c == -1.f)
+                vsubps(out, out, in);
+            else
+                vfmadd231ps(out, in, coef);
+        }
+    }
+    if (is_first) vpxord(out, out, out);
+}
+
+void jit_brgemm_wino_trans_kernel_t::load(
+        const Vmm &v, const Address &addr, data_type_t dt, bool is_tail) {
+    const Vmm vm = is_tail ? v | k_tail | T_z : v;
+    switch (dt) {
+        case f32: vmovups(vm, addr); break;
+        case bf16:
+            vpmovzxwd(vm, addr);
+            vpslld(v, v, 16);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+void jit_brgemm_wino_trans_kernel_t::store(
+        const Address &addr, const Vmm &v, data_type_t dt, bool is_tail) {
+    const Address am = is_tail ? addr | k_tail : addr;
+    switch (dt) {
+        case f32: vmovups(am, v); break;
+        case bf16:
+            vcvtneps2bf16(Ymm(vmm_cvt.getIdx()), v);
+            vmovdqu16(am, Ymm(vmm_cvt.getIdx()));
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+// Transforms a vector of channels of the source tile into the points of the
+// brgemm A matrices. Lanes beyond the channels are loaded as zeros, so the
+// padding of the last vector is written as well.
+void jit_brgemm_wino_trans_kernel_t::input_transform(bool is_tail) {
+    const int n = jcp_.n_in;
+
+    // L X, column by column.
+    mov(reg_ptr2, reg_src);
+    for (int j = 0; j < n; j++) {
+        mov(reg_ptr, reg_ptr2);
+        for (int k = 0; k < n; k++) {
+            load(vmm_in(k), ptr[reg_ptr], jcp_.src_dt, is_tail);
+            if (k < n - 1) add(reg_ptr, reg_row_stride);
+        }
+        if (j < n - 1) add(reg_ptr2, reg_col_stride);
+        for (int o = 0; o < n; o++) {
+            lin_comb(vmm_out(o), o);
+            vmovups(ptr[rsp + tmp_off(o, j)], vmm_out(o));
+        }
+    }
+
+    // (L X) L^T, row by row.
+    for (int i = 0; i < n; i++) {
+        for (int k = 0; k < n; k++)
+            vmovups(vmm_in(k), ptr[rsp + tmp_off(i, k)]);
+        for (int o = 0; o < n; o++) {
+            lin_comb(vmm_out(o), o);
+            store(ptr[reg_dst + (i * n + o) * jcp_.point_stride], vmm_out(o),
+                    jcp_.dst_dt, false);
+        }
+    }
+}
+
+// Transforms a vector of channels of the points of the brgemm C matrices
+// into the valid rows and columns of the destination tile.
+void jit_brgemm_wino_trans_kernel_t::output_transform(bool is_tail) {
+    const int n = jcp_.n_in, m = jcp_.n_out;
+
+    // L X, column by column.
+    for (int j = 0; j < n; j++) {
+        for (int k = 0; k < n; k++)
+            vmovups(vmm_in(k), ptr[reg_src + (k * n + j) * jcp_.point_stride]);
+        for (int o = 0; o < m; o++) {
+            lin_comb(vmm_out(o), o);
+            vmovups(ptr[rsp + tmp_off(o, j)], vmm_out(o));
+        }
+    }
+
+    if (jcp_.with_bias) load(vmm_bias, ptr[reg_bias], jcp_.bia_dt, is_tail);
+
+    // (L X) L^T, row by row.
+    Label l_end;
+    mov(reg_ptr, reg_dst);
+    for (int i = 0; i < m; i++) {
+        Label l_row_end;
+        cmp(reg_rows, i);
+        jle(l_end, T_NEAR);
+
+        for (int k = 0; k < n; k++)
+            vmovups(vmm_in(k), ptr[rsp + tmp_off(i, k)]);
+        for (int o = 0; o < m; o++) {
+            lin_comb(vmm_out(o), o);
+            if (jcp_.with_bias) vaddps(vmm_out(o), vmm_out(o), vmm_bias);
+        }
+        for (auto &inj : eltwise_injectors_)
+            inj->compute_vector_range(
+                    vmm_out(0).getIdx(), vmm_out(m - 1).getIdx() + 1);
+
+        mov(reg_ptr2, reg_ptr);
+        for (int o = 0; o < m; o++) {
+            cmp(reg_cols, o);
+            jle(l_row_end, T_NEAR);
+            store(ptr[reg_ptr2], vmm_out(o), jcp_.dst_dt, is_tail);
+            if (o < m - 1) add(reg_ptr2, reg_col_stride);
+        }
+        L(l_row_end);
+        if (i < m - 1) add(reg_ptr, reg_row_stride);
+    }
+    L(l_end);
+}
+
+void jit_brgemm_wino_trans_kernel_t::advance() {
+    add(reg_src, simd_w * src_dsz_);
+    add(reg_dst, simd_w * dst_dsz_);
+    if (jcp_.with_bias) add(reg_bias, simd_w * bia_dsz_);
+}
+
+void jit_brgemm_wino_trans_kernel_t::generate() {
+    preamble();
+    sub(rsp, tmp_size());
+
+    mov(reg_src, ptr[reg_param + GET_OFF(src)]);
+    mov(reg_dst, ptr[reg_param + GET_OFF(dst)]);
+    mov(reg_row_stride, ptr[reg_param + GET_OFF(row_stride)]);
+    mov(reg_col_stride, ptr[reg_param + GET_OFF(col_stride)]);
+    if (jcp_.is_output) {
+        mov(reg_rows, ptr[reg_param + GET_OFF(rows)]);
+        mov(reg_cols, ptr[reg_param + GET_OFF(cols)]);
+        if (jcp_.with_bias) mov(reg_bias, ptr[reg_param + GET_OFF(bias)]);
+    }
+    mov(reg_table, l_table_);
+    vpxord(vmm_zero, vmm_zero, vmm_zero);
+
+    auto transform = [&](bool is_tail) {
+        if (jcp_.is_output)
+            output_transform(is_tail);
+        else
+            input_transform(is_tail);
+    };
+
+    const dim_t nb_full = jcp_.nchannels / simd_w;
+    const int tail = (int)(jcp_.nchannels % simd_w);
+    if (nb_full > 0) {
+        Label l_loop;
+        mov(reg_cnt, nb_full);
+        L(l_loop);
+        transform(false);
+        advance();
+        dec(reg_cnt);
+        jnz(l_loop, T_NEAR);
+    }
+    if (tail > 0) {
+        mov(reg_cnt.cvt32(), (1 << tail) - 1);
+        kmovw(k_tail, reg_cnt.cvt32());
+        transform(true);
+        advance();
+    }
+
+    // Vectors of the padding beyond the last partial one.
+    if (!jcp_.is_output) {
+        const dim_t nb_zero
+                = (jcp_.nchannels_pad - rnd_up(jcp_.nchannels, simd_w))
+                / simd_w;
+        const int npoints = jcp_.n_out * jcp_.n_out;
+        for_(dim_t z = 0; z < nb_zero; z++)
+        for (int p = 0; p < npoints; p++)
+            store(ptr[reg_dst + p * jcp_.point_stride + z * simd_w * dst_dsz_],
+                    vmm_zero, jcp_.dst_dt, false);
+    }
+
+    add(rsp, tmp_size());
+    postamble();
+
+    for (auto &inj : eltwise_injectors_)
+        inj->prepare_table();
+
+    align(64);
+    L(l_table_);
+    for_(int o = 0; o < brgemm_wino_utils::max_alpha; o++)
+    for (int k = 0; k < brgemm_wino_utils::max_alpha; k++)
+        dd(float2int(jcp_.L[o][k]));
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
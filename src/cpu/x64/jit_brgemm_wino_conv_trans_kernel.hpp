@@ -0,0 +1,135 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_WINO_CONV_TRANS_KERNEL_HPP
+#define CPU_X64_JIT_BRGEMM_WINO_CONV_TRANS_KERNEL_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_attr.hpp"
+
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/jit_brgemm_wino_conv_utils.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// A tile transform computes L X L^T for a square grid X of n_in x n_in
+// points, where every point is a vector of channels. The input transform
+// (L = B^T) reads a tile of the channels-last source and writes alpha^2
+// points of the brgemm A matrices. The output transform (L = A^T) reads
+// alpha^2 points of the brgemm C matrices and writes the valid part of an
+// m x m tile of the destination with bias and eltwise post-ops applied.
+struct jit_wino_trans_conf_t {
+    bool is_output;
+    int n_in, n_out;
+    float L[brgemm_wino_utils::max_alpha][brgemm_wino_utils::max_alpha];
+    dim_t nchannels;
+    // Channels written by the input transform, the padding is zeroed.
+    dim_t nchannels_pad;
+    // Distance in bytes between the transform points of the brgemm matrices.
+    dim_t point_stride;
+    data_type_t src_dt, dst_dt, bia_dt;
+    bool with_bias;
+    post_ops_t post_ops;
+};
+
+struct jit_wino_trans_call_t {
+    const void *src;
+    void *dst;
+    const void *bias;
+    // Strides in bytes of the rows and the columns of the plain tile.
+    dim_t row_stride;
+    dim_t col_stride;
+    // Valid rows and columns of the destination tile.
+    dim_t rows;
+    dim_t cols;
+};
+
+struct jit_brgemm_wino_trans_kernel_t : public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_wino_trans_kernel_t)
+
+    jit_brgemm_wino_trans_kernel_t(const jit_wino_trans_conf_t &jcp);
+
+private:
+    using Vmm = Xbyak::Zmm;
+    static constexpr int simd_w = brgemm_wino_utils::simd_w;
+
+    const jit_wino_trans_conf_t jcp_;
+    const int src_dsz_;
+    const int dst_dsz_;
+    const int bia_dsz_;
+    std::vector<std::unique_ptr<jit_uni_eltwise_injector_t<avx512_core>>>
+            eltwise_injectors_;
+
+    const Xbyak::Reg64 reg_param = abi_param1;
+    const Xbyak::Reg64 reg_src = r8;
+    const Xbyak::Reg64 reg_dst = r9;
+    const Xbyak::Reg64 reg_bias = r10;
+    const Xbyak::Reg64 reg_row_stride = r11;
+    const Xbyak::Reg64 reg_col_stride = r12;
+    const Xbyak::Reg64 reg_ptr = r13;
+    const Xbyak::Reg64 reg_ptr2 = r14;
+    const Xbyak::Reg64 reg_cnt = r15;
+    const Xbyak::Reg64 reg_table = rbx;
+    const Xbyak::Reg64 reg_rows = rdx;
+    const Xbyak::Reg64 reg_cols = rsi;
+
+    const Xbyak::Opmask k_tail = k2;
+
+    // Points of a row or a column are held in vmm_in(0..n_in) and the
+    // results in vmm_out(0..n_out).
+    static Vmm vmm_in(int k) { return Vmm(k); }
+    static Vmm vmm_out(int o) {
+        return Vmm(brgemm_wino_utils::max_alpha + o);
+    }
+    const Vmm vmm_zero = Vmm(2 * brgemm_wino_utils::max_alpha);
+    const Vmm vmm_bias = Vmm(2 * brgemm_wino_utils::max_alpha + 1);
+    const Vmm vmm_cvt = Vmm(2 * brgemm_wino_utils::max_alpha + 2);
+
+    Xbyak::Label l_table_;
+
+    // Offset of the point (i, j) of L X in the stack buffer.
+    int tmp_off(int i, int j) const {
+        return (i * jcp_.n_in + j) * simd_w * (int)sizeof(float);
+    }
+    int tmp_size() const { return tmp_off(jcp_.n_out, 0); }
+
+    void lin_comb(const Vmm &out, int o);
+    void load(const Vmm &v, const Xbyak::Address &addr, data_type_t dt,
+            bool is_tail);
+    void store(const Xbyak::Address &addr, const Vmm &v, data_type_t dt,
+            bool is_tail);
+    void input_transform(bool is_tail);
+    void output_transform(bool is_tail);
+    void advance();
+
+    void generate() override;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,184 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/bfloat16.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/jit_brgemm_wino_conv_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace brgemm_wino_utils {
+
+using namespace dnnl::impl::utils;
+
+wino_matrices_t::wino_matrices_t(int m) : m(m), alpha(m + wino_r - 1) {
+    // Points closer to zero keep the transforms well conditioned. The
+    // infinity point is handled separately as the last one.
+    const double points[max_alpha - 1] = {0., 1., -1., 2., -2., .5, -.5};
+    const int npoints = alpha - 1;
+
+    for_(int i = 0; i < max_alpha; i++)
+    for (int j = 0; j < max_alpha; j++) {
+        AT[i][j] = 0.f;
+        BT[i][j] = 0.f;
+    }
+    for_(int i = 0; i < max_alpha; i++)
+    for (int j = 0; j < wino_r; j++)
+        G[i][j] = 0.f;
+
+    // Coefficients of prod_{k != skip} (x - a_k), lowest degree first.
+    auto poly = [&](int skip, double *c) {
+        for (int i = 0; i < alpha; i++)
+            c[i] = i == 0 ? 1. : 0.;
+        int deg = 0;
+        for (int k = 0; k < npoints; k++) {
+            if (k == skip) continue;
+            for (int i = deg + 1; i > 0; i--)
+                c[i] = c[i - 1] - points[k] * c[i];
+            c[0] = -points[k] * c[0];
+            deg++;
+        }
+    };
+
+    double c[max_alpha];
+    for (int j = 0; j < npoints; j++) {
+        const double a = points[j];
+        double norm = 1.;
+        for (int k = 0; k < npoints; k++)
+            if (k != j) norm *= a - points[k];
+
+        double pw = 1.;
+        for (int i = 0; i < nstl::max(m, wino_r); i++) {
+            if (i < m) AT[i][j] = (float)pw;
+            if (i < wino_r) G[j][i] = (float)(pw / norm);
+            pw *= a;
+        }
+        poly(j, c);
+        for (int i = 0; i < alpha; i++)
+            BT[j][i] = (float)c[i];
+    }
+    AT[m - 1][alpha - 1] = 1.f;
+    G[alpha - 1][wino_r - 1] = 1.f;
+    poly(-1, c);
+    for (int i = 0; i < alpha; i++)
+        BT[alpha - 1][i] = (float)c[i];
+}
+
+void init_wino_wei_layout(
+        wino_wei_layout_t &l, int m, dim_t ic, dim_t oc, data_type_t dt) {
+    const bool is_bf16 = dt == data_type::bf16;
+    l.m = m;
+    l.alpha = m + wino_r - 1;
+    l.ic = ic;
+    l.oc = oc;
+    l.dt = dt;
+    // bf16 rows are interleaved in pairs and the reduction is padded to
+    // whole AMX tiles.
+    l.vnni = is_bf16 ? 2 : 1;
+    l.ic_pad = rnd_up(ic, is_bf16 ? 2 * simd_w : simd_w);
+    l.oc_pad = rnd_up(oc, simd_w);
+    l.oc_block = nstl::min<dim_t>(4 * simd_w, l.oc_pad);
+    l.nb_oc = div_up(l.oc_pad, l.oc_block);
+}
+
+status_t init_wino_wei_md(memory_desc_t &md, const memory_desc_t &wei_md,
+        const wino_wei_layout_t &l) {
+    md = wei_md;
+    md.data_type = l.dt;
+    md.format_kind = format_kind::wino;
+    md.offset0 = 0;
+    for (int d = 0; d < md.ndims; d++) {
+        md.padded_dims[d] = md.dims[d];
+        md.padded_offsets[d] = 0;
+    }
+
+    auto &wd = md.format_desc.wino_desc;
+    wd.wino_format = wino_memory_format_t::wino_wei_aaOBio;
+    wd.r = wino_r;
+    wd.alpha = l.alpha;
+    wd.ic = (int)l.ic;
+    wd.oc = (int)l.oc;
+    wd.ic_block = (int)l.ic_pad;
+    wd.oc_block = (int)l.oc_block;
+    wd.ic2_block = l.vnni;
+    wd.oc2_block = (int)l.nb_oc;
+    wd.adj_scale = 1.f;
+    wd.size = l.nelems() * types::data_type_size(l.dt);
+    return status::success;
+}
+
+bool wino_wei_layout_from_md(
+        wino_wei_layout_t &l, const memory_desc_wrapper &md) {
+    if (!md.is_wino_desc()) return false;
+    const auto &wd = md.wino_desc();
+    if (wd.wino_format != wino_memory_format_t::wino_wei_aaOBio) return false;
+
+    init_wino_wei_layout(l, wd.alpha - wino_r + 1, wd.ic, wd.oc,
+            md.data_type());
+    return wd.r == wino_r && wd.ic_block == l.ic_pad
+            && wd.oc_block == l.oc_block && wd.ic2_block == l.vnni
+            && wd.oc2_block == l.nb_oc;
+}
+
+void transform_weights(const wino_wei_layout_t &l, const void *wei,
+        const memory_desc_wrapper &wei_d, void *wino_wei) {
+    const wino_matrices_t mat(l.m);
+    const int alpha = l.alpha;
+    const auto wei_dt = wei_d.data_type();
+
+    parallel_nd(l.nb_oc * l.oc_block, l.ic_pad, [&](dim_t oc, dim_t ic) {
+        float U[max_alpha][max_alpha] = {};
+        if (oc < l.oc && ic < l.ic) {
+            float g[wino_r][wino_r];
+            for_(int kh = 0; kh < wino_r; kh++)
+            for (int kw = 0; kw < wino_r; kw++)
+                g[kh][kw] = io::load_float_value(
+                        wei_dt, wei, wei_d.off(oc, ic, kh, kw));
+
+            float Gg[max_alpha][wino_r] = {};
+            for_(int i = 0; i < alpha; i++)
+            for_(int j = 0; j < wino_r; j++)
+            for (int k = 0; k < wino_r; k++)
+                Gg[i][j] += mat.G[i][k] * g[k][j];
+            for_(int i = 0; i < alpha; i++)
+            for_(int j = 0; j < alpha; j++)
+            for (int k = 0; k < wino_r; k++)
+                U[i][j] += Gg[i][k] * mat.G[j][k];
+        }
+
+        for_(int i = 0; i < alpha; i++)
+        for (int j = 0; j < alpha; j++)
+            io::store_float_value(
+                    l.dt, U[i][j], wino_wei, l.off(i * alpha + j, oc, ic));
+    });
+}
+
+} // namespace brgemm_wino_utils
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
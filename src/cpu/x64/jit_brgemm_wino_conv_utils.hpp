@@ -0,0 +1,104 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_WINO_CONV_UTILS_HPP
+#define CPU_X64_JIT_BRGEMM_WINO_CONV_UTILS_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc_wrapper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace brgemm_wino_utils {
+
+// Size of the filter supported by the transforms.
+constexpr int wino_r = 3;
+// The largest supported tile, F(6x6, 3x3).
+constexpr int max_alpha = 8;
+// Channels are transformed in vectors of 16 elements.
+constexpr int simd_w = 16;
+
+// Transform matrices of F(m x m, 3x3) built with the Cook-Toom algorithm
+// from the interpolation points {0, 1, -1, 2, -2[, 1/2, -1/2]} and infinity.
+// The output tile is computed as
+//     Y = A^T [(G g G^T) * (B^T d B)] A.
+struct wino_matrices_t {
+    wino_matrices_t(int m);
+
+    int m;
+    int alpha;
+    float AT[max_alpha][max_alpha];
+    float BT[max_alpha][max_alpha];
+    float G[max_alpha][wino_r];
+};
+
+// Layout of the transformed weights, which are the B matrices of the brgemm
+// kernels: [alpha * alpha][nb_oc][ic_pad / vnni][oc_block][vnni].
+struct wino_wei_layout_t {
+    int m;
+    int alpha;
+    dim_t ic, oc;
+    dim_t ic_pad, oc_pad;
+    dim_t oc_block, nb_oc;
+    int vnni;
+    data_type_t dt;
+
+    dim_t off(int p, dim_t oc, dim_t ic) const {
+        const dim_t ocb = oc / oc_block;
+        return ((((dim_t)p * nb_oc + ocb) * (ic_pad / vnni) + ic / vnni)
+                               * oc_block
+                       + oc % oc_block)
+                * vnni
+                + ic % vnni;
+    }
+    dim_t nelems() const {
+        return (dim_t)alpha * alpha * nb_oc * ic_pad * oc_block;
+    }
+};
+
+// Fills the layout for a tile of `m` outputs. Transformed weights are kept
+// in `dt` and padded so that the reduction fills whole kernels of any isa.
+void init_wino_wei_layout(
+        wino_wei_layout_t &l, int m, dim_t ic, dim_t oc, data_type_t dt);
+
+// Describes the transformed weights as a `wino` memory descriptor with the
+// dimensions of the plain weights `wei_md`.
+status_t init_wino_wei_md(memory_desc_t &md, const memory_desc_t &wei_md,
+        const wino_wei_layout_t &l);
+
+// Restores the layout from a `wino` memory descriptor. Returns false if the
+// descriptor doesn't hold brgemm Winograd weights.
+bool wino_wei_layout_from_md(
+        wino_wei_layout_t &l, const memory_desc_wrapper &md);
+
+// Computes U = G g G^T for every pair of channels of the plain weights and
+// stores it in the layout. Padded channels are zeroed.
+void transform_weights(const wino_wei_layout_t &l, const void *wei,
+        const memory_desc_wrapper &wei_d, void *wino_wei);
+
+} // namespace brgemm_wino_utils
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,85 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_brgemm_wino_reorder.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::utils;
+
+status_t brgemm_wino_wei_reorder_t::pd_t::init(
+        engine_t *engine, engine_t *src_engine, engine_t *dst_engine) {
+    CHECK(cpu_reorder_pd_t::init(engine, src_engine, dst_engine));
+
+    const memory_desc_wrapper id(src_md_), od(dst_md_);
+    VDISPATCH_REORDER(brgemm_wino_utils::wino_wei_layout_from_md(wl_, od),
+            VERBOSE_UNSUPPORTED_FORMAT_KIND);
+    VDISPATCH_REORDER(
+            id.is_blocking_desc(), VERBOSE_UNSUPPORTED_TENSOR_LAYOUT, "src");
+    VDISPATCH_REORDER(id.ndims() == 4 && id.dims()[0] == wl_.oc
+                    && id.dims()[1] == wl_.ic
+                    && id.dims()[2] == brgemm_wino_utils::wino_r
+                    && id.dims()[3] == brgemm_wino_utils::wino_r,
+            VERBOSE_INCONSISTENT_MDS, "src", "dst");
+    VDISPATCH_REORDER(one_of(id.data_type(), f32, bf16)
+                    && one_of(od.data_type(), f32, bf16)
+                    && IMPLICATION(od.data_type() == f32,
+                            id.data_type() == f32),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_REORDER(!id.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_REORDER(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+
+    return status::success;
+}
+
+status_t brgemm_wino_wei_reorder_t::pd_t::create(reorder_pd_t **reorder_pd,
+        engine_t *engine, const primitive_attr_t *attr, engine_t *src_engine,
+        const memory_desc_t *src_md, engine_t *dst_engine,
+        const memory_desc_t *dst_md) {
+    VDISPATCH_REORDER_IC(impl::is_dense_format_kind({src_md, dst_md}),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    auto _pd = make_unique_pd<pd_t>(
+            attr, src_engine->kind(), src_md, dst_engine->kind(), dst_md);
+    if (_pd == nullptr) return status::out_of_memory;
+    CHECK(_pd->init(engine, src_engine, dst_engine));
+    CHECK(_pd->init_scratchpad_md());
+    return safe_ptr_assign<reorder_pd_t>(*reorder_pd, _pd.release());
+}
+
+status_t brgemm_wino_wei_reorder_t::execute(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const void *, DNNL_ARG_FROM);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_TO);
+
+    brgemm_wino_utils::transform_weights(
+            pd()->wl_, src, memory_desc_wrapper(pd()->src_md()), dst);
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
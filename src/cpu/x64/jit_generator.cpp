@@ -14,6 +14,17 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstring>
+#include <typeinfo>
+
+#ifndef _WIN32
+#include <dlfcn.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "common/verbose.hpp"
+
 #include "jit_generator.hpp"
 
 namespace dnnl {
@@ -115,6 +126,303 @@ void jit_generator_t::transpose(const Xbyak::Reg64 &reg_src,
     transpose_8x4(0);
     if (ncolumns > 4) transpose_8x4(4);
 }
+
+namespace {
+
+thread_local jit_code_blob_t *current_code_blob = nullptr;
+
+uint64_t load_u64(const uint8_t *p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+void store_u64(uint8_t *p, uint64_t v) {
+    std::memcpy(p, &v, sizeof(v));
+}
+
+#ifndef _WIN32
+const uint8_t *get_library_base() {
+    Dl_info info;
+    if (dladdr(reinterpret_cast<void *>(&get_library_base), &info) == 0)
+        return nullptr;
+    return static_cast<const uint8_t *>(info.dli_fbase);
+}
+
+// Returns true if `addr` belongs to a loaded module or to a mapped page, so
+// the value can't be treated as a plain constant.
+bool is_host_address(uint64_t addr, const uint8_t **module_base) {
+    *module_base = nullptr;
+    if (addr == 0) return false;
+    Dl_info info;
+    if (dladdr(reinterpret_cast<void *>(addr), &info) != 0
+            && info.dli_fbase) {
+        *module_base = static_cast<const uint8_t *>(info.dli_fbase);
+        return true;
+    }
+    static const uint64_t page_size = sysconf(_SC_PAGESIZE);
+    unsigned char vec = 0;
+    return mincore(reinterpret_cast<void *>(addr & ~(page_size - 1)),
+                   page_size, &vec)
+            == 0;
+}
+#endif
+
+} // namespace
+
+size_t jit_generator_t::config_hash() const {
+    size_t seed = 0;
+    seed = hash_combine(seed, std::string(typeid(*this).name()));
+    seed = hash_combine(seed, std::string(name()));
+    seed = hash_combine(seed, static_cast<size_t>(max_cpu_isa_));
+    return seed;
+}
+
+status_t jit_generator_t::get_code_image(jit_code_image_t &image) {
+#ifdef _WIN32
+    return status::unimplemented;
+#else
+    using reloc_kind_t = jit_code_image_t::reloc_kind_t;
+    const size_t code_size = getSize();
+    const uint8_t *code = jit_ker_;
+    if (!code || code_size == 0 || code_size > UINT32_MAX)
+        return status::unimplemented;
+
+    image.name = name();
+    image.config_hash = config_hash();
+    image.code.assign(code, code + code_size);
+    image.relocs.clear();
+
+    // Labels referenced by an absolute address are resolved against the code
+    // location in `ready()`. To find them, resolve the jumps once again
+    // against a shifted copy of the code and compare the results.
+    const uint64_t code_addr = reinterpret_cast<uint64_t>(code);
+    std::vector<uint8_t> buf(code_size + 256);
+    uint8_t *shifted = buf.data();
+    while (((reinterpret_cast<uint64_t>(shifted) - code_addr) & 0xff) == 0)
+        shifted++;
+    std::memcpy(shifted, code, code_size);
+    uint8_t *const top = top_;
+    top_ = shifted;
+    isCalledCalcJmpAddress_ = false;
+    // Jumps to host functions may not be resolvable for the shifted copy, but
+    // such code is not relocatable anyway.
+#ifdef XBYAK_NO_EXCEPTION
+    calcJmpAddress();
+    const bool is_resolved = Xbyak::GetError() == Xbyak::ERR_NONE;
+    Xbyak::ClearError();
+#else
+    bool is_resolved = true;
+    try {
+        calcJmpAddress();
+    } catch (const Xbyak::Error &) { is_resolved = false; }
+#endif
+    top_ = top;
+    isCalledCalcJmpAddress_ = true;
+    if (!is_resolved) return status::unimplemented;
+
+    const uint64_t shift = reinterpret_cast<uint64_t>(shifted) - code_addr;
+    for (size_t off = 0; off < code_size; off++) {
+        if (code[off] == shifted[off]) continue;
+        // Relative jumps to host functions (Xbyak::inner::Labs) end up here.
+        if (off + sizeof(uint64_t) > code_size
+                || load_u64(shifted + off) - load_u64(code + off) != shift)
+            return status::unimplemented;
+        store_u64(image.code.data() + off, load_u64(code + off) - code_addr);
+        image.relocs.push_back(
+                {static_cast<uint32_t>(off), reloc_kind_t::code});
+        off += sizeof(uint64_t) - 1;
+    }
+
+    const uint8_t *library_base = get_library_base();
+    for (const auto &e : host_imms_) {
+        const size_t end = e.first;
+        const uint64_t imm = e.second;
+        const bool is_imm64 = end >= sizeof(uint64_t)
+                && load_u64(code + end - sizeof(uint64_t)) == imm;
+        if (is_imm64 && imm >= code_addr && imm < code_addr + code_size) {
+            store_u64(image.code.data() + end - sizeof(uint64_t),
+                    imm - code_addr);
+            image.relocs.push_back(
+                    {static_cast<uint32_t>(end - sizeof(uint64_t)),
+                            reloc_kind_t::code});
+            continue;
+        }
+
+        const uint8_t *module_base = nullptr;
+        if (!is_host_address(imm, &module_base)) continue;
+        if (!is_imm64 || !library_base || module_base != library_base)
+            return status::unimplemented;
+        store_u64(image.code.data() + end - sizeof(uint64_t),
+                imm - reinterpret_cast<uint64_t>(library_base));
+        image.relocs.push_back({static_cast<uint32_t>(end - sizeof(uint64_t)),
+                reloc_kind_t::library});
+    }
+    host_imms_.clear();
+    host_imms_.shrink_to_fit();
+
+    return status::success;
+#endif
+}
+
+status_t jit_generator_t::create_kernel(const jit_code_image_t &image) {
+#ifdef _WIN32
+    return status::unimplemented;
+#else
+    using reloc_kind_t = jit_code_image_t::reloc_kind_t;
+    const size_t code_size = image.code.size();
+    if (code_size == 0) return status::runtime_error;
+    // The kernels may be created in a different order or with different
+    // configurations than the ones the image was recorded for.
+    VCONDCHECK(primitive, create, check, jit, image.name == name(),
+            status::runtime_error,
+            "cache blob mismatch: expected kernel %s, got %s", name(),
+            image.name.c_str());
+    VCONDCHECK(primitive, create, check, jit,
+            image.config_hash == config_hash(), status::runtime_error,
+            "cache blob mismatch: configuration of kernel %s differs",
+            name());
+
+    const uint8_t *library_base = get_library_base();
+    for (const auto &r : image.relocs) {
+        if (r.offset + sizeof(uint64_t) > code_size)
+            return status::runtime_error;
+        if (r.kind == reloc_kind_t::library && !library_base)
+            return status::runtime_error;
+    }
+
+    while (maxSize_ < code_size && Xbyak::GetError() == Xbyak::ERR_NONE)
+        growMemory();
+    int err_code = Xbyak::GetError();
+    if (err_code == Xbyak::ERR_CANT_ALLOC) return status::out_of_memory;
+    if (err_code != Xbyak::ERR_NONE) return status::runtime_error;
+
+    std::memcpy(top_, image.code.data(), code_size);
+    setSize(code_size);
+    for (const auto &r : image.relocs) {
+        const uint64_t base = r.kind == reloc_kind_t::code
+                ? reinterpret_cast<uint64_t>(top_)
+                : reinterpret_cast<uint64_t>(library_base);
+        store_u64(top_ + r.offset, load_u64(top_ + r.offset) + base);
+    }
+
+    jit_ker_ = getCode();
+    return (jit_ker_) ? status::success : status::runtime_error;
+#endif
+}
+
+jit_code_blob_t::scope_t::scope_t(
+        jit_code_blob_t &code_blob, const cache_blob_t &cache_blob)
+    : prev_(current_code_blob) {
+    code_blob.images_.clear();
+    code_blob.is_serializable_ = true;
+    code_blob.cache_blob_ = cache_blob;
+    code_blob.n_images_to_restore_ = 0;
+    code_blob.is_header_restored_ = false;
+    current_code_blob = &code_blob;
+}
+
+jit_code_blob_t::scope_t::~scope_t() {
+    // The cache blob is owned by the caller and is not needed after the
+    // primitive creation.
+    current_code_blob->cache_blob_ = cache_blob_t();
+    current_code_blob = prev_;
+}
+
+jit_code_blob_t *jit_code_blob_t::current() {
+    return current_code_blob;
+}
+
+void jit_code_blob_t::record(jit_generator_t &kernel) {
+    if (!is_serializable_) return;
+    jit_code_image_t image;
+    if (kernel.get_code_image(image) != status::success) {
+        is_serializable_ = false;
+        images_.clear();
+        return;
+    }
+    images_.push_back(std::move(image));
+}
+
+status_t jit_code_blob_t::restore(jit_generator_t &kernel) {
+    if (!is_header_restored_) {
+        CHECK(cache_blob_.get_value(
+                reinterpret_cast<uint8_t *>(&n_images_to_restore_),
+                sizeof(n_images_to_restore_)));
+        is_header_restored_ = true;
+    }
+    if (n_images_to_restore_ == 0) return status::runtime_error;
+    n_images_to_restore_--;
+
+    jit_code_image_t image;
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    CHECK(cache_blob_.get_binary(&data, &size));
+    image.name.assign(reinterpret_cast<const char *>(data), size);
+    CHECK(cache_blob_.get_value(reinterpret_cast<uint8_t *>(&image.config_hash),
+            sizeof(image.config_hash)));
+    CHECK(cache_blob_.get_binary(&data, &size));
+    image.code.assign(data, data + size);
+
+    size_t n_relocs = 0;
+    CHECK(cache_blob_.get_value(
+            reinterpret_cast<uint8_t *>(&n_relocs), sizeof(n_relocs)));
+    if (n_relocs > 0) {
+        CHECK(cache_blob_.get_binary(&data, &size));
+        if (size != n_relocs * sizeof(jit_code_image_t::reloc_t))
+            return status::runtime_error;
+        image.relocs.resize(n_relocs);
+        std::memcpy(image.relocs.data(), data, size);
+    }
+
+    CHECK(kernel.create_kernel(image));
+    // Keep the image so the restored primitive can be serialized again.
+    images_.push_back(std::move(image));
+    return status::success;
+}
+
+status_t jit_code_blob_t::get_cache_blob_size(size_t *size) const {
+    if (!size) return status::invalid_arguments;
+    if (!is_serializable_) return status::unimplemented;
+    // Binaries are packed along with their size.
+    (*size) += sizeof(size_t);
+    for (const auto &image : images_) {
+        (*size) += sizeof(size_t) + image.name.size();
+        (*size) += sizeof(image.config_hash);
+        (*size) += sizeof(size_t) + image.code.size();
+        (*size) += sizeof(size_t);
+        if (!image.relocs.empty())
+            (*size) += sizeof(size_t)
+                    + image.relocs.size() * sizeof(jit_code_image_t::reloc_t);
+    }
+    return status::success;
+}
+
+status_t jit_code_blob_t::get_cache_blob(cache_blob_t &cache_blob) const {
+    if (!is_serializable_) return status::unimplemented;
+    const size_t n_images = images_.size();
+    CHECK(cache_blob.add_value(
+            reinterpret_cast<const uint8_t *>(&n_images), sizeof(n_images)));
+    for (const auto &image : images_) {
+        CHECK(cache_blob.add_binary(
+                reinterpret_cast<const uint8_t *>(image.name.data()),
+                image.name.size()));
+        CHECK(cache_blob.add_value(
+                reinterpret_cast<const uint8_t *>(&image.config_hash),
+                sizeof(image.config_hash)));
+        CHECK(cache_blob.add_binary(image.code.data(), image.code.size()));
+        const size_t n_relocs = image.relocs.size();
+        CHECK(cache_blob.add_value(
+                reinterpret_cast<const uint8_t *>(&n_relocs),
+                sizeof(n_relocs)));
+        if (n_relocs > 0)
+            CHECK(cache_blob.add_binary(
+                    reinterpret_cast<const uint8_t *>(image.relocs.data()),
+                    n_relocs * sizeof(jit_code_image_t::reloc_t)));
+    }
+    return status::success;
+}
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
@@ -18,9 +18,11 @@
 #define CPU_X64_JIT_GENERATOR_HPP
 
 #include <limits.h>
+#include <string>
 #include <vector>
 
 #include "common/bit_cast.hpp"
+#include "common/cache_blob.hpp"
 #include "common/compiler_workarounds.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
@@ -140,6 +142,75 @@ constexpr Xbyak::Operand::Code abi_not_param_reg =
 
 #endif
 
+class jit_generator_t;
+
+// Relocatable copy of the code of a finalized jit kernel. Absolute addresses
+// embedded into the code are stored as offsets from the beginning of the code
+// (`code` relocations) or from the load address of the library (`library`
+// relocations) and are patched when the kernel is restored.
+struct jit_code_image_t {
+    enum class reloc_kind_t : uint32_t { code = 0, library = 1 };
+    struct reloc_t {
+        uint32_t offset;
+        reloc_kind_t kind;
+    };
+
+    std::string name;
+    // Hash of the configuration the code was generated from, see
+    // jit_generator_t::config_hash().
+    size_t config_hash = 0;
+    std::vector<uint8_t> code;
+    std::vector<reloc_t> relocs;
+};
+
+// Keeps the images of the jit kernels created by a primitive so they can be
+// packed into a primitive cache blob, and feeds the images back to the kernels
+// when the primitive is created from a cache blob, so no code is generated.
+//
+// Kernels are matched with images in the order of their creation, hence only
+// primitives that create the same kernels in the same order for a given
+// primitive descriptor may use it. An image is restored only if the kernel
+// name and configuration hash match the ones of the kernel being created.
+struct jit_code_blob_t {
+    // Binds the blob to the jit kernels created by the current thread for the
+    // lifetime of the scope. The kernels are restored from `cache_blob` if it
+    // is not empty, otherwise their code is recorded.
+    struct scope_t {
+        scope_t(jit_code_blob_t &code_blob, const cache_blob_t &cache_blob);
+        ~scope_t();
+
+    private:
+        jit_code_blob_t *prev_;
+        DNNL_DISALLOW_COPY_AND_ASSIGN(scope_t);
+    };
+
+    jit_code_blob_t() = default;
+
+    status_t get_cache_blob_size(size_t *size) const;
+    status_t get_cache_blob(cache_blob_t &cache_blob) const;
+
+    static jit_code_blob_t *current();
+    static bool is_recording() {
+        const auto *code_blob = current();
+        return code_blob && !code_blob->is_restoring();
+    }
+
+    bool is_restoring() const { return bool(cache_blob_); }
+
+    void record(jit_generator_t &kernel);
+    status_t restore(jit_generator_t &kernel);
+
+private:
+    std::vector<jit_code_image_t> images_;
+    bool is_serializable_ = true;
+
+    cache_blob_t cache_blob_;
+    size_t n_images_to_restore_ = 0;
+    bool is_header_restored_ = false;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(jit_code_blob_t);
+};
+
 class jit_generator_t : public Xbyak::MmapAllocator,
                         public Xbyak::CodeGenerator,
                         public c_compatible {
@@ -2766,9 +2837,35 @@ public:
         int err_code = Xbyak::GetError();
         if (err_code == Xbyak::ERR_CANT_ALLOC) return status::out_of_memory;
         if (err_code != Xbyak::ERR_NONE) return status::runtime_error;
+        auto *code_blob = jit_code_blob_t::current();
+        if (code_blob && code_blob->is_restoring())
+            return code_blob->restore(*this);
         generate();
         jit_ker_ = getCode();
-        return (jit_ker_) ? status::success : status::runtime_error;
+        if (!jit_ker_) return status::runtime_error;
+        if (code_blob) code_blob->record(*this);
+        return status::success;
+    }
+
+    // Returns a hash of the configuration the code is generated from. The
+    // default one covers the kernel type, name and ISA; kernels generating
+    // different code for different descriptors mix the descriptor in.
+    virtual size_t config_hash() const;
+
+    // Returns a relocatable copy of the generated code. Fails with
+    // `unimplemented` if the code references host memory which can't be
+    // relocated, e.g. objects allocated on heap.
+    status_t get_code_image(jit_code_image_t &image);
+    // Finalizes the kernel with the code from `image` instead of generating it.
+    status_t create_kernel(const jit_code_image_t &image);
+
+    // Shadows Xbyak::CodeGenerator::mov() to track immediate values that may
+    // hold host addresses while the code is recorded into jit_code_blob_t.
+    using Xbyak::CodeGenerator::mov;
+    void mov(const Xbyak::Operand &op, uint64_t imm) {
+        Xbyak::CodeGenerator::mov(op, imm);
+        if (op.isREG(64) && jit_code_blob_t::is_recording())
+            host_imms_.emplace_back(getSize(), imm);
     }
 
     inline cpu_isa_t max_cpu_isa() const noexcept { return max_cpu_isa_; }
@@ -2793,6 +2890,9 @@ private:
 
     static constexpr unsigned max_code_size = 256 * 1024;
 
+    // Code offset past the immediate and the immediate value itself.
+    std::vector<std::pair<size_t, uint64_t>> host_imms_;
+
 protected:
     virtual void generate() = 0;
     const Xbyak::uint8 *jit_ker_ = nullptr;
@@ -841,6 +841,11 @@ struct jit_brgemm_conv_conf_t {
     int tr_src_num_guard_elems;
     bool global_transpose; // diff_dst & src tensors are transposed in one go
     int nthr_mb_work;
+    // Number of partial sums of the reduction by minibatch. It is nthr_mb
+    // unless the reduction is deterministic, then the work is split into
+    // blocks independent of the number of threads.
+    int nb_red_blk;
+    bool deterministic;
     int tr_iw, tr_ow;
     int spatial_blk_size; // Height/depth block size inside the driver
     int typesize_in;
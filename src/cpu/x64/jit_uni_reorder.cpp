@@ -104,6 +104,40 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator_t {
         return jit_generator_t::create_kernel();
     }
 
+    size_t config_hash() const override {
+        size_t seed = jit_generator_t::config_hash();
+        seed = hash_combine(seed, desc_.id);
+        seed = hash_combine(seed, prb_.itype);
+        seed = hash_combine(seed, prb_.otype);
+        seed = hash_combine(seed, prb_.ndims);
+        for (int d = 0; d < prb_.ndims; d++) {
+            const auto &node = prb_.nodes[d];
+            seed = hash_combine(seed, node.n);
+            seed = hash_combine(seed, node.tail_size);
+            seed = hash_combine(seed, node.dim_id);
+            seed = hash_combine(seed, node.parent_node_id);
+            seed = hash_combine(seed, node.is_zero_pad_needed);
+            seed = hash_combine(seed, node.is);
+            seed = hash_combine(seed, node.os);
+            seed = hash_combine(seed, node.ss);
+            seed = hash_combine(seed, node.cs);
+        }
+        seed = hash_combine(seed, prb_.ioff);
+        seed = hash_combine(seed, prb_.ooff);
+        seed = hash_combine(seed, prb_.src_scale_type);
+        seed = hash_combine(seed, prb_.dst_scale_type);
+        seed = hash_combine(seed, prb_.beta);
+        seed = hash_combine(seed, prb_.full_ndims);
+        seed = hash_combine(seed, prb_.is_tail_present);
+        seed = hash_combine(seed, prb_.scale_adjust);
+        seed = hash_combine(seed, prb_.compensation_mask);
+        seed = hash_combine(seed, prb_.req_s8s8_comp);
+        seed = hash_combine(seed, prb_.req_asymmetric_comp);
+        seed = hash_combine(seed, prb_.req_src_zp);
+        seed = hash_combine(seed, prb_.req_dst_zp);
+        return seed;
+    }
+
     enum class scale_arg_t { NONE, SRC, DST };
 
     enum {
@@ -2462,13 +2496,14 @@ void jit_uni_reorder_t::omp_driver_0d(int off, const char *in, char *out,
     }
 }
 
-void jit_uni_reorder_t::omp_driver_1d(int ithr, int nthr, int off,
-        const char *in, char *out, const float *src_scales,
+void jit_uni_reorder_t::omp_driver_1d(int nthr,
+        dynamic_work_counter_t &counter, int off, const char *in, char *out,
+        const float *src_scales,
         const float *dst_scales, int src_zp, int dst_zp,
         int32_t *compensation_scratch) const {
     const tr::prb_t &prb = pd()->prb_;
     const tr::node_t *ns = prb.nodes + off;
-    for_nd(ithr, nthr, (ptrdiff_t)ns[0].n, [&](ptrdiff_t d0) {
+    for_nd_dynamic(nthr, counter, (ptrdiff_t)ns[0].n, [&](ptrdiff_t d0) {
         tr::call_param_t base_params;
         base_params.in = in + d0 * ns[0].is * data_type_size(prb.itype);
         base_params.out = out + d0 * ns[0].os * data_type_size(prb.otype);
@@ -2494,13 +2529,14 @@ void jit_uni_reorder_t::omp_driver_1d(int ithr, int nthr, int off,
     });
 }
 
-void jit_uni_reorder_t::omp_driver_2d(int ithr, int nthr, int off,
-        const char *in, char *out, const float *src_scales,
+void jit_uni_reorder_t::omp_driver_2d(int nthr,
+        dynamic_work_counter_t &counter, int off, const char *in, char *out,
+        const float *src_scales,
         const float *dst_scales, int src_zp, int dst_zp,
         int32_t *compensation_scratch) const {
     const tr::prb_t &prb = pd()->prb_;
     const tr::node_t *ns = prb.nodes + off;
-    for_nd(ithr, nthr, (ptrdiff_t)ns[1].n, (ptrdiff_t)ns[0].n,
+    for_nd_dynamic(nthr, counter, (ptrdiff_t)ns[1].n, (ptrdiff_t)ns[0].n,
             [&](ptrdiff_t d1, ptrdiff_t d0) {
                 tr::call_param_t base_params;
                 base_params.in = in
@@ -2534,13 +2570,14 @@ void jit_uni_reorder_t::omp_driver_2d(int ithr, int nthr, int off,
             });
 }
 
-void jit_uni_reorder_t::omp_driver_3d(int ithr, int nthr, int off,
-        const char *in, char *out, const float *src_scales,
+void jit_uni_reorder_t::omp_driver_3d(int nthr,
+        dynamic_work_counter_t &counter, int off, const char *in, char *out,
+        const float *src_scales,
         const float *dst_scales, int src_zp, int dst_zp,
         int32_t *compensation_scratch) const {
     const tr::prb_t &prb = pd()->prb_;
     const tr::node_t *ns = prb.nodes + off;
-    for_nd(ithr, nthr, (ptrdiff_t)ns[2].n, (ptrdiff_t)ns[1].n,
+    for_nd_dynamic(nthr, counter, (ptrdiff_t)ns[2].n, (ptrdiff_t)ns[1].n,
             (ptrdiff_t)ns[0].n, [&](ptrdiff_t d2, ptrdiff_t d1, ptrdiff_t d0) {
                 tr::call_param_t base_params;
                 base_params.in = in
@@ -2574,13 +2611,14 @@ void jit_uni_reorder_t::omp_driver_3d(int ithr, int nthr, int off,
             });
 }
 
-void jit_uni_reorder_t::omp_driver_4d(int ithr, int nthr, int off,
-        const char *in, char *out, const float *src_scales,
+void jit_uni_reorder_t::omp_driver_4d(int nthr,
+        dynamic_work_counter_t &counter, int off, const char *in, char *out,
+        const float *src_scales,
         const float *dst_scales, int src_zp, int dst_zp,
         int32_t *compensation_scratch) const {
     const tr::prb_t &prb = pd()->prb_;
     const tr::node_t *ns = prb.nodes + off;
-    for_nd(ithr, nthr, (ptrdiff_t)ns[3].n, (ptrdiff_t)ns[2].n,
+    for_nd_dynamic(nthr, counter, (ptrdiff_t)ns[3].n, (ptrdiff_t)ns[2].n,
             (ptrdiff_t)ns[1].n, (ptrdiff_t)ns[0].n,
             [&](ptrdiff_t d3, ptrdiff_t d2, ptrdiff_t d1, ptrdiff_t d0) {
                 tr::call_param_t base_params;
@@ -2658,6 +2696,10 @@ void jit_uni_reorder_t::omp_driver(const char *in, char *out,
         omp_driver_0d(ndims_ker, in, out, src_scales, dst_scales, src_zp,
                 dst_zp, compensation_reduce_scratch);
     } else {
+        // Work is handed out dynamically, so compensation is accumulated in
+        // the scratch of the thread that happens to process the data and is
+        // reduced over all the threads afterwards.
+        dynamic_work_counter_t counter(0);
         parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
             int32_t *compensation_scratch = nullptr;
             if (req_compensation) {
@@ -2668,20 +2710,24 @@ void jit_uni_reorder_t::omp_driver(const char *in, char *out,
 
             switch (ndims - ndims_ker) {
                 case 1:
-                    omp_driver_1d(ithr, nthr, ndims_ker, in, out, src_scales,
-                            dst_scales, src_zp, dst_zp, compensation_scratch);
+                    omp_driver_1d(nthr, counter, ndims_ker, in, out,
+                            src_scales, dst_scales, src_zp, dst_zp,
+                            compensation_scratch);
                     break;
                 case 2:
-                    omp_driver_2d(ithr, nthr, ndims_ker, in, out, src_scales,
-                            dst_scales, src_zp, dst_zp, compensation_scratch);
+                    omp_driver_2d(nthr, counter, ndims_ker, in, out,
+                            src_scales, dst_scales, src_zp, dst_zp,
+                            compensation_scratch);
                     break;
                 case 3:
-                    omp_driver_3d(ithr, nthr, ndims_ker, in, out, src_scales,
-                            dst_scales, src_zp, dst_zp, compensation_scratch);
+                    omp_driver_3d(nthr, counter, ndims_ker, in, out,
+                            src_scales, dst_scales, src_zp, dst_zp,
+                            compensation_scratch);
                     break;
                 case 4:
-                    omp_driver_4d(ithr, nthr, ndims_ker, in, out, src_scales,
-                            dst_scales, src_zp, dst_zp, compensation_scratch);
+                    omp_driver_4d(nthr, counter, ndims_ker, in, out,
+                            src_scales, dst_scales, src_zp, dst_zp,
+                            compensation_scratch);
                     break;
                 default: assert(!"unimplemented");
             }
@@ -2786,6 +2832,7 @@ void jit_uni_reorder_t::fill_curr_data_chunks(const tr::prb_t &prb,
 }
 
 status_t jit_uni_reorder_t::init(engine_t *engine) {
+    jit_code_blob_t::scope_t jit_code_blob_scope(jit_code_blob_, cache_blob());
     CHECK(safe_ptr_assign(kernel_, tr::kernel_t::create(pd()->ker_desc_)));
     return kernel_->create_kernel();
 }
@@ -23,6 +23,7 @@
 #include "common/type_helpers.hpp"
 
 #include "cpu/reorder/cpu_reorder_pd.hpp"
+#include "cpu/x64/jit_generator.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -239,24 +240,37 @@ struct jit_uni_reorder_t : public primitive_t {
     status_t init(engine_t *engine) override;
     status_t execute(const exec_ctx_t &ctx) const override;
 
+    status_t get_cache_blob_size(
+            engine_t *engine, size_t *size) const override {
+        return jit_code_blob_.get_cache_blob_size(size);
+    }
+    status_t get_cache_blob(
+            engine_t *engine, cache_blob_t &cache_blob) const override {
+        return jit_code_blob_.get_cache_blob(cache_blob);
+    }
+
     enum { ndims_driver_max = 4 };
 
 private:
     void omp_driver_0d(int off, const char *in, char *out,
             const float *src_scales, const float *dst_scales, int src_zp,
             int dst_zp, int32_t *compensation_scratch) const;
-    void omp_driver_1d(int ithr, int nthr, int off, const char *in, char *out,
-            const float *src_scales, const float *dst_scales, int src_zp,
-            int dst_zp, int32_t *compensation_scratch) const;
-    void omp_driver_2d(int ithr, int nthr, int off, const char *in, char *out,
-            const float *src_scales, const float *dst_scales, int src_zp,
-            int dst_zp, int32_t *compensation_scratch) const;
-    void omp_driver_3d(int ithr, int nthr, int off, const char *in, char *out,
-            const float *src_scales, const float *dst_scales, int src_zp,
-            int dst_zp, int32_t *compensation_scratch) const;
-    void omp_driver_4d(int ithr, int nthr, int off, const char *in, char *out,
-            const float *src_scales, const float *dst_scales, int src_zp,
-            int dst_zp, int32_t *compensation_scratch) const;
+    void omp_driver_1d(int nthr, dynamic_work_counter_t &counter, int off,
+            const char *in, char *out, const float *src_scales,
+            const float *dst_scales, int src_zp, int dst_zp,
+            int32_t *compensation_scratch) const;
+    void omp_driver_2d(int nthr, dynamic_work_counter_t &counter, int off,
+            const char *in, char *out, const float *src_scales,
+            const float *dst_scales, int src_zp, int dst_zp,
+            int32_t *compensation_scratch) const;
+    void omp_driver_3d(int nthr, dynamic_work_counter_t &counter, int off,
+            const char *in, char *out, const float *src_scales,
+            const float *dst_scales, int src_zp, int dst_zp,
+            int32_t *compensation_scratch) const;
+    void omp_driver_4d(int nthr, dynamic_work_counter_t &counter, int off,
+            const char *in, char *out, const float *src_scales,
+            const float *dst_scales, int src_zp, int dst_zp,
+            int32_t *compensation_scratch) const;
 
     void omp_driver(const char *in, char *out, const float *src_scales,
             const float *dst_scales, int src_zp, int dst_zp,
@@ -272,6 +286,7 @@ private:
 
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     std::unique_ptr<tr::kernel_t> kernel_;
+    jit_code_blob_t jit_code_blob_;
 };
 
 struct jit_blk_reorder_t : public primitive_t {
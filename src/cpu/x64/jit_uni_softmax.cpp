@@ -1663,6 +1663,8 @@ status_t jit_uni_softmax_fwd_t::init(engine_t *engine) {
 }
 
 status_t jit_uni_softmax_fwd_t::execute(const exec_ctx_t &ctx) const {
+    if (pd()->split_axis_) return execute_split_axis(ctx);
+
     const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
     auto scratchpad_ptr = ctx.get_scratchpad_grantor().template get<char>(
@@ -1764,6 +1766,78 @@ status_t jit_uni_softmax_fwd_t::execute(const exec_ctx_t &ctx) const {
     return status::success;
 }
 
+status_t jit_uni_softmax_fwd_t::execute_split_axis(
+        const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+    auto stats = ctx.get_scratchpad_grantor().template get<float>(
+            memory_tracking::names::key_softmax_reduction);
+
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+    DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const auto src_dt = src_d.data_type();
+    const auto dst_dt = dst_d.data_type();
+    const auto src_dt_size = src_d.data_type_size();
+    const auto dst_dt_size = dst_d.data_type_size();
+    const dim_t axis_size = pd()->axis_size();
+    const dim_t outer_size = pd()->outer_size();
+    const dim_t nchunks = pd()->nthr_per_row();
+    const bool is_softmax = pd()->is_softmax();
+
+    // `stats` keeps the max of a chunk followed by the sum of exponents of
+    // its elements shifted by that max.
+    const auto chunk_stats = [&](dim_t ou, dim_t chunk) {
+        return stats + 2 * (ou * nchunks + chunk);
+    };
+
+    // Pass 1: statistics of every chunk.
+    parallel_nd(outer_size, nchunks, [&](dim_t ou, dim_t chunk) {
+        dim_t start {0}, end {0};
+        balance211(axis_size, nchunks, chunk, start, end);
+        const char *src_row = src + ou * axis_size * src_dt_size;
+        float max = nstl::numeric_limits<float>::lowest();
+        for (dim_t i = start; i < end; i++)
+            max = nstl::max(max, cpu::io::load_float_value(src_dt, src_row, i));
+        float sum = 0.f;
+        for (dim_t i = start; i < end; i++)
+            sum += ::expf(cpu::io::load_float_value(src_dt, src_row, i) - max);
+        float *cs = chunk_stats(ou, chunk);
+        cs[0] = max;
+        cs[1] = sum;
+    });
+
+    // Pass 2: every chunk combines the statistics of its row, which is cheap
+    // compared to a synchronization, and normalizes its elements.
+    parallel_nd(outer_size, nchunks, [&](dim_t ou, dim_t chunk) {
+        float max = nstl::numeric_limits<float>::lowest();
+        for (dim_t c = 0; c < nchunks; c++)
+            max = nstl::max(max, chunk_stats(ou, c)[0]);
+        float sum = 0.f;
+        for (dim_t c = 0; c < nchunks; c++) {
+            const float *cs = chunk_stats(ou, c);
+            // Empty chunks have no contribution.
+            if (cs[1] > 0.f) sum += cs[1] * ::expf(cs[0] - max);
+        }
+        const float denom = is_softmax ? (sum ? 1.f / sum : 1.f) : ::logf(sum);
+        const float scale = src_scales[0] * dst_scales[0];
+
+        dim_t start {0}, end {0};
+        balance211(axis_size, nchunks, chunk, start, end);
+        const char *src_row = src + ou * axis_size * src_dt_size;
+        char *dst_row = dst + ou * axis_size * dst_dt_size;
+        for (dim_t i = start; i < end; i++) {
+            const float d = cpu::io::load_float_value(src_dt, src_row, i) - max;
+            const float val = is_softmax ? ::expf(d) * denom : d - denom;
+            cpu::io::store_float_value(dst_dt, val * scale, dst_row, i);
+        }
+    });
+
+    return status::success;
+}
+
 jit_uni_softmax_bwd_t::jit_uni_softmax_bwd_t(const pd_t *apd)
     : primitive_t(apd) {}
 
@@ -158,6 +158,7 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
             const memory_desc_wrapper dst_d(dst_md());
             axis_is_plain_and_strided_ = dst_d.is_plain() && axis_stride() > 1;
             nthr_ = dnnl_get_max_threads();
+            split_axis_ = use_split_axis();
             init_scratchpad();
 
             return status::success;
@@ -167,9 +168,39 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
         size_t scratch_size_per_thr_ = 0;
         cpu_isa_t isa_ = isa_undef;
         bool axis_is_plain_and_strided_ = false;
+        // Rows are split between threads along the axis.
+        bool split_axis_ = false;
+
+        // Number of threads processing a single row in the split axis mode.
+        int nthr_per_row() const {
+            return nstl::max<int>(1, nthr_ / outer_size());
+        }
 
     private:
+        // When there are much fewer rows than threads, e.g. a softmax over a
+        // vocabulary for a single token, parallelization over rows leaves
+        // most of the threads idle. Such rows are split between threads
+        // instead: every thread computes the max and the sum of exponents of
+        // its chunk, and the chunks are normalized with the combined values.
+        bool use_split_axis() const {
+            constexpr dim_t min_chunk_size = 4096;
+            const memory_desc_wrapper dst_d(dst_md());
+            return dst_d.is_plain() && axis_stride() == 1
+                    && axis_size(true) == axis_size()
+                    && attr()->post_ops_.len() == 0
+                    && outer_size() * 4 <= nthr_
+                    && axis_size() >= 2 * min_chunk_size;
+        }
+
         void init_scratchpad() {
+            if (split_axis_) {
+                // The max and the sum of exponents of every chunk.
+                auto scratchpad = scratchpad_registry().registrar();
+                scratchpad.template book<float>(
+                        memory_tracking::names::key_softmax_reduction,
+                        2 * outer_size() * nthr_per_row());
+                return;
+            }
             const auto src_dt = src_md()->data_type;
             const auto dst_dt = dst_md()->data_type;
             // Relaxed accumulation allows to downconvert intermediate results
@@ -263,6 +294,7 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
     status_t execute(const exec_ctx_t &ctx) const override;
 
 private:
+    status_t execute_split_axis(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     std::unique_ptr<softmax_impl::jit_softmax_kernel_base_t> ker_;
 };
@@ -180,9 +180,12 @@ bool matmul_amx_blocking_params_macro_t::find_best_blocking(
             for (int m_div = 1; m_div <= current_blocking.nthr_ / b_div;
                     ++m_div) {
                 if ((current_blocking.nthr_ / b_div) % m_div != 0) continue;
-                for (int k_div = 1;
-                        k_div <= (current_blocking.nthr_ / b_div) / m_div;
-                        ++k_div) {
+                // The reduction over K would also go over the rows beyond
+                // the lengths of a ragged batch.
+                const int max_k_div = bgmmc.is_ragged
+                        ? 1
+                        : (current_blocking.nthr_ / b_div) / m_div;
+                for (int k_div = 1; k_div <= max_k_div; ++k_div) {
                     if (((current_blocking.nthr_ / b_div) / m_div) % k_div != 0)
                         continue;
                     int n_div = ((current_blocking.nthr_ / b_div) / m_div)
@@ -823,7 +826,10 @@ void matmul_amx_blocking_params_micro_t::find_best_blocking(
 
     const bool runtime_dims
             = bgmmc.is_runtime_M || bgmmc.is_runtime_N || bgmmc.is_runtime_K;
-    const int max_nthr_k = !runtime_dims && is_amx_xf16 && bgmmc.batch == 1
+    // The reduction over K would also go over the rows beyond the lengths of
+    // a ragged batch.
+    const bool k_parallel_ok = !runtime_dims && !bgmmc.is_ragged;
+    const int max_nthr_k = k_parallel_ok && is_amx_xf16 && bgmmc.batch == 1
             ? nstl::min(saturate(1, 7, bgmmc.nthr / 8), max_k_parallel_work)
             : 1;
     int iter = 0;
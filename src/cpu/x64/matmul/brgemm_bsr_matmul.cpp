@@ -0,0 +1,402 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/amx_tile_configure.hpp"
+#include "cpu/x64/matmul/brgemm_bsr_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+// Packs the stored blocks of R x C elements from the row-major order into
+// the kernel layout, where groups of vnni rows are interleaved.
+template <typename data_t>
+void pack_blocks(const data_t *values, data_t *packed, dim_t nnz_blocks,
+        dim_t R, dim_t C, dim_t vnni) {
+    parallel_nd(nnz_blocks, R, [&](dim_t p, dim_t r) {
+        const data_t *from = values + (p * R + r) * C;
+        data_t *to = packed + p * R * C + (r / vnni) * C * vnni + r % vnni;
+        for (dim_t c = 0; c < C; c++)
+            to[c * vnni] = from[c];
+    });
+}
+} // namespace
+
+status_t brgemm_bsr_matmul_t::pd_t::init(engine_t *engine) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+    const auto src_type = src_md(0)->data_type;
+    const auto wei_type = weights_md(0)->data_type;
+    const auto bia_type = weights_md(1)->data_type;
+    const auto dst_type = dst_md(0)->data_type;
+
+    const memory_desc_wrapper wei_d(weights_md(0));
+    VDISPATCH_MATMUL(wei_d.is_sparse_desc()
+                    && wei_d.encoding() == sparse_encoding::bsr,
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(!memory_desc_wrapper(src_md(0)).is_sparse_desc()
+                    && !memory_desc_wrapper(dst_md(0)).is_sparse_desc(),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(everyone_is(s32, wei_d.metadata_type(0),
+                             wei_d.metadata_type(1)),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(ndims() == 2, VERBOSE_BAD_NDIMS, "dst", ndims());
+
+    is_int8_ = one_of(src_type, u8, s8);
+    VDISPATCH_MATMUL(
+            IMPLICATION(!is_int8_,
+                    everyone_is(bf16, src_type, wei_type)
+                            && one_of(dst_type, f32, bf16)),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_MATMUL(IMPLICATION(is_int8_,
+                             wei_type == s8
+                                     && one_of(dst_type, f32, s32, bf16, s8,
+                                             u8)),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_MATMUL(IMPLICATION(with_bias(), one_of(bia_type, f32, bf16, s32)),
+            VERBOSE_UNSUPPORTED_BIAS_CFG);
+
+    VDISPATCH_MATMUL(attr()->has_default_values(smask_t::scales_data_type
+                                     | smask_t::post_ops | smask_t::sum_dt,
+                             dst_type),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(attr_scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
+    // Only weights scales may vary along the columns.
+    const auto &scales = attr()->scales_;
+    VDISPATCH_MATMUL(scales.get_mask(DNNL_ARG_SRC) <= 0
+                    && scales.get_mask(DNNL_ARG_DST) <= 0
+                    && (scales.get_mask(DNNL_ARG_WEIGHTS) <= 0
+                            || scales.get_mask(DNNL_ARG_WEIGHTS)
+                                    == wei_qmask_N()),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_MATMUL(attr_.post_ops_.check_sum_consistency(dst_type, is_int8_),
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_MATMUL(ref_post_ops_t::primitive_kind_ok(attr()->post_ops_),
+            VERBOSE_UNSUPPORTED_POSTOP);
+
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(attr_.set_default_formats(dst_md(0)) == status::success,
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_MATMUL(formats_ok(), VERBOSE_UNSUPPORTED_TAG);
+
+    // The tensors of a sparse matmul have no runtime dimensions, see
+    // memory_desc_init_by_bsr_encoding().
+    blk_k_ = wei_d.block_dims()[0];
+    blk_n_ = wei_d.block_dims()[1];
+    nnz_blocks_ = wei_d.nnz_blocks();
+    nb_k_ = K() / blk_k_;
+    nb_n_ = N() / blk_n_;
+    // A block column is stored by the kernels as whole vectors.
+    VDISPATCH_MATMUL(blk_n_ % 16 == 0, VERBOSE_SHAPE_RESTRICTION);
+
+    // Signed int8 sources are supported only by AMX, other ISAs need
+    // compensation of the source shift.
+    if (mayiuse(avx512_core_amx))
+        isa_ = avx512_core_amx;
+    else if (!is_int8_)
+        isa_ = avx512_core_bf16;
+    else if (src_type == u8)
+        isa_ = avx512_core_vnni;
+    else
+        isa_ = isa_undef;
+    VDISPATCH_MATMUL(isa_ != isa_undef && mayiuse(isa_),
+            VERBOSE_UNSUPPORTED_ISA);
+
+    nthr_ = dnnl_get_max_threads();
+    CHECK(init_brgemm(engine));
+    init_scratchpad();
+
+    return status::success;
+}
+
+bool brgemm_bsr_matmul_t::pd_t::formats_ok() const {
+    // Rows of the source are passed to the kernels in place.
+    const memory_desc_wrapper src_d(src_md(0));
+    const memory_desc_wrapper dst_d(dst_md(0));
+    return src_d.is_blocking_desc() && dst_d.is_blocking_desc()
+            && src_d.blocking_desc().inner_nblks == 0
+            && src_d.blocking_desc().strides[1] == 1
+            && dst_d.blocking_desc().inner_nblks == 0;
+}
+
+status_t brgemm_bsr_matmul_t::pd_t::init_brgemm(engine_t *engine) {
+    const bool is_amx = is_superset(isa_, avx512_core_amx);
+    const auto src_type = src_md(0)->data_type;
+    const auto wei_type = weights_md(0)->data_type;
+
+    m_blk_ = nstl::min<dim_t>(M(), 32);
+    const dim_t lda = memory_desc_wrapper(src_md(0)).blocking_desc().strides[0];
+
+    brgs_.resize(num_brg_kernels);
+    for (int is_m_tail = 0; is_m_tail < num_brg_kernels; is_m_tail++) {
+        const dim_t M_ker = is_m_tail ? M() % m_blk_ : m_blk_;
+        if (M_ker == 0) continue;
+
+        auto &brg = brgs_[is_m_tail];
+        CHECK(brgemm_desc_init(&brg, isa_, brgemm_addr, src_type, wei_type,
+                /* transA = */ false, /* transB = */ false, brgemm_row_major,
+                /* alpha = */ 1.f, /* beta = */ 0.f, lda, blk_n_, blk_n_,
+                M_ker, blk_n_, blk_k_));
+
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = (int)nb_k_;
+        if (is_amx) {
+            brgattr.use_uker = true;
+            brgattr.use_interleave_stores = true;
+            // Block columns have different numbers of stored blocks.
+            brgattr.var_bs = true;
+        }
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+        CHECK(brgemm_desc_finalize(&brg));
+        wsp_size_ = nstl::max(wsp_size_, (size_t)brg.get_wsp_buffer_size());
+    }
+
+    const bool is_vnni = brgemm_desc_t::is_b_data_layout_vnni(src_type,
+            wei_type, /* attr_b_is_vnni = */ false, brgs_[0].isa_impl);
+    vnni_ = is_vnni ? (dim_t)data_type_vnni_granularity(wei_type) : 1;
+    VDISPATCH_MATMUL(blk_k_ % vnni_ == 0, VERBOSE_SHAPE_RESTRICTION);
+
+    return status::success;
+}
+
+void brgemm_bsr_matmul_t::pd_t::init_scratchpad() {
+    const size_t wei_dsz = types::data_type_size(weights_md(0)->data_type);
+
+    auto scratchpad = scratchpad_registry().registrar();
+    // Stored blocks of every block column, see execute().
+    scratchpad.template book<int32_t>(key_matmul_sparse_tmp_ptr, nb_n_ + 1);
+    scratchpad.template book<int32_t>(
+            key_matmul_sparse_tmp_idx, 2 * nnz_blocks_);
+    scratchpad.book(key_brgemm_primitive_buffer_b,
+            nnz_blocks_ * blk_k_ * blk_n_, wei_dsz);
+    scratchpad.template book<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch, nthr_ * nb_k_);
+    // The accumulators are f32 or s32.
+    scratchpad.template book<float>(
+            key_brgemm_primitive_buffer, nthr_ * m_blk_ * blk_n_);
+    if (wsp_size_ > 0)
+        scratchpad.book(
+                key_conv_amx_tile_buffer, nthr_ * wsp_size_, sizeof(char));
+}
+
+status_t brgemm_bsr_matmul_t::init(engine_t *engine) {
+    ref_post_ops_
+            = utils::make_unique<ref_post_ops_t>(pd()->attr()->post_ops_);
+    if (!ref_post_ops_) return status::out_of_memory;
+    CHECK(ref_post_ops_->init(pd()->dst_md()));
+
+    const auto &brgs = pd()->brgs_;
+    brg_kernels_.resize(brgs.size());
+
+    for (size_t idx = 0; idx < brgs.size(); idx++) {
+        const auto &brg = brgs[idx];
+        if (brg.bcast_dim == 0) continue;
+
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, brg));
+        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+        if (is_superset(brg.isa_impl, avx512_core_amx))
+            brgemm_palettes_.insert((int)idx, brg);
+    }
+
+    return status::success;
+}
+
+status_t brgemm_bsr_matmul_t::execute(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const auto wei_values = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS, 0);
+    const auto wei_indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 1);
+    const auto wei_pointers = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 2);
+    const auto bias = CTX_IN_MEM(const void *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+    DEFINE_ARG_SCALES_BUFFER(wei_scales, DNNL_ARG_WEIGHTS);
+    DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper bia_d(pd()->weights_md(1));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    if (src_d.has_zero_dim() || dst_d.has_zero_dim()) return status::success;
+
+    const dim_t M = pd()->M(), N = pd()->N();
+    const dim_t R = pd()->blk_k_, C = pd()->blk_n_;
+    const dim_t nnz_blocks = pd()->nnz_blocks_;
+    const dim_t m_blk = pd()->m_blk_, nb_k = pd()->nb_k_, nb_n = pd()->nb_n_;
+    const dim_t nb_m = div_up(M, m_blk);
+    const size_t wsp_size = pd()->wsp_size_;
+    const bool is_amx = is_superset(pd()->isa_, avx512_core_amx);
+    const bool is_int8 = pd()->is_int8_;
+    const auto dst_dt = dst_d.data_type();
+    const dim_t src_dsz = src_d.data_type_size();
+    const dim_t wei_dsz = types::data_type_size(pd()->weights_md(0)->data_type);
+    const dim_t lda = src_d.blocking_desc().strides[0];
+
+    const auto &attr_scales = pd()->attr()->scales_;
+    const bool with_src_scales = !attr_scales.has_default_values(DNNL_ARG_SRC);
+    const bool with_wei_scales
+            = !attr_scales.has_default_values(DNNL_ARG_WEIGHTS);
+    const bool with_dst_scales = !attr_scales.has_default_values(DNNL_ARG_DST);
+    const dim_t wei_scale_stride_n
+            = attr_scales.get_mask(DNNL_ARG_WEIGHTS) == pd()->wei_qmask_N()
+            ? 1
+            : 0;
+    const auto wei_scale_dt = attr_scales.get_data_type(DNNL_ARG_WEIGHTS);
+    const bool wei_scale_is_common
+            = ctx.memory_mdw(DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS).nelems()
+            == 1;
+
+    const bool with_post_ops = !pd()->attr()->post_ops_.has_default_values();
+    const auto sum_dt = pd()->attr()->post_ops_.get_sum_dt(dst_dt);
+    const bool bia_bcast_m = bias && bia_d.dims()[0] == 1;
+    const bool bia_bcast_n = bias && bia_d.dims()[1] == 1;
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    auto col_ptr = scratchpad.template get<int32_t>(key_matmul_sparse_tmp_ptr);
+    auto col_blk = scratchpad.template get<int32_t>(key_matmul_sparse_tmp_idx);
+    auto packed = scratchpad.template get<char>(key_brgemm_primitive_buffer_b);
+    auto batch_base = scratchpad.template get<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch);
+    auto acc_base = scratchpad.template get<char>(key_brgemm_primitive_buffer);
+    auto wsp_base = scratchpad.template get<char>(key_conv_amx_tile_buffer);
+
+    // Transposes the block index, so that col_blk[2 * i] is the stored block
+    // and col_blk[2 * i + 1] its block row for the positions i of a block
+    // column between col_ptr[nbn] and col_ptr[nbn + 1]. The blocks of a
+    // column stay ordered by their block rows.
+    std::memset(col_ptr, 0, (nb_n + 1) * sizeof(int32_t));
+    for (dim_t p = 0; p < nnz_blocks; p++)
+        col_ptr[wei_indices[p] + 1]++;
+    for (dim_t nbn = 0; nbn < nb_n; nbn++)
+        col_ptr[nbn + 1] += col_ptr[nbn];
+    for (dim_t kb = 0; kb < nb_k; kb++)
+        for (dim_t p = wei_pointers[kb]; p < wei_pointers[kb + 1]; p++) {
+            const int32_t pos = col_ptr[wei_indices[p]]++;
+            col_blk[2 * pos] = (int32_t)p;
+            col_blk[2 * pos + 1] = (int32_t)kb;
+        }
+    // The fill moved every pointer to the beginning of the next column.
+    for (dim_t nbn = nb_n; nbn > 0; nbn--)
+        col_ptr[nbn] = col_ptr[nbn - 1];
+    col_ptr[0] = 0;
+
+    const dim_t vnni = pd()->vnni_;
+    if (wei_dsz == 2)
+        pack_blocks(static_cast<const uint16_t *>(wei_values),
+                reinterpret_cast<uint16_t *>(packed), nnz_blocks, R, C, vnni);
+    else
+        pack_blocks(static_cast<const uint8_t *>(wei_values),
+                reinterpret_cast<uint8_t *>(packed), nnz_blocks, R, C, vnni);
+
+    // Scales, bias and post-ops are applied to the accumulated rows.
+    auto store_rows = [&](const char *acc, dim_t m0, dim_t mb, dim_t n0) {
+        for_(dim_t r = 0; r < mb; r++)
+        for (dim_t j = 0; j < C; j++) {
+            const dim_t m = m0 + r, n = n0 + j;
+            float d = is_int8 ? (float)reinterpret_cast<const int32_t *>(
+                              acc)[r * C + j]
+                              : reinterpret_cast<const float *>(acc)[r * C + j];
+            if (with_src_scales) d *= src_scales[0];
+            if (with_wei_scales)
+                d *= wei_scale_is_common ? wei_scales[0]
+                                         : io::load_float_value(wei_scale_dt,
+                                                 wei_scales,
+                                                 wei_scale_stride_n * n);
+            if (bias) {
+                const dim_t bia_off
+                        = bia_d.off(bia_bcast_m ? 0 : m, bia_bcast_n ? 0 : n);
+                d += io::load_float_value(bia_d.data_type(), bias, bia_off);
+            }
+            const dim_t dst_off = dst_d.off(m, n);
+            if (with_post_ops) {
+                ref_post_ops_t::args_t args;
+                args.dst_val = io::load_float_value(sum_dt, dst, dst_off);
+                args.ctx = &ctx;
+                args.l_offset = m * N + n;
+                args.dst_md = pd()->dst_md();
+                ref_post_ops_->execute(d, args);
+            }
+            if (with_dst_scales) d *= dst_scales[0];
+            io::store_float_value(dst_dt, d, dst, dst_off);
+        }
+    };
+
+    // Tiles of a block column follow each other, so that its packed blocks
+    // stay in cache. The amount of work of a tile depends on the number of
+    // the stored blocks of its column, hence the dynamic scheduling.
+    const int nthr = pd()->nthr_;
+    dynamic_work_counter_t counter(0);
+    parallel(nthr, [&](const int ithr, const int nthr) {
+        brgemm_batch_element_t *batch = batch_base + ithr * nb_k;
+        char *acc = acc_base + ithr * m_blk * C * sizeof(float);
+        char *wsp = wsp_size > 0 ? wsp_base + ithr * wsp_size : nullptr;
+        int prev_ker_idx = -1;
+
+        for_nd_dynamic(nthr, counter, nb_n, nb_m, [&](dim_t nbn, dim_t mb) {
+            const dim_t m0 = mb * m_blk;
+            const dim_t rows = nstl::min(m_blk, M - m0);
+            const dim_t bs = col_ptr[nbn + 1] - col_ptr[nbn];
+
+            if (bs == 0) {
+                std::memset(acc, 0, rows * C * sizeof(float));
+            } else {
+                for (dim_t i = 0; i < bs; i++) {
+                    const int32_t *blk = col_blk + 2 * (col_ptr[nbn] + i);
+                    batch[i].ptr.A = src + (m0 * lda + blk[1] * R) * src_dsz;
+                    batch[i].ptr.B = packed + blk[0] * R * C * wei_dsz;
+                }
+                const int idx = rows < m_blk;
+                brgemm_palettes_.maybe_tile_configure(
+                        is_amx, prev_ker_idx, idx);
+                brgemm_kernel_execute(
+                        brg_kernels_[idx].get(), (int)bs, batch, acc, wsp);
+            }
+            store_rows(acc, m0, rows, nbn * C);
+        });
+
+        if (is_amx) amx_tile_release();
+    });
+
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
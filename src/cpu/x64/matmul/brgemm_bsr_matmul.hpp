@@ -0,0 +1,100 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_BRGEMM_BSR_MATMUL_HPP
+#define CPU_X64_MATMUL_BRGEMM_BSR_MATMUL_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/primitive_attr_postops.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/brgemm/brgemm_containers.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+// Matmul with block-sparse (BSR) weights.
+//
+// The weights are K x N, so a block row of the encoding spans R rows of the
+// reduction and a stored block updates C consecutive destination columns.
+// At execution the block index is transposed into a list of the stored
+// blocks of every block column, and the stored blocks are packed into the
+// kernel layout. A tile of the destination (a block of rows by a block
+// column) is then computed by one brgemm call whose batch holds only the
+// stored blocks of the block column, so zero blocks cost nothing.
+struct brgemm_bsr_matmul_t : public primitive_t {
+    struct pd_t : public ::dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using ::dnnl::impl::cpu::matmul::cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_bsr:", isa_, ""),
+                brgemm_bsr_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        // Kernels are indexed by is_m_tail.
+        static constexpr int num_brg_kernels = 2;
+
+        cpu_isa_t isa_ = isa_undef;
+        bool is_int8_ = false;
+        // Block dimensions of the weights and the number of stored blocks.
+        dim_t blk_k_ = 0, blk_n_ = 0, nnz_blocks_ = 0;
+        dim_t m_blk_ = 0, nb_k_ = 0, nb_n_ = 0;
+        // Number of rows interleaved by the packed layout of the kernels.
+        dim_t vnni_ = 1;
+        size_t wsp_size_ = 0;
+        int nthr_ = 0;
+        std::vector<brgemm_desc_t> brgs_;
+
+    private:
+        bool formats_ok() const;
+        status_t init_brgemm(engine_t *engine);
+        void init_scratchpad();
+    };
+
+    brgemm_bsr_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<ref_post_ops_t> ref_post_ops_;
+    std::vector<std::unique_ptr<brgemm_kernel_t>> brg_kernels_;
+    brgemm_containers::brgemm_palette_container_t brgemm_palettes_ {
+            pd_t::num_brg_kernels};
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
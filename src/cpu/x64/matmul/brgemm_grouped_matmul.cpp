@@ -0,0 +1,467 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/platform.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/matmul/matmul_utils.hpp"
+
+#include "cpu/x64/amx_tile_configure.hpp"
+#include "cpu/x64/matmul/brgemm_grouped_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+using ::dnnl::impl::cpu::matmul::matmul_helper_t;
+
+status_t brgemm_grouped_matmul_t::pd_t::init(engine_t *engine) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+    const auto src_type = src_md(0)->data_type;
+    const auto wei_type = weights_md(0)->data_type;
+    const auto bia_type = weights_md(1)->data_type;
+    const auto dst_type = dst_md(0)->data_type;
+
+    VDISPATCH_MATMUL(attr()->grouped_batch_, VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(is_dense_format_kind(), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(ndims() == 3, VERBOSE_BAD_NDIMS, "dst", ndims());
+    VDISPATCH_MATMUL(one_of(src_type, f32, bf16, f16), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_MATMUL(one_of(dst_type, f32, src_type), VERBOSE_UNSUPPORTED_DT);
+
+    // Integer weights are decompressed into the source data type while
+    // being packed.
+    with_wei_decompression_ = one_of(wei_type, s8, u8, s4, u4)
+            && attr()->fpmath_.apply_to_int_;
+    VDISPATCH_MATMUL(wei_type == src_type || with_wei_decompression_,
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_MATMUL(IMPLICATION(one_of(wei_type, s8, u8),
+                             attr()->mayiconvert(wei_type, src_type)),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_MATMUL(IMPLICATION(with_bias(), one_of(bia_type, f32, src_type)),
+            VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_MATMUL(platform::has_data_type_support(src_type),
+            VERBOSE_UNSUPPORTED_DT);
+
+    VDISPATCH_MATMUL(
+            attr()->has_default_values(smask_t::scales_data_type
+                            | smask_t::scales_groups
+                            | smask_t::zero_points_data_type
+                            | smask_t::zero_points_groups | smask_t::post_ops
+                            | smask_t::sum_dt | smask_t::fpmath_mode
+                            | smask_t::grouped_batch,
+                    dst_type),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(attr_scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
+    // Only weights scales may vary along the tensors.
+    const auto &scales = attr()->scales_;
+    VDISPATCH_MATMUL(scales.get_mask(DNNL_ARG_SRC) <= 0
+                    && scales.get_mask(DNNL_ARG_DST) <= 0,
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_MATMUL(IMPLICATION(!with_wei_decompression_,
+                             scales.get_mask(DNNL_ARG_WEIGHTS) <= 0
+                                     || scales.get_mask(DNNL_ARG_WEIGHTS)
+                                             == wei_qmask_N()),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_MATMUL(zero_points_ok(), VERBOSE_UNSUPPORTED_ZP_CFG);
+    VDISPATCH_MATMUL(attr_.post_ops_.check_sum_consistency(dst_type,
+                             /* is_int8 */ false),
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_MATMUL(ref_post_ops_t::primitive_kind_ok(attr()->post_ops_),
+            VERBOSE_UNSUPPORTED_POSTOP);
+
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(attr_.set_default_formats(dst_md(0)) == status::success,
+            VERBOSE_UNSUPPORTED_POSTOP);
+    for (auto md : {src_md(0), weights_md(0), weights_md(1), dst_md(0)}) {
+        const memory_desc_wrapper mdw(md);
+        VDISPATCH_MATMUL(!mdw.has_runtime_dims_or_strides(),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        VDISPATCH_MATMUL(mdw.is_zero() || mdw.is_blocking_desc(),
+                VERBOSE_UNSUPPORTED_TAG);
+    }
+
+    // Rows of the source are passed to the kernels in place.
+    const memory_desc_wrapper src_d(src_md(0));
+    VDISPATCH_MATMUL(src_d.blocking_desc().inner_nblks == 0
+                    && (src_d.blocking_desc().strides[2] == 1 || K() == 1),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    // The kernels compute in the data type of the source. AMX is used only
+    // when the reduction fills whole tiles.
+    dt_ = src_type;
+    const bool use_amx = K() % 32 == 0;
+    switch (dt_) {
+        case f32: isa_ = mayiuse(avx512_core) ? avx512_core : avx2; break;
+        case bf16:
+            isa_ = use_amx && mayiuse(avx512_core_amx) ? avx512_core_amx
+                                                       : avx512_core_bf16;
+            break;
+        case f16:
+            isa_ = use_amx && mayiuse(avx512_core_amx_fp16)
+                    ? avx512_core_amx_fp16
+                    : avx512_core_fp16;
+            break;
+        default: isa_ = isa_undef;
+    }
+    VDISPATCH_MATMUL(isa_ != isa_undef && mayiuse(isa_),
+            VERBOSE_UNSUPPORTED_ISA);
+
+    nthr_ = dnnl_get_max_threads();
+    CHECK(init_brgemm(engine));
+    init_scratchpad();
+
+    return status::success;
+}
+
+bool brgemm_grouped_matmul_t::pd_t::zero_points_ok() const {
+    const auto &zp = attr()->zero_points_;
+    if (!zp.has_default_values(DNNL_ARG_SRC)) return false;
+    if (!zp.has_default_values(DNNL_ARG_DST)) return false;
+    if (zp.has_default_values(DNNL_ARG_WEIGHTS)) return true;
+
+    // Weights zero points are only supported as part of the decompression.
+    if (!with_wei_decompression_) return false;
+    if (zp.get(DNNL_ARG_WEIGHTS).has_default_groups()) return true;
+
+    const auto gK = zp.get_group(DNNL_ARG_WEIGHTS, 0);
+    const auto gN = zp.get_group(DNNL_ARG_WEIGHTS, 1);
+    return IMPLICATION(gK > 1, K() % gK == 0)
+            && IMPLICATION(gN > 1, N() % gN == 0) && one_of(1, gK, gN);
+}
+
+status_t brgemm_grouped_matmul_t::pd_t::init_brgemm(engine_t *engine) {
+    const bool is_amx = is_superset(isa_, avx512_core_amx);
+
+    m_blk_ = brg_rows(0);
+    n_blk_ = nstl::min<dim_t>(rnd_up(N(), 16), 64);
+    nb_n_ = div_up(N(), n_blk_);
+    const dim_t lda = memory_desc_wrapper(src_md(0)).blocking_desc().strides[1];
+
+    brgs_.resize(num_brg_kernels);
+    for (int idx = 0; idx < num_brg_kernels; idx++) {
+        // Kernels taller than the destination are never used.
+        const dim_t M_ker = brg_rows(idx);
+        if (M_ker > M()) continue;
+
+        auto &brg = brgs_[idx];
+        CHECK(brgemm_desc_init(&brg, isa_, brgemm_addr, dt_, dt_,
+                /* transA = */ false, /* transB = */ false, brgemm_row_major,
+                /* alpha = */ 1.f, /* beta = */ 0.f, lda, n_blk_, n_blk_,
+                M_ker, n_blk_, K()));
+
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = 1;
+        if (is_amx) {
+            brgattr.use_uker = true;
+            brgattr.use_interleave_stores = true;
+        }
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+        CHECK(brgemm_desc_finalize(&brg));
+        wsp_size_ = nstl::max(wsp_size_, (size_t)brg.get_wsp_buffer_size());
+    }
+
+    const bool is_vnni = brgemm_desc_t::is_b_data_layout_vnni(dt_, dt_,
+            /* attr_b_is_vnni = */ false, brgs_.back().isa_impl);
+    vnni_ = is_vnni ? (dim_t)data_type_vnni_granularity(dt_) : 1;
+    VDISPATCH_MATMUL(K() % vnni_ == 0, VERBOSE_SHAPE_RESTRICTION);
+
+    return status::success;
+}
+
+void brgemm_grouped_matmul_t::pd_t::init_scratchpad() {
+    const size_t dt_size = types::data_type_size(dt_);
+
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(
+            key_matmul_grouped_wei_packed, nthr_ * K() * n_blk_, dt_size);
+    scratchpad.template book<float>(
+            key_matmul_grouped_acc, nthr_ * m_blk_ * n_blk_);
+    if (wsp_size_ > 0)
+        scratchpad.book(
+                key_matmul_grouped_amx_wsp, nthr_ * wsp_size_, sizeof(char));
+}
+
+status_t brgemm_grouped_matmul_t::init(engine_t *engine) {
+    ref_post_ops_
+            = utils::make_unique<ref_post_ops_t>(pd()->attr()->post_ops_);
+    if (!ref_post_ops_) return status::out_of_memory;
+    CHECK(ref_post_ops_->init(pd()->dst_md()));
+
+    const auto &brgs = pd()->brgs_;
+    brg_kernels_.resize(brgs.size());
+
+    for (size_t idx = 0; idx < brgs.size(); idx++) {
+        const auto &brg = brgs[idx];
+        if (brg.bcast_dim == 0) continue;
+
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, brg));
+        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+        if (is_superset(brg.isa_impl, avx512_core_amx))
+            brgemm_palettes_.insert((int)idx, brg);
+    }
+
+    return status::success;
+}
+
+status_t brgemm_grouped_matmul_t::execute(const exec_ctx_t &ctx) const {
+    switch (pd()->dt_) {
+        case f32: return execute_forward<float>(ctx);
+        case bf16: return execute_forward<bfloat16_t>(ctx);
+        case f16: return execute_forward<float16_t>(ctx);
+        default: assert(!"unsupported data type");
+    }
+    return status::runtime_error;
+}
+
+template <typename data_t>
+status_t brgemm_grouped_matmul_t::execute_forward(
+        const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+    const auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    const auto weights = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS);
+    const auto bias = CTX_IN_MEM(const void *, DNNL_ARG_BIAS);
+    const auto offsets
+            = CTX_IN_MEM(const int32_t *, DNNL_ARG_ATTR_GROUPED_OFFSETS);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+    DEFINE_ARG_SCALES_BUFFER(wei_scales, DNNL_ARG_WEIGHTS);
+    DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
+    DEFINE_ZERO_POINTS_BUFFER(wei_zero_points, DNNL_ARG_WEIGHTS);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const memory_desc_wrapper bia_d(pd()->weights_md(1));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    if (src_d.has_zero_dim() || wei_d.has_zero_dim() || dst_d.has_zero_dim())
+        return status::success;
+
+    const int ndims = pd()->ndims();
+    const dim_t G = dst_d.dims()[0];
+    const dim_t M = pd()->M(), N = pd()->N(), K = pd()->K();
+    const dim_t m_blk = pd()->m_blk_, n_blk = pd()->n_blk_;
+    const dim_t nb_n = pd()->nb_n_, vnni = pd()->vnni_;
+    const size_t wsp_size = pd()->wsp_size_;
+    const bool is_amx = is_superset(pd()->isa_, avx512_core_amx);
+    const auto wei_dt = wei_d.data_type();
+    const auto dst_dt = dst_d.data_type();
+
+    // Weights decompression, see ref_matmul_t.
+    const bool with_wei_decompression = pd()->with_wei_decompression_;
+    const auto &attr_zps = pd()->attr()->zero_points_;
+    const bool with_wei_zero_points
+            = !attr_zps.has_default_values(DNNL_ARG_WEIGHTS);
+    const int wei_zp_mask = attr_zps.get_mask(DNNL_ARG_WEIGHTS);
+    const auto wei_zp_dt = attr_zps.get_data_type(DNNL_ARG_WEIGHTS);
+    const auto wei_zp_group_k = attr_zps.get_group(DNNL_ARG_WEIGHTS, 0);
+    const auto wei_zp_group_n = attr_zps.get_group(DNNL_ARG_WEIGHTS, 1);
+    memory_desc_t wei_zp_md {};
+    CHECK(matmul_helper_t::get_quant_md(wei_zp_md, ndims, wei_d.dims(),
+            wei_zp_mask, wei_zp_group_k, wei_zp_group_n, wei_zp_dt));
+
+    const auto &attr_scales = pd()->attr()->scales_;
+    const bool with_src_scales = !attr_scales.has_default_values(DNNL_ARG_SRC);
+    const bool with_wei_scales
+            = !attr_scales.has_default_values(DNNL_ARG_WEIGHTS);
+    const bool with_dst_scales = !attr_scales.has_default_values(DNNL_ARG_DST);
+    const int wei_scale_mask = attr_scales.get_mask(DNNL_ARG_WEIGHTS);
+    const dim_t wei_scale_stride_n
+            = (wei_scale_mask & pd()->wei_qmask_N()) ? 1 : 0;
+    const auto wei_scale_dt = attr_scales.get_data_type(DNNL_ARG_WEIGHTS);
+    const auto wei_scale_group_k = attr_scales.get_group(DNNL_ARG_WEIGHTS, 0);
+    const auto wei_scale_group_n = attr_scales.get_group(DNNL_ARG_WEIGHTS, 1);
+    const bool wei_scale_is_common
+            = ctx.memory_mdw(DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS).nelems()
+            == 1;
+    memory_desc_t wei_scale_md {};
+    CHECK(matmul_helper_t::get_quant_md(wei_scale_md, ndims, wei_d.dims(),
+            wei_scale_mask, wei_scale_group_k, wei_scale_group_n,
+            wei_scale_dt));
+
+    const bool with_post_ops = !pd()->attr()->post_ops_.has_default_values();
+    const auto sum_dt = pd()->attr()->post_ops_.get_sum_dt(dst_dt);
+
+    // The source and bias may be broadcast across groups.
+    const bool src_bcast_g = src_d.dims()[0] == 1;
+    const bool bia_bcast_g = bias && bia_d.dims()[0] == 1;
+    const bool bia_bcast_m = bias && bia_d.dims()[1] == 1;
+    const bool bia_bcast_n = bias && bia_d.dims()[2] == 1;
+
+    auto row_begin = [&](dim_t g) { return nstl::max<dim_t>(0, offsets[g]); };
+    auto row_end = [&](dim_t g) {
+        return nstl::max(row_begin(g), nstl::min<dim_t>(M, offsets[g + 1]));
+    };
+
+    // Row blocks are grouped into chunks so that a packed block of weights is
+    // reused as much as possible while there are still enough tiles to keep
+    // the threads busy.
+    const int nthr = pd()->nthr_;
+    dim_t nb_m_total = 0;
+    for (dim_t g = 0; g < G; g++)
+        nb_m_total += div_up(row_end(g) - row_begin(g), m_blk);
+    dim_t chunk = 8;
+    while (chunk > 1 && div_up(nb_m_total, chunk) * nb_n < 4 * nthr)
+        chunk /= 2;
+    const dim_t nb_chunk = div_up(div_up(M, m_blk), chunk);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    auto wei_packed_base
+            = scratchpad.template get<data_t>(key_matmul_grouped_wei_packed);
+    auto acc_base = scratchpad.template get<float>(key_matmul_grouped_acc);
+    auto wsp_base = scratchpad.template get<char>(key_matmul_grouped_amx_wsp);
+
+    // Packs the block of weights as [K][n_blk] with vnni rows interleaved.
+    // The block tail is zeroed.
+    auto pack_weights = [&](data_t *wei_packed, dim_t g, dim_t n0) {
+        const dim_t nb = nstl::min(n_blk, N - n0);
+        for (dim_t k = 0; k < K; k++) {
+            data_t *row = wei_packed + (k / vnni) * n_blk * vnni + k % vnni;
+            for (dim_t j = 0; j < n_blk; j++) {
+                float w = 0.f;
+                if (j < nb) {
+                    dims_t idx = {g, k, n0 + j};
+                    w = io::load_float_value(wei_dt, weights, wei_d.off_v(idx));
+                    if (with_wei_decompression && with_wei_zero_points) {
+                        const dim_t off = matmul_helper_t::get_quant_off(idx,
+                                ndims, wei_zp_mask, wei_zp_group_k,
+                                wei_zp_group_n, wei_zp_md);
+                        w -= io::load_int_value(
+                                wei_zp_dt, wei_zero_points, off);
+                    }
+                    if (with_wei_decompression && with_wei_scales) {
+                        const dim_t off = matmul_helper_t::get_quant_off(idx,
+                                ndims, wei_scale_mask, wei_scale_group_k,
+                                wei_scale_group_n, wei_scale_md);
+                        // Single scale value was already converted into f32.
+                        w *= wei_scale_is_common ? wei_scales[0]
+                                                 : io::load_float_value(
+                                                         wei_scale_dt,
+                                                         wei_scales, off);
+                    }
+                }
+                row[j * vnni] = static_cast<data_t>(w);
+            }
+        }
+    };
+
+    // Scales, bias and post-ops are applied to the accumulated rows, and
+    // only the valid part of the block is stored.
+    auto store_rows = [&](const float *acc, dim_t g, dim_t m0, dim_t mb,
+                              dim_t n0) {
+        const dim_t nb = nstl::min(n_blk, N - n0);
+        for_(dim_t r = 0; r < mb; r++)
+        for (dim_t j = 0; j < nb; j++) {
+            const dim_t m = m0 + r, n = n0 + j;
+            float d = acc[r * n_blk + j];
+            if (with_src_scales) d *= src_scales[0];
+            if (with_wei_scales && !with_wei_decompression)
+                d *= wei_scale_is_common ? wei_scales[0]
+                                         : io::load_float_value(wei_scale_dt,
+                                                 wei_scales,
+                                                 wei_scale_stride_n * n);
+            if (bias) {
+                const dim_t bia_off = bia_d.off(bia_bcast_g ? 0 : g,
+                        bia_bcast_m ? 0 : m, bia_bcast_n ? 0 : n);
+                d += io::load_float_value(bia_d.data_type(), bias, bia_off);
+            }
+            const dim_t dst_off = dst_d.off(g, m, n);
+            if (with_post_ops) {
+                ref_post_ops_t::args_t args;
+                args.dst_val = io::load_float_value(sum_dt, dst, dst_off);
+                args.ctx = &ctx;
+                args.l_offset = (g * M + m) * N + n;
+                args.dst_md = pd()->dst_md();
+                ref_post_ops_->execute(d, args);
+            }
+            if (with_dst_scales) d *= dst_scales[0];
+            io::store_float_value(dst_dt, d, dst, dst_off);
+        }
+    };
+
+    dynamic_work_counter_t counter(0);
+    parallel(nthr, [&](const int ithr, const int nthr) {
+        data_t *wei_packed = wei_packed_base + ithr * K * n_blk;
+        float *acc = acc_base + ithr * m_blk * n_blk;
+        char *wsp = wsp_size > 0 ? wsp_base + ithr * wsp_size : nullptr;
+
+        int prev_ker_idx = -1;
+        dim_t packed_g = -1, packed_nb = -1;
+        brgemm_batch_element_t batch;
+
+        for_nd_dynamic(nthr, counter, G, nb_n, nb_chunk,
+                [&](dim_t g, dim_t nbn, dim_t c) {
+                    const dim_t m_end = row_end(g);
+                    const dim_t m_begin = row_begin(g) + c * chunk * m_blk;
+                    if (m_begin >= m_end) return;
+
+                    const dim_t n0 = nbn * n_blk;
+                    if (g != packed_g || nbn != packed_nb) {
+                        pack_weights(wei_packed, g, n0);
+                        packed_g = g;
+                        packed_nb = nbn;
+                    }
+
+                    const dim_t chunk_end
+                            = nstl::min(m_end, m_begin + chunk * m_blk);
+                    for (dim_t m0 = m_begin; m0 < chunk_end; m0 += m_blk) {
+                        const dim_t mb = nstl::min(m_blk, chunk_end - m0);
+                        // A tail is computed by kernels of decreasing
+                        // power-of-two heights.
+                        for (dim_t r = 0, idx = 0; r < mb; idx++) {
+                            const dim_t rows = pd_t::brg_rows((int)idx);
+                            if (rows > mb - r) continue;
+                            brgemm_palettes_.maybe_tile_configure(
+                                    is_amx, prev_ker_idx, (int)idx);
+                            batch.ptr.A = src
+                                    + src_d.off(src_bcast_g ? 0 : g, m0 + r, 0);
+                            batch.ptr.B = wei_packed;
+                            brgemm_kernel_execute(brg_kernels_[idx].get(), 1,
+                                    &batch, acc + r * n_blk, wsp);
+                            r += rows;
+                        }
+                        store_rows(acc, g, m0, mb, n0);
+                    }
+                });
+
+        if (is_amx) amx_tile_release();
+    });
+
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
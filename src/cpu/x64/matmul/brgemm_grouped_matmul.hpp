@@ -0,0 +1,107 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_BRGEMM_GROUPED_MATMUL_HPP
+#define CPU_X64_MATMUL_BRGEMM_GROUPED_MATMUL_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/primitive_attr_postops.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/brgemm/brgemm_containers.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+// Matmul with a grouped batch (mixture of experts). Each batch entry (group)
+// computes only the rows between two consecutive offsets, and the groups
+// usually share their source and destination through zero batch strides.
+//
+// Work is split into tiles of a group, a block of columns and a chunk of
+// row blocks of the group range. The block of weights of a tile is
+// decompressed (if needed) and packed into the kernel layout once and reused
+// for all its row blocks. Since the ranges are only known at execution time,
+// tiles are scheduled dynamically and row tails are computed with a chain of
+// kernels of decreasing power-of-two heights, so that no row is ever copied.
+struct brgemm_grouped_matmul_t : public primitive_t {
+    struct pd_t : public ::dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using ::dnnl::impl::cpu::matmul::cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_grouped:", isa_, ""),
+                brgemm_grouped_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        // Kernels compute 2^(num_brg_kernels - 1 - idx) rows.
+        static constexpr int num_brg_kernels = 6;
+        static dim_t brg_rows(int idx) {
+            return (dim_t)1 << (num_brg_kernels - 1 - idx);
+        }
+
+        cpu_isa_t isa_ = isa_undef;
+        // Data type of the source and of the packed weights.
+        data_type_t dt_ = data_type::undef;
+        dim_t m_blk_ = 0, n_blk_ = 0, nb_n_ = 0;
+        // Number of rows interleaved by the packed layout of the kernels.
+        dim_t vnni_ = 1;
+        bool with_wei_decompression_ = false;
+        size_t wsp_size_ = 0;
+        int nthr_ = 0;
+        std::vector<brgemm_desc_t> brgs_;
+
+    private:
+        bool zero_points_ok() const;
+        status_t init_brgemm(engine_t *engine);
+        void init_scratchpad();
+    };
+
+    brgemm_grouped_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    template <typename data_t>
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+
+    std::unique_ptr<ref_post_ops_t> ref_post_ops_;
+    std::vector<std::unique_ptr<brgemm_kernel_t>> brg_kernels_;
+    brgemm_containers::brgemm_palette_container_t brgemm_palettes_ {
+            pd_t::num_brg_kernels};
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -126,10 +126,16 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
             = src_dt == f32 && wei_dt == f16 && one_of(dst_dt, f16, f32);
     const bool is_f32_bf16
             = src_dt == f32 && wei_dt == bf16 && one_of(dst_dt, bf16, f32);
+    // Weights decompression, which also covers fp8 and fp4 weights.
     const bool is_bf16_with_int_wei = src_dt == bf16
-            && one_of(wei_dt, s8, u8, s4, u4) && one_of(dst_dt, bf16, f32);
+            && one_of(wei_dt, s8, u8, s4, u4, f8_e5m2, f8_e4m3, f4_e2m1)
+            && one_of(dst_dt, bf16, f32);
     const bool is_f16_with_int_wei = src_dt == f16
-            && one_of(wei_dt, s8, u8, s4, u4) && one_of(dst_dt, f16, f32);
+            && one_of(wei_dt, s8, u8, s4, u4, f8_e5m2, f8_e4m3, f4_e2m1)
+            && one_of(dst_dt, f16, f32);
+    const bool is_src_dyn_quant = attr()->src_dyn_quant_dt_ != undef
+            && one_of(src_dt, f32, bf16) && wei_dt == s8
+            && one_of(dst_dt, f32, bf16);
 
     auto check_bias = [&]() -> bool {
         const auto bia_dt = weights_md(1)->data_type;
@@ -212,7 +218,8 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     };
     const bool problem_dt_correct
             = one_of(true, is_int8, is_f8, is_bf16, is_f32, is_f16, is_f32_f16,
-                    is_f32_bf16, is_bf16_with_int_wei, is_f16_with_int_wei);
+                    is_f32_bf16, is_bf16_with_int_wei, is_f16_with_int_wei,
+                    is_src_dyn_quant);
 
     auto src_d = memory_desc_wrapper(src_md_);
     auto weights_d = memory_desc_wrapper(weights_md_);
@@ -237,7 +244,12 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
                                     zero_points_data_type
                             | primitive_attr_t::skip_mask_t::post_ops
                             | primitive_attr_t::skip_mask_t::sum_dt
-                            | primitive_attr_t::skip_mask_t::fpmath_mode,
+                            | primitive_attr_t::skip_mask_t::fpmath_mode
+                            | primitive_attr_t::skip_mask_t::ragged_batch
+                            | primitive_attr_t::skip_mask_t::weights_lut
+                            | primitive_attr_t::skip_mask_t::src_dyn_quant
+                            | primitive_attr_t::skip_mask_t::dropout
+                            | primitive_attr_t::skip_mask_t::rounding_mode,
                     dst_dt),
             VERBOSE_UNSUPPORTED_ATTR);
     const auto &po = attr()->post_ops_;
@@ -328,6 +340,9 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
         if (bgmmc_.apply_scales_in_buffer_b) brg.skip_scales = true;
         CHECK(brgemm_desc_set_postops(
                 &brg, attr(), &dst_md_, LDD, bgmmc_.bia_dt));
+        brg.with_src_scales = bgmmc_.with_src_dyn_quant;
+        brg.with_dropout = bgmmc_.with_dropout;
+        brg.with_stochastic_round = bgmmc_.with_stochastic_round;
 
         brgemm_attr_t brgattr;
         brgattr.generate_skip_accumulation
@@ -376,6 +391,8 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
 
 template <cpu_isa_t isa>
 status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
+    jit_code_blob_t::scope_t jit_code_blob_scope(jit_code_blob_, cache_blob());
+
     const auto &bgmmc = pd()->get_brgemm_matmul_conf();
     const int max_m_ker_idx
             = bgmmc.is_runtime_M ? max_num_dynamic_m_tails + 1 : 2;
@@ -460,6 +477,20 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
         }
     }
 
+    if (bgmmc.with_dropout) {
+        CHECK(safe_ptr_assign(dropout_mask_kernel_,
+                new jit_avx512_core_philox_t(
+                        jit_avx512_core_philox_t::kind_t::dropout_mask)));
+        CHECK(dropout_mask_kernel_->create_kernel());
+    }
+
+    if (bgmmc.with_stochastic_round) {
+        CHECK(safe_ptr_assign(rnd_bias_kernel_,
+                new jit_avx512_core_philox_t(
+                        jit_avx512_core_philox_t::kind_t::random_bits)));
+        CHECK(rnd_bias_kernel_->create_kernel());
+    }
+
     return status::success;
 }
 
@@ -490,8 +521,41 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
             pd()->N(), wei_scale_per_k, wei_scale_per_n, pd()->attr(),
             jit_scale_precompute_.get(), 1.f, bgmmc.req_transpose_scales);
 
+    // Every row of the weights gets a copy of its lookup table, so that the
+    // copy routine walks them the same way as the per-row scales.
+    float *wei_lut = nullptr;
+    if (bgmmc.with_wei_lut) {
+        const auto lut = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_WEIGHTS_LUT);
+        wei_lut = ctx.get_scratchpad_grantor().template get<float>(
+                key_matmul_wei_lut);
+        parallel_nd(bgmmc.K, [&](dim_t k) {
+            utils::array_copy(wei_lut + k * wei_lut_size,
+                    lut + (k / bgmmc.wei_lut_group) * wei_lut_size,
+                    wei_lut_size);
+        });
+    }
+
     brg_matmul_exec_ctx_t brgmm_ctx(ctx, pd(), oscales, src_zero_point,
-            wei_zero_point, dst_zero_point, dst_scales, helper);
+            wei_zero_point, dst_zero_point, dst_scales, wei_lut, helper);
+
+    if (bgmmc.with_dropout) {
+        const auto p = CTX_IN_MEM(
+                const float *, DNNL_ARG_ATTR_DROPOUT_PROBABILITY);
+        const auto seed
+                = CTX_IN_MEM(const uint32_t *, DNNL_ARG_ATTR_DROPOUT_SEED);
+        dropout_mask_kernel_->generate_dropout_mask(
+                brgmm_ctx.get_dropout_mask_ptr(), dst_d.nelems(), *p, *seed);
+    }
+
+    if (bgmmc.with_stochastic_round) {
+        const auto seed
+                = CTX_IN_MEM(const uint32_t *, DNNL_ARG_ATTR_ROUNDING_SEED);
+        rnd_bias_kernel_->generate_random_bits(brgmm_ctx.get_rnd_bias_ptr(),
+                dst_d.nelems()
+                        * jit_avx512_core_philox_t::rnd_bias_size(
+                                dst_d.data_type()),
+                *seed);
+    }
 
     const bool use_buffer_a
             = bgmmc.use_buffer_a || bgmmc.use_buffer_a_tail_only;
@@ -507,12 +571,33 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
 
     const int N_chunks = brgmm_ctx.get_N_chunks();
     const int N_chunk_tail = brgmm_ctx.get_N_chunk_tail();
+
+    // For a ragged batch, only the M chunks holding valid rows are
+    // distributed between threads.
+    const auto ragged_lengths = bgmmc.is_ragged
+            ? CTX_IN_MEM(const int32_t *, DNNL_ARG_ATTR_RAGGED_LENGTHS)
+            : nullptr;
+    const dim_t ragged_inner_batch = bgmmc.batch / dst_d.dims()[0];
+    auto get_valid_M_blocks = [&](int b) -> int {
+        const dim_t len = ragged_lengths[b / ragged_inner_batch];
+        return (int)div_up(nstl::max<dim_t>(0, nstl::min(bgmmc.M, len)),
+                bgmmc.M_blk);
+    };
+    auto get_ragged_work = [&](int b) -> int {
+        return div_up(get_valid_M_blocks(b), M_chunk_size) * N_chunks;
+    };
+    int ragged_work_amount = 0;
+    if (ragged_lengths)
+        for (int b = 0; b < bgmmc.batch; b++)
+            ragged_work_amount += get_ragged_work(b);
+
     parallel(num_threads, [&](const int ithr, const int nthr) {
         const int ithr_bmn = brgmm_ctx.get_thread_idx_for_bmn_gemm(ithr);
         const int ithr_k = brgmm_ctx.get_thread_idx_for_k(ithr);
         if (ithr_bmn < 0 || ithr_k < 0) return;
         int start {0}, end {0};
-        balance211(brgmm_ctx.get_parallel_work_amount_gemm(),
+        balance211(ragged_lengths ? ragged_work_amount
+                                  : brgmm_ctx.get_parallel_work_amount_gemm(),
                 brgmm_ctx.get_num_threads_for_bmn(), ithr_bmn, start, end);
         int kc_start {0}, kc_end {bgmmc.K_chunks};
         if (brgmm_ctx.parallel_reduction_is_used())
@@ -523,53 +608,17 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
         brgemm_palettes_.maybe_tile_configure(
                 is_amx, prev_ker_idx, brgmm_ctx.get_base_brgemm_kernel_idx());
 
-        int b {0}, mc {0}, nc {0}, b_per_t {0}, mc_per_t {0}, nc_per_t {0},
-                bt {0}, mt {0}, nt {0};
-        int m_chunks_per_thread = div_up(M_chunks, bgmmc.nthr_m);
-        int n_chunks_per_thread = div_up(N_chunks, bgmmc.nthr_n);
-        int batch_per_thread = div_up(bgmmc.batch, bgmmc.nthr_b);
-        if (brgmm_ctx.is_chunks_horizontal_process_order())
-            nd_iterator_init(start, bt, bgmmc.nthr_b, mt, bgmmc.nthr_m, nt,
-                    bgmmc.nthr_n, b_per_t, batch_per_thread, mc_per_t,
-                    m_chunks_per_thread, nc_per_t, n_chunks_per_thread);
-        else
-            nd_iterator_init(start, bt, bgmmc.nthr_b, nt, bgmmc.nthr_n, mt,
-                    bgmmc.nthr_m, b_per_t, batch_per_thread, nc_per_t,
-                    n_chunks_per_thread, mc_per_t, m_chunks_per_thread);
-        mc = mt * m_chunks_per_thread + mc_per_t;
-        nc = nt * n_chunks_per_thread + nc_per_t;
-        b = bt * batch_per_thread + b_per_t;
-
-        auto advance_func = [&]() {
-            ++start;
-            if (brgmm_ctx.is_chunks_horizontal_process_order())
-                nd_iterator_step(bt, bgmmc.nthr_b, mt, bgmmc.nthr_m, nt,
-                        bgmmc.nthr_n, b_per_t, batch_per_thread, mc_per_t,
-                        m_chunks_per_thread, nc_per_t, n_chunks_per_thread);
-            else
-                nd_iterator_step(bt, bgmmc.nthr_b, nt, bgmmc.nthr_n, mt,
-                        bgmmc.nthr_m, b_per_t, batch_per_thread, nc_per_t,
-                        n_chunks_per_thread, mc_per_t, m_chunks_per_thread);
-            mc = mt * m_chunks_per_thread + mc_per_t;
-            nc = nt * n_chunks_per_thread + nc_per_t;
-            b = bt * batch_per_thread + b_per_t;
-        };
-
         int mc_prev = -1;
         int nb_prev = -1;
         int b_prev = -1;
         const char *a_batch_ptr = nullptr;
         const char *b_batch_ptr = nullptr;
 
-        while (start < end) {
-            if (mc >= M_chunks || nc >= N_chunks || b >= bgmmc.batch) {
-                advance_func();
-                continue;
-            }
-
+        auto process_chunk = [&](int b, int mc, int nc) {
             auto m_start = mc * M_chunk_size;
             const bool m_chunk_tail = mc == M_chunks - 1 && M_chunk_tail > 0;
             auto m_end = m_start + (m_chunk_tail ? M_chunk_tail : M_chunk_size);
+            if (ragged_lengths) m_end = nstl::min(m_end, get_valid_M_blocks(b));
             auto n_start = nc * bgmmc.N_chunk_size;
             const bool n_chunk_tail = nc == N_chunks - 1 && N_chunk_tail > 0;
             auto n_end = n_start
@@ -624,7 +673,58 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
             }
             mc_prev = mc;
             b_prev = b;
+        };
+
+        if (ragged_lengths) {
+            // Work items are the valid (M chunk, N chunk) pairs of every
+            // batch in order.
+            for (int b = 0, offset = 0; b < bgmmc.batch && offset < end; b++) {
+                const int work = get_ragged_work(b);
+                for (int i = nstl::max(start, offset);
+                        i < nstl::min(end, offset + work); i++)
+                    process_chunk(b, (i - offset) / N_chunks,
+                            (i - offset) % N_chunks);
+                offset += work;
+            }
+            if (is_amx) { amx_tile_release(); }
+            return;
+        }
+
+        int b {0}, mc {0}, nc {0}, b_per_t {0}, mc_per_t {0}, nc_per_t {0},
+                bt {0}, mt {0}, nt {0};
+        int m_chunks_per_thread = div_up(M_chunks, bgmmc.nthr_m);
+        int n_chunks_per_thread = div_up(N_chunks, bgmmc.nthr_n);
+        int batch_per_thread = div_up(bgmmc.batch, bgmmc.nthr_b);
+        if (brgmm_ctx.is_chunks_horizontal_process_order())
+            nd_iterator_init(start, bt, bgmmc.nthr_b, mt, bgmmc.nthr_m, nt,
+                    bgmmc.nthr_n, b_per_t, batch_per_thread, mc_per_t,
+                    m_chunks_per_thread, nc_per_t, n_chunks_per_thread);
+        else
+            nd_iterator_init(start, bt, bgmmc.nthr_b, nt, bgmmc.nthr_n, mt,
+                    bgmmc.nthr_m, b_per_t, batch_per_thread, nc_per_t,
+                    n_chunks_per_thread, mc_per_t, m_chunks_per_thread);
+        mc = mt * m_chunks_per_thread + mc_per_t;
+        nc = nt * n_chunks_per_thread + nc_per_t;
+        b = bt * batch_per_thread + b_per_t;
+
+        auto advance_func = [&]() {
+            ++start;
+            if (brgmm_ctx.is_chunks_horizontal_process_order())
+                nd_iterator_step(bt, bgmmc.nthr_b, mt, bgmmc.nthr_m, nt,
+                        bgmmc.nthr_n, b_per_t, batch_per_thread, mc_per_t,
+                        m_chunks_per_thread, nc_per_t, n_chunks_per_thread);
+            else
+                nd_iterator_step(bt, bgmmc.nthr_b, nt, bgmmc.nthr_n, mt,
+                        bgmmc.nthr_m, b_per_t, batch_per_thread, nc_per_t,
+                        n_chunks_per_thread, mc_per_t, m_chunks_per_thread);
+            mc = mt * m_chunks_per_thread + mc_per_t;
+            nc = nt * n_chunks_per_thread + nc_per_t;
+            b = bt * batch_per_thread + b_per_t;
+        };
 
+        while (start < end) {
+            if (mc < M_chunks && nc < N_chunks && b < bgmmc.batch)
+                process_chunk(b, mc, nc);
             advance_func();
         }
         if (is_amx) { amx_tile_release(); }
@@ -676,6 +776,7 @@ void brgemm_matmul_t<isa>::compute_kernel(
             = brgmm_ctx.get_zp_a_compensation_ptr(ithr, b_idx, n_blk_idx);
     const auto zp_comp_b
             = brgmm_ctx.get_zp_b_compensation_result_ptr(ithr, m_blk_idx);
+    const auto src_scales = brgmm_ctx.get_src_scales_ptr(ithr, m_blk_idx);
     const auto zp_c_val_ptr = brgmm_ctx.get_zp_c_val_ptr();
     const auto &post_ops_binary_rhs_arg_vec
             = brgmm_ctx.get_post_ops_binary_rhs_arg_vec();
@@ -723,7 +824,10 @@ void brgemm_matmul_t<isa>::compute_kernel(
                     static_cast<const void *>(zp_comp_a),
                     static_cast<const void *>(zp_comp_b),
                     static_cast<const void *>(zp_c_val_ptr), false, 1, false,
-                    false, brgmm_ctx.get_dst_scales_ptr()};
+                    false, brgmm_ctx.get_dst_scales_ptr(), nullptr,
+                    src_scales, brgmm_ctx.get_dropout_mask_ptr(ptr_D),
+                    brgmm_ctx.get_dropout_inv_q_ptr(),
+                    brgmm_ctx.get_rnd_bias_ptr(ptr_D)};
             brgemm_kernel_execute_postops(brg_kernel, gemm_batch, addr_batch,
                     (void *)ptr_C, (void *)ptr_D, post_ops_data, scratch,
                     &leading_dimensions);
@@ -778,7 +882,10 @@ void brgemm_matmul_t<isa>::compute_kernel(
                     static_cast<const void *>(zp_comp_a),
                     static_cast<const void *>(zp_comp_b),
                     static_cast<const void *>(zp_c_val_ptr), false, 1, false,
-                    false, brgmm_ctx.get_dst_scales_ptr()};
+                    false, brgmm_ctx.get_dst_scales_ptr(), nullptr,
+                    src_scales, brgmm_ctx.get_dropout_mask_ptr(ptr_D),
+                    brgmm_ctx.get_dropout_inv_q_ptr(),
+                    brgmm_ctx.get_rnd_bias_ptr(ptr_D)};
 
             brgemm_kernel_execute_postops(brg_kernel_k_tail, 1, addr_batch,
                     (void *)ptr_C, (void *)ptr_D, post_ops_data, scratch,
@@ -1086,7 +1193,11 @@ void brgemm_matmul_t<isa>::maybe_reduce_partial_results_and_apply_postops(
                                 static_cast<const void *>(zp_comp_b),
                                 static_cast<const void *>(zp_c_val_ptr),
                                 skip_accumulation, 1, false, false,
-                                brgmm_ctx.get_dst_scales_ptr()};
+                                brgmm_ctx.get_dst_scales_ptr(), nullptr,
+                                nullptr,
+                                brgmm_ctx.get_dropout_mask_ptr(ptr_D),
+                                brgmm_ctx.get_dropout_inv_q_ptr(),
+                                brgmm_ctx.get_rnd_bias_ptr(ptr_D)};
 
                         brgemm_kernel_execute_postops(brg_kernel, 0, nullptr,
                                 (void *)ptr_C, (void *)ptr_D, post_ops_data,
@@ -1125,6 +1236,7 @@ void brgemm_matmul_t<isa>::copy_a_chunk_in_buffer(
                     ithr, m_blk_idx);
     ctx.zp_b_neg_value_ptr = (void *)brgmm_ctx.get_zp_b_neg_val_ptr();
     ctx.zp_ab_comp_ptr = (void *)brgmm_ctx.get_zp_ab_mixed_comp_ptr();
+    ctx.src_scales_ptr = (void *)brgmm_ctx.get_src_scales_ptr(ithr, m_blk_idx);
     ctx.dynamic_src_ld = brgmm_ctx.get_src_stride();
 
     for (int gb = 0; gb < gemm_batch_iters; gb++) {
@@ -1200,6 +1312,7 @@ void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
         ctx.current_K_pad = brgmm_ctx.get_current_K_pad(ctx.current_K_iters);
 
         ctx.scales_ptr = (void *)brgmm_ctx.get_oscales_ptr(n, k);
+        ctx.wei_lut_ptr = (void *)brgmm_ctx.get_wei_lut_ptr(k);
         if (bgmmc.blocked_B && !bgmmc.is_f16_with_int_wei
                 && isa == avx512_core_fp16) {
             cvt_float16_to_float((float *)ctx.tr_src, (float16_t *)ctx.src,
@@ -1220,6 +1333,7 @@ void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
         ctx.current_K_iters = bgmmc.K % bgmmc.K_blk;
         ctx.current_K_pad = brgmm_ctx.get_current_K_pad(ctx.current_K_iters);
         ctx.scales_ptr = (void *)brgmm_ctx.get_oscales_ptr(n, k);
+        ctx.wei_lut_ptr = (void *)brgmm_ctx.get_wei_lut_ptr(k);
         if (bgmmc.blocked_B && !bgmmc.is_f16_with_int_wei
                 && isa == avx512_core_fp16) {
             cvt_float16_to_float((float *)ctx.tr_src, (float16_t *)ctx.src,
@@ -1247,7 +1361,8 @@ template <cpu_isa_t isa>
 struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
     brg_matmul_exec_ctx_t(const exec_ctx_t &ctx, const pd_t *pd,
             const float *oscales, int32_t src_zp, int32_t wei_zp,
-            int32_t dst_zp, const float *dst_scales, matmul_helper_t &helper)
+            int32_t dst_zp, const float *dst_scales, const float *wei_lut,
+            matmul_helper_t &helper)
         : bgmmc_(pd->get_brgemm_matmul_conf())
         , src_d_(pd->src_md())
         , wei_d_(pd->weights_md())
@@ -1270,7 +1385,18 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 
         oscales_ptr_ = oscales;
         dst_scales_ptr_ = dst_scales;
+        if (bgmmc_.with_dropout) {
+            dropout_mask_ptr_
+                    = CTX_OUT_MEM(uint8_t *, DNNL_ARG_ATTR_DROPOUT_MASK);
+            dropout_inv_q_ = jit_avx512_core_philox_t::get_inv_q(
+                    *CTX_IN_MEM(
+                            const float *, DNNL_ARG_ATTR_DROPOUT_PROBABILITY));
+        }
+        wei_lut_ptr_ = wei_lut;
         memory_tracking::grantor_t scratchpad = ctx.get_scratchpad_grantor();
+        if (bgmmc_.with_stochastic_round)
+            rnd_bias_ptr_
+                    = scratchpad.template get<uint8_t>(key_matmul_rnd_bias);
         const auto &bgmmc = pd->get_brgemm_matmul_conf();
 
         batch_element_ptr_ = scratchpad.template get<brgemm_batch_element_t>(
@@ -1326,6 +1452,10 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                 ? scratchpad.template get<int32_t>(
                         key_brgemm_primitive_zp_comp_b)
                 : nullptr;
+        src_scales_ptr_ = bgmmc.with_src_dyn_quant
+                ? scratchpad.template get<float>(
+                        key_brgemm_primitive_src_scales)
+                : nullptr;
 
         zero_point_a_negative_val_ = -src_zp;
         zero_point_b_val_ = wei_zp;
@@ -1914,6 +2044,33 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 
     const float *get_dst_scales_ptr() const { return dst_scales_ptr_; }
 
+    uint8_t *get_dropout_mask_ptr() const { return dropout_mask_ptr_; }
+
+    // The mask has the layout of the destination.
+    const uint8_t *get_dropout_mask_ptr(const char *ptr_D) const {
+        if (!bgmmc_.with_dropout) return nullptr;
+        return dropout_mask_ptr_ + (ptr_D - data_C_ptr_) / bgmmc_.c_dt_sz;
+    }
+
+    const float *get_dropout_inv_q_ptr() const {
+        return bgmmc_.with_dropout ? &dropout_inv_q_ : nullptr;
+    }
+
+    uint8_t *get_rnd_bias_ptr() const { return rnd_bias_ptr_; }
+
+    // The random bias has the layout of the destination.
+    const uint8_t *get_rnd_bias_ptr(const char *ptr_D) const {
+        if (!bgmmc_.with_stochastic_round) return nullptr;
+        return rnd_bias_ptr_
+                + (ptr_D - data_C_ptr_) / bgmmc_.c_dt_sz
+                * jit_avx512_core_philox_t::rnd_bias_size(bgmmc_.dst_dt);
+    }
+
+    const float *get_wei_lut_ptr(dim_t k) const {
+        if (!bgmmc_.with_wei_lut) return nullptr;
+        return wei_lut_ptr_ + k * wei_lut_size;
+    }
+
     const int32_t *get_zp_a_neg_val_ptr() const {
         return &zero_point_a_negative_val_;
     }
@@ -1989,6 +2146,16 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                 + m_blk_local * bgmmc_.zp_b_comp_buffer_shift_m;
     }
 
+    // Scales of the rows of the source quantized by the copy routine.
+    float *get_src_scales_ptr(int ithr, int m_blk_idx) const {
+        if (!bgmmc_.with_src_dyn_quant) return nullptr;
+
+        const int m_blk_local = m_blk_idx % get_M_chunk_size();
+        return src_scales_ptr_
+                + (static_cast<dim_t>(ithr) * get_M_chunk_size() + m_blk_local)
+                * bgmmc_.M_blk;
+    }
+
     char *get_tile_workspace(int ithr) const {
         return is_amx_ ? wsp_tile_ptr_ + ithr * bgmmc_.wsp_tile_per_thr_bytes
                        : nullptr;
@@ -2264,11 +2431,16 @@ private:
     const char *bias_ptr_;
     const float *oscales_ptr_;
     const float *dst_scales_ptr_;
+    const float *wei_lut_ptr_;
+    uint8_t *dropout_mask_ptr_ = nullptr;
+    float dropout_inv_q_ = 0.f;
+    uint8_t *rnd_bias_ptr_ = nullptr;
     int32_t *s8s8_compensation_ptr_;
 
     int32_t *zero_point_a_compensations_ptr_;
     int32_t *zero_point_b_compensations_ptr_;
     int32_t *reorder_zp_a_comp_ptr_;
+    float *src_scales_ptr_;
 
     int32_t zero_point_a_negative_val_;
     int32_t zero_point_b_val_;
@@ -27,6 +27,7 @@
 #include "cpu/x64/brgemm/brgemm_containers.hpp"
 #include "cpu/x64/brgemm/brgemm_utils.hpp"
 #include "cpu/x64/cpu_reducer.hpp"
+#include "cpu/x64/jit_avx512_core_philox.hpp"
 #include "cpu/x64/jit_avx512_core_scale_precompute.hpp"
 #include "cpu/x64/jit_avx512_sparse_decompress_kernel.hpp"
 #include "cpu/x64/jit_brgemm_post_ops.hpp"
@@ -83,6 +84,15 @@ struct brgemm_matmul_t : public primitive_t {
         return execute_body(ctx);
     }
 
+    status_t get_cache_blob_size(
+            engine_t *engine, size_t *size) const override {
+        return jit_code_blob_.get_cache_blob_size(size);
+    }
+    status_t get_cache_blob(
+            engine_t *engine, cache_blob_t &cache_blob) const override {
+        return jit_code_blob_.get_cache_blob(cache_blob);
+    }
+
 private:
     struct brg_matmul_exec_ctx_t;
 
@@ -119,10 +129,14 @@ private:
     std::unique_ptr<jit_avx512_sparse_decompress_kernel_t>
             sparse_decompress_kernel_;
     std::unique_ptr<jit_avx512_core_scale_precompute_t> jit_scale_precompute_;
+    std::unique_ptr<jit_avx512_core_philox_t> dropout_mask_kernel_;
+    std::unique_ptr<jit_avx512_core_philox_t> rnd_bias_kernel_;
 
     using reducer_t = x64::jit_brgemm_kernel_diff_bias_t<
             typename cpu_isa_traits_t<isa>::Vmm>;
     std::unique_ptr<reducer_t> reducers_[2][2];
+
+    jit_code_blob_t jit_code_blob_;
 };
 
 } // namespace matmul
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <float.h>
+
 #include "common/c_types_map.hpp"
 #include "common/nstl.hpp"
 #include "common/type_helpers.hpp"
@@ -526,6 +528,220 @@ void jit_brgemm_matmul_copy_a_impl_t<Vmm>::generate() {
 template struct jit_brgemm_matmul_copy_a_impl_t<Zmm>;
 template struct jit_brgemm_matmul_copy_a_impl_t<Ymm>;
 
+// Copies a plain f32 or bf16 A into the buffer, quantized to s8 or u8 with a
+// scale per row. The scale of a row maps its largest magnitude to the largest
+// value of the quantized type, and is computed with the first block of K.
+// Next blocks of K read it back from the buffer of scales, which is also
+// passed to the post-ops of the brgemm kernels.
+struct jit_brgemm_matmul_copy_a_dyn_quant_t : public jit_brgemm_matmul_copy_a_t,
+                                              public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_matmul_copy_a_dyn_quant_t)
+
+    jit_brgemm_matmul_copy_a_dyn_quant_t(const brgemm_matmul_conf_t *conf)
+        : jit_brgemm_matmul_copy_a_t(conf)
+        , jit_generator_t(jit_name())
+        , typesize_(conf_->a_dt_sz)
+        , vnni_granularity_(data_type_vnni_granularity(conf_->src_dt))
+        , src_stride_(conf_->copy_A_src_stride)
+        , tr_src_stride_(conf_->LDA * conf_->tr_a_dt_sz) {}
+
+    void operator()(ctx_t *ctx) override { jit_generator_t::operator()(ctx); }
+    status_t create_kernel() override {
+        return jit_generator_t::create_kernel();
+    }
+
+private:
+    using reg64_t = const Xbyak::Reg64;
+    using opmask_t = const Xbyak::Opmask;
+
+    static constexpr int simd_w_ = 16;
+
+    const int typesize_;
+    const int vnni_granularity_;
+    const dim_t src_stride_;
+    const dim_t tr_src_stride_;
+
+    opmask_t kTail_row = k7;
+    opmask_t kTail_load = k6;
+    opmask_t kTail_store = k5;
+
+    reg64_t reg_src = rax;
+    reg64_t reg_tr_src = rbx;
+    reg64_t reg_K_start = rdx;
+    reg64_t reg_M_blk = r9;
+    reg64_t reg_K_blk = r10;
+    reg64_t reg_scales = r11;
+    reg64_t reg_aux_src = r12;
+    reg64_t regq_tmp = r14;
+
+    Zmm zmm_abs_mask = zmm31;
+    Zmm zmm_zero = zmm30;
+    Zmm zmm_inv_scale = zmm29;
+    Zmm zmm_max = zmm28;
+    Zmm zmm_tmp = zmm27;
+    Xmm xmm_max = Xmm(28);
+    Xmm xmm_tmp = Xmm(27);
+
+    void set_mask(opmask_t k, int nelems) {
+        mov(regq_tmp.cvt32(), (1 << nelems) - 1);
+        kmovw(k, regq_tmp.cvt32());
+    }
+    void load(const Zmm &zmm, const Address &addr, bool is_tail,
+            opmask_t k_tail);
+    void compute_row_scale();
+    void copy_K_loop(bool is_K_tail);
+    void copy_M_loop(bool is_K_tail);
+    void generate() override;
+};
+
+void jit_brgemm_matmul_copy_a_dyn_quant_t::load(const Zmm &zmm,
+        const Address &addr, bool is_tail, opmask_t k_tail) {
+    const Zmm zmm_load = is_tail ? zmm | k_tail | T_z : zmm;
+    if (conf_->orig_src_dt == data_type::bf16) {
+        vpmovzxwd(zmm_load, addr);
+        vpslld(zmm, zmm, 16);
+    } else
+        vmovups(zmm_load, addr);
+}
+
+// Computes the scale of the row at reg_src into xmm_max.
+void jit_brgemm_matmul_copy_a_dyn_quant_t::compute_row_scale() {
+    const dim_t nb_k = conf_->K / simd_w_;
+    const int k_tail = conf_->K % simd_w_;
+
+    vpxord(zmm_max, zmm_max, zmm_max);
+    mov(reg_aux_src, reg_src);
+    if (nb_k > 0) {
+        Label loop_K;
+        mov(regq_tmp, nb_k);
+        L(loop_K);
+        load(zmm_tmp, ptr[reg_aux_src], false, kTail_row);
+        vandps(zmm_tmp, zmm_tmp, zmm_abs_mask);
+        vmaxps(zmm_max, zmm_max, zmm_tmp);
+        add(reg_aux_src, simd_w_ * typesize_);
+        dec(regq_tmp);
+        jnz(loop_K, T_NEAR);
+    }
+    if (k_tail > 0) {
+        load(zmm_tmp, ptr[reg_aux_src], true, kTail_row);
+        vandps(zmm_tmp, zmm_tmp, zmm_abs_mask);
+        vmaxps(zmm_max, zmm_max, zmm_tmp);
+    }
+
+    // Maximum across the lanes.
+    vshuff32x4(zmm_tmp, zmm_max, zmm_max, 0x4e);
+    vmaxps(zmm_max, zmm_max, zmm_tmp);
+    vshuff32x4(zmm_tmp, zmm_max, zmm_max, 0xb1);
+    vmaxps(zmm_max, zmm_max, zmm_tmp);
+    vshufps(zmm_tmp, zmm_max, zmm_max, 0x4e);
+    vmaxps(zmm_max, zmm_max, zmm_tmp);
+    vshufps(zmm_tmp, zmm_max, zmm_max, 0xb1);
+    vmaxps(zmm_max, zmm_max, zmm_tmp);
+
+    // scale = max(absmax / qmax, FLT_MIN), as in the reference.
+    const float qmax = conf_->src_dt == data_type::s8 ? 127.f : 255.f;
+    mov(regq_tmp.cvt32(), float2int(qmax));
+    vmovd(xmm_tmp, regq_tmp.cvt32());
+    vdivss(xmm_max, xmm_max, xmm_tmp);
+    mov(regq_tmp.cvt32(), float2int(FLT_MIN));
+    vmovd(xmm_tmp, regq_tmp.cvt32());
+    vmaxss(xmm_max, xmm_max, xmm_tmp);
+}
+
+void jit_brgemm_matmul_copy_a_dyn_quant_t::copy_K_loop(bool is_K_tail) {
+    const int K_blk = is_K_tail ? conf_->K % conf_->K_blk
+                                : nstl::min(conf_->K, conf_->K_blk);
+    const int nb_k = K_blk / simd_w_;
+    const int k_tail = K_blk % simd_w_;
+
+    auto quantize = [&](int k, bool is_tail) {
+        load(zmm_tmp, ptr[reg_src + k * simd_w_ * typesize_], is_tail,
+                kTail_load);
+        vmulps(zmm_tmp, zmm_tmp, zmm_inv_scale);
+        vcvtps2dq(zmm_tmp, zmm_tmp);
+        // Lanes beyond the tail were loaded as zeros, and are stored up to
+        // the granularity of the brgemm kernels.
+        const auto addr = ptr[reg_tr_src + k * simd_w_];
+        const auto store_addr = is_tail ? addr | kTail_store : addr;
+        if (conf_->src_dt == data_type::u8) {
+            vpmaxsd(zmm_tmp, zmm_tmp, zmm_zero);
+            vpmovusdb(store_addr, zmm_tmp);
+        } else
+            vpmovsdb(store_addr, zmm_tmp);
+    };
+
+    for (int k = 0; k < nb_k; k++)
+        quantize(k, false);
+    if (k_tail > 0) {
+        set_mask(kTail_load, k_tail);
+        set_mask(kTail_store, rnd_up(k_tail, vnni_granularity_));
+        quantize(nb_k, true);
+    }
+}
+
+void jit_brgemm_matmul_copy_a_dyn_quant_t::copy_M_loop(bool is_K_tail) {
+    Label loop_M;
+    L(loop_M);
+
+    Label scale_computed;
+    Label scale_loaded;
+    cmp(reg_K_start, 0);
+    jne(scale_loaded, T_NEAR);
+    compute_row_scale();
+    vmovss(ptr[reg_scales], xmm_max);
+    jmp(scale_computed, T_NEAR);
+    L(scale_loaded);
+    vmovss(xmm_max, ptr[reg_scales]);
+    L(scale_computed);
+
+    mov(regq_tmp.cvt32(), float2int(1.f));
+    vmovd(xmm_tmp, regq_tmp.cvt32());
+    vdivss(xmm_tmp, xmm_tmp, xmm_max);
+    vbroadcastss(zmm_inv_scale, xmm_tmp);
+
+    copy_K_loop(is_K_tail);
+
+    add(reg_src, src_stride_);
+    add(reg_tr_src, tr_src_stride_);
+    add(reg_scales, sizeof(float));
+
+    dec(reg_M_blk);
+    jnz(loop_M, T_NEAR);
+}
+
+void jit_brgemm_matmul_copy_a_dyn_quant_t::generate() {
+    preamble();
+
+    mov(reg_src, ptr[param1 + GET_OFF(src)]);
+    mov(reg_tr_src, ptr[param1 + GET_OFF(tr_src)]);
+    mov(reg_scales, ptr[param1 + GET_OFF(src_scales_ptr)]);
+    mov(reg_K_start, ptr[param1 + GET_OFF(current_K_start)]);
+    mov(reg_K_blk, ptr[param1 + GET_OFF(current_K_blk)]);
+    mov(reg_M_blk, ptr[param1 + GET_OFF(current_M_blk)]);
+
+    mov(regq_tmp.cvt32(), 0x7fffffff);
+    vpbroadcastd(zmm_abs_mask, regq_tmp.cvt32());
+    vpxord(zmm_zero, zmm_zero, zmm_zero);
+    const int row_tail = conf_->K % simd_w_;
+    if (row_tail > 0) set_mask(kTail_row, row_tail);
+
+    Label done;
+    const dim_t K_blk_tail = conf_->K_tail > 0 ? conf_->K % conf_->K_blk : 0;
+    if (K_blk_tail > 0) {
+        Label not_K_tail;
+        cmp(reg_K_blk, K_blk_tail);
+        jne(not_K_tail, T_NEAR);
+        copy_M_loop(true);
+        jmp(done, T_NEAR);
+
+        L(not_K_tail);
+    }
+    copy_M_loop(false);
+    L(done);
+
+    postamble();
+}
+
 template <typename Vmm>
 struct jit_brgemm_matmul_copy_a_transposed_impl_t
     : public jit_brgemm_matmul_copy_a_t,
@@ -2891,6 +3107,96 @@ void jit_brgemm_matmul_copy_b_int8_t<Vmm>::generate() {
     postamble();
 }
 
+// Converts fp8 and fp4 weights to f32 for the copy routines of weights
+// decompression. f8_e5m2 is the upper half of f16. f8_e4m3 becomes f16 once
+// its exponent and mantissa are moved into place, and a multiplication then
+// fixes the exponent bias. Both go through the f16 to f32 conversion, which
+// is exact for every value, subnormals included. f4_e2m1 codes index a table
+// of the 16 values.
+struct jit_brgemm_matmul_fp_wei_cvt_t {
+    jit_brgemm_matmul_fp_wei_cvt_t(jit_generator_t *host, data_type_t dt,
+            int aux_vmm_idx, const Opmask &k_aux)
+        : host_(host), dt_(dt), zmm_aux_(aux_vmm_idx), k_aux_(k_aux) {}
+
+    // Loads 16 fp8 values into the f32 lanes of `vmm`, which may carry a
+    // zeroing mask.
+    void load_f8(const Xmm &vmm, const Operand &op);
+    // Replaces the f4_e2m1 codes in the dword lanes of `vmm` by their values.
+    void cvt_f4(const Xmm &vmm);
+    // Must be called by the host kernel after its postamble.
+    void prepare_table();
+
+private:
+    jit_generator_t *const host_;
+    const data_type_t dt_;
+    const Zmm zmm_aux_;
+    const Opmask k_aux_;
+    Label l_table_;
+
+    // Offsets of the constants in the table, which starts with the f4_e2m1
+    // values.
+    enum {
+        e4m3_and_mask_off = 16 * sizeof(float),
+        e4m3_bias_off = e4m3_and_mask_off + sizeof(float),
+        abs_mask_off = e4m3_bias_off + sizeof(float),
+        e4m3_nan_off = abs_mask_off + sizeof(float),
+        qnan_off = e4m3_nan_off + sizeof(float),
+    };
+
+    Address table_b(int off) const {
+        return host_->ptr_b[host_->rip + l_table_ + off];
+    }
+};
+
+void jit_brgemm_matmul_fp_wei_cvt_t::load_f8(
+        const Xmm &vmm, const Operand &op) {
+    assert(one_of(dt_, data_type::f8_e5m2, data_type::f8_e4m3));
+    const Zmm zmm(vmm.getIdx());
+    const Ymm ymm(vmm.getIdx());
+    Ymm ymm_load = ymm;
+    if (vmm.getOpmaskIdx() != 0)
+        ymm_load = ymm | Opmask(vmm.getOpmaskIdx()) | Xbyak::util::T_z;
+
+    host_->vpmovzxbw(ymm_load, op);
+    host_->vpsllw(ymm, ymm, 8);
+    if (dt_ == data_type::f8_e4m3) {
+        // The sign bit is duplicated by the shift and then cleared from the
+        // top of the exponent: s.eeee.mmm -> s.0eeee.mmm0000000.
+        host_->vpsraw(ymm, ymm, 1);
+        host_->vpandd(ymm, ymm, table_b(e4m3_and_mask_off));
+    }
+    host_->vcvtph2ps(zmm, ymm);
+    if (dt_ == data_type::f8_e4m3) {
+        host_->vmulps(zmm, zmm, table_b(e4m3_bias_off));
+        // s.1111.111 is NaN and the only encoding that lands on 480.
+        host_->vpandd(zmm_aux_, zmm, table_b(abs_mask_off));
+        host_->vcmpps(k_aux_, zmm_aux_, table_b(e4m3_nan_off),
+                jit_generator_t::_cmp_eq_oq);
+        host_->vpord(zmm | k_aux_, zmm, table_b(qnan_off));
+    }
+}
+
+void jit_brgemm_matmul_fp_wei_cvt_t::cvt_f4(const Xmm &vmm) {
+    assert(dt_ == data_type::f4_e2m1);
+    const Zmm zmm(vmm.getIdx());
+    host_->vpermps(zmm, zmm, host_->ptr[host_->rip + l_table_]);
+}
+
+void jit_brgemm_matmul_fp_wei_cvt_t::prepare_table() {
+    static constexpr float f4_e2m1_values[16] = {0.f, 0.5f, 1.f, 1.5f, 2.f,
+            3.f, 4.f, 6.f, -0.f, -0.5f, -1.f, -1.5f, -2.f, -3.f, -4.f, -6.f};
+
+    host_->align(64);
+    host_->L(l_table_);
+    for (float v : f4_e2m1_values)
+        host_->dd(float2int(v));
+    host_->dd(0xbfffbfff); // e4m3_and_mask_off
+    host_->dd(float2int(256.f)); // e4m3_bias_off: 2^(15 - 7)
+    host_->dd(0x7fffffff); // abs_mask_off
+    host_->dd(float2int(480.f)); // e4m3_nan_off
+    host_->dd(0x7fc00000); // qnan_off
+}
+
 template <typename Vmm>
 struct jit_brgemm_matmul_copy_b_bf16_t : public jit_brgemm_matmul_copy_b_t,
                                          public jit_generator_t {
@@ -2905,14 +3211,17 @@ struct jit_brgemm_matmul_copy_b_bf16_t : public jit_brgemm_matmul_copy_b_t,
         , src_stride(conf->copy_B_wei_stride)
         , tr_src_stride(conf_->LDB * k_blk_step * tr_typesize)
         , scales_N_stride(conf_->N * scales_typesize)
-        , is_src_int4(one_of(conf->orig_wei_dt, data_type::s4, data_type::u4))
+        , is_src_int4(one_of(conf->orig_wei_dt, data_type::s4, data_type::u4,
+                  data_type::f4_e2m1))
         , is_dynamic_stride(is_runtime_value(src_stride))
         , is_dynamic_N(conf->is_runtime_N)
         , do_N_loop(conf->LDB < conf->N_blk)
         , req_cvtps2bf16(conf->is_bf32 || conf->is_bf16_with_int_wei)
         , req_zp_b_shift(conf->has_zero_point_b && conf->with_wei_decompression)
         , req_apply_scales(conf->apply_scales_in_buffer_b)
-        , typesize_scale(is_src_int4 ? 2 : 1) {}
+        , req_lut(conf->with_wei_lut)
+        , typesize_scale(is_src_int4 ? 2 : 1)
+        , fp_cvt(this, conf->orig_wei_dt, vmm_fp_cvt_aux.getIdx(), kFpCvt) {}
 
     void operator()(ctx_t *ctx) override { jit_generator_t::operator()(ctx); }
     status_t create_kernel() override {
@@ -2937,7 +3246,9 @@ private:
     const bool req_cvtps2bf16;
     const bool req_zp_b_shift;
     const bool req_apply_scales;
+    const bool req_lut;
     const dim_t typesize_scale;
+    const dim_t lut_K_stride = wei_lut_size * sizeof(float);
 
     constexpr static int reg_src_offs = 0;
 
@@ -2950,13 +3261,15 @@ private:
     opmask_t kTail_int4 = k5;
     opmask_t kAAAA = k4;
     opmask_t k5555 = k3;
+    opmask_t kFpCvt = k2;
 
     reg64_t reg_src = rax;
     reg64_t reg_tr_src = rbx;
 
     reg64_t reg_K_iters = r8;
     reg64_t reg_N_blk = r9;
-    reg64_t reg_K_start = r10;
+    // rbp is reserved for EVEX address compression.
+    reg64_t reg_lut = r10;
     reg64_t reg_src_stride = r11;
     reg64_t reg_src_stride_x2 = r12;
     reg64_t reg_src_load_0 = r13;
@@ -2973,8 +3286,12 @@ private:
     Vmm vmm_permw = Vmm(1);
     Vmm vmm_tmp = Vmm(1); // used only for avx2_vnni_2
     Vmm vmm_zp_b_shift = Vmm(2);
+    // fp8 weights come without zero points.
+    Vmm vmm_fp_cvt_aux = Vmm(2);
     Vmm vmm_permd = Vmm(3);
 
+    jit_brgemm_matmul_fp_wei_cvt_t fp_cvt;
+
     void kmovx(Opmask k, unsigned w) {
         if (!isa_has_masks(conf_->isa)) return;
         const auto regw_tmp = reg_tmp.cvt32();
@@ -3031,6 +3348,8 @@ void jit_brgemm_matmul_copy_b_bf16_t<Vmm>::load_data(
         case data_type::bf16: vmovdqu16(vmm, op); break;
         case data_type::s8: uni_vpmovsxbd(vmm, op); break;
         case data_type::u8: uni_vpmovzxbd(vmm, op); break;
+        case data_type::f8_e5m2:
+        case data_type::f8_e4m3: fp_cvt.load_f8(vmm, op); break;
         // For int4, we see two int4 as one int8 and extend them int32
         // low half stores in lower bytes of vmm and high half in higher
         // bytes of vmm, then permute them into correct order
@@ -3044,12 +3363,14 @@ void jit_brgemm_matmul_copy_b_bf16_t<Vmm>::load_data(
             vpsrad(vmm_in | kAAAA, vmm_in, 4);
             break;
         case data_type::u4:
+        case data_type::f4_e2m1:
             uni_vpmovzxbd(maybe_mask(vmm_lower, is_tail), op);
             copy_half_int4(vmm_in, vmm_lower);
             vpermd(vmm_in, vmm_permd, vmm_in);
             uni_vpslld(vmm_in | k5555, vmm_in, 28);
             vpsrld(vmm_in | k5555, vmm_in, 28);
             vpsrld(vmm_in | kAAAA, vmm_in, 4);
+            if (conf_->orig_wei_dt == data_type::f4_e2m1) fp_cvt.cvt_f4(vmm_in);
             break;
         default: assert(!"unsupported data type");
     }
@@ -3070,7 +3391,9 @@ void jit_brgemm_matmul_copy_b_bf16_t<Vmm>::copy_2x32(
     }
 
     static constexpr int blk_sz = k_blk_step;
-    const int reserved_regs = is_src_int4 ? 4 : req_zp_b_shift ? 3 : 2;
+    const int reserved_regs = is_src_int4               ? 4
+            : req_zp_b_shift || conf_->is_fp8_fp4_weights ? 3
+                                                          : 2;
     const int max_isa_regs = isa_num_vregs(conf_->isa);
     const int max_regs_available = max_isa_regs - reserved_regs;
     const int max_unroll = max_regs_available / blk_sz;
@@ -3103,9 +3426,16 @@ void jit_brgemm_matmul_copy_b_bf16_t<Vmm>::copy_2x32(
         }
 
         if (utils::one_of(conf_->orig_wei_dt, data_type::s8, data_type::u8,
-                    data_type::s4, data_type::u4)) {
+                    data_type::s4, data_type::u4)
+                || conf_->is_fp8_fp4_weights) {
             if (req_zp_b_shift) uni_vpsubd(src_load, src_load, vmm_zp_b_shift);
-            uni_vcvtdq2ps(src_load, src_load);
+            // With a lookup table the 4-bit values are indices of the table
+            // of the row, which fits a single register.
+            if (req_lut)
+                vpermps(src_load, src_load,
+                        maybe_EVEX_compress_addr(reg_lut, k * lut_K_stride));
+            else if (!conf_->is_fp8_fp4_weights)
+                uni_vcvtdq2ps(src_load, src_load);
             if (req_apply_scales) {
                 const auto scales_offset
                         = (is_dynamic_stride ? 0 : k * scales_N_stride)
@@ -3308,6 +3638,7 @@ void jit_brgemm_matmul_copy_b_bf16_t<Vmm>::generate() {
     mov(reg_tr_src, ptr[param1 + GET_OFF(tr_src)]);
     mov(reg_N_blk, ptr[param1 + GET_OFF(current_N_blk)]);
     mov(reg_scales, ptr[param1 + GET_OFF(scales_ptr)]);
+    if (req_lut) mov(reg_lut, ptr[param1 + GET_OFF(wei_lut_ptr)]);
     if (is_dynamic_stride) {
         mov(reg_src_stride, ptr[param1 + GET_OFF(dynamic_src_stride)]);
         mov(reg_src_stride_x2, ptr[param1 + GET_OFF(dynamic_src_stride)]);
@@ -3335,6 +3666,8 @@ void jit_brgemm_matmul_copy_b_bf16_t<Vmm>::generate() {
             add(reg_src, (k_unroll * k_blk_step * src_stride) / typesize_scale);
         if (!zeropad && req_apply_scales)
             add(reg_scales, k_unroll * k_blk_step * scales_N_stride);
+        if (!zeropad && req_lut)
+            add(reg_lut, k_unroll * k_blk_step * lut_K_stride);
         add(reg_tr_src, k_unroll * tr_src_stride);
 
         sub(reg_K, k_unroll * k_blk_step);
@@ -3350,6 +3683,7 @@ void jit_brgemm_matmul_copy_b_bf16_t<Vmm>::generate() {
             add(reg_src, (k_blk_step * src_stride) / typesize_scale);
         if (!zeropad && req_apply_scales)
             add(reg_scales, k_blk_step * scales_N_stride);
+        if (!zeropad && req_lut) add(reg_lut, k_blk_step * lut_K_stride);
         add(reg_tr_src, tr_src_stride);
 
         sub(reg_K, k_blk_step);
@@ -3402,6 +3736,8 @@ void jit_brgemm_matmul_copy_b_bf16_t<Vmm>::generate() {
 
     add(rsp, stack_space_needed);
     postamble();
+
+    if (conf_->is_fp8_fp4_weights) fp_cvt.prepare_table();
 }
 
 template struct jit_brgemm_matmul_copy_b_bf16_t<Zmm>;
@@ -3417,7 +3753,8 @@ struct jit_brgemm_matmul_copy_b_f32_t : public jit_brgemm_matmul_copy_b_t,
         , jit_generator_t(jit_name())
         , dt_in_(conf->orig_wei_dt)
         , simd_w_(vreg_traits_t<Vmm>::vlen / sizeof(float))
-        , is_src_int4_(one_of(conf->orig_wei_dt, data_type::s4, data_type::u4))
+        , is_src_int4_(one_of(conf->orig_wei_dt, data_type::s4, data_type::u4,
+                  data_type::f4_e2m1))
         , req_zp_b_shift_(
                   conf->has_zero_point_b && conf->with_wei_decompression)
         , req_apply_scales_(conf->apply_scales_in_buffer_b)
@@ -3426,7 +3763,8 @@ struct jit_brgemm_matmul_copy_b_f32_t : public jit_brgemm_matmul_copy_b_t,
         , scales_typesize_(sizeof(float))
         , src_stride_(conf_->copy_B_wei_stride)
         , tr_src_stride_(conf_->LDB * typesize_out_)
-        , scales_N_stride_(conf_->N * scales_typesize_) {}
+        , scales_N_stride_(conf_->N * scales_typesize_)
+        , fp_cvt_(this, dt_in_, vmm_fp_cvt_aux.getIdx(), kFpCvt) {}
 
     void operator()(ctx_t *ctx) override { jit_generator_t::operator()(ctx); }
     status_t create_kernel() override {
@@ -3451,6 +3789,7 @@ private:
     opmask_t k5555 = k5;
     opmask_t kAAAA = k4;
     opmask_t kTail_int4 = k3;
+    opmask_t kFpCvt = k2;
 
     reg64_t reg_src = rax;
     reg64_t reg_tr_src = rbx;
@@ -3465,9 +3804,13 @@ private:
     Vmm vmm_zero = Vmm(0);
     Vmm vmm_permw = Vmm(1);
     Vmm vmm_permd = Vmm(2);
+    // fp8 weights are not packed as int4.
+    Vmm vmm_fp_cvt_aux = Vmm(2);
     Vmm vmm_zp_b_shift = Vmm(3);
     Ymm ymm_tail_mask = ymm1;
 
+    jit_brgemm_matmul_fp_wei_cvt_t fp_cvt_;
+
     inline void kmovw(Opmask k, unsigned w) {
         if (!isa_has_masks(conf_->isa)) return;
         mov(regw_tmp, w);
@@ -3517,6 +3860,8 @@ void jit_brgemm_matmul_copy_b_f32_t<Vmm>::load_data(
             break;
         case data_type::s8: uni_vpmovsxbd(vmm, op); break;
         case data_type::u8: uni_vpmovzxbd(vmm, op); break;
+        case data_type::f8_e5m2:
+        case data_type::f8_e4m3: fp_cvt_.load_f8(vmm, op); break;
         // For int4, we see two int4 as one int8 and extend them int32
         // low half stores in lower bytes of vmm and high half in higher
         // bytes of vmm, then permute them into correct order
@@ -3530,12 +3875,14 @@ void jit_brgemm_matmul_copy_b_f32_t<Vmm>::load_data(
             vpsrad(vmm_in | kAAAA, vmm_in, 4);
             break;
         case data_type::u4:
+        case data_type::f4_e2m1:
             uni_vpmovzxbd(maybe_mask(vmm_lower, is_tail), op);
             copy_half_int4(vmm_in, vmm_lower);
             vpermd(vmm_in, vmm_permd, vmm_in);
             uni_vpslld(vmm_in | k5555, vmm_in, 28);
             vpsrld(vmm_in | k5555, vmm_in, 28);
             vpsrld(vmm_in | kAAAA, vmm_in, 4);
+            if (dt_in_ == data_type::f4_e2m1) fp_cvt_.cvt_f4(vmm_in);
             break;
         default: assert(!"unsupported data type");
     }
@@ -3549,7 +3896,9 @@ template <typename Vmm>
 void jit_brgemm_matmul_copy_b_f32_t<Vmm>::copy_16_x_n_block(
         int nrows, int ncolumns) {
     const int max_isa_regs = isa_num_vregs(conf_->isa);
-    const int reserved_regs = req_zp_b_shift_ ? 4 : is_src_int4_ ? 3 : 2;
+    const int reserved_regs = req_zp_b_shift_ ? 4
+            : is_src_int4_ || conf_->is_fp8_fp4_weights ? 3
+                                                       : 2;
     const int max_regs_available = max_isa_regs - reserved_regs;
 
     auto get_vmm = [max_regs_available, reserved_regs](int reg_idx) {
@@ -3682,6 +4031,8 @@ void jit_brgemm_matmul_copy_b_f32_t<Vmm>::generate() {
     L(done);
 
     postamble();
+
+    if (conf_->is_fp8_fp4_weights) fp_cvt_.prepare_table();
 }
 
 template struct jit_brgemm_matmul_copy_b_f32_t<Zmm>;
@@ -5102,6 +5453,9 @@ status_t create_brgemm_matmul_copy_a(
         else
             CHECK(safe_ptr_assign(copy_ker,
                     new jit_brgemm_matmul_copy_a_transposed_impl_t<Ymm>(conf)));
+    } else if (conf->with_src_dyn_quant) {
+        CHECK(safe_ptr_assign(
+                copy_ker, new jit_brgemm_matmul_copy_a_dyn_quant_t(conf)));
     } else {
         if (is_superset(conf->isa, avx512_core))
             CHECK(safe_ptr_assign(
@@ -34,6 +34,7 @@ struct jit_brgemm_matmul_copy_b_t {
         const void *zp_a_neg_value_ptr;
         const void *zp_b_value_ptr;
         const void *scales_ptr;
+        const void *wei_lut_ptr;
 
         dim_t current_K_start;
         dim_t current_K_iters;
@@ -60,6 +61,7 @@ struct jit_brgemm_matmul_copy_a_t {
         const void *zp_a_compensation_result_ptr;
         const void *zp_b_neg_value_ptr;
         const void *zp_ab_comp_ptr;
+        const void *src_scales_ptr;
 
         dim_t current_K_start;
         dim_t current_K_blk;
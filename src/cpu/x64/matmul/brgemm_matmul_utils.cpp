@@ -22,6 +22,7 @@
 #include "cpu/matmul/matmul_utils.hpp"
 #include "cpu/platform.hpp"
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
+#include "cpu/x64/jit_avx512_core_philox.hpp"
 #include "cpu/x64/matmul/amx_blocking_heuristics.hpp"
 #include "cpu/x64/matmul/brgemm_matmul_utils.hpp"
 #include "oneapi/dnnl/dnnl_debug.h"
@@ -289,14 +290,19 @@ brgemm_matmul_conf_utils_t::brgemm_matmul_conf_utils_t(
     , tf32_dt(f32_dt
               && one_of(attr.fpmath_.mode_, fpmath_mode::tf32, fpmath_mode::any)
               && isa == avx10_2_512_amx_2)
-    , weights_decompression_support(one_of(bgmmc.wei_dt, u8, s8, u4, s4)
-              && one_of(attr.fpmath_.mode_, fpmath_mode::bf16, fpmath_mode::f16,
-                      fpmath_mode::any)
-              && IMPLICATION(attr.fpmath_.mode_ == fpmath_mode::f16,
-                      bgmmc.src_dt == f16)
-              && IMPLICATION(attr.fpmath_.mode_ == fpmath_mode::bf16,
-                      bgmmc.src_dt == bf16)
-              && attr.fpmath_.apply_to_int_)
+    , weights_decompression_support(
+              (one_of(bgmmc.wei_dt, u8, s8, u4, s4)
+                      && one_of(attr.fpmath_.mode_, fpmath_mode::bf16,
+                              fpmath_mode::f16, fpmath_mode::any)
+                      && IMPLICATION(attr.fpmath_.mode_ == fpmath_mode::f16,
+                              bgmmc.src_dt == f16)
+                      && IMPLICATION(attr.fpmath_.mode_ == fpmath_mode::bf16,
+                              bgmmc.src_dt == bf16)
+                      && attr.fpmath_.apply_to_int_)
+              // fp8 and fp4 values are exact in bf16 and f16, so their
+              // decompression doesn't depend on the fpmath mode.
+              || (one_of(bgmmc.wei_dt, f8_e5m2, f8_e4m3, f4_e2m1)
+                      && one_of(bgmmc.src_dt, bf16, f16)))
     , bf16_with_int_wei_dt(weights_decompression_support && bgmmc.src_dt == bf16
               && one_of(bgmmc.dst_dt, bf16, f32))
     // Keep this var separate from f16_dt to not slip f16:f16 on avx512_core and
@@ -366,7 +372,7 @@ status_t brgemm_matmul_conf_utils_t::set_or_check_B_tag(memory_desc_t &B_md,
                 ? get_default_n_block(format_tag::undef)
                 : bgmmc.N_blk;
         bgmmc.wei_tag = blocked_B_layouts_allowed && !bgmmc.is_runtime_N
-                        && !bgmmc.is_int4_weights
+                        && !bgmmc.is_int4_weights && !bgmmc.is_fp8_fp4_weights
                 ? this->pick_blocked_B_layout(default_n_block)
                 : bgmmc.is_int4_weights && bgmmc.N % 2 != 0
                 ? transposed_tensor_layout_tag
@@ -790,7 +796,7 @@ float compute_blocking_heuristic_avx512(brgemm_matmul_conf_t &bgmmc,
                 && bm_conf_utils.check_is_transposed(bgmmc.src_tag)
                 && !bm_conf_utils.is_int8()
                 && IMPLICATION(bm_conf_utils.is_bf16(), math::is_pow2(matmul.K))
-                && matmul.K >= 2048;
+                && matmul.K >= 2048 && !bgmmc.is_ragged;
         if (bwd_w_par_k_blk) {
             start_nthr_k = nstl::min(nthr, 4);
             assert(k_blk == nstl::min(matmul.K, 512));
@@ -799,7 +805,10 @@ float compute_blocking_heuristic_avx512(brgemm_matmul_conf_t &bgmmc,
         // Enable k-partitioning for huge k and small m/n dimensions.
         bool is_huge_k = matmul.K >= 20000;
         bool is_small_mn = matmul.M <= 512 && matmul.N <= 512;
-        bool use_k_partitioning = is_huge_k && is_small_mn;
+        // The reduction over K would also go over the rows beyond the lengths
+        // of a ragged batch.
+        bool use_k_partitioning
+                = is_huge_k && is_small_mn && !bgmmc.is_ragged;
 
         // TODO: expand to other data types.
         use_k_partitioning = use_k_partitioning && bm_conf_utils.is_f32();
@@ -1185,6 +1194,11 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.wei_dt = weights_d.data_type();
     bgmmc.orig_wei_dt = weights_d.data_type();
 
+    // The source is quantized on the fly, and the rest of the configuration
+    // is the one of an int8 problem.
+    bgmmc.with_src_dyn_quant = attr.src_dyn_quant_dt_ != data_type::undef;
+    if (bgmmc.with_src_dyn_quant) bgmmc.src_dt = attr.src_dyn_quant_dt_;
+
     bgmmc.with_reduce = mmd.reduce_desc.format_kind != format_kind::undef;
     bgmmc.reduce_dt
             = bgmmc.with_reduce ? mmd.reduce_desc.data_type : data_type::undef;
@@ -1213,6 +1227,8 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.is_amx = is_superset(isa, avx512_core_amx);
     bgmmc.a_dt_sz = bgmmc.tr_a_dt_sz = types::data_type_size(bgmmc.src_dt);
     bgmmc.b_dt_sz = bgmmc.tr_b_dt_sz = types::data_type_size(bgmmc.wei_dt);
+    if (bgmmc.with_src_dyn_quant)
+        bgmmc.a_dt_sz = types::data_type_size(bgmmc.orig_src_dt);
 
     bgmmc.packed_sparse_weights = weights_d.is_sparse_packed_desc();
     if (bgmmc.packed_sparse_weights) {
@@ -1226,7 +1242,10 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.is_f32_f16 = bm_conf_utils.is_f32_f16();
     bgmmc.is_f32_bf16 = bm_conf_utils.is_f32_bf16();
     bgmmc.with_wei_decompression = bm_conf_utils.with_weights_decompression();
-    bgmmc.is_int4_weights = one_of(bgmmc.wei_dt, data_type::s4, data_type::u4);
+    bgmmc.is_int4_weights = one_of(
+            bgmmc.wei_dt, data_type::s4, data_type::u4, data_type::f4_e2m1);
+    bgmmc.is_fp8_fp4_weights = bgmmc.with_wei_decompression
+            && one_of(bgmmc.wei_dt, f8_e5m2, f8_e4m3, f4_e2m1);
 
     // Make BRGeMM compute MatMul as if it were in bfloat16, while down-convert
     // happens during copy-buffer computations
@@ -1323,12 +1342,48 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.is_runtime_M = is_runtime_value(bgmmc.M);
     bgmmc.is_runtime_N = is_runtime_value(bgmmc.N);
     bgmmc.is_runtime_K = is_runtime_value(bgmmc.K);
+    bgmmc.is_ragged = attr.ragged_batch_;
+    bgmmc.wei_lut_group = attr.weights_lut_group_;
+    bgmmc.with_wei_lut = bgmmc.wei_lut_group > 0;
 
     VCHECK_BG(bm_conf_utils.set_or_check_tags(src_md, dst_md, bias_md, helper),
             VERBOSE_UNSUPPORTED_TAG);
     VCHECK_BG(attr.set_default_formats(&dst_md), VERBOSE_UNSUPPORTED_TAG);
     VCONDCHECK_BG(post_ops_ok(bgmmc, attr, dst_d), VERBOSE_UNSUPPORTED_POSTOP);
 
+    // The dropout mask is generated for the whole destination before the
+    // computations, and is read by the brgemm kernels with the offsets of
+    // the destination.
+    bgmmc.with_dropout = !attr.dropout_.has_default_values();
+    if (bgmmc.with_dropout) {
+        const memory_desc_wrapper mask_d(attr.dropout_.dropout_desc_);
+        VCONDCHECK_BG(is_superset(bgmmc.isa, avx512_core),
+                VERBOSE_UNSUPPORTED_ISA);
+        VCONDCHECK_BG(one_of(mask_d.data_type(), u8, s8),
+                VERBOSE_UNSUPPORTED_DT_CFG);
+        VCONDCHECK_BG(!(bgmmc.is_runtime_M || bgmmc.is_runtime_N),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        VCONDCHECK_BG(!bgmmc.is_ragged, VERBOSE_UNSUPPORTED_FEATURE,
+                "dropout with ragged batch");
+        VCONDCHECK_BG(dst_d.is_dense() && dst_d.similar_to(mask_d, true, false),
+                VERBOSE_UNSUPPORTED_TAG);
+    }
+
+    // Same for the random bias of the stochastic rounding.
+    bgmmc.with_stochastic_round = attr.rounding_mode_.get(DNNL_ARG_DST)
+            == rounding_mode::stochastic;
+    if (bgmmc.with_stochastic_round) {
+        VCONDCHECK_BG(is_superset(bgmmc.isa, avx512_core),
+                VERBOSE_UNSUPPORTED_ISA);
+        VCONDCHECK_BG(one_of(bgmmc.dst_dt, bf16, f16, f8_e5m2, f8_e4m3),
+                VERBOSE_UNSUPPORTED_DT_CFG);
+        VCONDCHECK_BG(!(bgmmc.is_runtime_M || bgmmc.is_runtime_N),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        VCONDCHECK_BG(!bgmmc.is_ragged, VERBOSE_UNSUPPORTED_FEATURE,
+                "stochastic rounding with ragged batch");
+        VCONDCHECK_BG(dst_d.is_dense(), VERBOSE_UNSUPPORTED_TAG);
+    }
+
     // runtime values for M/N dimensions are only supported
     VCONDCHECK_BG((!(is_runtime_value(bgmmc.batch) || bgmmc.is_runtime_K)),
             VERBOSE_RUNTIMEDIM_UNSUPPORTED)
@@ -1377,6 +1432,24 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.transposed_B = bm_conf_utils.check_is_transposed(bgmmc.wei_tag)
             || bgmmc.wei_tag == adbc;
     bgmmc.use_buffer_b = bm_conf_utils.use_buffer_b();
+
+    // Weights are looked up by the copy routine of plain bf16 weights, which
+    // otherwise converts integer weights.
+    VCONDCHECK_BG(IMPLICATION(bgmmc.with_wei_lut,
+                          bgmmc.is_bf16_with_int_wei && bgmmc.use_buffer_b
+                                  && !bgmmc.blocked_B && !bgmmc.transposed_B),
+            VERBOSE_UNSUPPORTED_FEATURE, "weights lookup table");
+
+    // fp8 and fp4 weights are converted by the copy routines of plain
+    // weights, and the MX formats come without zero points.
+    if (bgmmc.is_fp8_fp4_weights) {
+        VCONDCHECK_BG(is_superset(bgmmc.isa, avx512_core) && bgmmc.use_buffer_b
+                        && !bgmmc.blocked_B && !bgmmc.transposed_B,
+                VERBOSE_UNSUPPORTED_FEATURE, "fp8 and fp4 weights layout");
+        VCONDCHECK_BG(bgmmc.wei_zp_type == brgemm_broadcast_t::none,
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+    }
+
     bgmmc.req_transpose_scales = bgmmc.apply_scales_in_buffer_b
             && bgmmc.is_oscale_per_k && bgmmc.is_oscale_per_n
             && bgmmc.transposed_B;
@@ -1406,12 +1479,36 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
                     bm_conf_utils.check_is_plain(bgmmc.src_tag));
     bgmmc.transposed_A = ((transposed_A && !bgmmc.treat_A_as_plain)
             || bgmmc.src_tag == adbc);
+
+    // Dynamic quantization of the source is done by the copy routine of a
+    // plain A, which reads whole rows of f32 or bf16 values.
+    if (bgmmc.with_src_dyn_quant) {
+        VCONDCHECK_BG(one_of(bgmmc.orig_src_dt, f32, bf16)
+                        && bgmmc.orig_wei_dt == s8
+                        && !bgmmc.with_wei_decompression,
+                VERBOSE_UNSUPPORTED_DT_CFG);
+        VCONDCHECK_BG(is_superset(bgmmc.isa, avx512_core),
+                VERBOSE_UNSUPPORTED_ISA);
+        VCONDCHECK_BG(!(bgmmc.is_runtime_M || bgmmc.is_runtime_N),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        VCONDCHECK_BG(!bgmmc.with_reduce, VERBOSE_UNSUPPORTED_FEATURE,
+                "reduction with dynamic quantization");
+        VCONDCHECK_BG(everyone_is(brgemm_broadcast_t::none,
+                              bgmmc.src_zp_type, bgmmc.wei_zp_type,
+                              bgmmc.dst_zp_type),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+        VCONDCHECK_BG(!bgmmc.transposed_A
+                        && (bm_conf_utils.check_is_plain(bgmmc.src_tag)
+                                || bgmmc.treat_A_as_plain),
+                VERBOSE_UNSUPPORTED_TAG);
+    }
     // For batched problems with plain A and C and fully broadcasted across B
     // we can merge all the batch dimensions into M if broadcast strategies
-    // set is limited for binary post-ops
+    // set is limited for binary post-ops. Ragged batches keep the batch
+    // dimensions as the valid rows are defined per batch entry.
     const bool plain_A_layout = bm_conf_utils.check_is_plain(bgmmc.src_tag)
             || bgmmc.treat_A_as_plain;
-    const bool merge_batch_dims_into_M = bgmmc.batch > 1
+    const bool merge_batch_dims_into_M = bgmmc.batch > 1 && !bgmmc.is_ragged
             && bgmmc.bcast_B_desc.bcast_across_all_batch_dims && plain_A_layout
             && helper.is_src_dst_layout_batch_fusable()
             && post_ops_ok(
@@ -1484,7 +1581,7 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
                     && isa == avx512_core_fp16)
             || (bgmmc.wei_zp_type != brgemm_broadcast_t::none
                     && !bm_conf_utils.with_weights_decompression())
-            || bgmmc.transposed_A;
+            || bgmmc.transposed_A || bgmmc.with_src_dyn_quant;
 
     bgmmc.use_buffer_a = is_copy_a_required;
 
@@ -1531,6 +1628,11 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     VCHECK_BG(compute_blocking_heuristic(bgmmc, bm_conf_utils),
             VERBOSE_BLOCKING_FAIL, "");
 
+    // The scales of the rows are computed with the first block of K, and are
+    // applied to the whole reduction.
+    VCONDCHECK_BG(IMPLICATION(bgmmc.with_src_dyn_quant, bgmmc.nthr_k == 1),
+            VERBOSE_BLOCKING_FAIL, "");
+
     if (bgmmc.wei_n_blk > bgmmc.N_blk
             && IMPLICATION(
                     bgmmc.N == bgmmc.N_blk, bgmmc.N >= bgmmc.wei_n_blk)) {
@@ -1579,6 +1681,12 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     // Sets things related to chunks and others
     init_aux_values(bgmmc, src_d, weights_d, dst_d);
 
+    // The reduction of partial results computed by several threads would also
+    // go over the rows beyond the lengths of a ragged batch.
+    VCONDCHECK_BG(IMPLICATION(bgmmc.is_ragged,
+                          bgmmc.nthr_k == 1 || bgmmc.K_chunks == 1),
+            VERBOSE_UNSUPPORTED_FEATURE, "parallel reduction with ragged batch");
+
     bgmmc.use_buffer_reduce
             = (bgmmc.reduce_dt != data_type::f32) || (bgmmc.nthr_k > 1);
 
@@ -1746,6 +1854,10 @@ status_t init_conf(brgemm_matmul_conf_t &conf, dim_t batch, dim_t M, dim_t K,
 void init_aux_values(brgemm_matmul_conf_t &bgmmc,
         const memory_desc_wrapper &src_d, const memory_desc_wrapper &wei_d,
         const memory_desc_wrapper &dst_d) {
+    // The work of a ragged batch is balanced over the M chunks holding valid
+    // rows, so a chunk spans a single block to compute as few rows beyond the
+    // lengths as possible.
+    if (bgmmc.is_ragged) bgmmc.M_chunk_size = 1;
     bgmmc.M_chunk_elems = bgmmc.M_blk * bgmmc.M_chunk_size;
     bgmmc.N_chunk_elems = bgmmc.N_blk * bgmmc.N_chunk_size;
     bgmmc.K_chunk_elems
@@ -1905,7 +2017,8 @@ void init_aux_values(brgemm_matmul_conf_t &bgmmc,
             bgmmc.with_eltwise, bgmmc.with_binary, bgmmc.acc_dt != bgmmc.dst_dt,
             bgmmc.s8s8_compensation_required, bgmmc.has_zero_point_a,
             bgmmc.has_zero_point_b, bgmmc.has_zero_point_c,
-            bgmmc.with_dst_scales);
+            bgmmc.with_dst_scales, bgmmc.with_src_dyn_quant,
+            bgmmc.with_dropout, bgmmc.with_stochastic_round);
 
     bgmmc.zp_a_comp_shift_n = bgmmc.wei_n_blk;
     bgmmc.zp_a_comp_elems_per_thr
@@ -1968,10 +2081,26 @@ void init_scratchpad(memory_tracking::registrar_t &scratchpad,
                 bgmmc.nthr * bgmmc.zp_b_comp_elems_per_thr,
                 types::data_type_size(s32));
 
+    if (bgmmc.with_src_dyn_quant)
+        scratchpad.book(key_brgemm_primitive_src_scales,
+                static_cast<size_t>(bgmmc.nthr) * bgmmc.M_chunk_size
+                        * bgmmc.M_blk,
+                sizeof(float));
+
     if (is_superset(bgmmc.isa, avx512_core_amx))
         scratchpad.book(key_conv_amx_tile_buffer,
                 static_cast<size_t>(bgmmc.nthr) * bgmmc.wsp_tile_per_thr_bytes,
                 default_data_align);
+    if (bgmmc.with_wei_lut)
+        scratchpad.book(key_matmul_wei_lut, bgmmc.K * wei_lut_size,
+                sizeof(float));
+    if (bgmmc.with_stochastic_round) {
+        const dim_t rnd_bias_size = bgmmc.batch * bgmmc.M * bgmmc.N
+                * jit_avx512_core_philox_t::rnd_bias_size(bgmmc.dst_dt);
+        scratchpad.book(key_matmul_rnd_bias,
+                rnd_up(rnd_bias_size, jit_avx512_core_philox_t::bytes_per_vec),
+                sizeof(uint8_t), 64);
+    }
     if (bgmmc.is_runtime_M || bgmmc.is_runtime_N)
         scratchpad.book(key_brgemm_primitive_buffer_d,
                 bgmmc.M_blk * bgmmc.N_blk * bgmmc.c_dt_sz * bgmmc.nthr,
@@ -32,6 +32,8 @@ namespace x64 {
 namespace matmul {
 
 constexpr int max_batch_ndims = DNNL_MAX_NDIMS - 2;
+// Number of values of a lookup table of 4-bit weights.
+constexpr int wei_lut_size = 16;
 
 struct brgemm_matmul_bcast_desc_t {
 
@@ -215,12 +217,29 @@ struct brgemm_matmul_conf_t {
     bool is_f16_with_int_wei = false;
     bool is_f32_f16 = false;
     bool is_f32_bf16 = false;
+    // 4-bit weights, including f4_e2m1, packed two values per byte.
     bool is_int4_weights = false;
+    // f8_e5m2, f8_e4m3 or f4_e2m1 weights (MX formats) converted by the copy
+    // routine as a part of weights decompression.
+    bool is_fp8_fp4_weights = false;
     bool is_tf32 = false;
     bool req_wei_vnni_downconvert = false;
     bool is_runtime_M = false;
     bool is_runtime_N = false;
     bool is_runtime_K = false;
+    bool is_ragged = false;
+    // 4-bit weights are indices into tables of wei_lut_size values, one per
+    // wei_lut_group rows.
+    bool with_wei_lut = false;
+    dim_t wei_lut_group = 0;
+    // f32/bf16 source is quantized to src_dt by the copy of A, which also
+    // computes a scale per row.
+    bool with_src_dyn_quant = false;
+    // Accumulators are dropped by a mask generated before the computations.
+    bool with_dropout = false;
+    // Destination is rounded stochastically with random bias bytes generated
+    // before the computations.
+    bool with_stochastic_round = false;
     bool is_src_batch_layout_trivial = false;
     bool is_wei_batch_layout_trivial = false;
     bool is_dst_batch_layout_trivial = false;
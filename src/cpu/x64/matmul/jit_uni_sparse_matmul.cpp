@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <cassert>
 
 #include "common/c_types_map.hpp"
@@ -23,6 +24,8 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/ref_io_helper.hpp"
+
 #include "cpu/x64/jit_generator.hpp"
 
 #include "cpu/x64/matmul/jit_uni_sparse_matmul.hpp"
@@ -41,7 +44,8 @@ struct sparse_matmul_kernel_t : public jit_generator_t {
 
     struct call_params_t {
         const int32_t *src_indices;
-        const float *src_values, *wei, *dst;
+        const void *src_values, *wei;
+        const float *dst;
         size_t block_size;
         size_t nnz;
     };
@@ -52,7 +56,9 @@ struct sparse_matmul_kernel_t : public jit_generator_t {
         , vlen_(vlen)
         , simd_w_(vlen_ / data_type_size())
         , tail_block_size_(N() % block_size())
-        , tail_size_(tail_block_size() % simd_w()) {}
+        , tail_size_(tail_block_size() % simd_w())
+        , src_dt_(pd->src_md()->data_type)
+        , wei_dt_(pd->weights_md()->data_type) {}
 
     ~sparse_matmul_kernel_t() override = default;
 
@@ -65,8 +71,15 @@ struct sparse_matmul_kernel_t : public jit_generator_t {
     size_t tail_block_size() const { return tail_block_size_; }
     size_t tail_size() const { return tail_size_; }
 
+    // Size of the accumulators and of the rows written by the kernel.
     int data_type_size() const { return sizeof(float); }
     int index_type_size() const { return sizeof(int32_t); }
+    int src_data_type_size() const {
+        return (int)types::data_type_size(src_dt_);
+    }
+    int wei_data_type_size() const {
+        return (int)types::data_type_size(wei_dt_);
+    }
 
     int block_size() const { return vlen(); }
 
@@ -80,6 +93,8 @@ protected:
     size_t simd_w_;
     size_t tail_block_size_;
     size_t tail_size_;
+    data_type_t src_dt_;
+    data_type_t wei_dt_;
 };
 
 template <cpu_isa_t isa>
@@ -128,11 +143,12 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
 
     Address wei_ptr(size_t offt = 0) {
         if (N() == 1)
-            return ptr[reg_wei + reg_src_col_idx * data_type_size() + offt];
+            return ptr[reg_wei + reg_src_col_idx * wei_data_type_size()
+                    + offt];
 
         imul(reg_tmp, reg_src_col_idx, N());
         add(reg_tmp, reg_block_offset);
-        return ptr[reg_wei + reg_tmp * data_type_size() + offt];
+        return ptr[reg_wei + reg_tmp * wei_data_type_size() + offt];
     }
 
     Address dst_ptr(size_t offt = 0) {
@@ -140,7 +156,8 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
     }
 
     Address src_values_ptr(size_t offt = 0) {
-        return ptr[reg_src_values + reg_nnz_count * data_type_size() + offt];
+        return ptr[reg_src_values + reg_nnz_count * src_data_type_size()
+                + offt];
     }
 
     Address src_indices_ptr(size_t offt = 0) {
@@ -166,6 +183,57 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
 
     void prepare_tail_mask();
 
+    // Loads a vector of weights converted to f32.
+    void load_wei(const Vmm &vmm, const Address &addr, bool is_tail) {
+        using namespace data_type;
+        if (wei_dt_ == f32) {
+            if (is_tail)
+                load_tail(vmm, addr);
+            else
+                uni_vmovups(vmm, addr);
+            return;
+        }
+
+        // Other data types are supported only with avx512_core.
+        assert(isa == avx512_core);
+        const Vmm vmm_load = is_tail ? vmm | tail_opmask | T_z : vmm;
+        switch (wei_dt_) {
+            case bf16:
+                vpmovzxwd(vmm_load, addr);
+                vpslld(vmm, vmm, 16);
+                break;
+            case s8:
+                vpmovsxbd(vmm_load, addr);
+                vcvtdq2ps(vmm, vmm);
+                break;
+            default: assert(!"unsupported data type");
+        }
+    }
+
+    // Broadcasts a source value converted to f32. A broadcast word or byte
+    // fills every dword, so the conversion only needs shifts.
+    void broadcast_src(const Vmm &vmm, const Address &addr) {
+        using namespace data_type;
+        switch (src_dt_) {
+            case f32: uni_vbroadcastss(vmm, addr); break;
+            case bf16:
+                vpbroadcastw(vmm, addr);
+                vpslld(vmm, vmm, 16);
+                break;
+            case s8:
+            case u8:
+                vpbroadcastb(vmm, addr);
+                vpslld(vmm, vmm, 24);
+                if (src_dt_ == s8)
+                    vpsrad(vmm, vmm, 24);
+                else
+                    vpsrld(vmm, vmm, 24);
+                vcvtdq2ps(vmm, vmm);
+                break;
+            default: assert(!"unsupported data type");
+        }
+    }
+
     Vmm get_dst_reg(int index) const {
         // Vmm(0) is reserved for mask.
         return Vmm(index + 1);
@@ -187,11 +255,11 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
         for (int i_load = 0; i_load < nloads; i_load++) {
             Vmm vreg_tmp_wei = get_wei_reg(i_load, is_tail_block);
             // Load a row of weights.
-            if (is_tail_block && tail_size() > 0 && i_load == nloads - 1) {
-                load_tail(vreg_tmp_wei, wei_ptr(vlen() * i_load));
-            } else {
-                uni_vmovups(vreg_tmp_wei, wei_ptr(vlen() * i_load));
-            }
+            const bool is_tail
+                    = is_tail_block && tail_size() > 0 && i_load == nloads - 1;
+            load_wei(vreg_tmp_wei,
+                    wei_ptr(simd_w() * wei_data_type_size() * i_load),
+                    is_tail);
             // Multiply the broadcasted value with the row of weights
             // and accumulate result in dst.
             Vmm vreg_tmp_dst = get_dst_reg(i_load);
@@ -209,8 +277,8 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
 
             for (int uf = 0; uf < unroll_factor; uf++) {
                 // Load src values to broadcast.
-                uni_vbroadcastss(
-                        vreg_src_val, src_values_ptr(uf * data_type_size()));
+                broadcast_src(vreg_src_val,
+                        src_values_ptr(uf * src_data_type_size()));
                 // Load an index.
                 movsxd(reg_src_col_idx,
                         src_indices_ptr(uf * index_type_size()));
@@ -229,7 +297,7 @@ struct jit_uni_sparse_matmul_kernel_t : public sparse_matmul_kernel_t {
         jz(skip_row_tail, T_NEAR);
 
         // Load src values to broadcast.
-        uni_vbroadcastss(vreg_src_val, src_values_ptr());
+        broadcast_src(vreg_src_val, src_values_ptr());
         // Load an index.
         movsxd(reg_src_col_idx, src_indices_ptr());
         loop_within_block_row(vreg_src_val, reg_src_col_idx, is_tail_block);
@@ -338,6 +406,11 @@ status_t jit_uni_sparse_matmul_t::init(engine_t *engine) {
     if (!kernel_) return status::runtime_error;
 
     CHECK(kernel_->create_kernel());
+
+    ref_post_ops_
+            = utils::make_unique<ref_post_ops_t>(pd()->attr()->post_ops_);
+    if (!ref_post_ops_) return status::out_of_memory;
+    CHECK(ref_post_ops_->init(pd()->dst_md()));
     return status::success;
 }
 
@@ -345,14 +418,41 @@ jit_uni_sparse_matmul_t::jit_uni_sparse_matmul_t(const pd_t *apd)
     : primitive_t(apd) {}
 jit_uni_sparse_matmul_t::~jit_uni_sparse_matmul_t() = default;
 
+namespace {
+// Splits the rows between the threads so that every thread gets about the
+// same number of non-zero entries rather than the same number of rows. An
+// empty row still costs a row of the destination, so a row is weighted by
+// its number of non-zero entries plus one.
+void balance_rows_by_nnz(const int32_t *pointers, dim_t M, int nthr, int ithr,
+        dim_t &start, dim_t &end) {
+    auto cost = [&](dim_t m) { return pointers[m] - pointers[0] + m; };
+    // The first row with the cost of the preceding rows of at least `work`.
+    auto find_row = [&](dim_t work) {
+        dim_t lo = 0, hi = M;
+        while (lo < hi) {
+            const dim_t mid = (lo + hi) / 2;
+            if (cost(mid) < work)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo;
+    };
+    const dim_t total = cost(M);
+    start = find_row(total * ithr / nthr);
+    end = find_row(total * (ithr + 1) / nthr);
+}
+} // namespace
+
 status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
-    const auto *weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
-    const auto *src_values = CTX_IN_MEM(const float *, DNNL_ARG_SRC, 0);
-    const auto *src_indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
-    const auto *src_pointers = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 2);
+    using namespace memory_tracking::names;
+    const auto *weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    const auto *src_values = CTX_IN_MEM(const char *, DNNL_ARG_SRC, 0);
+    const auto *src_buffer_1 = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
+    const auto *src_buffer_2 = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 2);
 
     status_t status = status::success;
-    auto dst = CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DST, status);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
     CHECK(status);
 
     const memory_desc_wrapper src_d(pd()->src_md());
@@ -360,10 +460,34 @@ status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
 
     const dim_t M = dst_d.dims()[0];
     const dim_t N = dst_d.dims()[1];
+    const dim_t src_dsz = src_d.data_type_size();
+    const auto dst_dt = dst_d.data_type();
+    const bool use_row_buffer = pd()->use_row_buffer();
+    const bool with_post_ops = !pd()->attr()->post_ops_.has_default_values();
+    const auto sum_dt = pd()->attr()->post_ops_.get_sum_dt(dst_dt);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+
+    const int32_t *src_indices = src_buffer_1;
+    const int32_t *src_pointers = src_buffer_2;
+    if (src_d.encoding() == sparse_encoding::coo) {
+        // The row indices of the sorted COO encoding are compressed into CSR
+        // pointers, and the column indices are used as is.
+        auto pointers
+                = scratchpad.template get<int32_t>(key_matmul_sparse_tmp_ptr);
+        const int32_t *row_indices = src_buffer_1;
+        const dim_t nnz = src_d.nnz();
+        parallel_nd(M + 1, [&](dim_t m) {
+            pointers[m] = (int32_t)(std::lower_bound(row_indices,
+                                            row_indices + nnz, (int32_t)m)
+                    - row_indices);
+        });
+        src_indices = src_buffer_2;
+        src_pointers = pointers;
+    }
+    auto row_buffer_base
+            = scratchpad.template get<float>(key_matmul_dst_in_acc_dt);
 
-    // TODO: Implement a load balancing mechanism that would distribute
-    // rows between threads based on the number of non-zero elements in those
-    // rows.
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
     // Empirical.
     const size_t threshold_in_kb = 1400;
@@ -372,12 +496,18 @@ status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
 
     // If not, use 0, which means all threads.
     const int nthr = data_to_process_in_kb < threshold_in_kb;
+#else
+    const int nthr = pd()->nthr_;
+#endif
 
     parallel(nthr, [&](const int ithr, const int nthr) {
         dim_t start = 0, end = 0;
-        balance211(M, nthr, ithr, start, end);
+        balance_rows_by_nnz(src_pointers, M, nthr, ithr, start, end);
         if (start >= end) return;
 
+        float *row_buffer
+                = use_row_buffer ? row_buffer_base + ithr * N : nullptr;
+
         for (dim_t m = start; m < end; m++) {
             const int row_begin = src_pointers[m];
             const int row_end = src_pointers[m + 1];
@@ -385,31 +515,30 @@ status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
 
             sparse_matmul_kernel_t::call_params_t p;
             p.nnz = nnz;
-            p.src_values = src_values + row_begin;
+            p.src_values = src_values + row_begin * src_dsz;
             p.src_indices = src_indices + row_begin;
             p.wei = weights;
-            p.dst = dst + (m * N);
+            p.dst = use_row_buffer ? row_buffer
+                                   : static_cast<float *>(dst) + m * N;
             p.block_size = kernel_->block_size();
             (*kernel_)(&p);
+
+            if (!use_row_buffer) continue;
+            for (dim_t n = 0; n < N; n++) {
+                float d = row_buffer[n];
+                if (with_post_ops) {
+                    ref_post_ops_t::args_t args;
+                    args.dst_val = io::load_float_value(sum_dt, dst, m * N + n);
+                    args.ctx = &ctx;
+                    args.l_offset = m * N + n;
+                    args.dst_md = pd()->dst_md();
+                    ref_post_ops_->execute(d, args);
+                }
+                io::store_float_value(dst_dt, d, dst, m * N + n);
+            }
         }
     });
-#else
 
-    parallel_nd(M, [&](dim_t m) {
-        const int row_begin = src_pointers[m];
-        const int row_end = src_pointers[m + 1];
-        const int nnz = row_end - row_begin;
-
-        sparse_matmul_kernel_t::call_params_t p;
-        p.nnz = nnz;
-        p.src_values = src_values + row_begin;
-        p.src_indices = src_indices + row_begin;
-        p.wei = weights;
-        p.dst = dst + (m * N);
-        p.block_size = kernel_->block_size();
-        (*kernel_)(&p);
-    });
-#endif
     return status::success;
 }
 
@@ -18,6 +18,8 @@
 #define CPU_X64_MATMUL_JIT_UNI_SPARSE_MATMUL_HPP
 
 #include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
 #include "common/primitive.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
@@ -43,6 +45,7 @@ struct jit_uni_sparse_matmul_t : public primitive_t {
 
         status_t init(engine_t *engine) {
             using namespace data_type;
+            using smask_t = primitive_attr_t::skip_mask_t;
             const auto src_type = src_md(0)->data_type;
             const auto wei_type = weights_md(0)->data_type;
             const auto dst_type = dst_md(0)->data_type;
@@ -50,20 +53,52 @@ struct jit_uni_sparse_matmul_t : public primitive_t {
             memory_desc_wrapper src_d(src_md());
             memory_desc_wrapper wei_d(weights_md(0));
 
-            const bool problem_dt_correct
-                    = utils::everyone_is(f32, src_type, wei_type, dst_type)
-                    && src_d.is_sparse_desc() && !wei_d.is_sparse_desc()
-                    && utils::everyone_is(s32, src_d.metadata_type(0),
-                            src_d.metadata_type(1));
+            VDISPATCH_MATMUL(
+                    src_d.is_sparse_desc() && !wei_d.is_sparse_desc(),
+                    VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            VDISPATCH_MATMUL(utils::one_of(src_d.encoding(),
+                                     sparse_encoding::csr,
+                                     sparse_encoding::coo),
+                    VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            VDISPATCH_MATMUL(src_d.metadata_type(0) == s32
+                            && IMPLICATION(
+                                    src_d.encoding() == sparse_encoding::csr,
+                                    src_d.metadata_type(1) == s32),
+                    VERBOSE_UNSUPPORTED_SPARSE_CFG);
+
+            // bf16 and int8 values are accumulated in f32.
+            const bool is_f32 = utils::everyone_is(f32, src_type, wei_type);
+            const bool is_bf16 = utils::everyone_is(bf16, src_type, wei_type);
+            const bool is_int8
+                    = utils::one_of(src_type, u8, s8) && wei_type == s8;
+            const bool problem_dt_correct = (is_f32 && dst_type == f32)
+                    || ((is_bf16 || is_int8)
+                            && utils::one_of(dst_type, f32, bf16));
 
             VDISPATCH_MATMUL(problem_dt_correct, VERBOSE_UNSUPPORTED_DT_CFG);
             VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+            VDISPATCH_MATMUL(attr()->has_default_values(
+                                     smask_t::post_ops | smask_t::sum_dt,
+                                     dst_type),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_MATMUL(attr_.post_ops_.check_sum_consistency(dst_type,
+                                     /* is_int8 */ false),
+                    VERBOSE_UNSUPPORTED_POSTOP);
             VDISPATCH_MATMUL(
-                    attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
-            VDISPATCH_MATMUL(mayiuse(avx2), VERBOSE_UNSUPPORTED_ISA);
+                    ref_post_ops_t::primitive_kind_ok(attr()->post_ops_),
+                    VERBOSE_UNSUPPORTED_POSTOP);
+            // Conversions of the values use masked loads.
+            VDISPATCH_MATMUL(mayiuse(is_f32 ? avx2 : avx512_core),
+                    VERBOSE_UNSUPPORTED_ISA);
             VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_MATMUL(
+                    attr_.set_default_formats(dst_md(0)) == status::success,
+                    VERBOSE_UNSUPPORTED_POSTOP);
             VDISPATCH_MATMUL(formats_ok(), VERBOSE_UNSUPPORTED_TAG);
 
+            nthr_ = dnnl_get_max_threads();
+            init_scratchpad();
+
             return status::success;
         }
 
@@ -75,6 +110,28 @@ struct jit_uni_sparse_matmul_t : public primitive_t {
                                            .matches_one_of_tag(format_tag::ab);
             return is_dst_ab && is_wei_ab;
         }
+
+        // The kernel accumulates a row of the destination in f32. Rows are
+        // passed through a buffer when they need a conversion or post-ops.
+        bool use_row_buffer() const {
+            return dst_md()->data_type != data_type::f32
+                    || !attr()->post_ops_.has_default_values();
+        }
+
+        int nthr_ = 0;
+
+    private:
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            auto scratchpad = scratchpad_registry().registrar();
+            if (memory_desc_wrapper(src_md()).encoding()
+                    == sparse_encoding::coo)
+                scratchpad.template book<int32_t>(
+                        key_matmul_sparse_tmp_ptr, M() + 1);
+            if (use_row_buffer())
+                scratchpad.template book<float>(
+                        key_matmul_dst_in_acc_dt, nthr_ * N());
+        }
     };
 
     jit_uni_sparse_matmul_t(const pd_t *apd);
@@ -86,6 +143,7 @@ struct jit_uni_sparse_matmul_t : public primitive_t {
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     std::unique_ptr<sparse_matmul_kernel_t> kernel_;
+    std::unique_ptr<ref_post_ops_t> ref_post_ops_;
 };
 
 } // namespace matmul
@@ -0,0 +1,397 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <math.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/amx_tile_configure.hpp"
+#include "cpu/x64/sdpa/brgemm_sdpa.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+status_t brgemm_sdpa_t::pd_t::init(engine_t *engine) {
+    CHECK(init_common(engine));
+
+    // The kernels compute in the data type of the queries. AMX is used only
+    // when the head size fills whole tiles.
+    dt_ = qry_md()->data_type;
+    const bool use_amx = desc()->head_size() % 32 == 0;
+    switch (dt_) {
+        case f32: isa_ = mayiuse(avx512_core) ? avx512_core : avx2; break;
+        case bf16:
+            isa_ = use_amx && mayiuse(avx512_core_amx) ? avx512_core_amx
+                                                       : avx512_core_bf16;
+            break;
+        case f16:
+            isa_ = use_amx && mayiuse(avx512_core_amx_fp16)
+                    ? avx512_core_amx_fp16
+                    : avx512_core_fp16;
+            break;
+        default: isa_ = isa_undef;
+    }
+    VDISPATCH_SDPA(
+            isa_ != isa_undef && mayiuse(isa_), VERBOSE_UNSUPPORTED_ISA);
+
+    // Queries are passed to the kernels in place.
+    const memory_desc_wrapper qry_d(qry_md());
+    VDISPATCH_SDPA(qry_d.blocking_desc().strides[3] == 1
+                    || desc()->head_size() == 1,
+            VERBOSE_UNSUPPORTED_TAG);
+
+    nthr_ = dnnl_get_max_threads();
+    CHECK(init_brgemm(engine));
+    init_scratchpad();
+
+    return status::success;
+}
+
+status_t brgemm_sdpa_t::pd_t::init_brgemm(engine_t *engine) {
+    const dim_t Q = desc()->queries(), K = desc()->keys();
+    const dim_t D = desc()->head_size(), DV = desc()->values();
+    const bool is_amx = is_superset(isa_, avx512_core_amx);
+
+    m_blk_ = nstl::min<dim_t>(Q, 32);
+    nb_m_ = div_up(Q, m_blk_);
+    k_blk_ = nstl::min<dim_t>(rnd_up(K, 32), 64);
+    ldv_ = rnd_up(DV, 16);
+    const dim_t lda = memory_desc_wrapper(qry_md()).blocking_desc().strides[2];
+
+    brgs_.resize(num_brg_kernels);
+    for_(bool is_values : {false, true})
+    for (bool is_m_tail : {false, true}) {
+        const dim_t M = is_m_tail ? Q % m_blk_ : m_blk_;
+        if (M == 0) continue;
+
+        // Scores are computed from scratch for each block of keys while
+        // values are accumulated over all of them.
+        auto &brg = brgs_[brg_idx(is_values, is_m_tail)];
+        if (is_values) {
+            CHECK(brgemm_desc_init(&brg, isa_, brgemm_addr, dt_, dt_,
+                    /* transA = */ false, /* transB = */ false,
+                    brgemm_row_major, /* alpha = */ 1.f, /* beta = */ 1.f,
+                    k_blk_, ldv_, DV, M, DV, k_blk_));
+        } else {
+            CHECK(brgemm_desc_init(&brg, isa_, brgemm_addr, dt_, dt_,
+                    /* transA = */ false, /* transB = */ false,
+                    brgemm_row_major, /* alpha = */ 1.f, /* beta = */ 0.f,
+                    lda, k_blk_, k_blk_, M, k_blk_, D));
+        }
+
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = 1;
+        if (is_amx) {
+            brgattr.use_uker = true;
+            brgattr.use_interleave_stores = true;
+        }
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+        CHECK(brgemm_desc_finalize(&brg));
+        wsp_size_ = nstl::max(wsp_size_, (size_t)brg.get_wsp_buffer_size());
+    }
+
+    const bool is_vnni = brgemm_desc_t::is_b_data_layout_vnni(
+            dt_, dt_, /* attr_b_is_vnni = */ false, brgs_[0].isa_impl);
+    vnni_ = is_vnni ? (dim_t)data_type_vnni_granularity(dt_) : 1;
+    VDISPATCH_SDPA(D % vnni_ == 0, VERBOSE_SHAPE_RESTRICTION);
+
+    return status::success;
+}
+
+void brgemm_sdpa_t::pd_t::init_scratchpad() {
+    const dim_t D = desc()->head_size(), DV = desc()->values();
+    const size_t dt_size = types::data_type_size(dt_);
+
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.book(key_sdpa_keys_packed, nthr_ * D * k_blk_, dt_size);
+    scratchpad.book(key_sdpa_values_packed, nthr_ * k_blk_ * ldv_, dt_size);
+    scratchpad.book(key_sdpa_probs, nthr_ * m_blk_ * k_blk_, dt_size);
+    scratchpad.template book<float>(key_sdpa_scores, nthr_ * m_blk_ * k_blk_);
+    scratchpad.template book<float>(key_sdpa_acc, nthr_ * m_blk_ * DV);
+    scratchpad.template book<float>(key_sdpa_row_stats, nthr_ * 2 * m_blk_);
+    if (wsp_size_ > 0)
+        scratchpad.book(key_sdpa_amx_wsp, nthr_ * wsp_size_, sizeof(char));
+}
+
+status_t brgemm_sdpa_t::init(engine_t *engine) {
+    const auto &brgs = pd()->brgs_;
+    brg_kernels_.resize(brgs.size());
+
+    for (size_t idx = 0; idx < brgs.size(); idx++) {
+        const auto &brg = brgs[idx];
+        if (brg.bcast_dim == 0) continue;
+
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, brg));
+        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+        if (is_superset(brg.isa_impl, avx512_core_amx))
+            brgemm_palettes_.insert((int)idx, brg);
+    }
+
+    return status::success;
+}
+
+status_t brgemm_sdpa_t::execute(const exec_ctx_t &ctx) const {
+    switch (pd()->dt_) {
+        case f32: return execute_forward<float>(ctx);
+        case bf16: return execute_forward<bfloat16_t>(ctx);
+        case f16: return execute_forward<float16_t>(ctx);
+        default: assert(!"unsupported data type");
+    }
+    return status::runtime_error;
+}
+
+template <typename data_t>
+status_t brgemm_sdpa_t::execute_forward(const exec_ctx_t &ctx) const {
+    auto qry = CTX_IN_MEM(const data_t *, DNNL_ARG_QUERIES);
+    auto key = CTX_IN_MEM(const void *, DNNL_ARG_KEYS);
+    auto val = CTX_IN_MEM(const void *, DNNL_ARG_VALUES);
+    auto msk = CTX_IN_MEM(const void *, DNNL_ARG_ATTN_MASK);
+    auto scale = CTX_IN_MEM(const void *, DNNL_ARG_SCALE);
+    auto key_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_KEYS);
+    auto key_zp = CTX_IN_MEM(
+            const void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_KEYS);
+    auto val_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_VALUES);
+    auto val_zp = CTX_IN_MEM(
+            const void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_VALUES);
+    auto blk = CTX_IN_MEM(const void *, DNNL_ARG_KV_BLOCK_TABLE);
+    auto ragged_lengths
+            = CTX_IN_MEM(const int32_t *, DNNL_ARG_ATTR_RAGGED_LENGTHS);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+
+    const auto *d = pd()->desc();
+    const sdpa_loader_t qry_d(*pd()->qry_md(), qry);
+    sdpa_loader_t load_key(*pd()->key_md(), key, d->kq_scales, key_scales,
+            d->kq_zero_points, key_zp);
+    sdpa_loader_t load_val(*pd()->val_md(), val, d->vs_scales, val_scales,
+            d->vs_zero_points, val_zp);
+    load_key.set_block_table(*pd()->kv_block_table_md(), blk, 3);
+    load_val.set_block_table(*pd()->kv_block_table_md(), blk, 2);
+    const sdpa_loader_t load_msk(*pd()->attn_mask_md(), msk);
+    const sdpa_loader_t dst_d(*pd()->dst_md(), dst);
+
+    float attn_scale = 1.f;
+    if (pd()->with_attn_scale()) {
+        attn_scale = io::load_float_value(d->scale_dt, scale, 0);
+        if (d->invert_scale) attn_scale = 1.f / attn_scale;
+    }
+    const bool with_mask = pd()->with_attn_mask();
+    const bool inf_as_zero
+            = d->softmax_alg == alg_kind::softmax_accurate_inf_as_zero;
+    const auto dst_dt = pd()->dst_md()->data_type;
+
+    const dim_t MB = pd()->MB(), H = pd()->H();
+    const dim_t Q = d->queries(), D = d->head_size(), DV = d->values();
+    const dim_t m_blk = pd()->m_blk_, nb_m = pd()->nb_m_;
+    const dim_t k_blk = pd()->k_blk_, ldv = pd()->ldv_, vnni = pd()->vnni_;
+    const size_t wsp_size = pd()->wsp_size_;
+    const bool is_amx = is_superset(pd()->isa_, avx512_core_amx);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    auto k_packed_base = scratchpad.template get<data_t>(key_sdpa_keys_packed);
+    auto v_packed_base
+            = scratchpad.template get<data_t>(key_sdpa_values_packed);
+    auto probs_base = scratchpad.template get<data_t>(key_sdpa_probs);
+    auto scores_base = scratchpad.template get<float>(key_sdpa_scores);
+    auto acc_base = scratchpad.template get<float>(key_sdpa_acc);
+    auto stats_base = scratchpad.template get<float>(key_sdpa_row_stats);
+    auto wsp_base = scratchpad.template get<char>(key_sdpa_amx_wsp);
+
+    // A ragged batch only distributes the blocks holding valid queries
+    // between threads.
+    auto get_nb_m = [&](dim_t mb) -> dim_t {
+        return ragged_lengths
+                ? div_up(pd()->valid_queries(ragged_lengths, mb), m_blk)
+                : nb_m;
+    };
+    dim_t work_amount = 0;
+    for (dim_t mb = 0; mb < MB; mb++)
+        work_amount += H * get_nb_m(mb);
+
+    parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        data_t *k_packed = k_packed_base + ithr * D * k_blk;
+        data_t *v_packed = v_packed_base + ithr * k_blk * ldv;
+        data_t *probs = probs_base + ithr * m_blk * k_blk;
+        float *scores = scores_base + ithr * m_blk * k_blk;
+        float *acc = acc_base + ithr * m_blk * DV;
+        float *row_max = stats_base + ithr * 2 * m_blk;
+        float *row_sum = row_max + m_blk;
+        char *wsp = wsp_size > 0 ? wsp_base + ithr * wsp_size : nullptr;
+
+        int prev_ker_idx = -1;
+        brgemm_batch_element_t batch;
+
+        dim_t mb {0}, h {0}, mbb {start};
+        while (mbb >= H * get_nb_m(mb))
+            mbb -= H * get_nb_m(mb++);
+        h = mbb / get_nb_m(mb);
+        mbb %= get_nb_m(mb);
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t q0 = mbb * m_blk;
+            const dim_t m = nstl::min(m_blk, Q - q0);
+            const bool is_m_tail = m < m_blk;
+            const dim_t kh = pd()->kv_head(h);
+            const dim_t kmb = pd()->kv_mb(pd()->key_md(), mb);
+            const dim_t vmb = pd()->kv_mb(pd()->val_md(), mb);
+            const dim_t q_valid = pd()->valid_queries(ragged_lengths, mb);
+            const dim_t k_valid = pd()->valid_keys(ragged_lengths, mb);
+            // The last valid query of the block sees the most keys.
+            const dim_t k_end = nstl::max<dim_t>(0,
+                    pd()->causal_keys_end(
+                            nstl::min(q0 + m, q_valid) - 1, q_valid, k_valid));
+
+            for (dim_t r = 0; r < m; r++) {
+                row_max[r] = -INFINITY;
+                row_sum[r] = 0.f;
+            }
+            for (dim_t i = 0; i < m * DV; i++)
+                acc[i] = 0.f;
+
+            for (dim_t k0 = 0; k0 < k_end; k0 += k_blk) {
+                const dim_t kb = nstl::min(k_blk, k_end - k0);
+
+                // Keys are packed as [D][k_blk] with vnni rows interleaved,
+                // and the block tail is zeroed.
+                for_(dim_t i = 0; i < D; i++)
+                for (dim_t k = 0; k < k_blk; k++) {
+                    const float v = k < kb ? load_key(kmb, kh, i, k0 + k) : 0.f;
+                    k_packed[((i / vnni) * k_blk + k) * vnni + i % vnni] = v;
+                }
+
+                const int qk_idx = pd_t::brg_idx(false, is_m_tail);
+                brgemm_palettes_.maybe_tile_configure(
+                        is_amx, prev_ker_idx, qk_idx);
+                batch.ptr.A = qry + qry_d.off(mb, h, q0, 0);
+                batch.ptr.B = k_packed;
+                brgemm_kernel_execute(
+                        brg_kernels_[qk_idx].get(), 1, &batch, scores, wsp);
+
+                // Turn the scores into probabilities relative to the running
+                // maximum of each row, and rescale what has been accumulated
+                // so far if the maximum has grown.
+                for (dim_t r = 0; r < m; r++) {
+                    const dim_t q = q0 + r;
+                    const dim_t r_end = nstl::min(kb,
+                            pd()->causal_keys_end(q, q_valid, k_valid) - k0);
+                    float *s = scores + r * k_blk;
+                    data_t *p = probs + r * k_blk;
+
+                    float blk_max = -INFINITY;
+                    for (dim_t k = 0; k < k_blk; k++) {
+                        if (k < r_end) {
+                            s[k] *= attn_scale;
+                            if (with_mask) s[k] += load_msk(mb, h, q, k0 + k);
+                        } else
+                            s[k] = -INFINITY;
+                        blk_max = nstl::max(blk_max, s[k]);
+                    }
+
+                    const float new_max = nstl::max(row_max[r], blk_max);
+                    if (new_max == -INFINITY) {
+                        for (dim_t k = 0; k < k_blk; k++)
+                            p[k] = 0.f;
+                        continue;
+                    }
+
+                    const float alpha = expf(row_max[r] - new_max);
+                    if (alpha != 1.f) {
+                        row_sum[r] *= alpha;
+                        for (dim_t v = 0; v < DV; v++)
+                            acc[r * DV + v] *= alpha;
+                    }
+
+                    float sum = 0.f;
+                    for (dim_t k = 0; k < k_blk; k++) {
+                        const float e = expf(s[k] - new_max);
+                        p[k] = e;
+                        sum += e;
+                    }
+                    row_sum[r] += sum;
+                    row_max[r] = new_max;
+                }
+
+                // Values are packed as [k_blk][ldv] with vnni rows
+                // interleaved. Padding is zeroed as it is multiplied by zero
+                // probabilities.
+                for_(dim_t k = 0; k < k_blk; k++)
+                for (dim_t v = 0; v < ldv; v++) {
+                    const float x = k < kb && v < DV
+                            ? load_val(vmb, kh, k0 + k, v)
+                            : 0.f;
+                    v_packed[((k / vnni) * ldv + v) * vnni + k % vnni] = x;
+                }
+
+                const int sv_idx = pd_t::brg_idx(true, is_m_tail);
+                brgemm_palettes_.maybe_tile_configure(
+                        is_amx, prev_ker_idx, sv_idx);
+                batch.ptr.A = probs;
+                batch.ptr.B = v_packed;
+                brgemm_kernel_execute(
+                        brg_kernels_[sv_idx].get(), 1, &batch, acc, wsp);
+            }
+
+            // A row without visible keys is either zeroed or left undefined
+            // depending on the softmax algorithm.
+            for (dim_t r = 0; r < m; r++) {
+                const float inv_sum = row_sum[r] > 0.f ? 1.f / row_sum[r]
+                        : inf_as_zero                  ? 0.f
+                                                       : NAN;
+                for (dim_t v = 0; v < DV; v++)
+                    io::store_float_value(dst_dt, acc[r * DV + v] * inv_sum,
+                            dst, dst_d.off(mb, h, q0 + r, v));
+            }
+
+            if (++mbb == get_nb_m(mb)) {
+                mbb = 0;
+                if (++h == H) {
+                    h = 0;
+                    while (++mb < MB && get_nb_m(mb) == 0)
+                        ;
+                }
+            }
+        }
+
+        if (is_amx) amx_tile_release();
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,103 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_SDPA_BRGEMM_SDPA_HPP
+#define CPU_X64_SDPA_BRGEMM_SDPA_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_sdpa_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/brgemm/brgemm_containers.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Flash-attention style SDPA. A block of queries of a head is multiplied by
+// blocks of keys, and the scores are turned into probabilities with a running
+// maximum and sum per query (online softmax). The probabilities are then
+// multiplied by the corresponding block of values and accumulated, so the
+// scores are never materialized for more than a single block of keys.
+//
+// Both multiplications are done with brgemm kernels. Blocks of keys and
+// values are dequantized (if needed) and packed into the kernel layout in a
+// per-thread buffer right before being used.
+struct brgemm_sdpa_t : public primitive_t {
+    struct pd_t : public cpu_sdpa_pd_t {
+        using cpu_sdpa_pd_t::cpu_sdpa_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("brg:", isa_, ""), brgemm_sdpa_t);
+
+        status_t init(engine_t *engine);
+
+        // Index of the kernel computing scores (Q x K) or accumulating
+        // values (P x V) for a full or a tail block of queries.
+        static int brg_idx(bool is_values, bool is_m_tail) {
+            return 2 * (int)is_values + (int)is_m_tail;
+        }
+        static constexpr int num_brg_kernels = 4;
+
+        cpu_isa_t isa_ = isa_undef;
+        // Data type of the queries, the packed keys and values, and the
+        // probabilities passed to the kernels.
+        data_type_t dt_ = data_type::undef;
+        dim_t m_blk_ = 0, nb_m_ = 0, k_blk_ = 0;
+        // Leading dimension of the packed values.
+        dim_t ldv_ = 0;
+        // Number of rows interleaved by the packed layout of the kernels.
+        dim_t vnni_ = 1;
+        size_t wsp_size_ = 0;
+        int nthr_ = 0;
+        std::vector<brgemm_desc_t> brgs_;
+
+    private:
+        status_t init_brgemm(engine_t *engine);
+        void init_scratchpad();
+    };
+
+    brgemm_sdpa_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    template <typename data_t>
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+
+    std::vector<std::unique_ptr<brgemm_kernel_t>> brg_kernels_;
+    brgemm_containers::brgemm_palette_container_t brgemm_palettes_ {
+            pd_t::num_brg_kernels};
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
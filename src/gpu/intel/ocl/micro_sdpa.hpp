@@ -117,6 +117,10 @@ struct micro_sdpa_t : public gpu_primitive_t {
                     utils::everyone_is(4, qry_md()->ndims, key_md()->ndims,
                             val_md()->ndims, dst_md()->ndims),
                     VERBOSE_UNSUPPORTED_TAG);
+            VCHECK_SDPA_COND(!with_kv_block_table(),
+                    VERBOSE_UNSUPPORTED_FEATURE, "paged keys and values");
+            VCHECK_SDPA_COND(
+                    !attr()->ragged_batch_, VERBOSE_UNSUPPORTED_ATTR);
             if (with_attn_mask()) {
                 VCHECK_SDPA_COND(
                         attn_mask_md()->ndims == 4, VERBOSE_UNSUPPORTED_TAG);
@@ -56,6 +56,8 @@ struct ref_sdpa_t : public gpu_primitive_t {
                     utils::everyone_is(4, qry_md()->ndims, key_md()->ndims,
                             val_md()->ndims, dst_md()->ndims),
                     VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_SDPA(!with_kv_block_table(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "paged keys and values");
             if (with_attn_mask()) {
                 VDISPATCH_SDPA(
                         attn_mask_md()->ndims == 4, VERBOSE_UNSUPPORTED_TAG);
@@ -805,6 +805,21 @@ DNNL_GRAPH_OP_SCHEMA(dnnl_gen_index, 1,
                         executable_creator<genindex_executable_t>)
                 .SET_ARG_INDICES_GETTER(genindex_executable_t))
 
+DNNL_GRAPH_OP_SCHEMA(dnnl_paged_cache_load, 1,
+        op_schema_t()
+                .set_num_inputs(2)
+                .set_num_outputs(1)
+                .set_input(0, "cache")
+                .set_input(1, "block_table")
+                .set_output(0, "output")
+                // Analysis rules
+                .set_shape_inference_function(
+                        infer_paged_cache_load_output_shape)
+                .SET_LAYOUT_PROPAGATOR(layout_propagator_for_paged_cache_load)
+                .SET_EXECUTABLE_CREATOR(
+                        executable_creator<paged_cache_load_executable_t>)
+                .SET_ARG_INDICES_GETTER(paged_cache_load_executable_t))
+
 DNNL_GRAPH_OP_SCHEMA(dnnl_shuffle, 1,
         op_schema_t()
                 .set_num_inputs(1)
@@ -81,6 +81,7 @@ namespace op_kind {
     X(dnnl_gen_index, Dnnl_gen_index) \
     X(dnnl_mask, Dnnl_mask) \
     X(dnnl_sdpa, Dnnl_sdpa) \
+    X(dnnl_paged_cache_load, Dnnl_paged_cache_load) \
     X(dnnl_host_scalar, Dnnl_host_scalar)
 
 enum kind_t {
@@ -0,0 +1,255 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "graph/backend/dnnl/kernels/gated_mlp_decomp.hpp"
+
+#include "graph/backend/dnnl/common.hpp"
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+#include "cpu/cpu_stream.hpp"
+#include "oneapi/dnnl/dnnl_threadpool.h"
+#endif
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+gated_mlp_decomp_kernel_t::gated_mlp_args_set_t::gated_mlp_args_set_t(
+        gated_mlp_decomp_kernel_t *kernel) {
+    const auto &cfg = kernel->cfg_;
+    const auto &eng = kernel->p_engine_;
+
+    mems.resize(cfg.nthr);
+    for (int tid = 0; tid < cfg.nthr; tid++) {
+        mems[tid].resize(cfg.blocks.size());
+        for (size_t i = 0; i < cfg.blocks.size(); i++) {
+            const auto &blk = cfg.blocks[i];
+            auto &m = mems[tid][i];
+            m.src = memory(blk.src_md, eng, nullptr);
+            m.wei_gate = memory(blk.wei_gate_md, eng, nullptr);
+            m.wei_up = memory(blk.wei_up_md, eng, nullptr);
+            m.up_dst = memory(blk.up_dst_md, eng, nullptr);
+            m.h = memory(blk.h_md, eng, nullptr);
+            m.wei_down = memory(blk.wei_down_md, eng, nullptr);
+            m.acc = memory(blk.acc_md, eng, nullptr);
+            m.dst_user = memory(blk.dst_user_md, eng, nullptr);
+
+            m.up_args = {{DNNL_ARG_SRC, m.src}, {DNNL_ARG_WEIGHTS, m.wei_up},
+                    {DNNL_ARG_DST, m.up_dst}};
+            m.gate_args = {{DNNL_ARG_SRC, m.src},
+                    {DNNL_ARG_WEIGHTS, m.wei_gate}, {DNNL_ARG_DST, m.h},
+                    {DNNL_ARG_ATTR_MULTIPLE_POST_OP(blk.gate_bin_idx)
+                                    | DNNL_ARG_SRC_1,
+                            m.up_dst}};
+            m.down_args = {{DNNL_ARG_SRC, m.h},
+                    {DNNL_ARG_WEIGHTS, m.wei_down}, {DNNL_ARG_DST, m.acc}};
+            m.reorder_args
+                    = {{DNNL_ARG_FROM, m.acc}, {DNNL_ARG_TO, m.dst_user}};
+
+            if (blk.scratchpad_size) {
+                m.scratchpad = memory(
+                        memory::desc({static_cast<dim_t>(blk.scratchpad_size)},
+                                memory::data_type::u8, memory::format_tag::a),
+                        eng, nullptr);
+                for (auto *args : {&m.up_args, &m.gate_args, &m.down_args,
+                             &m.reorder_args})
+                    args->insert({DNNL_ARG_SCRATCHPAD, m.scratchpad});
+            }
+        }
+    }
+
+    if (cfg.n_chunks > 1) {
+        for (dim_t i = 0; i < cfg.n_chunks; i++) {
+            sum_srcs.emplace_back(cfg.partial_md, eng, nullptr);
+            sum_args.insert({DNNL_ARG_MULTIPLE_SRC + (int)i, sum_srcs.back()});
+        }
+        sum_dst = memory(cfg.sum_dst_md, eng, nullptr);
+        sum_args.insert({DNNL_ARG_DST, sum_dst});
+        if (cfg.sum_scratchpad_size) {
+            sum_scratchpad = memory(
+                    memory::desc({static_cast<dim_t>(cfg.sum_scratchpad_size)},
+                            memory::data_type::u8, memory::format_tag::a),
+                    eng, nullptr);
+            sum_args.insert({DNNL_ARG_SCRATCHPAD, sum_scratchpad});
+        }
+    }
+}
+
+status_t gated_mlp_decomp_kernel_t::compile_impl(
+        const dnnl_partition_impl_t *part, const engine_t *g_engine,
+        const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    p_engine_ = make_dnnl_engine(*g_engine);
+    g_alloc_
+            = reinterpret_cast<graph::allocator_t *>(g_engine->get_allocator());
+
+    // Check if it's supported by decomposition kernel
+    if (!cfg_.initial_check(part->get_ops(), inputs, outputs))
+        return status::unimplemented;
+
+    // The kernel writes to the user output directly, so an output with any
+    // layout is set to the plain row-major one.
+    for (size_t i = 0; i < outputs.size(); i++) {
+        auto &out = const_cast<logical_tensor_t &>(outputs[i]);
+        if (out.layout_type != layout_type::any) continue;
+        const ltw out_lt(out);
+        const auto md = memory::desc(out_lt.vdims(),
+                static_cast<memory::data_type>(out_lt.data_type()),
+                get_ncx_format(out_lt.ndims()));
+        BACKEND_DNNL_CHECK(fill_layout_info(&out, md));
+    }
+
+    resource_ctor_ = [this]() {
+        return std::make_shared<gated_mlp_args_set_t>(this);
+    };
+
+    // Initialize and construct kernel params
+    return cfg_.construct_params(thread_registry_, shared_registry_, p_engine_,
+            part->get_fpmath_mode());
+}
+
+status_t gated_mlp_decomp_kernel_t::execute_impl(const stream_t *g_stream,
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs) {
+    dnnl::stream strm = make_dnnl_stream(p_engine_, *g_stream);
+
+    // Memory objects are created for the number of threads known at
+    // compilation, the actual number of threads can't exceed it.
+    int nthr = cfg_.nthr;
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    auto *tp_stream
+            = dnnl::impl::utils::downcast<dnnl::impl::cpu::cpu_stream_t *>(
+                    const_cast<stream_t *>(g_stream));
+    tp_stream->before_exec_hook();
+    int thread_num = 1;
+    dnnl_threadpool_interop_get_max_concurrency(&thread_num);
+    nthr = std::min(nthr, thread_num);
+    tp_stream->after_exec_hook();
+#endif
+
+    thread_local_cache_t<gated_mlp_args_set_t> res_cache;
+    gated_mlp_args_set_t *res = res_cache.get_or_add(
+            reinterpret_cast<size_t>(this), resource_ctor_);
+
+    using cfg_t = gated_mlp_decomp_config_t;
+    char *src_ptr = static_cast<char *>(
+            inputs[cfg_.graph_inport[cfg_t::src]].get_data_handle());
+    char *wei_gate_ptr = static_cast<char *>(
+            inputs[cfg_.graph_inport[cfg_t::wei_gate]].get_data_handle());
+    char *wei_up_ptr = static_cast<char *>(
+            inputs[cfg_.graph_inport[cfg_t::wei_up]].get_data_handle());
+    char *wei_down_ptr = static_cast<char *>(
+            inputs[cfg_.graph_inport[cfg_t::wei_down]].get_data_handle());
+    char *dst_ptr = static_cast<char *>(outputs[0].get_data_handle());
+
+    const size_t thread_size = thread_registry_.size();
+    temporary_scratchpad_t scratchpad(
+            thread_size * nthr + shared_registry_.size(), p_engine_,
+            *g_alloc_);
+    assertm(scratchpad.size()
+                    >= thread_size * nthr + shared_registry_.size(),
+            "no enough scratchpad memory");
+    char *scratchpad_ptr = scratchpad.get_buffer();
+    grantor_t shared_grantor
+            = shared_registry_.grantor(scratchpad_ptr + thread_size * nthr);
+    char *partials_ptr = shared_grantor.get(cfg_t::key_partials);
+
+    const size_t src_dt_size = memory::data_type_size(cfg_.dt_src);
+    const size_t dst_dt_size = memory::data_type_size(cfg_.dt_dst);
+
+    const auto loop = [&](int tid, int nthr, dim_t mb, dim_t ichunk) {
+        const dim_t m0 = mb * cfg_.m_blk;
+        const size_t kind = m0 + cfg_.m_blk > cfg_.M ? 1 : 0;
+        const auto &blk = cfg_.blocks[kind];
+        auto &mems = res->mems[tid][kind];
+
+        grantor_t var_grantor = thread_registry_.grantor(
+                scratchpad_ptr + thread_size * tid);
+        mems.up_dst.set_data_handle(var_grantor.get(cfg_t::key_up_dst));
+        mems.h.set_data_handle(var_grantor.get(cfg_t::key_h));
+        if (mems.scratchpad)
+            mems.scratchpad.set_data_handle(
+                    var_grantor.get(cfg_t::key_scratchpad));
+
+        mems.src.set_data_handle(src_ptr + m0 * cfg_.src_ld * src_dt_size);
+        char *dst_user_ptr = dst_ptr + m0 * cfg_.dst_ld * dst_dt_size;
+        mems.dst_user.set_data_handle(dst_user_ptr);
+
+        // Select where the down projection accumulates its result: the
+        // partial results buffer if the intermediate dimension is split
+        // between threads, the user output if no conversion is needed, or the
+        // thread's accumulator otherwise.
+        const bool split_n = cfg_.n_chunks > 1;
+        const bool inplace = !split_n && blk.dst_reorder.get_inplace();
+        if (split_n)
+            mems.acc.set_data_handle(
+                    partials_ptr + cfg_.partial_offset(ichunk, m0));
+        else if (inplace)
+            mems.acc.set_data_handle(dst_user_ptr);
+        else
+            mems.acc.set_data_handle(var_grantor.get(cfg_t::key_acc));
+
+        dim_t nb_start = 0, nb_end = 0;
+        balance211(cfg_.nb_n, cfg_.n_chunks, ichunk, nb_start, nb_end);
+        for (dim_t nb = nb_start; nb < nb_end; nb++) {
+            const dim_t n0 = nb * cfg_.n_blk;
+            mems.wei_up.set_data_handle(
+                    wei_up_ptr + n0 * cfg_.wei_up_n_stride * src_dt_size);
+            mems.wei_gate.set_data_handle(
+                    wei_gate_ptr + n0 * cfg_.wei_gate_n_stride * src_dt_size);
+            mems.wei_down.set_data_handle(
+                    wei_down_ptr + n0 * cfg_.wei_down_k_stride * src_dt_size);
+
+            // in parallel region - these primitives should use single thread.
+            blk.up_prim.execute(strm, mems.up_args);
+            blk.gate_prim.execute(strm, mems.gate_args);
+            if (nb == nb_start)
+                blk.down_prim.execute(strm, mems.down_args);
+            else
+                blk.down_acc_prim.execute(strm, mems.down_args);
+        }
+
+        if (!split_n && !inplace)
+            blk.dst_reorder.execute(strm, mems.reorder_args);
+    };
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    tp_stream->before_exec_hook();
+#endif
+
+    parallel_nd_ext(nthr, cfg_.nb_m, cfg_.n_chunks, loop);
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    tp_stream->after_exec_hook();
+#endif
+
+    if (cfg_.n_chunks > 1) {
+        for (dim_t i = 0; i < cfg_.n_chunks; i++)
+            res->sum_srcs[i].set_data_handle(
+                    partials_ptr + cfg_.partial_offset(i, 0));
+        res->sum_dst.set_data_handle(dst_ptr);
+        if (res->sum_scratchpad)
+            res->sum_scratchpad.set_data_handle(
+                    shared_grantor.get(cfg_t::key_sum_scratchpad));
+        cfg_.sum_prim.execute(strm, res->sum_args);
+    }
+    return status::success;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,133 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_GATED_MLP_DECOMP_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_GATED_MLP_DECOMP_HPP
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "graph/backend/dnnl/kernels/gated_mlp_decomp_config.hpp"
+#include "graph/backend/dnnl/kernels/kernel_base.hpp"
+
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+#include "graph/backend/dnnl/scratchpad.hpp"
+#include "graph/backend/dnnl/thread_local_cache.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Computes the gated MLP block by block without materializing the [M, N]
+// intermediate tensors. Each thread processes a block of tokens and a chunk of
+// the intermediate dimension, so the weights of the up and gate projections
+// are read once per token block and the intermediate blocks stay in cache.
+struct gated_mlp_decomp_kernel_t : public kernel_base_t {
+private:
+    allocator_t *g_alloc_ = nullptr;
+    // Buffers private to each thread and buffers shared between threads
+    registry_t thread_registry_;
+    registry_t shared_registry_;
+
+    gated_mlp_decomp_config_t cfg_;
+
+public:
+    gated_mlp_decomp_kernel_t() {
+        thread_local_cache_t<gated_mlp_args_set_t> res_cache;
+        res_cache.retain();
+    }
+
+    ~gated_mlp_decomp_kernel_t() override {
+        thread_local_cache_t<gated_mlp_args_set_t> res_cache;
+        res_cache.remove_if_exist(reinterpret_cast<size_t>(this));
+        res_cache.release();
+    }
+
+    status_t compile_impl(const dnnl_partition_impl_t *part,
+            const engine_t *g_engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) override;
+
+    status_t execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override;
+
+    // Memory objects and execution args of each thread for each block kind
+    // (full and tail).
+    class gated_mlp_args_set_t {
+    public:
+        struct block_mems_t {
+            memory src, wei_gate, wei_up, up_dst, h, wei_down, acc, dst_user,
+                    scratchpad;
+            std::unordered_map<int, memory> up_args, gate_args, down_args,
+                    reorder_args;
+        };
+
+        gated_mlp_args_set_t(gated_mlp_decomp_kernel_t *kernel);
+
+        // Indexed by [tid][block kind]
+        std::vector<std::vector<block_mems_t>> mems;
+        std::vector<memory> sum_srcs;
+        memory sum_dst, sum_scratchpad;
+        std::unordered_map<int, memory> sum_args;
+    };
+
+    std::function<std::shared_ptr<gated_mlp_args_set_t>()> resource_ctor_;
+
+#ifdef DNNL_WITH_SYCL
+    status_t sycl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(sycl_deps);
+        UNUSED(sycl_event);
+        return status::unimplemented;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    status_t ocl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<cl_event> &cl_deps,
+            cl_event *ret_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(cl_deps);
+        UNUSED(ret_event);
+        return status::unimplemented;
+    }
+#endif
+
+    DEF_KERNEL_METHOD_STR(gated_mlp_decomp_kernel_t)
+    DNNL_DISALLOW_COPY_AND_ASSIGN(gated_mlp_decomp_kernel_t)
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
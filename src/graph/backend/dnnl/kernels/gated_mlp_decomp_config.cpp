@@ -0,0 +1,413 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "graph/backend/dnnl/kernels/gated_mlp_decomp_config.hpp"
+
+#include "graph/backend/dnnl/passes/utils.hpp"
+
+#define VCHECK_GATED_MLP_DECOMP(cond, status, msg, ...) \
+    VCONDCHECK(graph, create, check, gated_mlp_decomp_kernel_t, (cond), \
+            status, msg, ##__VA_ARGS__);
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+namespace {
+using op_ptr = std::shared_ptr<op_t>;
+
+bool is_commutative(algorithm alg) {
+    return impl::utils::one_of(alg, algorithm::binary_add,
+            algorithm::binary_mul, algorithm::binary_min,
+            algorithm::binary_max);
+}
+
+// Collapses all dimensions but the last one of a row-major tensor. Returns
+// the leading dimension of the collapsed 2D tensor or 0 if the tensor can't be
+// collapsed.
+dim_t get_collapsed_ld(const logical_tensor_t &lt) {
+    const ltw lt_w(lt);
+    if (lt_w.is_any()) return lt_w.vdims().back();
+    if (!lt_w.is_strided()) return 0;
+
+    const auto dims = lt_w.vdims();
+    const auto strides = lt_w.vstrides();
+    const int ndims = (int)dims.size();
+    if (strides[ndims - 1] != 1) return 0;
+    for (int d = 0; d < ndims - 2; d++) {
+        if (strides[d] != dims[d + 1] * strides[d + 1]) return 0;
+    }
+    return strides[ndims - 2];
+}
+} // namespace
+
+bool gated_mlp_decomp_config_t::initial_check(
+        const std::vector<std::shared_ptr<op_t>> &ops,
+        const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    // The order of input logical tensors in inputs is not certain, we need
+    // to record the input offset in a certain order of ops.
+    CHECK_BOOL(record_input_offset(ops, inputs));
+
+    const ltw src_lt(inputs[graph_inport[src]]);
+    const ltw wei_gate_lt(inputs[graph_inport[wei_gate]]);
+    const ltw wei_up_lt(inputs[graph_inport[wei_up]]);
+    const ltw wei_down_lt(inputs[graph_inport[wei_down]]);
+    const ltw dst_lt(outputs[0]);
+
+    VCHECK_GATED_MLP_DECOMP(src_lt.ndims() >= 2 && dst_lt.ndims() >= 2, false,
+            "Unsupported src or dst dims");
+    VCHECK_GATED_MLP_DECOMP(wei_gate_lt.ndims() == 2 && wei_up_lt.ndims() == 2
+                    && wei_down_lt.ndims() == 2,
+            false, "Only 2D weights are supported");
+    VCHECK_GATED_MLP_DECOMP(wei_gate_lt.is_strided() && wei_up_lt.is_strided()
+                    && wei_down_lt.is_strided(),
+            false, "Only strided weights are supported");
+
+    dt_src = static_cast<memory::data_type>(src_lt.data_type());
+    dt_dst = static_cast<memory::data_type>(dst_lt.data_type());
+    VCHECK_GATED_MLP_DECOMP(
+            impl::utils::one_of(dt_src, memory::data_type::f32,
+                    memory::data_type::bf16, memory::data_type::f16)
+                    && dt_dst == dt_src
+                    && wei_gate_lt.data_type() == src_lt.data_type()
+                    && wei_up_lt.data_type() == src_lt.data_type()
+                    && wei_down_lt.data_type() == src_lt.data_type(),
+            false, "Unsupported data types");
+
+    const auto src_dims = src_lt.vdims();
+    K = src_dims.back();
+    M = src_lt.nelems() / K;
+    src_ld = get_collapsed_ld(inputs[graph_inport[src]]);
+    VCHECK_GATED_MLP_DECOMP(src_ld > 0 && !src_lt.is_any(), false,
+            "Unsupported src layout");
+
+    // Weights are [K, N] or [N, K] if they are transposed.
+    const auto init_wei = [](const ltw &lt, bool transpose, dim_t &k,
+                                  dim_t &n, dim_t &k_stride, dim_t &n_stride) {
+        const auto dims = lt.vdims();
+        const auto strides = lt.vstrides();
+        k = dims[transpose ? 1 : 0];
+        n = dims[transpose ? 0 : 1];
+        k_stride = strides[transpose ? 1 : 0];
+        n_stride = strides[transpose ? 0 : 1];
+    };
+    dim_t gate_k, gate_n, up_k, up_n, down_k;
+    init_wei(wei_gate_lt, transpose_gate_, gate_k, gate_n, wei_gate_k_stride,
+            wei_gate_n_stride);
+    init_wei(wei_up_lt, transpose_up_, up_k, up_n, wei_up_k_stride,
+            wei_up_n_stride);
+    init_wei(wei_down_lt, transpose_down_, down_k, O, wei_down_k_stride,
+            wei_down_n_stride);
+    N = gate_n;
+    VCHECK_GATED_MLP_DECOMP(gate_k == K && up_k == K && up_n == N
+                    && down_k == N,
+            false, "Shapes of the matmuls don't match");
+
+    const auto dst_dims = dst_lt.vdims();
+    dst_ld = get_collapsed_ld(outputs[0]);
+    VCHECK_GATED_MLP_DECOMP(dst_ld > 0 && dst_dims.back() == O
+                    && dst_lt.nelems() == M * O,
+            false, "Unsupported dst shape or layout");
+
+    // The block of the intermediate dimension should divide it to avoid tail
+    // processing in the innermost loop.
+    n_blk = 0;
+    for (dim_t blk : {256, 192, 128, 96, 64, 32, 16}) {
+        if (N % blk == 0) {
+            n_blk = blk;
+            break;
+        }
+    }
+    VCHECK_GATED_MLP_DECOMP(n_blk > 0, false,
+            "Intermediate size %ld is not divisible by a supported block",
+            static_cast<long int>(N));
+
+    // 32 rows keep the per-thread accumulator small enough to stay in L2 for
+    // typical hidden sizes.
+    m_blk = std::min<dim_t>(M, 32);
+    nb_m = impl::utils::div_up(M, m_blk);
+    nb_n = N / n_blk;
+
+    // Initialize nthr with current threads num
+    nthr = dnnl_get_current_num_threads();
+    // When there are not enough token blocks to feed all the threads (e.g.
+    // next token generation), split the intermediate dimension as well.
+    n_chunks = nb_m >= nthr
+            ? 1
+            : std::min(nb_n, impl::utils::div_up<dim_t>(nthr, nb_m));
+    return true;
+}
+
+impl::status_t gated_mlp_decomp_config_t::construct_params(
+        registry_t &thread_registry, registry_t &shared_registry,
+        const dnnl::engine &p_engine, const fpmath_t &fpmath) {
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+    // Primitives are executed inside of the parallel region, create them
+    // with single thread (see sdp_decomp_config_t::construct_params()).
+    omp_set_num_threads(1);
+#endif
+    blocks.resize(M % m_blk ? 2 : 1);
+    CHECK(init_block(blocks[0], m_blk, p_engine, fpmath));
+    if (M % m_blk) CHECK(init_block(blocks[1], M % m_blk, p_engine, fpmath));
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+    omp_set_num_threads(nthr);
+#endif
+
+    if (n_chunks > 1) {
+        partial_md = memory::desc(
+                {M, O}, memory::data_type::f32, memory::format_tag::ab);
+        sum_dst_md = memory::desc({M, O}, dt_dst, {dst_ld, 1});
+        primitive_attr sum_attr;
+        sum_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+        const std::vector<float> scales(n_chunks, 1.f);
+        const std::vector<memory::desc> srcs(n_chunks, partial_md);
+        auto sum_pd = sum::primitive_desc(
+                p_engine, sum_dst_md, scales, srcs, sum_attr);
+        sum_prim = sum(sum_pd);
+        sum_scratchpad_size = sum_pd.scratchpad_desc().get_size();
+    }
+
+    // Per-thread buffers. The accumulator is needed only if a thread
+    // computes the whole intermediate dimension, otherwise partial results
+    // are written to the shared buffer directly.
+    registrar_t thread_registrar = thread_registry.registrar();
+    size_t scratchpad_size = 0;
+    for (const auto &blk : blocks)
+        scratchpad_size = std::max(scratchpad_size, blk.scratchpad_size);
+    thread_registrar.book(key_up_dst, blocks[0].up_dst_md.get_size());
+    thread_registrar.book(key_h, blocks[0].h_md.get_size());
+    if (n_chunks == 1)
+        thread_registrar.book(key_acc, blocks[0].acc_md.get_size());
+    if (scratchpad_size)
+        thread_registrar.book(key_scratchpad, scratchpad_size);
+
+    registrar_t shared_registrar = shared_registry.registrar();
+    if (n_chunks > 1) {
+        shared_registrar.book(key_partials, n_chunks * partial_md.get_size());
+        if (sum_scratchpad_size)
+            shared_registrar.book(key_sum_scratchpad, sum_scratchpad_size);
+    }
+    return status::success;
+}
+
+impl::status_t gated_mlp_decomp_config_t::init_block(gated_mlp_block_t &blk,
+        dim_t m, const dnnl::engine &p_engine, const fpmath_t &fpmath) const {
+    using dt = memory::data_type;
+    using tag = memory::format_tag;
+
+    blk.m = m;
+
+    primitive_attr attr;
+    attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+    attr.set_fpmath_mode(
+            static_cast<dnnl::fpmath_mode>(fpmath.mode_), fpmath.apply_to_int_);
+
+    blk.src_md = memory::desc({m, K}, dt_src, {src_ld, 1});
+    blk.wei_up_md = memory::desc(
+            {K, n_blk}, dt_src, {wei_up_k_stride, wei_up_n_stride});
+    blk.wei_gate_md = memory::desc(
+            {K, n_blk}, dt_src, {wei_gate_k_stride, wei_gate_n_stride});
+    // The up block is consumed by the gate matmul as a binary post-op, keep
+    // it in f32 to avoid extra rounding.
+    blk.up_dst_md = memory::desc({m, n_blk}, dt::f32, tag::ab);
+    blk.h_md = memory::desc({m, n_blk}, dt_src, tag::ab);
+    blk.wei_down_md = memory::desc(
+            {n_blk, O}, dt_src, {wei_down_k_stride, wei_down_n_stride});
+    blk.acc_md = memory::desc({m, O}, dt::f32, tag::ab);
+    blk.dst_user_md = memory::desc({m, O}, dt_dst, {dst_ld, 1});
+
+    auto up_pd = matmul::primitive_desc(
+            p_engine, blk.src_md, blk.wei_up_md, blk.up_dst_md, attr);
+    blk.up_prim = matmul(up_pd);
+
+    primitive_attr gate_attr = attr;
+    post_ops gate_pops;
+    if (has_act_) gate_pops.append_eltwise(act_alg_, act_alpha_, act_beta_);
+    gate_pops.append_binary(bin_alg_, blk.up_dst_md);
+    blk.gate_bin_idx = gate_pops.len() - 1;
+    gate_attr.set_post_ops(gate_pops);
+    auto gate_pd = matmul::primitive_desc(
+            p_engine, blk.src_md, blk.wei_gate_md, blk.h_md, gate_attr);
+    blk.gate_prim = matmul(gate_pd);
+
+    auto down_pd = matmul::primitive_desc(
+            p_engine, blk.h_md, blk.wei_down_md, blk.acc_md, attr);
+    blk.down_prim = matmul(down_pd);
+
+    primitive_attr down_acc_attr = attr;
+    post_ops down_acc_pops;
+    down_acc_pops.append_sum(1.f);
+    down_acc_attr.set_post_ops(down_acc_pops);
+    auto down_acc_pd = matmul::primitive_desc(
+            p_engine, blk.h_md, blk.wei_down_md, blk.acc_md, down_acc_attr);
+    blk.down_acc_prim = matmul(down_acc_pd);
+
+    primitive_attr reorder_attr;
+    reorder_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+    auto reorder_pd = reorder::primitive_desc(
+            p_engine, blk.acc_md, p_engine, blk.dst_user_md, reorder_attr);
+    blk.dst_reorder.init(reorder_pd);
+
+    blk.scratchpad_size = 0;
+    for (const auto &md :
+            {up_pd.scratchpad_desc(), gate_pd.scratchpad_desc(),
+                    down_pd.scratchpad_desc(), down_acc_pd.scratchpad_desc(),
+                    reorder_pd.scratchpad_desc()})
+        blk.scratchpad_size = std::max(blk.scratchpad_size, md.get_size());
+    return status::success;
+}
+
+impl::status_t gated_mlp_decomp_config_t::record_input_offset(
+        const std::vector<std::shared_ptr<op_t>> &ops,
+        const std::vector<logical_tensor_t> &inputs) {
+    const auto find_graph_inport = [&](const std::shared_ptr<value_t> &val) {
+        for (int i = 0; i < (int)inputs.size(); i++) {
+            if (val->get_logical_tensor().id == inputs[i].id) { return i; }
+        }
+        // If the corresponding input is not found, return an invalid value
+        return -1;
+    };
+    // Returns the producer of a value if it belongs to the partition
+    const auto get_producer = [&](const std::shared_ptr<value_t> &val) {
+        if (!val->has_producer()) return op_ptr();
+        op_t *producer = &val->get_producer();
+        for (const auto &cur_op : ops)
+            if (cur_op.get() == producer) return cur_op;
+        return op_ptr();
+    };
+    const auto &binary_algs = get_binary_alg_map();
+    const auto &eltwise_algs = get_eltwise_alg_map();
+
+    std::vector<op_ptr> matmuls;
+    for (const auto &cur_op : ops) {
+        const auto op_kind = cur_op->get_kind();
+        if (op_kind != graph::op_kind::MatMul) continue;
+        VCHECK_GATED_MLP_DECOMP(cur_op->num_inputs() == 2,
+                status::unimplemented, "Matmul with bias is not supported");
+        VCHECK_GATED_MLP_DECOMP(
+                !cur_op->get_attr<bool>(op_attr::transpose_a),
+                status::unimplemented, "Not support transpose_a is true");
+        matmuls.emplace_back(cur_op);
+    }
+    VCHECK_GATED_MLP_DECOMP(matmuls.size() == 3, status::invalid_graph,
+            "Expected 3 matmuls, but got %zu", matmuls.size());
+
+    // The down projection consumes the result of the binary op.
+    op_ptr down, bin;
+    for (const auto &mm : matmuls) {
+        auto producer = get_producer(mm->get_input_value(0));
+        if (!producer) continue;
+        down = mm;
+        bin = producer;
+    }
+    VCHECK_GATED_MLP_DECOMP(down && bin && binary_algs.count(bin->get_kind()),
+            status::invalid_graph, "Failed to find the down projection");
+    bin_alg_ = binary_algs.at(bin->get_kind());
+
+    // Walks from an input of the binary op to the matmul producing it.
+    // Records the activation in between, if any.
+    size_t n_act_ops = 0;
+    const auto trace = [&](const std::shared_ptr<value_t> &val,
+                               op_ptr &act) -> op_ptr {
+        auto producer = get_producer(val);
+        if (!producer) return nullptr;
+        if (producer->get_kind() == graph::op_kind::MatMul) return producer;
+
+        // Swish decomposed into sigmoid and multiply
+        if (producer->get_kind() == graph::op_kind::Multiply) {
+            for (size_t i = 0; i < 2; i++) {
+                auto mm = get_producer(producer->get_input_value(i));
+                auto sig = get_producer(producer->get_input_value(1 - i));
+                if (!mm || !sig || mm->get_kind() != graph::op_kind::MatMul
+                        || sig->get_kind() != graph::op_kind::Sigmoid
+                        || get_producer(sig->get_input_value(0)) != mm)
+                    continue;
+                act = producer;
+                n_act_ops = 2;
+                has_act_ = true;
+                act_alg_ = algorithm::eltwise_swish;
+                act_alpha_ = 1.f;
+                act_beta_ = 0.f;
+                return mm;
+            }
+            return nullptr;
+        }
+
+        if (!eltwise_algs.count(producer->get_kind())) return nullptr;
+        auto mm = get_producer(producer->get_input_value(0));
+        if (!mm || mm->get_kind() != graph::op_kind::MatMul) return nullptr;
+        // Same attributes as for the eltwise lowering, see
+        // merge_common_eltwise_attrs().
+        act = producer;
+        n_act_ops = 1;
+        has_act_ = true;
+        act_alg_ = get_eltwise_alg(producer, false);
+        act_alpha_ = producer->has_attr(op_attr::alpha)
+                ? producer->get_attr<float>(op_attr::alpha)
+                : producer->has_attr(op_attr::min)
+                ? producer->get_attr<float>(op_attr::min)
+                : producer->get_kind() == graph::op_kind::HardSwish ? 1.f / 6.f
+                                                                    : 0.f;
+        act_beta_ = producer->has_attr(op_attr::beta)
+                ? producer->get_attr<float>(op_attr::beta)
+                : producer->has_attr(op_attr::max)
+                ? producer->get_attr<float>(op_attr::max)
+                : producer->get_kind() == graph::op_kind::HardSwish ? 1.f / 2.f
+                                                                    : 0.f;
+        return mm;
+    };
+
+    op_ptr act0, act1;
+    op_ptr gate = trace(bin->get_input_value(0), act0);
+    op_ptr up = trace(bin->get_input_value(1), act1);
+    VCHECK_GATED_MLP_DECOMP(gate && up && gate != up && !(act0 && act1),
+            status::unimplemented, "Unsupported gated mlp structure");
+    if (act1) {
+        // The activation is applied to the second input of the binary op,
+        // swap the inputs if possible.
+        VCHECK_GATED_MLP_DECOMP(is_commutative(bin_alg_),
+                status::unimplemented,
+                "Activation on the second input of a non-commutative binary "
+                "op is not supported");
+        std::swap(gate, up);
+    }
+    VCHECK_GATED_MLP_DECOMP(ops.size() == 4 + n_act_ops, status::unimplemented,
+            "Unexpected ops in gated mlp partition");
+
+    transpose_gate_ = gate->get_attr<bool>(op_attr::transpose_b);
+    transpose_up_ = up->get_attr<bool>(op_attr::transpose_b);
+    transpose_down_ = down->get_attr<bool>(op_attr::transpose_b);
+
+    graph_inport = {find_graph_inport(gate->get_input_value(0)),
+            find_graph_inport(gate->get_input_value(1)),
+            find_graph_inport(up->get_input_value(1)),
+            find_graph_inport(down->get_input_value(1))};
+    VCHECK_GATED_MLP_DECOMP(
+            graph_inport[src] == find_graph_inport(up->get_input_value(0)),
+            status::unimplemented, "Gate and up matmuls use different inputs");
+    for (int idx : graph_inport) {
+        VCHECK_GATED_MLP_DECOMP(idx != -1, status::unimplemented,
+                "Failed to find graph inport");
+    }
+    return status::success;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
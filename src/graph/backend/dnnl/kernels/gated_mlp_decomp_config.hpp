@@ -0,0 +1,152 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_GATED_MLP_DECOMP_CONFIG_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_GATED_MLP_DECOMP_CONFIG_HPP
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "common/dnnl_thread.hpp"
+
+#include "graph/interface/c_types_map.hpp"
+#include "graph/interface/graph_attr.hpp"
+
+#include "graph/backend/dnnl/kernels/sdp_decomp_config.hpp"
+#include "graph/backend/dnnl/scratchpad.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Primitives computing a block of rows [m, O] of the gated MLP output for a
+// block of columns [n_blk] of the intermediate tensor:
+//   up   = src[m, K] x wei_up[K, n_blk]
+//   h    = binary(act(src[m, K] x wei_gate[K, n_blk]), up)
+//   acc += h[m, n_blk] x wei_down[n_blk, O]
+// The activation and the binary op are fused into the gate matmul as post-ops,
+// so the intermediate blocks stay in cache and are never written to the user
+// memory.
+struct gated_mlp_block_t {
+    dim_t m = 0;
+    primitive up_prim, gate_prim, down_prim, down_acc_prim;
+    // Converts the accumulator into the user destination. Used only when the
+    // whole intermediate dimension is processed by a single thread.
+    sdp_reorder_t dst_reorder;
+    // Index of the binary post-op of the gate matmul taking the up block
+    int gate_bin_idx = 0;
+
+    memory::desc src_md, wei_gate_md, wei_up_md, up_dst_md, h_md, wei_down_md,
+            acc_md, dst_user_md;
+    size_t scratchpad_size = 0;
+};
+
+struct gated_mlp_decomp_config_t {
+public:
+    gated_mlp_decomp_config_t() = default;
+
+    // src is [M, K], gate and up weights are [K, N], down weights are [N, O].
+    // All leading dimensions of src and dst are collapsed into M.
+    dim_t M = 0, K = 0, N = 0, O = 0;
+
+    // Block sizes over tokens and over the intermediate dimension
+    dim_t m_blk = 0, n_blk = 0;
+    // Number of blocks of each kind
+    dim_t nb_m = 0, nb_n = 0;
+    // Number of chunks the intermediate dimension is split into between
+    // threads. When it's larger than 1, each chunk produces a partial result
+    // and the partial results are summed up at the end.
+    dim_t n_chunks = 1;
+
+    // Thread nums during the workflow
+    int nthr = 1;
+
+    // Leading dimensions of src and dst, and strides of the weights along the
+    // reduction and the output dimensions.
+    dim_t src_ld = 0, dst_ld = 0;
+    dim_t wei_gate_k_stride = 0, wei_gate_n_stride = 0;
+    dim_t wei_up_k_stride = 0, wei_up_n_stride = 0;
+    dim_t wei_down_k_stride = 0, wei_down_n_stride = 0;
+
+    memory::data_type dt_src = memory::data_type::undef;
+    memory::data_type dt_dst = memory::data_type::undef;
+
+    // Used to record the exact input offset in subgraph
+    std::vector<int> graph_inport;
+    enum input_index_t { src = 0, wei_gate, wei_up, wei_down };
+
+    // Full and tail (if M is not divisible by m_blk) blocks
+    std::vector<gated_mlp_block_t> blocks;
+
+    // Sums up partial results of the chunks into the user destination
+    primitive sum_prim;
+    memory::desc partial_md, sum_dst_md;
+    size_t sum_scratchpad_size = 0;
+
+    // Registry keys of the per-thread and the shared buffers
+    enum registry_key_t {
+        key_up_dst = 0,
+        key_h,
+        key_acc,
+        key_scratchpad,
+        key_partials,
+        key_sum_scratchpad,
+    };
+
+    // The function is used to check if the configuration of gated MLP is
+    // supported by current implementation of decomp kernel. If the check
+    // passes, initialize few members according to inputs. If no, return
+    // false directly and fallback to large kernel.
+    bool initial_check(const std::vector<std::shared_ptr<op_t>> &ops,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs);
+
+    // Used to construct all params that gated MLP needs
+    impl::status_t construct_params(registry_t &thread_registry,
+            registry_t &shared_registry, const dnnl::engine &p_engine,
+            const fpmath_t &fpmath);
+
+    // Offset of the block of partial results in bytes
+    size_t partial_offset(dim_t ichunk, dim_t m0) const {
+        return (ichunk * M + m0) * O * sizeof(float);
+    }
+
+private:
+    bool has_act_ = false;
+    algorithm act_alg_ = algorithm::undef;
+    float act_alpha_ = 0.f, act_beta_ = 0.f;
+    algorithm bin_alg_ = algorithm::undef;
+    bool transpose_gate_ = false, transpose_up_ = false,
+         transpose_down_ = false;
+
+    impl::status_t record_input_offset(
+            const std::vector<std::shared_ptr<op_t>> &ops,
+            const std::vector<logical_tensor_t> &inputs);
+
+    impl::status_t init_block(gated_mlp_block_t &blk, dim_t m,
+            const dnnl::engine &p_engine, const fpmath_t &fpmath) const;
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
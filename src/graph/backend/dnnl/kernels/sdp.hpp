@@ -54,9 +54,11 @@ public:
         const engine_kind_t ekind = g_engine->kind();
         bool enable_decomp = false;
         bool enable_ukernel = false;
+        bool enable_cpu_primitive = false;
 
         if (ekind == engine_kind::cpu) {
             enable_decomp = enable_decomp_kernel();
+            enable_cpu_primitive = !force_primitive();
         } else if (ekind == engine_kind::gpu) {
             enable_ukernel = !force_primitive();
         } else {
@@ -74,7 +76,11 @@ public:
             ret = kernel->compile_impl(part, g_engine, inputs, outputs);
         }
 
-        if (ret != status::success && enable_ukernel) {
+        // On CPU, the sdpa primitive streams keys and values in blocks and
+        // doesn't materialize the scores, so it's preferred over the
+        // decomposition when an optimized implementation is available.
+        if (ret != status::success
+                && (enable_ukernel || enable_cpu_primitive)) {
             kernel = std::make_shared<sdp_primitive_kernel_t<quantized>>();
             ret = kernel->compile_impl(part, g_engine, inputs, outputs);
         }
@@ -112,8 +118,8 @@ public:
 
     // An internal env var is provided to force using primitive based SDPA
     // implementation and skipping ukernel based optimization on GPU or
-    // decomposition based optimization on CPU. Currently it's for oneDNN debug
-    // and testing only.
+    // sdpa primitive and decomposition based optimizations on CPU. Currently
+    // it's for oneDNN debug and testing only.
     bool force_primitive() const {
         const int force = graph::utils::getenv_int_internal(
                 "GRAPH_SDPA_FORCE_PRIMITIVE", 0);
@@ -516,6 +516,10 @@ impl::status_t sdp_decomp_config_t::record_input_offset(
             = {graph::op_kind::Divide, graph::op_kind::Multiply,
                     graph::op_kind::Add, graph::op_kind::Select,
                     graph::op_kind::SoftMax};
+    for (const auto &cur_op : sg->get_ops())
+        VCHECK_SDP_DECOMP(
+                cur_op->get_kind() != graph::op_kind::PagedCacheLoad,
+                status::unimplemented, "Not support paged key-value cache");
     for (const auto &cur_op : sg->get_ops()) {
         const auto &op_kind = cur_op->get_kind();
         VCHECK_SDP_DECOMP(op_kind != graph::op_kind::GenIndex,
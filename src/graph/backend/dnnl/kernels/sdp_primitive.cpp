@@ -149,7 +149,7 @@ void sdp_primitive_kernel_t<quantized>::prepare_args_set(
 
 template <bool quantized>
 status_t sdp_primitive_kernel_t<quantized>::get_prim_exec_args(
-        exec_args_t &args, memory (&mem_storage)[10],
+        exec_args_t &args, memory (&mem_storage)[11],
         const execution_args_set_t *res) const {
     bool ok = res->find_value_mem_map(cfg_.q_.get(), mem_storage[0])
             && res->find_value_mem_map(cfg_.k_.get(), mem_storage[1])
@@ -177,33 +177,36 @@ status_t sdp_primitive_kernel_t<quantized>::get_prim_exec_args(
         ok = ok
                 && res->find_value_mem_map(
                         cfg_.v_zero_points_.get(), mem_storage[9]);
+    if (cfg_.kv_block_table_)
+        ok = ok
+                && res->find_value_mem_map(
+                        cfg_.kv_block_table_.get(), mem_storage[10]);
 
     VCONDCHECK(graph, exec, check, sdp_primitive_kernel, ok,
             status::runtime_error,
             "sdp_primitive_kernel get_prim_exec_args failed");
 
-    memory_arg_t mem_arg_q = {mem_storage[0].get(), true};
-    memory_arg_t mem_arg_k = {mem_storage[1].get(), true};
-    memory_arg_t mem_arg_v = {mem_storage[2].get(), true};
-    memory_arg_t mem_arg_dst = {mem_storage[3].get(), false};
-    memory_arg_t mem_arg_scale = {mem_storage[4].get(true), true};
-    memory_arg_t mem_arg_mask = {mem_storage[5].get(true), true};
-    memory_arg_t mem_arg_k_scale = {mem_storage[6].get(true), true};
-    memory_arg_t mem_arg_v_scale = {mem_storage[7].get(true), true};
-    memory_arg_t mem_arg_k_zero_points = {mem_storage[8].get(true), true};
-    memory_arg_t mem_arg_v_zero_points = {mem_storage[9].get(true), true};
-
     args.clear();
-    args[DNNL_ARG_QUERIES] = mem_arg_q;
-    args[DNNL_ARG_KEYS] = mem_arg_k;
-    args[DNNL_ARG_VALUES] = mem_arg_v;
-    args[DNNL_ARG_DST] = mem_arg_dst;
-    args[DNNL_ARG_SCALE] = mem_arg_scale;
-    args[DNNL_ARG_ATTN_MASK] = mem_arg_mask;
-    args[DNNL_ARG_ATTR_SCALES | DNNL_ARG_KEYS] = mem_arg_k_scale;
-    args[DNNL_ARG_ATTR_SCALES | DNNL_ARG_VALUES] = mem_arg_v_scale;
-    args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_KEYS] = mem_arg_k_zero_points;
-    args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_VALUES] = mem_arg_v_zero_points;
+    args[DNNL_ARG_QUERIES] = {mem_storage[0].get(), true};
+    args[DNNL_ARG_KEYS] = {mem_storage[1].get(), true};
+    args[DNNL_ARG_VALUES] = {mem_storage[2].get(), true};
+    args[DNNL_ARG_DST] = {mem_storage[3].get(), false};
+
+    // Optional arguments are passed only when present, as CPU
+    // implementations don't expect empty memory objects in the arguments.
+    const std::pair<int, int> optional_args[] = {
+            {DNNL_ARG_SCALE, 4},
+            {DNNL_ARG_ATTN_MASK, 5},
+            {DNNL_ARG_ATTR_SCALES | DNNL_ARG_KEYS, 6},
+            {DNNL_ARG_ATTR_SCALES | DNNL_ARG_VALUES, 7},
+            {DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_KEYS, 8},
+            {DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_VALUES, 9},
+            {DNNL_ARG_KV_BLOCK_TABLE, 10},
+    };
+    for (const auto &arg : optional_args) {
+        auto *mem = mem_storage[arg.second].get(true);
+        if (mem) args[arg.first] = {mem, true};
+    }
 
     return status::success;
 }
@@ -218,16 +221,37 @@ status_t sdp_primitive_kernel_t<quantized>::execute_impl(
     execution_args_set_t *res = res_cache.get_or_add(
             reinterpret_cast<size_t>(this), resource_ctor_);
 
-    // Micro kernel doesn't use scratchpad memory, here we force-set size as
-    // zero to avoid redundant memory allocation and deallocation.
-    temporary_scratchpad_t scratchpad(0, p_engine_, *g_alloc_);
+    // Micro kernel doesn't use scratchpad memory, while CPU implementations
+    // keep per-thread blocks of keys, values and scores there.
+    const auto &sdpa_pd = cfg_.sdpa_pd_;
+    const size_t scratchpad_size
+            = sdpa_pd->scratchpad_size(impl::scratchpad_mode::user);
+    temporary_scratchpad_t scratchpad(scratchpad_size, p_engine_, *g_alloc_);
     prepare_args_set(res, inputs, outputs, scratchpad);
 
-    memory mem_storage[10];
+    memory mem_storage[11];
     exec_args_t args;
     CHECK(get_prim_exec_args(args, mem_storage, res));
     exec_ctx_t ctx(p_stream.get(), std::move(args));
 
+    // The primitive is executed directly, so the scratchpad grantor is set up
+    // here in the same way as for a user-provided scratchpad.
+    memory scratchpad_mem;
+    const memory_storage_t *scratchpad_storage = nullptr;
+    if (scratchpad_size > 0) {
+        VCONDCHECK(graph, exec, check, sdp_primitive_kernel,
+                scratchpad.size() >= scratchpad_size, status::out_of_memory,
+                "sdp_primitive_kernel failed to allocate scratchpad");
+        scratchpad_mem = memory({{static_cast<memory::dim>(scratchpad_size)},
+                                        memory::data_type::u8,
+                                        memory::format_tag::a},
+                p_engine_, scratchpad.get_buffer());
+        scratchpad_storage = scratchpad_mem.get()->memory_storage();
+    }
+    const auto grantor = sdpa_pd->scratchpad_registry().grantor(
+            scratchpad_storage, ctx);
+    ctx.set_scratchpad_grantor(&grantor);
+
     return cfg_.sdpa_prim_->execute(ctx);
 }
 
@@ -253,7 +277,7 @@ status_t sdp_primitive_kernel_t<quantized>::sycl_execute_impl(
     temporary_scratchpad_t scratchpad(0, p_engine_, *g_alloc_);
     prepare_args_set(res, inputs, outputs, scratchpad);
 
-    memory mem_storage[10];
+    memory mem_storage[11];
     exec_args_t args;
     CHECK(get_prim_exec_args(args, mem_storage, res));
     exec_ctx_t ctx(p_stream.get(), std::move(args));
@@ -299,7 +323,7 @@ status_t sdp_primitive_kernel_t<quantized>::ocl_execute_impl(
     temporary_scratchpad_t scratchpad(0, p_engine_, *g_alloc_);
     prepare_args_set(res, inputs, outputs, scratchpad);
 
-    memory mem_storage[10];
+    memory mem_storage[11];
     exec_args_t args;
     CHECK(get_prim_exec_args(args, mem_storage, res));
     exec_ctx_t ctx(p_stream.get(), std::move(args));
@@ -124,6 +124,45 @@ status_t sdp_primitive_config_t::locate_io(std::shared_ptr<subgraph_t> &sg,
         if (4 == mm2->num_inputs()) v_zero_points_ = mm2->get_input_value(3);
     }
 
+    // Paged keys and values are read by the primitive directly from the pools
+    // of blocks, so the ops gathering them are bypassed.
+    auto find_paged_load = [](std::shared_ptr<value_t> val) -> op_t * {
+        while (val->has_producer()) {
+            auto &producer = val->get_producer();
+            if (producer.get_kind() == op_kind::dnnl_paged_cache_load)
+                return &producer;
+            if (!one_of(producer.get_kind(), op_kind::dnnl_permute,
+                        op_kind::dnnl_transpose))
+                return nullptr;
+            val = producer.get_input_value(0);
+        }
+        return nullptr;
+    };
+    op_t *k_load = find_paged_load(k_);
+    op_t *v_load = find_paged_load(v_);
+    VCHECK_SDP_PRIMITIVE((k_load == nullptr) == (v_load == nullptr),
+            status::unimplemented,
+            "Keys and values should be either both paged or not");
+    if (k_load) {
+        const auto table = k_load->get_input_value(1);
+        VCHECK_SDP_PRIMITIVE(table->get_logical_tensor().id
+                        == v_load->get_input_value(1)->get_logical_tensor().id,
+                status::unimplemented,
+                "Keys and values should share the block table");
+        VCHECK_SDP_PRIMITIVE(
+                v_->has_producer() && &v_->get_producer() == v_load,
+                status::unimplemented, "Paged values can't be permuted");
+        // The primitive expects keys transposed to (head_size, tokens).
+        const auto &k_lt = k_->get_logical_tensor();
+        const auto &k_pool_lt
+                = k_load->get_input_value(0)->get_logical_tensor();
+        VCHECK_SDP_PRIMITIVE(k_lt.dims[2] == k_pool_lt.dims[3],
+                status::unimplemented, "Paged keys should be transposed");
+        k_ = k_load->get_input_value(0);
+        v_ = v_load->get_input_value(0);
+        kv_block_table_ = table;
+    }
+
     auto k_follow = follow_back(k_);
     for (auto &t : inputs)
         if (k_follow->get_logical_tensor().id == t.id) {
@@ -175,7 +214,10 @@ status_t sdp_primitive_config_t::initial_check(
             "At least 3 inputs are required");
 
     // Ukernel doesn't support f32 datatype now
-    VCHECK_SDP_PRIMITIVE(inputs[0].data_type != dnnl_data_type_t::dnnl_f32,
+    const bool is_gpu = sg->p_engine_->get_kind() == dnnl::engine::kind::gpu;
+    VCHECK_SDP_PRIMITIVE(IMPLICATION(is_gpu,
+                                 inputs[0].data_type
+                                         != dnnl_data_type_t::dnnl_f32),
             status::invalid_arguments,
             "SDPA ukernel doesn't support f32 datatype now");
 
@@ -344,6 +386,12 @@ status_t sdp_primitive_config_t::init(std::shared_ptr<subgraph_t> &sg,
     // Retrieve mds and create pd, primitive
     auto md_q = make_dnnl_memory_desc(q_->get_logical_tensor());
     auto md_k = make_dnnl_memory_desc(k_->get_logical_tensor());
+    dnnl::memory::desc md_kv_block_table;
+    if (kv_block_table_) {
+        md_k = md_k.permute_axes({0, 1, 3, 2});
+        md_kv_block_table = make_dnnl_memory_desc(
+                kv_block_table_->get_logical_tensor());
+    }
     auto md_v = make_dnnl_memory_desc(v_->get_logical_tensor());
     auto md_dst = make_dnnl_memory_desc(dst_->get_logical_tensor());
 
@@ -378,7 +426,16 @@ status_t sdp_primitive_config_t::init(std::shared_ptr<subgraph_t> &sg,
     CHECK(create_sdpa_pd(sdpa_pd_, p_engine.get(), md_q.get(), md_k.get(),
             md_v.get(), md_dst.get(), md_mask.get(), scale_dt, invert_scale_,
             kv_head_number_, mask_type_, softmax_alg, attr.get(), qk_attr.get(),
-            vs_attr.get()));
+            vs_attr.get(), md_kv_block_table.get(true)));
+
+    // The reference CPU implementation is slower than the decomposition, so
+    // it's not used here.
+    VCONDCHECK(graph, create, dispatch, sdp,
+            IMPLICATION(p_engine.get_kind() == dnnl::engine::kind::cpu,
+                    std::string(sdpa_pd_->name()).rfind("ref", 0) != 0),
+            status::unimplemented,
+            "sdpa primitive has no optimized cpu implementation, falling "
+            "back\n");
 
     auto status = sdpa_pd_->create_primitive(sdpa_prim_, p_engine.get());
 
@@ -59,6 +59,10 @@ public:
     std::shared_ptr<value_t> k_zero_points_ = nullptr;
     std::shared_ptr<value_t> v_zero_points_ = nullptr;
 
+    // Block table of paged keys and values. When it's set, `k_` and `v_` are
+    // the pools of blocks.
+    std::shared_ptr<value_t> kv_block_table_ = nullptr;
+
     bool invert_scale_ = false;
     bool quantized_ = false;
     attn_mask_type_t mask_type_ = attn_mask_type::undef;
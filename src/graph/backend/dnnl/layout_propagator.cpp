@@ -1764,6 +1764,32 @@ status_t layout_propagator_for_sdpa(std::shared_ptr<op_t> &op,
     return status;
 }
 
+status_t layout_propagator_for_paged_cache_load(std::shared_ptr<op_t> &op,
+        const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+        pd_cache_t &pd_cache, subgraph_rewriter_t &rewriter) {
+    // The blocks are gathered by plain offsets, so the cache and the block
+    // table are always kept in plain formats.
+    for (size_t i = 0; i < op->num_inputs(); i++) {
+        auto md = make_dnnl_memory_desc(
+                op->get_input_value(i)->get_logical_tensor());
+        if (is_plain(md)) continue;
+        auto plain_md = dnnl::memory::desc(md.get_dims(), md.get_data_type(),
+                get_ncx_format(md.get_dims()));
+        insert_reorder_before(
+                op, i, plain_md, p_engine, mgr, pd_cache, rewriter);
+    }
+
+    value_ptr dst_val = op->get_output_value(0);
+    const logical_tensor_t &out_lt = dst_val->get_logical_tensor();
+    const auto dst_md = ltw(out_lt).is_any()
+            ? dnnl::memory::desc(ltw(out_lt).vdims(),
+                    static_cast<dnnl::memory::data_type>(
+                            ltw(out_lt).data_type()),
+                    dnnl::memory::format_tag::abcd)
+            : make_dnnl_memory_desc(out_lt);
+    return fill_layout_info(dst_val, dst_md);
+}
+
 status_t layout_propagator_for_host_scalar(std::shared_ptr<op_t> &op,
         const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
         pd_cache_t &pd_cache, subgraph_rewriter_t &rewriter) {
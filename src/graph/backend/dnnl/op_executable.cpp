@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  *******************************************************************************/
+#include <cstring>
 #include <map>
 #include <memory>
 #include <string>
@@ -1087,6 +1088,30 @@ concat_executable_t::desc_t concat_executable_t::create_desc(
     return {pd, false};
 }
 
+std::vector<size_t> concat_executable_t::get_src_offsets(
+        std::shared_ptr<op_t> &op, const type &pd) {
+    const auto dst_md = pd.dst_desc();
+    const auto res = utils::try_reverse_axis(
+            op->get_attr<int64_t>(op_attr::axis), dst_md.get_ndims());
+    if (!res.first || dst_md.get_format_kind() != format_kind::blocked)
+        return {};
+    const auto axis = res.second;
+
+    const size_t dt_size = memory::data_type_size(dst_md.get_data_type());
+    memory::dims offsets(dst_md.get_ndims(), 0);
+    std::vector<size_t> src_offsets;
+    for (int i = 0; i < static_cast<int>(op->num_inputs()); i++) {
+        const auto src_md = pd.src_desc(i);
+        const auto view_md = dst_md.submemory_desc(
+                src_md.get_dims(), offsets, /* allow_empty = */ true);
+        if (!view_md) return {};
+        src_offsets.push_back(static_cast<size_t>(
+                view_md.get_submemory_offset() * dt_size));
+        offsets[axis] += src_md.get_dims()[axis];
+    }
+    return src_offsets;
+}
+
 resampling_executable_t::desc_t resampling_executable_t::create_desc(
         std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
         fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
@@ -1814,6 +1839,47 @@ void genindex_executable_t ::execute(const stream &stream,
     stream.get()->after_exec_hook();
 }
 
+void paged_cache_load_executable_t::execute(const stream &stream,
+        const std::unordered_map<int, memory> &args) const {
+    const auto &cache = args.at(DNNL_ARG_SRC_0);
+    const auto &table = args.at(DNNL_ARG_SRC_1);
+    const auto &dst = args.at(DNNL_ARG_DST);
+
+    const auto cache_md = cache.get_desc();
+    const auto cache_dims = cache_md.get_dims();
+    const auto cs = cache_md.get_strides();
+    const auto ts = table.get_desc().get_strides();
+    const auto dst_md = dst.get_desc();
+    const auto dst_dims = dst_md.get_dims();
+    const auto ds = dst_md.get_strides();
+
+    const dim_t block_size = cache_dims[2], D = cache_dims[3];
+    const size_t dt_size = memory::data_type_size(cache_md.get_data_type());
+    const auto *cache_ptr = static_cast<const char *>(cache.get_data_handle());
+    const auto *table_ptr
+            = static_cast<const int32_t *>(table.get_data_handle());
+    auto *dst_ptr = static_cast<char *>(dst.get_data_handle());
+
+    stream.get()->before_exec_hook();
+    dnnl::impl::parallel_nd(dst_dims[0], dst_dims[1], dst_dims[2],
+            [&](dim_t b, dim_t h, dim_t t) {
+                const dim_t blk = table_ptr[b * ts[0] + t / block_size * ts[1]];
+                const char *src = cache_ptr
+                        + (blk * cs[0] + h * cs[1] + t % block_size * cs[2])
+                                * dt_size;
+                char *d = dst_ptr
+                        + (b * ds[0] + h * ds[1] + t * ds[2]) * dt_size;
+                if (cs[3] == 1 && ds[3] == 1) {
+                    std::memcpy(d, src, D * dt_size);
+                    return;
+                }
+                for (dim_t i = 0; i < D; i++)
+                    std::memcpy(d + i * ds[3] * dt_size,
+                            src + i * cs[3] * dt_size, dt_size);
+            });
+    stream.get()->after_exec_hook();
+}
+
 static void get_arg_indices_for_post_ops(const op_t *op, fusion_info_mgr_t &mgr,
         arg_indices_t &indices, size_t &base_index) {
     const fusion_info_t &fusion_info
@@ -2434,6 +2500,19 @@ arg_indices_t genindex_executable_t::get_arg_indices(
     return arg_indices;
 }
 
+arg_indices_t paged_cache_load_executable_t::get_arg_indices(
+        const op_t *op, fusion_info_mgr_t &mgr) {
+    UNUSED(op);
+    UNUSED(mgr);
+
+    arg_indices_t arg_indices;
+    arg_indices.insert({DNNL_ARG_SRC_0, indices_t {input, 0}});
+    arg_indices.insert({DNNL_ARG_SRC_1, indices_t {input, 1}});
+    arg_indices.insert({DNNL_ARG_DST, indices_t {output, 0}});
+
+    return arg_indices;
+}
+
 arg_indices_t sdpa_executable_t::get_arg_indices(
         const op_t *op, fusion_info_mgr_t &mgr) {
     UNUSED(mgr);
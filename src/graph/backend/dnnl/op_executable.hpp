@@ -1161,10 +1161,14 @@ struct concat_executable_t : public op_executable_t {
             fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
         prim_ = dnnl::concat(desc);
+        src_offsets_ = get_src_offsets(op, desc);
     }
 
     void execute(const stream &stream,
             const std::unordered_map<int, memory> &args) const override {
+        // The memory planner may let the producers write the inputs directly
+        // into the output, then there is nothing to copy.
+        if (is_inplaced(args)) return;
         prim_.execute(stream, args);
     }
 
@@ -1188,7 +1192,28 @@ struct concat_executable_t : public op_executable_t {
 #endif
 
 private:
+    // Returns the offsets in bytes of the inputs inside the output or an
+    // empty vector if they can't be computed.
+    static std::vector<size_t> get_src_offsets(
+            std::shared_ptr<op_t> &op, const type &pd);
+
+    bool is_inplaced(const std::unordered_map<int, memory> &args) const {
+        auto dst = args.find(DNNL_ARG_DST);
+        if (src_offsets_.empty() || dst == args.end()) return false;
+        char *dst_ptr = static_cast<char *>(dst->second.get_data_handle());
+        if (dst_ptr == nullptr) return false;
+        for (size_t i = 0; i < src_offsets_.size(); i++) {
+            auto src = args.find(DNNL_ARG_MULTIPLE_SRC + static_cast<int>(i));
+            if (src == args.end()
+                    || src->second.get_data_handle()
+                            != dst_ptr + src_offsets_[i])
+                return false;
+        }
+        return true;
+    }
+
     dnnl::concat prim_;
+    std::vector<size_t> src_offsets_;
 };
 
 struct shuffle_executable_t : public op_executable_t {
@@ -2778,6 +2803,62 @@ private:
 #endif
 };
 
+// Gathers the blocks of a paged key-value cache into a dense tensor. Paged
+// SDPA patterns are only enabled on CPU, so there is no GPU implementation.
+struct paged_cache_load_executable_t : public op_executable_t {
+    DECLARE_ARG_INDICES_GETTER;
+
+    paged_cache_load_executable_t(std::shared_ptr<op_t> &op,
+            const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+            pd_cache_t &pd_cache) {
+        UNUSED(op);
+        UNUSED(p_engine);
+        UNUSED(mgr);
+        UNUSED(pd_cache);
+    }
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override;
+
+#ifdef DNNL_WITH_SYCL
+    ::sycl::event execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps) const override {
+        if (stream.get_engine().get_kind() == engine::kind::cpu) {
+            auto strm_t = stream.get();
+            auto *sycl_stream_impl = dnnl::impl::utils::downcast<
+                    dnnl::impl::xpu::sycl::stream_impl_t *>(strm_t->impl());
+
+            strm_t->before_exec_hook();
+            if (!deps.empty()) { sycl_stream_impl->sycl_ctx().set_deps(deps); }
+
+            execute(stream, args);
+
+            // return output event
+            ::sycl::event return_event = sycl_stream_impl->get_output_event();
+            strm_t->after_exec_hook();
+            return return_event;
+        }
+        assertm(false,
+                "paged_cache_load opexcutable is only implemented for cpu");
+        throw std::runtime_error("Unimplement");
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<cl_event> &deps) const override {
+        UNUSED(stream);
+        UNUSED(args);
+        UNUSED(deps);
+        assertm(false,
+                "paged_cache_load opexcutable is only implemented for cpu");
+        throw std::runtime_error("Unimplement");
+    }
+#endif
+};
+
 struct sdpa_executable_t : public op_executable_t {
     DECLARE_ARG_INDICES_GETTER;
 
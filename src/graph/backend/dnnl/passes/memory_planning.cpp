@@ -26,6 +26,7 @@
 
 #include "graph/backend/dnnl/common.hpp"
 #include "graph/backend/dnnl/op_executable.hpp"
+#include "graph/backend/dnnl/utils.hpp"
 
 #include "graph/backend/dnnl/passes/constant_propagation.hpp"
 #include "graph/backend/dnnl/passes/memory_planning.hpp"
@@ -392,6 +393,17 @@ status_t memory_planner_t::assign_external_inputs_buffer(
 status_t memory_planner_t::assign_external_outputs_buffer(
         std::shared_ptr<subgraph_t> &sg,
         const std::vector<logical_tensor_t> &outputs, fusion_info_mgr_t &mgr) {
+    // The inputs of a concat op are written into the concat output at some
+    // offsets, which is possible only with a temporary buffer. So the concat
+    // output is not replaced with the external buffer of an op inplaced into
+    // it, and the op writes its output out of place instead.
+    auto is_concat_base = [&](const value_t *val) {
+        return std::any_of(concat_views_.begin(), concat_views_.end(),
+                [&](const std::pair<const value_t *const, concat_view_t> &v) {
+                    return v.second.base_ == val;
+                });
+    };
+
     for (auto &val : sg->get_output_values()) {
         for (size_t i = 0; i < outputs.size(); i++) {
             if (val->get_logical_tensor().id == outputs[i].id) {
@@ -426,7 +438,8 @@ status_t memory_planner_t::assign_external_outputs_buffer(
                         auto in_val = producer.get_input_value(pair.in_idx_);
                         if (buffer_assignments_.at(in_val.get()) != orig_info
                                 || buffer_assignments_.at(in_val.get()).kind_
-                                        == external_input)
+                                        == external_input
+                                || is_concat_base(in_val.get()))
                             continue;
                         q.push(in_val.get());
                     }
@@ -487,6 +500,94 @@ status_t memory_planner_t::assign_internal_persistent_buffer(
     return status::success;
 }
 
+// Find the concat ops whose inputs can be produced directly into the concat
+// output. An input qualifies if it is an internal non-constant edge consumed
+// only by the concat op and its memory layout is exactly the layout of the
+// corresponding part of the concat output, i.e. the part is contiguous in the
+// concat output. A concat op is handled only if all its inputs qualify, so the
+// op has nothing left to copy.
+void memory_planner_t::collect_concat_views(std::shared_ptr<subgraph_t> &sg) {
+    // Temporary buffers of other engines can't be referenced with an offset
+    if (sg->p_engine_->get_kind() != dnnl::engine::kind::cpu) return;
+
+    const auto &sg_outs = sg->get_output_values();
+    auto &mgr = sg->fusion_info_mgr_;
+
+    // The output of an op with post-sum must be inplaced with the post-sum
+    // input, so it can't be placed anywhere else
+    auto has_post_sum = [&](const op_t &op) {
+        if (!op.has_attr(op_attr::fusion_info_key)
+                || op.get_attr<int64_t>(op_attr::fusion_info_key) == -1)
+            return false;
+        int64_t key = op.get_attr<int64_t>(op_attr::fusion_info_key);
+        for (const auto &pop : mgr.get_info(key).get_post_ops())
+            if (pop->is_post_sum()) return true;
+        return false;
+    };
+
+    // Compare strides of non-trivial dimensions only
+    auto same_strides = [](const dnnl::memory::desc &a,
+                                const dnnl::memory::desc &b) {
+        const auto &dims = a.get_dims();
+        const auto &a_strides = a.get_strides();
+        const auto &b_strides = b.get_strides();
+        for (size_t i = 0; i < dims.size(); i++) {
+            if (dims[i] != 1 && a_strides[i] != b_strides[i]) return false;
+        }
+        return true;
+    };
+
+    for (auto &op : sg->get_ops()) {
+        if (op->get_kind() != op_kind::dnnl_concat) continue;
+        // Fused scales or zero points change the values
+        if (op->has_attr(op_attr::fusion_info_key)
+                && op->get_attr<int64_t>(op_attr::fusion_info_key) != -1)
+            continue;
+
+        const auto dst_val = op->get_output_value(0);
+        const auto dst_lt = dst_val->get_logical_tensor();
+        if (ltw(dst_lt).layout_type() != layout_type::strided) continue;
+
+        const auto res = utils::try_reverse_axis(
+                op->get_attr<int64_t>(op_attr::axis), dst_lt.ndims);
+        if (!res.first) continue;
+        const auto axis = static_cast<size_t>(res.second);
+
+        const auto dst_md = make_dnnl_memory_desc(dst_lt);
+        const size_t dt_size
+                = dnnl::memory::data_type_size(dst_md.get_data_type());
+        dnnl::memory::dims offsets(dst_md.get_dims().size(), 0);
+
+        std::unordered_map<const value_t *, concat_view_t> views;
+        bool ok = true;
+        for (auto &in_val : op->get_input_values()) {
+            const auto in_lt = in_val->get_logical_tensor();
+            ok = in_val->has_producer() && !has_post_sum(in_val->get_producer())
+                    && in_val->get_consumers().size() == 1
+                    && alias_analyzer_.get_all_aliases(in_val.get()).empty()
+                    && std::find(sg_outs.begin(), sg_outs.end(), in_val.get())
+                            == sg_outs.end()
+                    && ltw(in_lt).property_type() != property_type::constant
+                    && ltw(in_lt).layout_type() == layout_type::strided
+                    && in_lt.data_type == dst_lt.data_type;
+            if (!ok) break;
+
+            const auto in_md = make_dnnl_memory_desc(in_lt);
+            const auto view_md = dst_md.submemory_desc(
+                    in_md.get_dims(), offsets, /* allow_empty = */ true);
+            ok = view_md && in_md.get_size() != 0
+                    && same_strides(in_md, view_md);
+            if (!ok) break;
+
+            const size_t offset = static_cast<size_t>(
+                    view_md.get_submemory_offset() * dt_size);
+            views.insert({in_val.get(), {dst_val.get(), offset}});
+            offsets[axis] += in_md.get_dims()[axis];
+        }
+        if (ok) concat_views_.insert(views.begin(), views.end());
+    }
+}
+
 // Assign internal non constant edges (such as src reorder output in conv
 // pattern) to temporary buffer. Those temporary buffer will be dynamically
 // allocated/freed during execution. In order to reduce memory footprint, we
@@ -530,7 +631,8 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
                         = temporary_buffer_ref_count[info.index_] == 1;
                 if (reuse_in_buffer) {
                     value_t *out = op->get_output_value(pair.out_idx_).get();
-                    if (!buffer_assignments_.count(out)) {
+                    if (!buffer_assignments_.count(out)
+                            && !concat_views_.count(out)) {
                         buffer_assignments_.insert(std::make_pair(out, info));
                         temporary_buffer_ref_count[info.index_]
                                 += edge_ref_count.at(out);
@@ -544,6 +646,32 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
             // already assigned buffer, skip it
             if (buffer_assignments_.count(out.get())) continue;
 
+            // this output is a part of a concat output, so allocate the
+            // concat output in advance and write this output into it
+            auto view = concat_views_.find(out.get());
+            if (view != concat_views_.end()) {
+                const value_t *base = view->second.base_;
+                if (!buffer_assignments_.count(base)) {
+                    size_t idx = temporary_buffer_assigner_.request(
+                            make_dnnl_memory_desc(base->get_logical_tensor())
+                                    .get_size());
+                    buffer_assignments_.insert(std::make_pair(
+                            base, assign_info_t(internal_temporary, idx)));
+                    auto ref = edge_ref_count.find(const_cast<value_t *>(base));
+                    temporary_buffer_ref_count[idx]
+                            = ref == edge_ref_count.end() ? 0 : ref->second;
+                }
+
+                assign_info_t info = buffer_assignments_.at(base);
+                if (info.kind_ == internal_temporary) {
+                    info.offset_ = view->second.offset_;
+                    buffer_assignments_.insert(std::make_pair(out.get(), info));
+                    temporary_buffer_ref_count[info.index_]
+                            += edge_ref_count.at(out.get());
+                    continue;
+                }
+            }
+
             // this output need a new buffer, record it
             auto lt = out->get_logical_tensor();
             size_t idx = temporary_buffer_assigner_.request(
@@ -711,6 +839,9 @@ status_t memory_planner_t::book_buffers(std::shared_ptr<subgraph_t> &sg) {
 
     registrar_t temporary_registrar = temporary_registry_.registrar();
     registrar_t persistent_registrar = persistent_registry_.registrar();
+    // book the parts of concat outputs after the whole buffers. Their keys
+    // follow the keys of the whole buffers.
+    std::vector<const value_t *> views;
     for (const value_t *val : to_be_booked) {
         const assign_info_t &info = buffer_assignments_.at(val);
         switch (info.kind_) {
@@ -720,6 +851,10 @@ status_t memory_planner_t::book_buffers(std::shared_ptr<subgraph_t> &sg) {
             case external_output: break;
             // book buffers for internal temporary and persistent
             case internal_temporary:
+                if (info.offset_ != 0) {
+                    views.emplace_back(val);
+                    break;
+                }
                 temporary_registrar.book(info.index_,
                         temporary_buffer_assigner_.query_size(info.index_));
                 break;
@@ -734,6 +869,18 @@ status_t memory_planner_t::book_buffers(std::shared_ptr<subgraph_t> &sg) {
                         info.kind_);
         }
     }
+
+    for (const value_t *val : views) {
+        const assign_info_t &info = buffer_assignments_.at(val);
+        const auto view = std::make_pair(info.index_, info.offset_);
+        if (!temporary_view_keys_.count(view)) {
+            size_t key = temporary_buffer_assigner_.num_buffers()
+                    + temporary_view_keys_.size();
+            temporary_view_keys_.insert({view, key});
+        }
+        temporary_registrar.book_view(
+                temporary_view_keys_.at(view), info.index_, info.offset_);
+    }
     return status::success;
 }
 
@@ -751,10 +898,14 @@ status_t memory_planner_t::prepare_execution_args_set(
             case external_output:
                 exec_args_set_.add_mem_use_external_outputs({mem, info.index_});
                 break;
-            case internal_temporary:
-                exec_args_set_.add_mem_use_internal_temporary(
-                        {mem, info.index_});
+            case internal_temporary: {
+                size_t key = info.offset_ == 0
+                        ? info.index_
+                        : temporary_view_keys_.at(
+                                std::make_pair(info.index_, info.offset_));
+                exec_args_set_.add_mem_use_internal_temporary({mem, key});
                 break;
+            }
             case internal_persistent:
                 exec_args_set_.add_mem_use_internal_persistent(
                         {mem, info.index_});
@@ -895,6 +1046,9 @@ status_t memory_planner_t::run(std::shared_ptr<subgraph_t> &sg) {
     // Assign external_input buffers to subgraph's inputs and their alias
     CHECK(assign_external_inputs_buffer(sg, inputs));
 
+    // Find the concat inputs which can be written into the concat outputs
+    collect_concat_views(sg);
+
     // Assign internal temporary buffer for all other edges
     CHECK(assign_internal_temporary_buffer(sg, edge_ref_count, mgr, false));
 
@@ -278,6 +278,9 @@ public:
         return data_[id]->max_bytes_;
     }
 
+    // return the number of allocated buffers
+    size_t num_buffers() const { return data_.size(); }
+
     void clear() {
         free_.clear();
         data_.clear();
@@ -326,6 +329,10 @@ private:
 //   Take this subgraph 't1 -> op1 -> t2 -> op2 -> t3 -> op3 -> t4-> op4 -> t5'
 //   as an example: when writing data to t4, t2 is not used any more, so they
 //   have disjoint live range and we can make them share same buffer.
+// - Concat sharing. If every input of a concat op is a contiguous part of the
+//   concat output, the producers of the inputs write their results directly
+//   into the concat output buffer at the corresponding offsets, so the concat
+//   op doesn't need to copy anything.
 //
 // The following internal env vars can be used to control the memory planning:
 // - _ONEDNN_GRAPH_ENABLE_MEM_REUSE
@@ -383,6 +390,7 @@ public:
         }
 
         str += std::to_string(info.index_);
+        if (info.offset_ != 0) str += "_+" + std::to_string(info.offset_);
         return str;
     }
 
@@ -396,15 +404,16 @@ private:
 
     class assign_info_t {
     public:
-        assign_info_t(buffer_kind_t kind, size_t index)
-            : kind_(kind), index_(index) {}
+        assign_info_t(buffer_kind_t kind, size_t index, size_t offset = 0)
+            : kind_(kind), index_(index), offset_(offset) {}
 
         assign_info_t() = default;
         assign_info_t(const assign_info_t &other) = default;
         assign_info_t &operator=(const assign_info_t &other) = default;
 
         bool operator==(const assign_info_t &other) const {
-            return kind_ == other.kind_ && index_ == other.index_;
+            return kind_ == other.kind_ && index_ == other.index_
+                    && offset_ == other.offset_;
         }
 
         bool operator!=(const assign_info_t &other) const {
@@ -413,6 +422,13 @@ private:
 
         buffer_kind_t kind_;
         size_t index_; // the index to allocated buffer
+        size_t offset_; // the offset in bytes inside the allocated buffer
+    };
+
+    // A part of a concat op output starting at the given offset in bytes
+    struct concat_view_t {
+        const value_t *base_;
+        size_t offset_;
     };
 
     struct time_bound_t {
@@ -430,8 +446,12 @@ private:
         temporary_registry_.clear();
         external_inputs_live_range_.clear();
         inplace_pairs_.clear();
+        concat_views_.clear();
+        temporary_view_keys_.clear();
     }
 
+    void collect_concat_views(std::shared_ptr<subgraph_t> &sg);
+
     status_t assign_external_inputs_buffer(std::shared_ptr<subgraph_t> &sg,
             const std::vector<logical_tensor_t> &inputs);
 
@@ -467,6 +487,10 @@ private:
     std::unordered_map<const assign_info_t *, time_bound_t>
             external_inputs_live_range_;
     std::vector<inplace_pair_t> inplace_pairs_;
+    // the inputs of concat ops which are written into the concat outputs
+    std::unordered_map<const value_t *, concat_view_t> concat_views_;
+    // the registry keys of temporary buffers with a non-zero offset
+    std::map<std::pair<size_t, size_t>, size_t> temporary_view_keys_;
 };
 
 } // namespace dnnl_impl
@@ -134,6 +134,57 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_sdp_fusion_cpu)
             return std::make_shared<sdp_base_t<>>();
         });
 
+/*
+ [query] [key cache]  [block table]  [value cache]
+     \        \          /       \       /
+      \     PagedCacheLoad       PagedCacheLoad
+       \          |                    |
+        \ [StaticTranspose]*           |
+         \     /                       |
+          MatMul                       |
+            |                          |
+    [scale and masks]*                 |
+            |                          |
+         Softmax                       |
+               \                      /
+                 ------- MatMul -------
+                           |
+            [StaticTranspose + Reshape/Reorder]*
+                           |
+                       [output]
+*/
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_paged_sdp_fusion_cpu)
+        .set_priority(22.0f)
+        .set_kind(partition_kind_t::sdp)
+        .set_engine_kind(engine_kind::cpu)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    auto paged_key
+                            = pgraph->append_op(graph::op_kind::PagedCacheLoad);
+                    auto popt_graph = std::make_shared<pb_graph_t>();
+                    auto transpose_key = popt_graph->append_op(
+                            graph::op_kind::StaticTranspose);
+                    popt_graph->create_input_port(0, transpose_key, 0);
+                    popt_graph->create_output_port(0, transpose_key, 0);
+                    auto opt_transpose_key = pgraph->append_optional(
+                            popt_graph, {in_edge(0, paged_key, 0)});
+                    auto matmul_qk = pgraph->append_op(graph::op_kind::MatMul,
+                            {in_edge(1, opt_transpose_key, 0)});
+                    auto optional_scale_and_mask
+                            = optional_scale_and_masks(pgraph, matmul_qk);
+                    auto softmax = pgraph->append_op(graph::op_kind::SoftMax,
+                            {in_edge(0, optional_scale_and_mask, 0)});
+                    auto paged_value
+                            = pgraph->append_op(graph::op_kind::PagedCacheLoad);
+                    auto matmul_v = pgraph->append_op(graph::op_kind::MatMul,
+                            {in_edge(0, softmax, 0),
+                                    in_edge(1, paged_value, 0)});
+                    optional_transpose_reshape(pgraph, matmul_v, 0);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<sdp_base_t<>>();
+        });
+
 DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, float_sdp_gemma_fusion_cpu)
         .set_priority(21.0f)
         .set_kind(partition_kind_t::sdp)
@@ -153,6 +153,13 @@ public:
         lcm_alignment_ = graph::utils::lcm(lcm_alignment_, alignment);
     }
 
+    // book a piece of memory inside an already booked piece
+    void book_view(const key_t &key, const key_t &base_key, size_t offset) {
+        if (offset_map_.count(key)) return;
+        assertm(offset_map_.count(base_key), "base piece is not booked");
+        offset_map_.insert({key, offset_map_.at(base_key) + offset});
+    }
+
     // get the offset of a booked piece of memory
     offset_t get(const key_t &key) const {
         if (size_ == 0 || offset_map_.count(key) != 1) return 0;
@@ -194,6 +201,11 @@ public:
         registry_.book(key, size, alignment);
     }
 
+    void book_view(const registry_t::key_t &key,
+            const registry_t::key_t &base_key, size_t offset) {
+        registry_.book_view(key, base_key, offset);
+    }
+
 private:
     registry_t &registry_;
 };
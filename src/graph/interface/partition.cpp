@@ -331,6 +331,11 @@ status_t DNNL_API dnnl_graph_compiled_partition_execute(
                 compiled_partition->info(), duration_ms);
     } else {
         CHECK(compiled_partition->execute(stream, ins, outs));
+        // Kernels release their temporary buffers on return, so primitives
+        // submitted to an asynchronous CPU stream have to be completed.
+        if (stream->engine()->kind() == engine_kind::cpu
+                && (stream->flags() & dnnl::impl::stream_flags::out_of_order))
+            CHECK(stream->wait());
     }
     return status::success;
 }
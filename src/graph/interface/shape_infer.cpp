@@ -1735,6 +1735,38 @@ status_t infer_groupnorm_output_shape(op_t *n,
     return status::success;
 }
 
+status_t infer_paged_cache_load_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto cache = logical_tensor_wrapper_t(inputs[0]);
+    auto block_table = logical_tensor_wrapper_t(inputs[1]);
+    auto out0 = logical_tensor_wrapper_t(outputs[0]);
+
+    VCHECK_INVALID_SHAPE(cache.ndims() == 4 && block_table.ndims() == 2,
+            "%s, cache should be 4D and block table should be 2D, but got "
+            "%d and %d",
+            op_t::kind2str(n->get_kind()).c_str(), cache.ndims(),
+            block_table.ndims());
+
+    // cache: [num_blocks, num_heads, block_size, head_size]
+    // block_table: [batch_size, max_blocks_per_seq]
+    // dst: [batch_size, num_heads, max_blocks_per_seq * block_size, head_size]
+    const dims cache_dims = cache.vdims();
+    const dims table_dims = block_table.vdims();
+    dims inferred_out_shape = {table_dims[0], cache_dims[1],
+            table_dims[1] * cache_dims[2], cache_dims[3]};
+
+    if (!out0.is_shape_unknown()) {
+        VCHECK_INVALID_SHAPE(validate(inferred_out_shape, out0.vdims()),
+                "%s, inferred out shape and output shape are not compatible",
+                op_t::kind2str(n->get_kind()).c_str());
+        return status::success;
+    }
+
+    set_shape_and_strides(*outputs[0], inferred_out_shape);
+    return status::success;
+}
+
 } // namespace graph
 } // namespace impl
 } // namespace dnnl
@@ -210,6 +210,10 @@ status_t infer_prelu_bwd_output_shape(op_t *n,
 status_t infer_groupnorm_output_shape(op_t *n,
         std::vector<logical_tensor_t *> &inputs,
         std::vector<logical_tensor_t *> &outputs);
+
+status_t infer_paged_cache_load_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs);
 } // namespace graph
 } // namespace impl
 } // namespace dnnl
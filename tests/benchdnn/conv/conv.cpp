@@ -444,7 +444,10 @@ void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
 
     float trh = 0.f;
     if (prb->alg & WINO) {
-        trh = prb->dt[1] == dnnl_f16 ? 7e-3f : 2e-5f;
+        // bf16 transformed tensors keep only 8 bits of mantissa.
+        trh = prb->dt[1] == dnnl_bf16 ? 1e-2f
+                : prb->dt[1] == dnnl_f16 ? 7e-3f
+                                         : 2e-5f;
         if (prb->dir & FLAG_WEI) {
             // This is an empirical equation derived by observing growth error
             // with increasing 'k' dimension in gemm of winograd
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2021 Intel Corporation
+* Copyright 2019-2025 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -20,6 +20,7 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include <tuple>
+#include <vector>
 
 namespace dnnl {
 
@@ -29,10 +30,6 @@ static bool are_valid_flags(
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
     if (engine_kind == dnnl_gpu && (stream_flags & dnnl_stream_out_of_order))
         ok = false;
-#endif
-#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
-    if (engine_kind == dnnl_cpu && (stream_flags & dnnl_stream_out_of_order))
-        ok = false;
 #endif
     return ok;
 }
@@ -137,6 +134,90 @@ TEST(stream_test_c_t, GetStream) {
 }
 #endif
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+TEST(stream_test_cpp_t, OutOfOrderCPU) {
+    engine eng(engine::kind::cpu, 0);
+
+    memory::dims dims = {2, 3, 4, 5};
+    memory::desc md(dims, memory::data_type::f32, memory::format_tag::nchw);
+    const size_t nelems = 2 * 3 * 4 * 5;
+
+    // dst = 2 * src + 1
+    auto eltwise_pd = eltwise_forward::primitive_desc(eng, prop_kind::forward,
+            algorithm::eltwise_linear, md, md, 2.f, 1.f);
+    auto eltwise = eltwise_forward(eltwise_pd);
+
+    stream s(eng, stream::flags::out_of_order);
+
+    // Two independent chains: an in-place one and one ping-ponging between
+    // two buffers. Each step depends on the previous one of its chain.
+    std::vector<memory> mems;
+    for (int i = 0; i < 3; i++) {
+        mems.emplace_back(md, eng);
+        float *ptr = static_cast<float *>(mems.back().get_data_handle());
+        for (size_t j = 0; j < nelems; j++)
+            ptr[j] = 0.f;
+    }
+    const int nsteps = 8;
+    for (int step = 0; step < nsteps; step++) {
+        eltwise.execute(s, {{DNNL_ARG_SRC, mems[0]}, {DNNL_ARG_DST, mems[0]}});
+        const auto &src = mems[1 + step % 2], &dst = mems[1 + (step + 1) % 2];
+        eltwise.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    }
+    s.wait();
+
+    // Both chains compute 2^nsteps - 1.
+    const float expected = (float)((1 << nsteps) - 1);
+    for (int i : {0, 1}) {
+        const float *ptr = static_cast<float *>(mems[i].get_data_handle());
+        for (size_t j = 0; j < nelems; j++)
+            ASSERT_EQ(ptr[j], expected);
+    }
+}
+#endif
+
+#if defined(DNNL_EXPERIMENTAL_PROFILING) \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+TEST(stream_test_cpp_t, TestProfilingAPICPU) {
+    engine eng(engine::kind::cpu, 0);
+
+    memory::dims dims = {2, 3, 4, 5};
+    memory::desc md(dims, memory::data_type::f32, memory::format_tag::nchw);
+
+    auto eltwise_pd = eltwise_forward::primitive_desc(
+            eng, prop_kind::forward, algorithm::eltwise_relu, md, md, 0.0f);
+    auto eltwise = eltwise_forward(eltwise_pd);
+    auto mem = memory(md, eng);
+
+    stream s(eng, stream::flags::profiling);
+
+    // Reset profiler's state.
+    ASSERT_NO_THROW(reset_profiling(s));
+
+    // Every execution is expected to produce an entry.
+    eltwise.execute(s, {{DNNL_ARG_SRC, mem}, {DNNL_ARG_DST, mem}});
+    eltwise.execute(s, {{DNNL_ARG_SRC, mem}, {DNNL_ARG_DST, mem}});
+    s.wait();
+
+    // Query profiling data.
+    std::vector<uint64_t> nsec;
+    ASSERT_NO_THROW(nsec = get_profiling_data(s, profiling_data_kind::time));
+    ASSERT_EQ(nsec.size(), 2u);
+
+    // Reset profiler's state.
+    ASSERT_NO_THROW(reset_profiling(s));
+    // Test that the profiler's state was reset.
+    ASSERT_NO_THROW(nsec = get_profiling_data(s, profiling_data_kind::time));
+    ASSERT_TRUE(nsec.empty());
+
+    // A stream without the profiling flag doesn't collect the data.
+    stream s_no_prof(eng);
+    ASSERT_ANY_THROW(reset_profiling(s_no_prof));
+}
+#endif
+
 namespace {
 struct print_to_string_param_name_t {
     template <class ParamType>
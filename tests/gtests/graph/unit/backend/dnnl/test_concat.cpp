@@ -14,11 +14,15 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cmath>
 #include <functional>
 #include <random>
 
 #include "gtest/gtest.h"
 
+#include "backend/dnnl/dnnl_partition_impl.hpp"
+#include "backend/dnnl/kernels/large_partition.hpp"
+
 #include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
 #include "graph/unit/unit_test_common.hpp"
 #include "graph/unit/utils.hpp"
@@ -424,3 +428,135 @@ TEST(test_concat_execute, ConcatEmptyInput) {
             graph::status::success);
     strm->wait();
 }
+
+TEST(test_concat_execute, ConcatWithProducersInPartition) {
+    /*
+      relu    abs   (abs)
+         \   /   \   /
+         concat   (the abs output may also be a partition output)
+           |
+          relu
+    */
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    const std::vector<int64_t> src0_shape {2, 3, 4, 4};
+    const std::vector<int64_t> src1_shape {2, 5, 4, 4};
+    const std::vector<int64_t> dst_shape {2, 8, 4, 4};
+
+    std::vector<float> src0_data(utils::product(src0_shape));
+    std::vector<float> src1_data(utils::product(src1_shape));
+    for (size_t i = 0; i < src0_data.size(); i++)
+        src0_data[i] = static_cast<float>(i % 11) - 5.f;
+    for (size_t i = 0; i < src1_data.size(); i++)
+        src1_data[i] = static_cast<float>(i % 7) - 3.f;
+
+    // If the output of abs is also an output of the partition, it can't be
+    // written into the concat output, and the concat copies its inputs.
+    for (bool abs_is_output : {false, true}) {
+        graph::op_t relu0(0, graph::op_kind::ReLU, "relu0");
+        graph::op_t abs1(1, graph::op_kind::Abs, "abs1");
+        graph::op_t concat(2, graph::op_kind::Concat, "concat");
+        concat.set_attr<int64_t>(graph::op_attr::axis, 1);
+        graph::op_t relu3(3, graph::op_kind::ReLU, "relu3");
+        graph::op_t abs4(4, graph::op_kind::Abs, "abs4");
+
+        auto src0 = utils::logical_tensor_init(
+                0, src0_shape, graph::data_type::f32);
+        auto src1 = utils::logical_tensor_init(
+                1, src1_shape, graph::data_type::f32);
+        auto relu0_dst = utils::logical_tensor_init(
+                2, src0_shape, graph::data_type::f32);
+        auto abs1_dst = utils::logical_tensor_init(
+                3, src1_shape, graph::data_type::f32);
+        auto concat_dst = utils::logical_tensor_init(
+                4, dst_shape, graph::data_type::f32);
+        auto dst = utils::logical_tensor_init(
+                5, dst_shape, graph::data_type::f32);
+        auto abs4_dst = utils::logical_tensor_init(
+                6, src1_shape, graph::data_type::f32);
+
+        relu0.add_input(src0);
+        relu0.add_output(relu0_dst);
+        abs1.add_input(src1);
+        abs1.add_output(abs1_dst);
+        concat.add_input(relu0_dst);
+        concat.add_input(abs1_dst);
+        concat.add_output(concat_dst);
+        relu3.add_input(concat_dst);
+        relu3.add_output(dst);
+        abs4.add_input(abs1_dst);
+        abs4.add_output(abs4_dst);
+
+        graph::graph_t g(eng->kind());
+        g.add_op(&relu0);
+        g.add_op(&abs1);
+        g.add_op(&concat);
+        g.add_op(&relu3);
+        if (abs_is_output) g.add_op(&abs4);
+        g.finalize();
+
+        // The reference runs the ops one by one, so the concat copies.
+        graph::graph_t ref_g(eng->kind());
+        ref_g.add_op(&relu0);
+        ref_g.add_op(&abs1);
+        ref_g.add_op(&concat);
+        ref_g.add_op(&relu3);
+        ref_g.finalize();
+
+        test_tensor_t src0_ts(src0, eng, src0_data);
+        test_tensor_t src1_ts(src1, eng, src1_data);
+        test_tensor_t ref_dst_ts(dst, eng);
+        ASSERT_EQ(run_graph(ref_g, {src0_ts, src1_ts}, {ref_dst_ts}, *eng,
+                          *strm),
+                graph::status::success);
+
+        // The partition holds all the ops but abs4, which is left outside
+        // to consume the output of abs1.
+        const graph::fpmath_t fpm {graph::fpmath_mode::strict, false};
+        auto part_impl
+                = std::make_shared<graph::dnnl_impl::dnnl_partition_impl_t>(
+                        eng->kind(), fpm, graph::partition_kind_t::undef);
+        for (const auto &op : g.get_ops()) {
+            if (op->get_id() != abs4.get_id()) part_impl->add_op(op);
+        }
+        part_impl->init(graph::dnnl_impl::large_partition_kernel_creator);
+
+        graph::partition_t p;
+        p.init(part_impl);
+        auto partition_inputs = p.get_inputs();
+        auto partition_outputs = p.get_outputs();
+        ASSERT_EQ(partition_inputs.size(), 2U);
+        ASSERT_EQ(partition_outputs.size(), abs_is_output ? 2U : 1U);
+
+        std::vector<const graph::logical_tensor_t *> inputs, outputs;
+        std::vector<test_tensor_t> inputs_ts, outputs_ts;
+        for (auto &lt : partition_inputs) {
+            inputs.emplace_back(&lt);
+            inputs_ts.emplace_back(lt.id == src0.id ? src0_ts : src1_ts);
+        }
+        for (auto &lt : partition_outputs) {
+            outputs.emplace_back(&lt);
+            outputs_ts.emplace_back(lt, eng);
+        }
+
+        graph::compiled_partition_t cp(p);
+        ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+        ASSERT_EQ(cp.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                          test_tensor_t::to_graph_tensor(outputs_ts)),
+                graph::status::success);
+        strm->wait();
+
+        for (size_t i = 0; i < partition_outputs.size(); i++) {
+            const auto out = outputs_ts[i].as_vec_type<float>();
+            if (partition_outputs[i].id == dst.id) {
+                const auto ref = ref_dst_ts.as_vec_type<float>();
+                ASSERT_EQ(out, ref);
+            } else {
+                ASSERT_EQ(partition_outputs[i].id, abs1_dst.id);
+                for (size_t j = 0; j < src1_data.size(); j++)
+                    ASSERT_EQ(out[j], std::fabs(src1_data[j]));
+            }
+        }
+    }
+}
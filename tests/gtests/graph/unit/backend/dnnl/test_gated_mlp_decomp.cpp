@@ -0,0 +1,187 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl_graph.hpp"
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+#include "graph/unit/utils.hpp"
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+using dim_t = dnnl_dim_t;
+using dims = std::vector<dim_t>;
+
+static inline void custom_setenv(
+        const char *name, const char *value, int overwrite) {
+#ifdef _WIN32
+    SetEnvironmentVariable(name, value);
+#else
+    ::setenv(name, value, overwrite);
+#endif
+}
+
+// Constructs gated mlp: down(binary(act(src x wei_gate), src x wei_up)). When
+// swish is true, the activation is decomposed into Sigmoid and Multiply,
+// otherwise ReLU is used.
+static void construct_gated_mlp(graph::graph_t *agraph, dim_t M, dim_t K,
+        dim_t N, dim_t O, bool swish, graph::op_kind_t bin_kind) {
+    const auto dt = graph::data_type::f32;
+    size_t lt_id = 0;
+    auto src = utils::logical_tensor_init(lt_id++, {M, K}, dt);
+    auto wei_gate = utils::logical_tensor_init(lt_id++, {K, N}, dt);
+    auto wei_up = utils::logical_tensor_init(lt_id++, {K, N}, dt);
+    auto wei_down = utils::logical_tensor_init(lt_id++, {N, O}, dt);
+    auto gate_out = utils::logical_tensor_init(lt_id++, {M, N}, dt);
+    auto up_out = utils::logical_tensor_init(lt_id++, {M, N}, dt);
+    auto sig_out = utils::logical_tensor_init(lt_id++, {M, N}, dt);
+    auto act_out = utils::logical_tensor_init(lt_id++, {M, N}, dt);
+    auto bin_out = utils::logical_tensor_init(lt_id++, {M, N}, dt);
+    auto dst = utils::logical_tensor_init(lt_id++, {M, O}, dt);
+
+    graph::op_t fc_gate {0, graph::op_kind::MatMul, "fc_gate"};
+    graph::op_t fc_up {1, graph::op_kind::MatMul, "fc_up"};
+    graph::op_t sigmoid {2, graph::op_kind::Sigmoid, "sigmoid"};
+    graph::op_t act {3,
+            swish ? graph::op_kind::Multiply : graph::op_kind::ReLU, "act"};
+    graph::op_t bin {4, bin_kind, "bin"};
+    graph::op_t fc_down {5, graph::op_kind::MatMul, "fc_down"};
+
+    fc_gate.add_input(src);
+    fc_gate.add_input(wei_gate);
+    fc_gate.add_output(gate_out);
+    fc_up.add_input(src);
+    fc_up.add_input(wei_up);
+    fc_up.add_output(up_out);
+    act.add_input(gate_out);
+    if (swish) {
+        sigmoid.add_input(gate_out);
+        sigmoid.add_output(sig_out);
+        act.add_input(sig_out);
+    }
+    act.add_output(act_out);
+    bin.add_input(act_out);
+    bin.add_input(up_out);
+    bin.add_output(bin_out);
+    fc_down.add_input(bin_out);
+    fc_down.add_input(wei_down);
+    fc_down.add_output(dst);
+
+    agraph->add_op(&fc_gate);
+    agraph->add_op(&fc_up);
+    if (swish) agraph->add_op(&sigmoid);
+    agraph->add_op(&act);
+    agraph->add_op(&bin);
+    agraph->add_op(&fc_down);
+}
+
+// Compiles and executes the partition with and without the decomposition
+// kernel and compares the results.
+static void run_and_compare(const std::string &pass_name, dim_t M, dim_t K,
+        dim_t N, dim_t O, bool swish, graph::op_kind_t bin_kind) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    graph::graph_t g(eng->kind());
+    construct_gated_mlp(&g, M, K, N, O, swish, bin_kind);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass(pass_name);
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+
+    auto partition_inputs = p.get_inputs();
+    auto partition_outputs = p.get_outputs();
+    // The source is consumed by both the gate and the up projections.
+    ASSERT_EQ(partition_inputs.size(), 5U);
+    ASSERT_EQ(partition_outputs.size(), 1U);
+
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (auto &lt : partition_inputs)
+        inputs.emplace_back(&lt);
+    for (auto &lt : partition_outputs) {
+        lt = utils::logical_tensor_init(
+                lt.id, lt.data_type, graph::layout_type::any);
+        outputs.emplace_back(&lt);
+    }
+
+    // Repeated inputs are bound to the same tensor.
+    std::vector<test_tensor_t> inputs_ts;
+    std::unordered_map<size_t, size_t> input_idx;
+    for (auto &lt : inputs) {
+        if (input_idx.count(lt->id)) {
+            inputs_ts.emplace_back(inputs_ts[input_idx[lt->id]]);
+            continue;
+        }
+        input_idx[lt->id] = inputs_ts.size();
+        inputs_ts.emplace_back(*lt, eng);
+        inputs_ts.back().fill<float>(0.f, 1.f);
+    }
+
+    std::vector<std::vector<test_tensor_t>> outputs_ts(2);
+    for (int force_primitive : {1, 0}) {
+        custom_setenv("_ONEDNN_GRAPH_GATED_MLP_FORCE_PRIMITIVE",
+                force_primitive ? "1" : "0", 1);
+        graph::compiled_partition_t cp(p);
+        ASSERT_EQ(p.compile(&cp, inputs, outputs, eng),
+                graph::status::success);
+        auto &outs = outputs_ts[force_primitive];
+        for (auto &lt : outputs) {
+            graph::logical_tensor_t compiled_output;
+            cp.query_logical_tensor(lt->id, &compiled_output);
+            outs.emplace_back(compiled_output, eng);
+        }
+        ASSERT_EQ(cp.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                          test_tensor_t::to_graph_tensor(outs)),
+                graph::status::success);
+        strm->wait();
+    }
+
+    ASSERT_TRUE(allclose<float>(outputs_ts[0][0], outputs_ts[1][0],
+            /*rtol*/ 1e-4f,
+            /*atol*/ 1e-4f));
+}
+
+TEST(test_gated_mlp_decomp_execute, F32SwishGatedMlp_CPU) {
+    SKIP_IF(get_engine()->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    // Single token, a full block and a block with tail.
+    for (dim_t M : {1, 32, 70})
+        run_and_compare("gated_mlp_v1", M, 64, 384, 96, true,
+                graph::op_kind::Multiply);
+}
+
+TEST(test_gated_mlp_decomp_execute, F32ReluGatedMlp_CPU) {
+    SKIP_IF(get_engine()->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    for (auto bin_kind : {graph::op_kind::Multiply, graph::op_kind::Add,
+                 graph::op_kind::Subtract})
+        run_and_compare("gated_mlp", 40, 64, 256, 64, false, bin_kind);
+}
@@ -0,0 +1,233 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl_graph.hpp"
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+#include "graph/unit/utils.hpp"
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+using dim_t = dnnl_dim_t;
+using dims = std::vector<dim_t>;
+
+namespace {
+
+// Shapes shared by the tests: 2 sequences of 3 blocks of 4 tokens taken from
+// a pool of 8 blocks in a scattered order.
+constexpr dim_t B = 2, H = 2, Q = 3, D = 16, BS = 4, NBS = 3, NB = 8;
+constexpr dim_t S = NBS * BS;
+const std::vector<int32_t> block_table = {5, 2, 7, 0, 3, 1};
+
+float cache_at(const std::vector<float> &cache, dim_t b, dim_t h, dim_t t,
+        dim_t d) {
+    const dim_t blk = block_table[b * NBS + t / BS];
+    return cache[((blk * H + h) * BS + t % BS) * D + d];
+}
+
+// Compiles the only partition produced by `pass_name` for the graph and
+// executes it with the given inputs.
+void compile_and_execute(graph::graph_t &g, const std::string &pass_name,
+        std::vector<test_tensor_t> &inputs_ts, test_tensor_t &output_ts) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    g.finalize();
+    graph::pass::pass_base_ptr apass = get_pass(pass_name);
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+
+    auto partition_inputs = p.get_inputs();
+    auto partition_outputs = p.get_outputs();
+    ASSERT_EQ(partition_outputs.size(), 1U);
+
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (auto &lt : partition_inputs)
+        inputs.emplace_back(&lt);
+    outputs.emplace_back(&partition_outputs[0]);
+
+    graph::compiled_partition_t cp(p);
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    // Partition inputs may come in any order and repeat the tensors consumed
+    // by several ops, so the tensors are matched by the ids of their logical
+    // tensors.
+    std::vector<test_tensor_t> ordered_ts;
+    for (auto &lt : partition_inputs)
+        for (auto &ts : inputs_ts)
+            if (ts.get().get_logical_tensor().id == lt.id)
+                ordered_ts.emplace_back(ts);
+    ASSERT_EQ(ordered_ts.size(), partition_inputs.size());
+
+    graph::logical_tensor_t compiled_output;
+    cp.query_logical_tensor(partition_outputs[0].id, &compiled_output);
+    output_ts = test_tensor_t(compiled_output, eng);
+    ASSERT_EQ(cp.execute(strm, test_tensor_t::to_graph_tensor(ordered_ts),
+                      {output_ts.get()}),
+            graph::status::success);
+    strm->wait();
+}
+
+} // namespace
+
+TEST(test_paged_cache_load_execute, Gather_CPU) {
+    SKIP_IF(get_engine()->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    const auto f32 = graph::data_type::f32;
+    auto cache_lt = utils::logical_tensor_init(0, {NB, H, BS, D}, f32);
+    auto table_lt = utils::logical_tensor_init(
+            1, {B, NBS}, graph::data_type::s32);
+    auto dst_lt = utils::logical_tensor_init(2, {B, H, S, D}, f32);
+
+    graph::op_t load {0, graph::op_kind::PagedCacheLoad, "load"};
+    load.add_input(cache_lt);
+    load.add_input(table_lt);
+    load.add_output(dst_lt);
+
+    graph::graph_t g(get_engine()->kind());
+    ASSERT_EQ(g.add_op(&load), graph::status::success);
+
+    std::vector<test_tensor_t> inputs_ts;
+    inputs_ts.emplace_back(cache_lt, get_engine());
+    inputs_ts.back().fill<float>(0.f, 1.f);
+    inputs_ts.emplace_back(table_lt, get_engine(), block_table);
+    test_tensor_t dst_ts;
+    compile_and_execute(g, "paged_cache_load_pass", inputs_ts, dst_ts);
+
+    const auto cache = inputs_ts[0].as_vec_type<float>();
+    const auto dst = dst_ts.as_vec_type<float>();
+    for (dim_t b = 0; b < B; b++)
+        for (dim_t h = 0; h < H; h++)
+            for (dim_t t = 0; t < S; t++)
+                for (dim_t d = 0; d < D; d++)
+                    ASSERT_EQ(dst[((b * H + h) * S + t) * D + d],
+                            cache_at(cache, b, h, t, d));
+}
+
+TEST(test_paged_cache_load_execute, PagedSdpa_CPU) {
+    SKIP_IF(get_engine()->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    const auto f32 = graph::data_type::f32;
+    // Keys are either transposed by the matmul or by an explicit transpose.
+    for (bool explicit_transpose : {false, true}) {
+        size_t id = 0;
+        auto q_lt = utils::logical_tensor_init(id++, {B, H, Q, D}, f32);
+        auto k_cache_lt = utils::logical_tensor_init(id++, {NB, H, BS, D}, f32);
+        auto v_cache_lt = utils::logical_tensor_init(id++, {NB, H, BS, D}, f32);
+        auto table_lt = utils::logical_tensor_init(
+                id++, {B, NBS}, graph::data_type::s32);
+        auto k_lt = utils::logical_tensor_init(id++, {B, H, S, D}, f32);
+        auto kt_lt = utils::logical_tensor_init(id++, {B, H, D, S}, f32);
+        auto v_lt = utils::logical_tensor_init(id++, {B, H, S, D}, f32);
+        auto score_lt = utils::logical_tensor_init(id++, {B, H, Q, S}, f32);
+        auto prob_lt = utils::logical_tensor_init(id++, {B, H, Q, S}, f32);
+        auto dst_lt = utils::logical_tensor_init(id++, {B, H, Q, D}, f32);
+
+        graph::op_t load_k {0, graph::op_kind::PagedCacheLoad, "load_k"};
+        load_k.add_input(k_cache_lt);
+        load_k.add_input(table_lt);
+        load_k.add_output(k_lt);
+
+        graph::op_t transpose_k {1, graph::op_kind::StaticTranspose, "trans"};
+        transpose_k.set_attr<std::vector<int64_t>>(
+                graph::op_attr::order, {0, 1, 3, 2});
+        transpose_k.add_input(k_lt);
+        transpose_k.add_output(kt_lt);
+
+        graph::op_t matmul_qk {2, graph::op_kind::MatMul, "matmul_qk"};
+        matmul_qk.set_attr<bool>(
+                graph::op_attr::transpose_b, !explicit_transpose);
+        matmul_qk.add_input(q_lt);
+        matmul_qk.add_input(explicit_transpose ? kt_lt : k_lt);
+        matmul_qk.add_output(score_lt);
+
+        graph::op_t softmax {3, graph::op_kind::SoftMax, "softmax"};
+        softmax.set_attr<int64_t>(graph::op_attr::axis, 3);
+        softmax.add_input(score_lt);
+        softmax.add_output(prob_lt);
+
+        graph::op_t load_v {4, graph::op_kind::PagedCacheLoad, "load_v"};
+        load_v.add_input(v_cache_lt);
+        load_v.add_input(table_lt);
+        load_v.add_output(v_lt);
+
+        graph::op_t matmul_v {5, graph::op_kind::MatMul, "matmul_v"};
+        matmul_v.add_input(prob_lt);
+        matmul_v.add_input(v_lt);
+        matmul_v.add_output(dst_lt);
+
+        graph::graph_t g(get_engine()->kind());
+        ASSERT_EQ(g.add_op(&load_k), graph::status::success);
+        if (explicit_transpose) {
+            ASSERT_EQ(g.add_op(&transpose_k), graph::status::success);
+        }
+        ASSERT_EQ(g.add_op(&matmul_qk), graph::status::success);
+        ASSERT_EQ(g.add_op(&softmax), graph::status::success);
+        ASSERT_EQ(g.add_op(&load_v), graph::status::success);
+        ASSERT_EQ(g.add_op(&matmul_v), graph::status::success);
+
+        std::vector<test_tensor_t> inputs_ts;
+        for (const auto &lt : {q_lt, k_cache_lt, v_cache_lt}) {
+            inputs_ts.emplace_back(lt, get_engine());
+            inputs_ts.back().fill<float>(0.f, 1.f);
+        }
+        inputs_ts.emplace_back(table_lt, get_engine(), block_table);
+        test_tensor_t dst_ts;
+        compile_and_execute(
+                g, "float_paged_sdp_fusion_cpu", inputs_ts, dst_ts);
+
+        const auto qry = inputs_ts[0].as_vec_type<float>();
+        const auto key = inputs_ts[1].as_vec_type<float>();
+        const auto val = inputs_ts[2].as_vec_type<float>();
+        std::vector<float> ref(B * H * Q * D, 0.f);
+        for (dim_t b = 0; b < B; b++)
+            for (dim_t h = 0; h < H; h++)
+                for (dim_t q = 0; q < Q; q++) {
+                    std::vector<float> s(S, 0.f);
+                    float max = -INFINITY, sum = 0.f;
+                    for (dim_t t = 0; t < S; t++) {
+                        for (dim_t d = 0; d < D; d++)
+                            s[t] += qry[((b * H + h) * Q + q) * D + d]
+                                    * cache_at(key, b, h, t, d);
+                        max = std::max(max, s[t]);
+                    }
+                    for (dim_t t = 0; t < S; t++) {
+                        s[t] = std::exp(s[t] - max);
+                        sum += s[t];
+                    }
+                    float *out = &ref[((b * H + h) * Q + q) * D];
+                    for (dim_t t = 0; t < S; t++)
+                        for (dim_t d = 0; d < D; d++)
+                            out[d] += s[t] / sum * cache_at(val, b, h, t, d);
+                }
+
+        ASSERT_TRUE(allclose<float>(dst_ts.as_vec_type<float>(), ref,
+                /*rtol*/ 1e-4f,
+                /*atol*/ 1e-4f));
+    }
+}
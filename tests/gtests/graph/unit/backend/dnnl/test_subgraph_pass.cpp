@@ -1291,6 +1291,86 @@ TEST(test_subgraph_pass, MemoryPlanning) {
     ASSERT_TRUE(mem_offkeys.empty());
 }
 
+TEST(test_subgraph_pass, MemoryPlanningConcatInplace_CPU) {
+    /*
+    mul_scales   mul_scales
+            \     /
+             concat
+               |
+           mul_scales
+    */
+    graph::engine_t *g_eng = get_engine();
+    dnnl::engine p_eng = dnnl::impl::graph::dnnl_impl::make_dnnl_engine(*g_eng);
+    SKIP_IF(g_eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    graph::op_t op1(1, dnnl_impl::op_kind::dnnl_mul_scales, "op1");
+    graph::op_t op2(2, dnnl_impl::op_kind::dnnl_mul_scales, "op2");
+    graph::op_t op3(3, dnnl_impl::op_kind::dnnl_concat, "op3");
+    graph::op_t op4(4, dnnl_impl::op_kind::dnnl_mul_scales, "op4");
+
+    op1.set_attr<std::vector<float>>(op_attr::scales, {0.5});
+    op2.set_attr<std::vector<float>>(op_attr::scales, {0.5});
+    op3.set_attr<int64_t>(op_attr::axis, 1);
+    op4.set_attr<std::vector<float>>(op_attr::scales, {0.5});
+
+    logical_tensor_t val0
+            = logical_tensor_init(0, {1, 4, 8}, graph::data_type::f32);
+    logical_tensor_t val1
+            = logical_tensor_init(1, {1, 4, 8}, graph::data_type::f32);
+    logical_tensor_t val2
+            = logical_tensor_init(2, {1, 4, 8}, graph::data_type::f32);
+    logical_tensor_t val3
+            = logical_tensor_init(3, {1, 4, 8}, graph::data_type::f32);
+    logical_tensor_t val4
+            = logical_tensor_init(4, {1, 8, 8}, graph::data_type::f32);
+    logical_tensor_t val5
+            = logical_tensor_init(5, {1, 8, 8}, graph::data_type::f32);
+    logical_tensor_t val6
+            = logical_tensor_init(6, {1, 8, 8}, graph::data_type::u8);
+
+    op1.add_input(val0);
+    op1.add_output(val2);
+    op2.add_input(val1);
+    op2.add_output(val3);
+    op3.add_input(val2);
+    op3.add_input(val3);
+    op3.add_output(val4);
+    op3.add_output(val6);
+    op4.add_input(val4);
+    op4.add_output(val5);
+
+    graph::graph_t g;
+    g.add_op(&op1);
+    g.add_op(&op2);
+    g.add_op(&op3);
+    g.add_op(&op4);
+    g.finalize();
+    const graph::fpmath_t fpm {fpmath_mode::strict, false};
+    auto subgraph = std::make_shared<dnnl_impl::subgraph_t>(
+            g.get_ops(), p_eng, fpm, false, /* reset_layout */ false);
+
+    std::vector<logical_tensor_t> inputs = {val0, val1};
+    std::vector<logical_tensor_t> outputs = {val5};
+    dnnl_impl::set_given_inputs_outputs(subgraph, inputs, outputs);
+
+    dnnl_impl::memory_planner_t memory_planner;
+    ASSERT_EQ(memory_planner.run(subgraph), graph::status::success);
+
+    // the outputs of op1 and op2 are the two halves of the op3 output
+    std::vector<std::string> infos;
+    for (const auto &op : subgraph->get_ops()) {
+        if (op->get_kind() != dnnl_impl::op_kind::dnnl_concat) continue;
+        for (const auto &in : op->get_input_values())
+            infos.emplace_back(memory_planner.get_memory_info(in.get()));
+        infos.emplace_back(
+                memory_planner.get_memory_info(op->get_output_value(0).get()));
+    }
+    ASSERT_EQ(infos.size(), 3U);
+    ASSERT_EQ(infos[0], infos[2]);
+    ASSERT_EQ(infos[1], infos[2] + "_+" + std::to_string(4 * 8 * 4));
+}
+
 TEST(test_subgraph_pass, FusePostOpsForConvDepthwise_CPU) {
     /*   conv
           |
@@ -0,0 +1,320 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <dnnl_test_common.hpp>
+#include <gtest/gtest.h>
+
+#include "sdpa_internal.hpp"
+#include "test_utils.hpp"
+
+#include <oneapi/dnnl/dnnl.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace dnnl {
+
+namespace {
+
+using mdt = memory::data_type;
+
+enum class cpu_mask_t { none, buffer, causal_tl, causal_br };
+
+struct sdpa_cpu_params_t {
+    memory::dim mb, heads, kv_heads, queries, keys, head_size;
+    mdt dt; // Queries and destination.
+    mdt kv_dt; // Keys and values, quantized per token if integer.
+    cpu_mask_t mask;
+    // The batch entries hold (b + 1) / mb of the queries and keys.
+    bool ragged;
+};
+
+std::ostream &operator<<(std::ostream &ss, const sdpa_cpu_params_t &p) {
+    ss << "mb" << p.mb << "_h" << p.heads << "_kvh" << p.kv_heads << "_q"
+       << p.queries << "_k" << p.keys << "_d" << p.head_size << "_"
+       << dnnl_dt2str(memory::convert_to_c(p.dt)) << "_"
+       << dnnl_dt2str(memory::convert_to_c(p.kv_dt)) << "_mask"
+       << static_cast<int>(p.mask) << (p.ragged ? "_ragged" : "");
+    return ss;
+}
+
+bool is_int(mdt dt) {
+    return dt == mdt::s8 || dt == mdt::u8;
+}
+
+// Values on a coarse grid are exact in every tested data type, so the
+// reference only accounts for the rounding done inside the primitive.
+void fill_grid(std::vector<float> &v, int lo, int hi, float step, int seed) {
+    for (size_t i = 0; i < v.size(); i++)
+        v[i] = (lo + (int)((i * 7 + seed * 13 + i / 5) % (hi - lo + 1)))
+                * step;
+}
+
+memory to_memory(const std::vector<float> &data, const memory::desc &md,
+        const engine &eng, stream &strm) {
+    memory f32_mem({md.get_dims(), mdt::f32, md.get_strides()}, eng);
+    write_to_dnnl_memory(data.data(), f32_mem);
+    memory mem(md, eng);
+    reorder(f32_mem, mem).execute(strm, f32_mem, mem);
+    strm.wait();
+    return mem;
+}
+
+std::vector<float> from_memory(
+        memory &mem, const engine &eng, stream &strm) {
+    const auto md = mem.get_desc();
+    memory f32_mem({md.get_dims(), mdt::f32, md.get_strides()}, eng);
+    reorder(mem, f32_mem).execute(strm, mem, f32_mem);
+    strm.wait();
+    auto ptr = map_memory<float>(f32_mem);
+    const float *data = ptr;
+    return std::vector<float>(data, data + product(md.get_dims()));
+}
+
+} // namespace
+
+class sdpa_cpu_test_t : public ::testing::TestWithParam<sdpa_cpu_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+                "CPU engine not found.");
+        p = GetParam();
+        Test();
+    }
+
+    void Test() {
+        engine eng(engine::kind::cpu, 0);
+        stream strm(eng);
+
+        const memory::dim B = p.mb, H = p.heads, KVH = p.kv_heads;
+        const memory::dim Q = p.queries, K = p.keys, D = p.head_size;
+        const bool quantized = is_int(p.kv_dt);
+
+        const memory::dims q_sz = {B, H, Q, D}, k_sz = {B, KVH, D, K};
+        const memory::dims v_sz = {B, KVH, K, D}, msk_sz = {1, 1, Q, K};
+        const memory::dims ksc_sz = {B, KVH, 1, K}, vsc_sz = {B, KVH, K, 1};
+
+        using tag = memory::format_tag;
+        memory::desc q_md(q_sz, p.dt, tag::abcd);
+        memory::desc k_md(k_sz, p.kv_dt, tag::abcd);
+        memory::desc v_md(v_sz, p.kv_dt, tag::abcd);
+        memory::desc dst_md(q_sz, p.dt, tag::abcd);
+        memory::desc msk_md(msk_sz, mdt::f32, tag::abcd);
+        memory::desc ksc_md(ksc_sz, mdt::f32, tag::abcd);
+        memory::desc vsc_md(vsc_sz, mdt::f32, tag::abcd);
+        memory::desc kzp_md(ksc_sz, mdt::s8, tag::abcd);
+        memory::desc vzp_md(vsc_sz, mdt::s8, tag::abcd);
+        memory::desc scale_md({1}, mdt::f32, tag::a);
+
+        std::vector<float> q(product(q_sz)), k(product(k_sz)),
+                v(product(v_sz)), msk(product(msk_sz));
+        std::vector<float> ksc(product(ksc_sz)), vsc(product(vsc_sz));
+        std::vector<float> kzp(product(ksc_sz), 0.f),
+                vzp(product(vsc_sz), 0.f);
+        fill_grid(q, -4, 4, 0.25f, 1);
+        fill_grid(msk, -8, 0, 0.5f, 4);
+        // Some keys are fully hidden by the buffer mask.
+        for (size_t i = 0; i < msk.size(); i += 11)
+            msk[i] = -INFINITY;
+        if (quantized) {
+            const int lo = p.kv_dt == mdt::u8 ? 0 : -8;
+            fill_grid(k, lo, lo + 16, 1.f, 2);
+            fill_grid(v, lo, lo + 16, 1.f, 3);
+            fill_grid(ksc, 1, 4, 0.0625f, 5);
+            fill_grid(vsc, 1, 4, 0.0625f, 6);
+            fill_grid(kzp, -2, 2, 1.f, 7);
+            fill_grid(vzp, -2, 2, 1.f, 8);
+        } else {
+            fill_grid(k, -4, 4, 0.25f, 2);
+            fill_grid(v, -4, 4, 0.25f, 3);
+        }
+        const float scale = 8.f;
+
+        const bool with_buffer = p.mask == cpu_mask_t::buffer;
+        int mask_kind = static_cast<int>(dnnl::impl::attn_mask_type::undef);
+        if (with_buffer)
+            mask_kind = static_cast<int>(dnnl::impl::attn_mask_type::buffer);
+        if (p.mask == cpu_mask_t::causal_tl)
+            mask_kind = static_cast<int>(dnnl::impl::attn_mask_type::top_left);
+        if (p.mask == cpu_mask_t::causal_br)
+            mask_kind = static_cast<int>(
+                    dnnl::impl::attn_mask_type::bottom_right);
+
+        std::vector<float> lengths(B);
+        for (memory::dim b = 0; b < B; b++)
+            lengths[b] = static_cast<float>((b + 1) * std::max(Q, K) / B);
+
+        primitive_attr attr, kq_attr, vs_attr;
+        if (p.ragged) attr.set_ragged_batch(true);
+        if (quantized) {
+            kq_attr.set_scales(DNNL_ARG_WEIGHTS, 1 << 0 | 1 << 1 | 1 << 3, {},
+                    mdt::f32);
+            kq_attr.set_zero_points(DNNL_ARG_WEIGHTS, 1 << 0 | 1 << 1 | 1 << 3,
+                    {}, mdt::s8);
+            vs_attr.set_scales(DNNL_ARG_WEIGHTS, 1 << 0 | 1 << 1 | 1 << 2, {},
+                    mdt::f32);
+            vs_attr.set_zero_points(DNNL_ARG_WEIGHTS, 1 << 0 | 1 << 1 | 1 << 2,
+                    {}, mdt::s8);
+        }
+
+        // Reference: dequantize, then a plain softmax over the visible keys.
+        std::vector<float> ref(product(q_sz), 0.f);
+        const memory::dim group = H / KVH;
+        for (memory::dim row = 0; row < B * H * Q; row++) {
+            const memory::dim b = row / (H * Q), h = row / Q % H, i = row % Q;
+            const memory::dim kh = h / group;
+            const auto len = static_cast<memory::dim>(lengths[b]);
+            const memory::dim Qv = p.ragged ? std::min(Q, len) : Q;
+            const memory::dim Kv = p.ragged ? std::min(K, len) : K;
+            if (i >= Qv) continue;
+            memory::dim k_end = Kv;
+            if (p.mask == cpu_mask_t::causal_tl) k_end = std::min(Kv, i + 1);
+            if (p.mask == cpu_mask_t::causal_br)
+                k_end = std::min(Kv, i + 1 + Kv - Qv);
+
+            std::vector<float> s(K, -INFINITY);
+            float s_max = -INFINITY;
+            for (memory::dim j = 0; j < k_end; j++) {
+                const memory::dim sc_off = (b * KVH + kh) * K + j;
+                float acc = 0.f;
+                for (memory::dim d = 0; d < D; d++) {
+                    float kval = k[((b * KVH + kh) * D + d) * K + j];
+                    if (quantized)
+                        kval = (kval - kzp[sc_off]) * ksc[sc_off];
+                    acc += q[((b * H + h) * Q + i) * D + d] * kval;
+                }
+                s[j] = acc / scale + (with_buffer ? msk[i * K + j] : 0.f);
+                s_max = std::max(s_max, s[j]);
+            }
+            if (s_max == -INFINITY) continue;
+
+            float sum = 0.f;
+            for (memory::dim j = 0; j < K; j++) {
+                s[j] = std::exp(s[j] - s_max);
+                sum += s[j];
+            }
+            for (memory::dim d = 0; d < D; d++) {
+                float acc = 0.f;
+                for (memory::dim j = 0; j < K; j++) {
+                    const memory::dim sc_off = (b * KVH + kh) * K + j;
+                    float vval = v[((b * KVH + kh) * K + j) * D + d];
+                    if (quantized)
+                        vval = (vval - vzp[sc_off]) * vsc[sc_off];
+                    acc += s[j] * vval;
+                }
+                ref[((b * H + h) * Q + i) * D + d] = acc / sum;
+            }
+        }
+
+        impl::sdpa::primitive_desc pd;
+        try {
+            pd = impl::sdpa::primitive_desc(eng, q_md, k_md, v_md,
+                    with_buffer ? &msk_md : nullptr, mdt::f32, dst_md,
+                    /* invert_scale = */ true, KVH, mask_kind,
+                    dnnl::impl::alg_kind::softmax_accurate_inf_as_zero, attr,
+                    kq_attr, vs_attr);
+        } catch (const dnnl::error &e) {
+            if (e.status == dnnl_unimplemented)
+                GTEST_SKIP() << "Unimplemented: " << e.what();
+            throw;
+        }
+
+        std::unordered_map<int, memory> args = {
+                {DNNL_ARG_QUERIES, to_memory(q, q_md, eng, strm)},
+                {DNNL_ARG_KEYS, to_memory(k, k_md, eng, strm)},
+                {DNNL_ARG_VALUES, to_memory(v, v_md, eng, strm)},
+                {DNNL_ARG_SCALE, to_memory({scale}, scale_md, eng, strm)}};
+        if (with_buffer)
+            args[DNNL_ARG_ATTN_MASK] = to_memory(msk, msk_md, eng, strm);
+        if (p.ragged)
+            args[DNNL_ARG_ATTR_RAGGED_LENGTHS] = to_memory(
+                    lengths, {{B}, mdt::s32, tag::a}, eng, strm);
+        if (quantized) {
+            args[DNNL_ARG_ATTR_SCALES | DNNL_ARG_KEYS]
+                    = to_memory(ksc, ksc_md, eng, strm);
+            args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_KEYS]
+                    = to_memory(kzp, kzp_md, eng, strm);
+            args[DNNL_ARG_ATTR_SCALES | DNNL_ARG_VALUES]
+                    = to_memory(vsc, vsc_md, eng, strm);
+            args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_VALUES]
+                    = to_memory(vzp, vzp_md, eng, strm);
+        }
+
+        // Probabilities are passed to the second multiplication in the
+        // queries data type, which bounds the error for low precision.
+        const float tol = p.dt == mdt::f32 ? 1e-4f : 2e-2f;
+        const float v_max = quantized ? 1.5f : 1.f;
+
+        // Every implementation available for the problem is checked.
+        do {
+            SCOPED_TRACE(pd.impl_info_str());
+            memory dst(dst_md, eng);
+            args[DNNL_ARG_DST] = dst;
+            impl::sdpa(pd).execute(strm, args);
+            strm.wait();
+
+            // Rows beyond the length of a ragged batch entry are undefined.
+            const auto out = from_memory(dst, eng, strm);
+            for (size_t i = 0; i < out.size(); i++) {
+                const memory::dim b = i / (H * Q * D), row = i / D % Q;
+                if (p.ragged && row >= lengths[b]) continue;
+                ASSERT_NEAR(out[i], ref[i],
+                        tol * v_max * (1.f + std::abs(ref[i])))
+                        << "index " << i;
+            }
+        } while (pd.next_impl());
+    }
+
+    sdpa_cpu_params_t p;
+};
+
+TEST_P(sdpa_cpu_test_t, TestsSdpa) {}
+
+INSTANTIATE_TEST_SUITE_P(f32, sdpa_cpu_test_t,
+        ::testing::Values(sdpa_cpu_params_t {1, 2, 2, 37, 130, 64, mdt::f32,
+                                  mdt::f32, cpu_mask_t::none, false},
+                sdpa_cpu_params_t {2, 4, 2, 33, 70, 32, mdt::f32, mdt::f32,
+                        cpu_mask_t::buffer, false},
+                sdpa_cpu_params_t {1, 2, 1, 70, 70, 64, mdt::f32, mdt::f32,
+                        cpu_mask_t::causal_tl, false},
+                sdpa_cpu_params_t {1, 2, 2, 5, 100, 32, mdt::f32, mdt::f32,
+                        cpu_mask_t::causal_br, false},
+                sdpa_cpu_params_t {1, 2, 2, 40, 10, 16, mdt::f32, mdt::f32,
+                        cpu_mask_t::causal_br, false}));
+
+INSTANTIATE_TEST_SUITE_P(lowp, sdpa_cpu_test_t,
+        ::testing::Values(sdpa_cpu_params_t {1, 2, 2, 64, 64, 64, mdt::bf16,
+                                  mdt::bf16, cpu_mask_t::causal_tl, false},
+                sdpa_cpu_params_t {1, 2, 1, 40, 77, 32, mdt::bf16, mdt::bf16,
+                        cpu_mask_t::buffer, false},
+                sdpa_cpu_params_t {1, 2, 2, 40, 77, 64, mdt::f16, mdt::f16,
+                        cpu_mask_t::buffer, false}));
+
+INSTANTIATE_TEST_SUITE_P(quantized, sdpa_cpu_test_t,
+        ::testing::Values(sdpa_cpu_params_t {1, 4, 2, 20, 90, 64, mdt::bf16,
+                                  mdt::s8, cpu_mask_t::causal_br, false},
+                sdpa_cpu_params_t {2, 2, 2, 17, 33, 32, mdt::f32, mdt::u8,
+                        cpu_mask_t::buffer, false}));
+
+INSTANTIATE_TEST_SUITE_P(ragged, sdpa_cpu_test_t,
+        ::testing::Values(sdpa_cpu_params_t {3, 2, 2, 70, 70, 32, mdt::f32,
+                                  mdt::f32, cpu_mask_t::causal_tl, true},
+                sdpa_cpu_params_t {3, 2, 1, 1, 90, 64, mdt::bf16, mdt::bf16,
+                        cpu_mask_t::none, true},
+                sdpa_cpu_params_t {3, 2, 2, 40, 77, 32, mdt::f32, mdt::u8,
+                        cpu_mask_t::causal_br, true}));
+
+} // namespace dnnl
@@ -330,6 +330,17 @@ static auto cases_padded = []() {
                     {{4, 8, 5, 5}, {4, 3, 5, 5}}, {4, 11, 5, 5}},
             concat_test_params_t {1, {fmt::nChw8c, fmt::nChw16c}, fmt::nChw16c,
                     {{4, 8, 5, 5}, {4, 3, 5, 5}}, {4, 11, 5, 5}},
+            // several inputs share a block
+            concat_test_params_t {1,
+                    {fmt::nChw16c, fmt::nChw16c, fmt::nChw16c}, fmt::nChw16c,
+                    {{2, 24, 7, 7}, {2, 12, 7, 7}, {2, 32, 7, 7}},
+                    {2, 68, 7, 7}},
+            concat_test_params_t {1, {fmt::nChw8c, fmt::nChw8c, fmt::nChw8c},
+                    fmt::nChw8c, {{2, 5, 7, 7}, {2, 12, 7, 7}, {2, 7, 7, 7}},
+                    {2, 24, 7, 7}},
+            concat_test_params_t {1, {fmt::nhwc, fmt::nhwc, fmt::nhwc},
+                    fmt::nhwc, {{2, 5, 7, 7}, {2, 20, 7, 7}, {2, 33, 7, 7}},
+                    {2, 58, 7, 7}},
             // not over channels
             concat_test_params_t {2, {fmt::nChw16c, fmt::nChw16c}, fmt::nchw,
                     {{4, 25, 5, 5}, {4, 25, 5, 5}}, {4, 25, 10, 5}},
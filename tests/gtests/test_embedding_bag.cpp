@@ -0,0 +1,274 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct embedding_bag_test_params_t {
+    algorithm aalgorithm;
+    memory::dim num_embeddings;
+    memory::dim dim;
+    memory::dim nbags;
+    bool with_weights;
+    // Scales mask for the table, -1 stands for no scales.
+    int scales_mask;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+template <typename src_data_t, typename dst_data_t = float>
+class embedding_bag_test_t
+    : public ::testing::TestWithParam<embedding_bag_test_params_t> {
+private:
+    embedding_bag_test_params_t p;
+    memory::data_type src_dt, dst_dt;
+
+protected:
+    void SetUp() override {
+        src_dt = data_traits_t<src_data_t>::data_type;
+        dst_dt = data_traits_t<dst_data_t>::data_type;
+
+        p = ::testing::TestWithParam<embedding_bag_test_params_t>::GetParam();
+
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Embedding bag is implemented for CPU only.");
+        SKIP_IF(unsupported_data_type(src_dt)
+                        || unsupported_data_type(dst_dt),
+                "Engine does not support this data type.");
+
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    void Test() {
+        using pd_t = embedding_bag_forward::primitive_desc;
+        using dt = memory::data_type;
+        using tag = memory::format_tag;
+
+        const bool is_int8 = src_dt == dt::s8 || src_dt == dt::u8;
+        allows_attr_t aa {};
+        aa.scales = is_int8;
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        const memory::dim R = p.num_embeddings, D = p.dim, B = p.nbags;
+
+        // Bags of 0 to 4 indices, so some of them are empty.
+        std::vector<int> offsets(B);
+        memory::dim nindices = 0;
+        for (memory::dim b = 0; b < B; b++) {
+            offsets[b] = (int)nindices;
+            nindices += b % 5;
+        }
+        auto bag_end = [&](memory::dim b) {
+            return b + 1 < B ? (memory::dim)offsets[b + 1] : nindices;
+        };
+        auto src_md = memory::desc({R, D}, src_dt, tag::ab);
+        auto indices_md = memory::desc({nindices}, dt::s32, tag::a);
+        auto offsets_md = memory::desc({B}, dt::s32, tag::a);
+        auto weights_md = memory::desc({nindices}, dt::f32, tag::a);
+        auto dst_md = memory::desc({B, D}, dst_dt, tag::any);
+
+        std::vector<int> indices(nindices);
+        for (memory::dim i = 0; i < nindices; i++)
+            indices[i] = (int)((i * 7919 + 13) % R);
+
+        // Small integers and powers of two are exact in all the data types.
+        std::vector<float> src_f(R * D), weights_f(nindices), scales_f(R);
+        for_(memory::dim r = 0; r < R; r++)
+        for (memory::dim d = 0; d < D; d++)
+            src_f[r * D + d] = src_dt == dt::u8
+                    ? (float)((r + d) % 7)
+                    : (float)((r * 3 + d) % 7) - 3.f;
+        for (memory::dim i = 0; i < nindices; i++)
+            weights_f[i] = 0.25f * (float)(i % 4 + 1);
+        for (memory::dim r = 0; r < R; r++)
+            scales_f[r] = 0.5f * (float)(1 + r % 4);
+
+        primitive_attr attr;
+        if (p.scales_mask >= 0)
+            attr.set_scales_mask(DNNL_ARG_SRC, p.scales_mask);
+
+        // default pd ctor
+        auto pd = pd_t();
+        // regular pd ctor
+        if (p.with_weights) {
+            pd = pd_t(eng, prop_kind::forward_inference, p.aalgorithm, src_md,
+                    indices_md, offsets_md, weights_md, dst_md, attr);
+        } else {
+            pd = pd_t(eng, prop_kind::forward_inference, p.aalgorithm, src_md,
+                    indices_md, offsets_md, dst_md, attr);
+            // test all pd ctors
+            test_fwd_pd_constructors<pd_t>(pd, aa,
+                    prop_kind::forward_inference, p.aalgorithm, src_md,
+                    indices_md, offsets_md, dst_md);
+        }
+
+        EXPECT_ANY_THROW(embedding_bag_forward(pd, {}));
+        // default primitive ctor
+        auto prim = embedding_bag_forward();
+        // regular primitive ctor
+        prim = embedding_bag_forward(pd);
+
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SRC_0)
+                == pd.src_desc());
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SRC_1)
+                == pd.indices_desc());
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SRC_2)
+                == pd.offsets_desc());
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_DST)
+                == pd.dst_desc());
+        if (p.with_weights)
+            ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_WEIGHTS)
+                    == pd.weights_desc());
+        else
+            ASSERT_TRUE(pd.weights_desc().is_zero());
+        ASSERT_EQ(pd.get_algorithm(), p.aalgorithm);
+        ASSERT_EQ(pd.get_prop_kind(), prop_kind::forward_inference);
+
+        auto f32_src_mem
+                = memory({{R, D}, dt::f32, tag::ab}, eng, src_f.data());
+        auto src_mem = memory(pd.src_desc(), eng);
+        reorder(f32_src_mem, src_mem).execute(strm, f32_src_mem, src_mem);
+        auto indices_mem = memory(indices_md, eng, indices.data());
+        auto offsets_mem = memory(offsets_md, eng, offsets.data());
+        auto weights_mem = memory(weights_md, eng, weights_f.data());
+        auto scales_mem = memory(
+                {{p.scales_mask == 1 ? R : 1}, dt::f32, tag::a}, eng,
+                scales_f.data());
+        auto dst_mem = memory(pd.dst_desc(), eng);
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC_0, src_mem},
+                {DNNL_ARG_SRC_1, indices_mem}, {DNNL_ARG_SRC_2, offsets_mem},
+                {DNNL_ARG_DST, dst_mem}};
+        if (p.with_weights) args.insert({DNNL_ARG_WEIGHTS, weights_mem});
+        if (p.scales_mask >= 0)
+            args.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, scales_mem});
+        prim.execute(strm, args);
+        strm.wait();
+
+        std::vector<float> dst_f(B * D);
+        auto f32_dst_mem
+                = memory({{B, D}, dt::f32, tag::ab}, eng, dst_f.data());
+        reorder(dst_mem, f32_dst_mem).execute(strm, dst_mem, f32_dst_mem);
+        strm.wait();
+
+        const bool is_max = p.aalgorithm == algorithm::embedding_bag_max;
+        const float eps = dst_dt == dt::f32 ? 1e-6f : 1e-2f;
+        for_(memory::dim b = 0; b < B; b++)
+        for (memory::dim d = 0; d < D; d++) {
+            const memory::dim beg = offsets[b], end = bag_end(b);
+            float ref = is_max && end > beg ? -INFINITY : 0.f;
+            for (memory::dim i = beg; i < end; i++) {
+                const int r = indices[i];
+                float v = src_f[r * D + d];
+                if (p.scales_mask >= 0)
+                    v *= scales_f[p.scales_mask == 1 ? r : 0];
+                if (p.with_weights) v *= weights_f[i];
+                ref = is_max ? std::max(ref, v) : ref + v;
+            }
+            if (p.aalgorithm == algorithm::embedding_bag_mean && end > beg)
+                ref /= (float)(end - beg);
+            const float got = dst_f[b * D + d];
+            ASSERT_NEAR(got, ref, eps * std::max(1.f, std::fabs(ref)))
+                    << "bag " << b << " dim " << d << " "
+                    << pd.impl_info_str();
+        }
+    }
+};
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // per-sample weights are supported for sum only
+            embedding_bag_test_params_t {algorithm::embedding_bag_max, 16, 8,
+                    4, true, -1, true, dnnl_unimplemented},
+            // not supported alg_kind
+            embedding_bag_test_params_t {algorithm::eltwise_relu, 16, 8, 4,
+                    false, -1, true, dnnl_invalid_arguments},
+            // negative dim
+            embedding_bag_test_params_t {algorithm::embedding_bag_sum, 16, -8,
+                    4, false, -1, true, dnnl_invalid_arguments});
+};
+
+static auto zero_dim = []() {
+    return ::testing::Values(
+            embedding_bag_test_params_t {algorithm::embedding_bag_sum, 16, 0,
+                    4, false, -1},
+            embedding_bag_test_params_t {algorithm::embedding_bag_sum, 16, 8,
+                    0, false, -1});
+};
+
+static auto simple_cases = []() {
+    return ::testing::Values(
+            embedding_bag_test_params_t {algorithm::embedding_bag_sum, 100,
+                    64, 37, false, -1},
+            embedding_bag_test_params_t {algorithm::embedding_bag_sum, 100,
+                    100, 37, true, -1},
+            embedding_bag_test_params_t {algorithm::embedding_bag_mean, 50,
+                    500, 23, false, -1},
+            embedding_bag_test_params_t {algorithm::embedding_bag_max, 50, 17,
+                    64, false, -1});
+};
+
+static auto int8_cases = []() {
+    return ::testing::Values(
+            embedding_bag_test_params_t {algorithm::embedding_bag_sum, 100,
+                    64, 37, true, 1},
+            embedding_bag_test_params_t {algorithm::embedding_bag_mean, 100,
+                    130, 37, false, 0},
+            embedding_bag_test_params_t {algorithm::embedding_bag_max, 50,
+                    500, 23, false, 1},
+            // scales are supported per row or for the whole table only
+            embedding_bag_test_params_t {algorithm::embedding_bag_sum, 16, 8,
+                    4, false, 2, true, dnnl_unimplemented});
+};
+
+#define INST_TEST_CASE(test) \
+    TEST_P(test, TestsEmbeddingBag) {} \
+    INSTANTIATE_TEST_SUITE_P(TestEmbeddingBagEF, test, expected_failures()); \
+    INSTANTIATE_TEST_SUITE_P(TestEmbeddingBagZero, test, zero_dim()); \
+    INSTANTIATE_TEST_SUITE_P(TestEmbeddingBagSimple, test, simple_cases());
+
+#define INST_TEST_CASE_INT8(test) \
+    INST_TEST_CASE(test) \
+    INSTANTIATE_TEST_SUITE_P(TestEmbeddingBagInt8, test, int8_cases());
+
+using embedding_bag_test_f32 = embedding_bag_test_t<float>;
+using embedding_bag_test_bf16 = embedding_bag_test_t<bfloat16_t>;
+using embedding_bag_test_f16 = embedding_bag_test_t<float16_t, float16_t>;
+using embedding_bag_test_bf16_bf16 = embedding_bag_test_t<bfloat16_t,
+        bfloat16_t>;
+using embedding_bag_test_s8 = embedding_bag_test_t<int8_t>;
+using embedding_bag_test_u8 = embedding_bag_test_t<uint8_t, bfloat16_t>;
+
+INST_TEST_CASE(embedding_bag_test_f32)
+INST_TEST_CASE(embedding_bag_test_bf16)
+INST_TEST_CASE(embedding_bag_test_f16)
+INST_TEST_CASE(embedding_bag_test_bf16_bf16)
+INST_TEST_CASE_INT8(embedding_bag_test_s8)
+INST_TEST_CASE_INT8(embedding_bag_test_u8)
+
+} // namespace dnnl
@@ -0,0 +1,177 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.h"
+
+namespace dnnl {
+
+// Batched gemm results are compared against the single problem functions.
+// Small integers keep the results exact regardless of the summation order.
+class gemm_batch_test_t : public ::testing::Test {
+protected:
+    template <typename T>
+    static std::vector<T> fill(dnnl_dim_t size, int mod, int shift) {
+        std::vector<T> v(size);
+        for (dnnl_dim_t i = 0; i < size; i++)
+            v[i] = static_cast<T>(i % mod - shift);
+        return v;
+    }
+};
+
+TEST_F(gemm_batch_test_t, TestSgemmStrided) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Gemm is supported on CPU only.");
+
+    // Both fewer and more problems than threads are tried.
+    for (dnnl_dim_t batch : {1, 3, 97}) {
+        const dnnl_dim_t M = 37, N = 45, K = 19;
+        const dnnl_dim_t lda = K + 1, ldb = N, ldc = N + 3;
+        const dnnl_dim_t stride_a = M * lda, stride_b = K * ldb;
+        const dnnl_dim_t stride_c = M * ldc;
+
+        auto A = fill<float>(batch * stride_a, 7, 3);
+        auto B = fill<float>(batch * stride_b, 5, 2);
+        auto C = fill<float>(batch * stride_c, 3, 1);
+        auto C_ref = C;
+
+        ASSERT_EQ(dnnl_sgemm_batch_strided('N', 'N', M, N, K, 2.f, A.data(),
+                          lda, stride_a, B.data(), ldb, stride_b, 1.f,
+                          C.data(), ldc, stride_c, batch),
+                dnnl_success);
+        for (dnnl_dim_t i = 0; i < batch; i++)
+            ASSERT_EQ(dnnl_sgemm('N', 'N', M, N, K, 2.f,
+                              A.data() + i * stride_a, lda,
+                              B.data() + i * stride_b, ldb, 1.f,
+                              C_ref.data() + i * stride_c, ldc),
+                    dnnl_success);
+        ASSERT_EQ(C, C_ref);
+    }
+}
+
+TEST_F(gemm_batch_test_t, TestSgemmGrouped) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Gemm is supported on CPU only.");
+
+    const std::vector<dnnl_dim_t> group_sizes = {4, 0, 9};
+    const std::vector<char> transa = {'N', 'T', 'T'};
+    const std::vector<char> transb = {'T', 'N', 'N'};
+    const std::vector<dnnl_dim_t> M = {3, 8, 64}, N = {130, 8, 17};
+    const std::vector<dnnl_dim_t> K = {5, 8, 33};
+    const std::vector<float> alpha = {1.f, 1.f, -1.f}, beta = {0.f, 0.f, 2.f};
+    // Leading dimensions cover the transposed matrices too.
+    std::vector<dnnl_dim_t> lda, ldb, ldc;
+    for (size_t g = 0; g < group_sizes.size(); g++) {
+        lda.push_back(transa[g] == 'N' ? K[g] : M[g]);
+        ldb.push_back(transb[g] == 'N' ? N[g] : K[g]);
+        ldc.push_back(N[g]);
+    }
+
+    std::vector<std::vector<float>> A, B, C, C_ref;
+    std::vector<const float *> A_ptrs, B_ptrs;
+    std::vector<float *> C_ptrs;
+    for (size_t g = 0; g < group_sizes.size(); g++)
+        for (dnnl_dim_t i = 0; i < group_sizes[g]; i++) {
+            A.push_back(fill<float>(M[g] * K[g], 7 + (int)i, 3));
+            B.push_back(fill<float>(K[g] * N[g], 5, 2));
+            C.push_back(fill<float>(M[g] * N[g], 3, 1));
+            C_ref.push_back(C.back());
+        }
+    for (size_t i = 0; i < A.size(); i++) {
+        A_ptrs.push_back(A[i].data());
+        B_ptrs.push_back(B[i].data());
+        C_ptrs.push_back(C[i].data());
+    }
+
+    ASSERT_EQ(dnnl_sgemm_batch_grouped((dnnl_dim_t)group_sizes.size(),
+                      group_sizes.data(), transa.data(), transb.data(),
+                      M.data(), N.data(), K.data(), alpha.data(),
+                      A_ptrs.data(), lda.data(), B_ptrs.data(), ldb.data(),
+                      beta.data(), C_ptrs.data(), ldc.data()),
+            dnnl_success);
+
+    size_t i = 0;
+    for (size_t g = 0; g < group_sizes.size(); g++)
+        for (dnnl_dim_t j = 0; j < group_sizes[g]; j++, i++) {
+            ASSERT_EQ(dnnl_sgemm(transa[g], transb[g], M[g], N[g], K[g],
+                              alpha[g], A[i].data(), lda[g], B[i].data(),
+                              ldb[g], beta[g], C_ref[i].data(), ldc[g]),
+                    dnnl_success);
+            ASSERT_EQ(C[i], C_ref[i]);
+        }
+}
+
+TEST_F(gemm_batch_test_t, TestGemmU8S8S32Pointers) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Gemm is supported on CPU only.");
+
+    const dnnl_dim_t batch = 11, M = 25, N = 40, K = 70;
+    std::vector<std::vector<uint8_t>> A;
+    std::vector<std::vector<int8_t>> B;
+    std::vector<std::vector<int32_t>> C, C_ref, co;
+    std::vector<const uint8_t *> A_ptrs;
+    std::vector<const int8_t *> B_ptrs;
+    std::vector<int32_t *> C_ptrs;
+    std::vector<const int32_t *> co_ptrs;
+    for (dnnl_dim_t i = 0; i < batch; i++) {
+        A.push_back(fill<uint8_t>(M * K, 11 + (int)i, 0));
+        B.push_back(fill<int8_t>(K * N, 9, 4));
+        C.push_back(fill<int32_t>(M * N, 3, 1));
+        C_ref.push_back(C.back());
+        co.push_back(fill<int32_t>(N, 13, 6));
+    }
+    for (dnnl_dim_t i = 0; i < batch; i++) {
+        A_ptrs.push_back(A[i].data());
+        B_ptrs.push_back(B[i].data());
+        C_ptrs.push_back(C[i].data());
+        co_ptrs.push_back(co[i].data());
+    }
+
+    ASSERT_EQ(dnnl_gemm_u8s8s32_batch('N', 'N', 'R', M, N, K, 1.f,
+                      A_ptrs.data(), K, 1, B_ptrs.data(), N, -2, 1.f,
+                      C_ptrs.data(), N, co_ptrs.data(), batch),
+            dnnl_success);
+    for (dnnl_dim_t i = 0; i < batch; i++) {
+        ASSERT_EQ(dnnl_gemm_u8s8s32('N', 'N', 'R', M, N, K, 1.f, A[i].data(),
+                          K, 1, B[i].data(), N, -2, 1.f, C_ref[i].data(), N,
+                          co[i].data()),
+                dnnl_success);
+        ASSERT_EQ(C[i], C_ref[i]);
+    }
+}
+
+TEST_F(gemm_batch_test_t, TestInvalidArguments) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Gemm is supported on CPU only.");
+
+    float a = 1.f, b = 1.f, c = 0.f;
+    ASSERT_EQ(dnnl_sgemm_batch_strided('N', 'N', 1, 1, 1, 1.f, &a, 1, 1, &b,
+                      1, 1, 0.f, &c, 1, 1, -1),
+            dnnl_invalid_arguments);
+    // Packed matrices are not supported by the batched functions.
+    ASSERT_EQ(dnnl_sgemm_batch_strided('P', 'N', 1, 1, 1, 1.f, &a, 1, 1, &b,
+                      1, 1, 0.f, &c, 1, 1, 1),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_sgemm_batch('N', 'N', 1, 1, 1, 1.f, nullptr, 1, nullptr, 1,
+                      0.f, nullptr, 1, 0),
+            dnnl_success);
+}
+
+} // namespace dnnl
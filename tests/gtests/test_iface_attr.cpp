@@ -127,6 +127,54 @@ TEST_F(attr_test_t, TestDeterministic) {
     }
 }
 
+TEST_F(attr_test_t, TestRaggedBatch) {
+    dnnl::primitive_attr attr;
+    // Check the default value
+    ASSERT_EQ(false, attr.get_ragged_batch());
+
+    for (auto b : {true, false}) {
+        attr.set_ragged_batch(b);
+        ASSERT_EQ(b, attr.get_ragged_batch());
+    }
+}
+
+TEST_F(attr_test_t, TestGroupedBatch) {
+    dnnl::primitive_attr attr;
+    // Check the default value
+    ASSERT_EQ(false, attr.get_grouped_batch());
+
+    for (auto b : {true, false}) {
+        attr.set_grouped_batch(b);
+        ASSERT_EQ(b, attr.get_grouped_batch());
+    }
+}
+
+TEST_F(attr_test_t, TestWeightsLut) {
+    dnnl::primitive_attr attr;
+    // Check the default value
+    ASSERT_EQ(0, attr.get_weights_lut());
+
+    for (memory::dim g : {32, 128, 0}) {
+        attr.set_weights_lut(g);
+        ASSERT_EQ(g, attr.get_weights_lut());
+    }
+    EXPECT_ANY_THROW(attr.set_weights_lut(-1));
+}
+
+TEST_F(attr_test_t, TestSrcDynamicQuantization) {
+    dnnl::primitive_attr attr;
+    // Check the default value
+    ASSERT_EQ(memory::data_type::undef, attr.get_src_dynamic_quantization());
+
+    for (auto dt : {memory::data_type::s8, memory::data_type::u8,
+                 memory::data_type::undef}) {
+        attr.set_src_dynamic_quantization(dt);
+        ASSERT_EQ(dt, attr.get_src_dynamic_quantization());
+    }
+    EXPECT_ANY_THROW(
+            attr.set_src_dynamic_quantization(memory::data_type::f32));
+}
+
 HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestScratchpadArg) {
     engine eng = get_test_engine();
 
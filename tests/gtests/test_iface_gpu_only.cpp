@@ -33,6 +33,10 @@ TEST(iface_gpu_only, gemm) {
     status = dnnl_gemm_s8s8s32('N', 'N', 'C', 1, 1, 1, 1.0f, nullptr, 1, 0,
             nullptr, 1, 0, 0.0f, nullptr, 1, nullptr);
     ASSERT_EQ(status, dnnl_unimplemented);
+
+    status = dnnl_sgemm_batch_strided('N', 'N', 1, 1, 1, 1.0f, nullptr, 1, 1,
+            nullptr, 1, 1, 0.0f, nullptr, 1, 1, 1);
+    ASSERT_EQ(status, dnnl_unimplemented);
 }
 
 TEST(iface_gpu_only, isa) {
@@ -14,6 +14,12 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
@@ -116,6 +122,56 @@ TEST(primitive_cache_test, TestCacheHit) {
 #endif
     ASSERT_EQ(get_primitive_cache_size(), 2);
 }
+
+// Stresses cache lookups from a growing number of threads. All lookups are
+// cache hits. The throughput for each number of threads is reported as a test
+// property, e.g. it can be compared between different values of
+// ONEDNN_PRIMITIVE_CACHE_SHARDS using --gtest_output=xml.
+TEST(primitive_cache_test, TestMultithreadedCacheHit) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    const int n_pds = 64;
+    const int n_iters = 2000;
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(n_pds);
+
+    engine eng(get_test_engine_kind(), 0);
+    std::vector<eltwise_forward::primitive_desc> pds;
+    for (int i = 0; i < n_pds; i++) {
+        auto md = memory::desc({i + 1, 1, 1, 1}, dt::f32, tag::nchw);
+        pds.emplace_back(eng, prop_kind::forward_inference,
+                algorithm::eltwise_relu, md, md, 0.f, 0.f);
+        auto relu = eltwise_forward(pds.back());
+    }
+    ASSERT_EQ(get_primitive_cache_size(), n_pds);
+
+    const int max_nthr = std::min(
+            64, std::max(1, (int)std::thread::hardware_concurrency()));
+    for (int nthr = 1; nthr <= max_nthr; nthr *= 2) {
+        std::vector<std::thread> threads;
+        auto start = std::chrono::steady_clock::now();
+        for (int ithr = 0; ithr < nthr; ithr++) {
+            threads.emplace_back([&, ithr]() {
+                for (int i = 0; i < n_iters; i++)
+                    auto relu = eltwise_forward(pds[(ithr + i) % n_pds]);
+            });
+        }
+        for (auto &t : threads)
+            t.join();
+        auto end = std::chrono::steady_clock::now();
+
+        // No entries are expected to be added or evicted.
+        ASSERT_EQ(get_primitive_cache_size(), n_pds);
+
+        double sec = std::chrono::duration<double>(end - start).count();
+        auto lookups_per_sec = (int64_t)(nthr * n_iters / std::max(sec, 1e-9));
+        ::testing::Test::RecordProperty(
+                "lookups_per_sec_nthr_" + std::to_string(nthr),
+                std::to_string(lookups_per_sec));
+    }
+}
 #endif
 
 } // namespace dnnl
@@ -35,6 +35,12 @@ TEST(iface_sparse_test_t, TestSparseMDCreation) {
     ASSERT_NO_THROW(md = memory::desc::coo({64, 128}, dt::f32, nnz, dt::s32));
     // Packed.
     ASSERT_NO_THROW(md = memory::desc::packed({64, 128}, dt::f32, nnz));
+    // BSR.
+    ASSERT_NO_THROW(md = memory::desc::bsr({64, 128}, dt::f32, nnz,
+                            {16, 32}, dt::s32, dt::s32));
+    // Blocks must cover the tensor.
+    EXPECT_ANY_THROW(md = memory::desc::bsr({64, 128}, dt::f32, nnz,
+                             {16, 48}, dt::s32, dt::s32));
 }
 
 TEST(iface_sparse_test_t, TestSparseMDComparison) {
@@ -94,6 +100,15 @@ TEST(iface_sparse_test_t, TestSparseMDComparison) {
     ASSERT_NO_THROW(md1 = memory::desc::packed({64, 128}, dt::f32, nnz));
     ASSERT_NO_THROW(md2 = memory::desc::packed({64, 128}, dt::f32, nnz + 1));
     ASSERT_NE(md1, md2);
+
+    // BSR.
+
+    // Different block dimensions.
+    ASSERT_NO_THROW(md1 = memory::desc::bsr({64, 128}, dt::f32, nnz,
+                            {16, 32}, dt::s32, dt::s32));
+    ASSERT_NO_THROW(md2 = memory::desc::bsr({64, 128}, dt::f32, nnz,
+                            {32, 16}, dt::s32, dt::s32));
+    ASSERT_NE(md1, md2);
 }
 
 TEST(iface_sparse_test_t, TestSparseMDQueries) {
@@ -139,6 +154,18 @@ TEST(iface_sparse_test_t, TestSparseMDQueries) {
 
     ASSERT_EQ(md.get_nnz(), nnz);
     ASSERT_EQ(md.get_sparse_encoding(), memory::sparse_encoding::packed);
+
+    // BSR. The number of non-zero entries counts all the stored elements.
+    ASSERT_NO_THROW(md = memory::desc::bsr(dims, data_type, nnz, {16, 32},
+                            indices_dt, pointers_dt));
+    ASSERT_EQ(md.get_dims(), dims);
+    ASSERT_EQ(md.get_data_type(), data_type);
+    ASSERT_EQ(md.get_format_kind(), memory::format_kind::sparse);
+
+    ASSERT_EQ(md.get_nnz(), nnz * 16 * 32);
+    ASSERT_EQ(md.get_sparse_encoding(), memory::sparse_encoding::bsr);
+    ASSERT_EQ(md.get_data_type(1), indices_dt);
+    ASSERT_EQ(md.get_data_type(2), pointers_dt);
 }
 
 TEST(iface_sparse_test_t, TestSparseMDSize) {
@@ -194,6 +221,22 @@ TEST(iface_sparse_test_t, TestSparseMDSize) {
 
     // Size of bitmask.
     ASSERT_EQ(md.get_size(2), 0u);
+
+    // BSR.
+    ASSERT_NO_THROW(md = memory::desc::bsr({64, 128}, dt::f32, nnz,
+                            {16, 32}, dt::s32, dt::s32));
+    // Size of values.
+    exp_values_size = nnz * 16 * 32 * memory::data_type_size(dt::f32);
+    ASSERT_EQ(md.get_size(), exp_values_size);
+    ASSERT_EQ(md.get_size(0), exp_values_size);
+
+    // Size of block column indices.
+    exp_indices_size = nnz * memory::data_type_size(dt::s32);
+    ASSERT_EQ(md.get_size(1), exp_indices_size);
+
+    // Size of block row pointers.
+    exp_pointers_size = (64 / 16 + 1) * memory::data_type_size(dt::s32);
+    ASSERT_EQ(md.get_size(2), exp_pointers_size);
 }
 
 HANDLE_EXCEPTIONS_FOR_TEST(iface_sparse_test_t, TestSparseMemoryCreation) {
@@ -405,4 +448,113 @@ TEST(iface_sparse_test_t, TestSparseMemoryMapUnmap) {
     ASSERT_NO_THROW(mem.unmap_data(mapped_col_indices, 2));
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST(iface_sparse_test_t, TestBsrMatmul) {
+    engine eng = get_test_engine();
+
+    const bool is_unimplemented = (eng.get_kind() == engine::kind::gpu
+            || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL);
+    if (is_unimplemented) return;
+
+    stream strm(eng);
+    const memory::dim M = 50, K = 128, N = 96, R = 16, C = 32;
+    const memory::dim nb_k = K / R, nb_n = N / C;
+
+    struct dt_cfg_t {
+        dt src, wei, dst;
+    };
+    for (const auto &cfg : {dt_cfg_t {dt::f32, dt::f32, dt::f32},
+                 dt_cfg_t {dt::bf16, dt::bf16, dt::f32},
+                 dt_cfg_t {dt::bf16, dt::bf16, dt::bf16},
+                 dt_cfg_t {dt::u8, dt::s8, dt::f32},
+                 dt_cfg_t {dt::s8, dt::s8, dt::s32}}) {
+        SKIP_FOR_LOOP(unsupported_data_type(cfg.src, eng),
+                "Engine does not support this data type.");
+
+        // Every block row keeps every other block, the first block column
+        // is empty for odd block rows.
+        std::vector<int> indices, pointers = {0};
+        for (memory::dim kb = 0; kb < nb_k; kb++) {
+            for (memory::dim nbn = kb % 2; nbn < nb_n; nbn += 2)
+                indices.push_back((int)nbn);
+            pointers.push_back((int)indices.size());
+        }
+        const memory::dim nnz_blocks = (memory::dim)indices.size();
+
+        // Small integers are exact in all the data types and the results
+        // do not depend on the order of accumulation.
+        std::vector<float> src_f(M * K), wei_dense_f(K * N, 0.f);
+        std::vector<float> values_f(nnz_blocks * R * C);
+        for (memory::dim i = 0; i < M * K; i++)
+            src_f[i] = (float)(i * 7 % 5) - (cfg.src == dt::u8 ? 0.f : 2.f);
+        for (memory::dim kb = 0; kb < nb_k; kb++)
+            for (int p = pointers[kb]; p < pointers[kb + 1]; p++)
+                for_(memory::dim r = 0; r < R; r++)
+                for (memory::dim c = 0; c < C; c++) {
+                    const float w = (float)((p * 5 + r * 3 + c) % 7) - 3.f;
+                    values_f[(p * R + r) * C + c] = w;
+                    wei_dense_f[(kb * R + r) * N + indices[p] * C + c] = w;
+                }
+
+        auto make_mem = [&](const memory::desc &md, const float *data) {
+            memory f32_mem({md.get_dims(), dt::f32, memory::format_tag::ab},
+                    eng, const_cast<float *>(data));
+            memory mem(md, eng);
+            reorder(f32_mem, mem).execute(strm, f32_mem, mem);
+            return mem;
+        };
+
+        auto src_md = memory::desc({M, K}, cfg.src, memory::format_tag::ab);
+        auto dst_md = memory::desc({M, N}, cfg.dst, memory::format_tag::ab);
+        auto src_mem = make_mem(src_md, src_f.data());
+
+        // BSR values are converted as a plain tensor of the stored blocks.
+        auto values_mem = make_mem(
+                memory::desc({nnz_blocks * R, C}, cfg.wei,
+                        memory::format_tag::ab),
+                values_f.data());
+        auto wei_md = memory::desc::bsr(
+                {K, N}, cfg.wei, nnz_blocks, {R, C}, dt::s32, dt::s32);
+        memory wei_mem(wei_md, eng,
+                {values_mem.get_data_handle(), indices.data(),
+                        pointers.data()});
+
+        matmul::primitive_desc pd;
+        try {
+            pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md);
+        } catch (error &e) {
+            if (e.status == dnnl_unimplemented) continue;
+            throw;
+        }
+        auto dst_mem = memory(dst_md, eng);
+        matmul(pd).execute(strm,
+                {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, wei_mem},
+                        {DNNL_ARG_DST, dst_mem}});
+
+        // Dense matmul with the same weights as the reference.
+        auto wei_dense_md
+                = memory::desc({K, N}, cfg.wei, memory::format_tag::ab);
+        auto wei_dense_mem = make_mem(wei_dense_md, wei_dense_f.data());
+        auto ref_mem = memory(dst_md, eng);
+        matmul(matmul::primitive_desc(eng, src_md, wei_dense_md, dst_md))
+                .execute(strm,
+                        {{DNNL_ARG_SRC, src_mem},
+                                {DNNL_ARG_WEIGHTS, wei_dense_mem},
+                                {DNNL_ARG_DST, ref_mem}});
+        strm.wait();
+
+        auto to_f32 = [&](memory mem) {
+            std::vector<float> out(M * N);
+            memory f32_mem({{M, N}, dt::f32, memory::format_tag::ab}, eng,
+                    out.data());
+            reorder(mem, f32_mem).execute(strm, mem, f32_mem);
+            strm.wait();
+            return out;
+        };
+        const auto dst_f = to_f32(dst_mem);
+        const auto ref_f = to_f32(ref_mem);
+        for (memory::dim i = 0; i < M * N; i++)
+            ASSERT_EQ(dst_f[i], ref_f[i]) << pd.impl_info_str();
+    }
+}
+
 } // namespace dnnl
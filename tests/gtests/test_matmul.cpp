@@ -19,6 +19,8 @@
 
 #include "oneapi/dnnl/dnnl.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <vector>
 
 namespace dnnl {
@@ -669,6 +671,583 @@ INSTANTIATE_TEST_SUITE_P(
 INSTANTIATE_TEST_SUITE_P(
         Generic_u8s8u8, iface, cases_x8(data_type::u8, data_type::u8));
 
+HANDLE_EXCEPTIONS_FOR_TEST(matmul_ragged_test_t, TestsRaggedBatch) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Ragged batch is supported on CPU only.");
+
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    const memory::dim B0 = 3, B1 = 2, M = 50, K = 40, N = 24;
+    const std::vector<int32_t> lengths = {M, 17, 0};
+
+    memory::desc src_md({B0, B1, M, K}, data_type::f32, tag::abcd);
+    memory::desc wei_md({1, 1, K, N}, data_type::f32, tag::abcd);
+    memory::desc dst_md({B0, B1, M, N}, data_type::f32, tag::abcd);
+    memory::desc len_md({B0}, data_type::s32, tag::a);
+
+    primitive_attr attr;
+    attr.set_ragged_batch(true);
+    ASSERT_TRUE(attr.get_ragged_batch());
+    matmul::primitive_desc pd(eng, src_md, wei_md, dst_md, attr);
+
+    memory src(src_md, eng), wei(wei_md, eng), len(len_md, eng);
+    {
+        // Small integers keep the results exact.
+        auto s = map_memory<float>(src);
+        for (memory::dim i = 0; i < B0 * B1 * M * K; i++)
+            s[i] = static_cast<float>(i % 7 - 3);
+        auto w = map_memory<float>(wei);
+        for (memory::dim i = 0; i < K * N; i++)
+            w[i] = static_cast<float>(i % 5 - 2);
+        auto l = map_memory<int32_t>(len);
+        for (memory::dim i = 0; i < B0; i++)
+            l[i] = lengths[i];
+    }
+
+    // Every implementation available for the problem is checked.
+    do {
+        memory dst(dst_md, eng);
+        matmul(pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst},
+                        {DNNL_ARG_ATTR_RAGGED_LENGTHS, len}});
+        strm.wait();
+
+        auto s = map_memory<float>(src);
+        auto w = map_memory<float>(wei);
+        auto d = map_memory<float>(dst);
+        // Rows beyond the lengths are undefined and not checked.
+        for_(memory::dim b = 0; b < B0 * B1; b++)
+        for_(memory::dim m = 0; m < lengths[b / B1]; m++)
+        for (memory::dim n = 0; n < N; n++) {
+            float ref = 0.f;
+            for (memory::dim k = 0; k < K; k++)
+                ref += s[(b * M + m) * K + k] * w[k * N + n];
+            ASSERT_EQ(d[(b * M + m) * N + n], ref) << pd.impl_info_str();
+        }
+    } while (pd.next_impl());
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(matmul_ragged_test_t, TestsRaggedBatchRowBlocks) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Ragged batch is supported on CPU only.");
+
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    // Brgemm implementations compute blocks of several rows. Lengths which
+    // are not multiples of the blocks end in the middle of a block.
+    const memory::dim B = 4, M = 96, K = 64, N = 48;
+    const std::vector<int32_t> lengths = {M, 37, 1, 0};
+
+    for (auto dt : {data_type::f32, data_type::bf16}) {
+        if (unsupported_data_type(dt)) continue;
+
+        memory::desc src_md({B, M, K}, dt, tag::abc);
+        memory::desc wei_md({B, K, N}, dt, tag::abc);
+        memory::desc dst_md({B, M, N}, data_type::f32, tag::abc);
+        memory::desc len_md({B}, data_type::s32, tag::a);
+
+        primitive_attr attr;
+        attr.set_ragged_batch(true);
+        matmul::primitive_desc pd(eng, src_md, wei_md, dst_md, attr);
+
+        // Small integers keep the results exact in bf16.
+        std::vector<float> s_f(B * M * K), w_f(B * K * N);
+        for (size_t i = 0; i < s_f.size(); i++)
+            s_f[i] = static_cast<float>(i % 7 - 3);
+        for (size_t i = 0; i < w_f.size(); i++)
+            w_f[i] = static_cast<float>(i % 5 - 2);
+
+        memory src(src_md, eng), wei(wei_md, eng), len(len_md, eng);
+        {
+            if (dt == data_type::bf16) {
+                auto s = map_memory<bfloat16_t>(src);
+                for (size_t i = 0; i < s_f.size(); i++)
+                    s[i] = s_f[i];
+                auto w = map_memory<bfloat16_t>(wei);
+                for (size_t i = 0; i < w_f.size(); i++)
+                    w[i] = w_f[i];
+            } else {
+                auto s = map_memory<float>(src);
+                for (size_t i = 0; i < s_f.size(); i++)
+                    s[i] = s_f[i];
+                auto w = map_memory<float>(wei);
+                for (size_t i = 0; i < w_f.size(); i++)
+                    w[i] = w_f[i];
+            }
+            auto l = map_memory<int32_t>(len);
+            for (memory::dim i = 0; i < B; i++)
+                l[i] = lengths[i];
+        }
+
+        // Every implementation available for the problem is checked.
+        do {
+            memory dst(dst_md, eng);
+            matmul(pd).execute(strm,
+                    {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                            {DNNL_ARG_DST, dst},
+                            {DNNL_ARG_ATTR_RAGGED_LENGTHS, len}});
+            strm.wait();
+
+            auto d = map_memory<float>(dst);
+            // Rows beyond the lengths are undefined and not checked.
+            for_(memory::dim b = 0; b < B; b++)
+            for_(memory::dim m = 0; m < lengths[b]; m++)
+            for (memory::dim n = 0; n < N; n++) {
+                float ref = 0.f;
+                for (memory::dim k = 0; k < K; k++)
+                    ref += s_f[(b * M + m) * K + k]
+                            * w_f[(b * K + k) * N + n];
+                ASSERT_EQ(d[(b * M + m) * N + n], ref) << pd.impl_info_str();
+            }
+        } while (pd.next_impl());
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(matmul_grouped_test_t, TestsGroupedBatch) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Grouped batch is supported on CPU only.");
+
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    // Tokens are packed by expert and share the source and destination.
+    const memory::dim G = 4, T = 70, K = 40, N = 72;
+    const std::vector<int32_t> offsets = {0, 33, 33, 61, T};
+
+    memory::desc src_md({1, T, K}, data_type::f32, tag::abc);
+    memory::desc wei_md({G, K, N}, data_type::f32, tag::abc);
+    memory::desc dst_md({G, T, N}, data_type::f32, memory::dims {0, N, 1});
+    memory::desc off_md({G + 1}, data_type::s32, tag::a);
+
+    primitive_attr attr;
+    attr.set_grouped_batch(true);
+    ASSERT_TRUE(attr.get_grouped_batch());
+    matmul::primitive_desc pd(eng, src_md, wei_md, dst_md, attr);
+
+    memory src(src_md, eng), wei(wei_md, eng), off(off_md, eng);
+    {
+        // Small integers keep the results exact.
+        auto s = map_memory<float>(src);
+        for (memory::dim i = 0; i < T * K; i++)
+            s[i] = static_cast<float>(i % 7 - 3);
+        auto w = map_memory<float>(wei);
+        for (memory::dim i = 0; i < G * K * N; i++)
+            w[i] = static_cast<float>(i % 5 - 2);
+        auto o = map_memory<int32_t>(off);
+        for (memory::dim i = 0; i <= G; i++)
+            o[i] = offsets[i];
+    }
+
+    // Every implementation available for the problem is checked.
+    do {
+        memory dst(dst_md, eng);
+        matmul(pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst},
+                        {DNNL_ARG_ATTR_GROUPED_OFFSETS, off}});
+        strm.wait();
+
+        auto s = map_memory<float>(src);
+        auto w = map_memory<float>(wei);
+        auto d = map_memory<float>(dst);
+        for_(memory::dim g = 0; g < G; g++)
+        for_(memory::dim t = offsets[g]; t < offsets[g + 1]; t++)
+        for (memory::dim n = 0; n < N; n++) {
+            float ref = 0.f;
+            for (memory::dim k = 0; k < K; k++)
+                ref += s[t * K + k] * w[(g * K + k) * N + n];
+            ASSERT_EQ(d[t * N + n], ref) << pd.impl_info_str();
+        }
+    } while (pd.next_impl());
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(matmul_lut_test_t, TestsWeightsLut) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Weights lookup tables are supported on CPU only.");
+    SKIP_IF(unsupported_data_type(data_type::bf16),
+            "Engine does not support this data type.");
+
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    const memory::dim M = 20, K = 64, N = 48, G = 32, L = 16;
+
+    memory::desc src_md({M, K}, data_type::bf16, tag::ab);
+    memory::desc wei_md({K, N}, data_type::u4, tag::ab);
+    memory::desc dst_md({M, N}, data_type::f32, tag::ab);
+    memory::desc lut_md({K / G, L}, data_type::f32, tag::ab);
+    memory::desc sc_md({N}, data_type::f32, tag::a);
+
+    primitive_attr attr;
+    attr.set_fpmath_mode(fpmath_mode::bf16, true);
+    attr.set_weights_lut(G);
+    attr.set_scales_mask(DNNL_ARG_WEIGHTS, 1 << 1);
+    ASSERT_EQ(attr.get_weights_lut(), G);
+    matmul::primitive_desc pd(eng, src_md, wei_md, dst_md, attr);
+
+    memory src(src_md, eng), wei(wei_md, eng), lut(lut_md, eng),
+            sc(sc_md, eng);
+    std::vector<float> s_f(M * K);
+    std::vector<int> w_idx(K * N);
+    {
+        // Table values and scales are powers of two multiples of small
+        // integers, which keeps the results exact in bf16.
+        auto s = map_memory<bfloat16_t>(src);
+        for (memory::dim i = 0; i < M * K; i++) {
+            s_f[i] = static_cast<float>(i % 7 - 3);
+            s[i] = s_f[i];
+        }
+        auto w = map_memory<uint8_t>(wei);
+        for (memory::dim i = 0; i < K * N; i += 2) {
+            w_idx[i] = static_cast<int>((i * 5) % L);
+            w_idx[i + 1] = static_cast<int>((i * 3 + 7) % L);
+            w[i / 2] = static_cast<uint8_t>(w_idx[i] | (w_idx[i + 1] << 4));
+        }
+        auto l = map_memory<float>(lut);
+        for (memory::dim i = 0; i < K / G * L; i++)
+            l[i] = static_cast<float>(i % L - 8) / (i < L ? 4 : 2);
+        auto c = map_memory<float>(sc);
+        for (memory::dim n = 0; n < N; n++)
+            c[n] = n % 2 ? 0.5f : 2.f;
+    }
+
+    // Every implementation available for the problem is checked.
+    do {
+        memory dst(dst_md, eng);
+        matmul(pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst}, {DNNL_ARG_ATTR_WEIGHTS_LUT, lut},
+                        {DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS, sc}});
+        strm.wait();
+
+        auto l = map_memory<float>(lut);
+        auto c = map_memory<float>(sc);
+        auto d = map_memory<float>(dst);
+        for_(memory::dim m = 0; m < M; m++)
+        for (memory::dim n = 0; n < N; n++) {
+            float ref = 0.f;
+            for (memory::dim k = 0; k < K; k++)
+                ref += s_f[m * K + k] * l[k / G * L + w_idx[k * N + n]];
+            ASSERT_EQ(d[m * N + n], ref * c[n]) << pd.impl_info_str();
+        }
+    } while (pd.next_impl());
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(matmul_mx_test_t, TestsWeightsMx) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "MX weights decompression is supported on CPU only.");
+    SKIP_IF(unsupported_data_type(data_type::bf16),
+            "Engine does not support this data type.");
+
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    const memory::dim M = 20, K = 96, N = 48, G = 32;
+
+    // Values exact in every weights data type, and their encodings.
+    const float values[16] = {0.f, 0.5f, 1.f, 1.5f, 2.f, 3.f, 4.f, 6.f, -0.f,
+            -0.5f, -1.f, -1.5f, -2.f, -3.f, -4.f, -6.f};
+    const uint8_t e4m3_codes[8]
+            = {0x00, 0x30, 0x38, 0x3c, 0x40, 0x44, 0x48, 0x4c};
+    const uint8_t e5m2_codes[8]
+            = {0x00, 0x38, 0x3c, 0x3e, 0x40, 0x42, 0x44, 0x46};
+
+    memory::desc src_md({M, K}, data_type::bf16, tag::ab);
+    memory::desc dst_md({M, N}, data_type::f32, tag::ab);
+    memory::desc sc_md({K / G, N}, data_type::e8m0, tag::ab);
+
+    for (auto wei_dt :
+            {data_type::f4_e2m1, data_type::f8_e4m3, data_type::f8_e5m2}) {
+        memory::desc wei_md({K, N}, wei_dt, tag::ab);
+
+        primitive_attr attr;
+        attr.set_scales(DNNL_ARG_WEIGHTS, (1 << 0) | (1 << 1), {G, 1},
+                data_type::e8m0);
+        matmul::primitive_desc pd(eng, src_md, wei_md, dst_md, attr);
+
+        memory src(src_md, eng), wei(wei_md, eng), sc(sc_md, eng);
+        std::vector<float> s_f(M * K), c_f(K / G * N);
+        std::vector<int> w_idx(K * N);
+        {
+            auto s = map_memory<bfloat16_t>(src);
+            for (memory::dim i = 0; i < M * K; i++) {
+                s_f[i] = static_cast<float>(i % 7 - 3);
+                s[i] = s_f[i];
+            }
+            auto w = map_memory<uint8_t>(wei);
+            for (memory::dim i = 0; i < K * N; i++) {
+                const int idx = static_cast<int>((i * 5 + i / N) % 16);
+                w_idx[i] = idx;
+                if (wei_dt == data_type::f4_e2m1) {
+                    if (i % 2 == 0)
+                        w[i / 2] = static_cast<uint8_t>(idx);
+                    else
+                        w[i / 2] |= static_cast<uint8_t>(idx << 4);
+                } else {
+                    const uint8_t *codes = wei_dt == data_type::f8_e4m3
+                            ? e4m3_codes
+                            : e5m2_codes;
+                    w[i] = static_cast<uint8_t>(
+                            codes[idx % 8] | (idx / 8 ? 0x80 : 0));
+                }
+            }
+            // Power of two scales from 1/2 to 4 keep the results exact.
+            auto c = map_memory<uint8_t>(sc);
+            for (memory::dim i = 0; i < K / G * N; i++) {
+                const int e = static_cast<int>(i % 4) - 1;
+                c[i] = static_cast<uint8_t>(127 + e);
+                c_f[i] = e < 0 ? 0.5f : static_cast<float>(1 << e);
+            }
+        }
+
+        // Every implementation available for the problem is checked.
+        do {
+            memory dst(dst_md, eng);
+            matmul(pd).execute(strm,
+                    {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                            {DNNL_ARG_DST, dst},
+                            {DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS, sc}});
+            strm.wait();
+
+            auto d = map_memory<float>(dst);
+            for_(memory::dim m = 0; m < M; m++)
+            for (memory::dim n = 0; n < N; n++) {
+                float ref = 0.f;
+                for (memory::dim k = 0; k < K; k++)
+                    ref += s_f[m * K + k] * values[w_idx[k * N + n]]
+                            * c_f[k / G * N + n];
+                ASSERT_EQ(d[m * N + n], ref) << pd.impl_info_str();
+            }
+        } while (pd.next_impl());
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(matmul_dyn_quant_test_t, TestsSrcDynamicQuant) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Source dynamic quantization is supported on CPU only.");
+
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    const memory::dim M = 20, K = 72, N = 48;
+
+    memory::desc src_md({M, K}, data_type::f32, tag::ab);
+    memory::desc wei_md({K, N}, data_type::s8, tag::ab);
+    memory::desc dst_md({M, N}, data_type::f32, tag::ab);
+    memory::desc sc_md({N}, data_type::f32, tag::a);
+
+    for (auto q_dt : {data_type::s8, data_type::u8}) {
+        const bool is_s8 = q_dt == data_type::s8;
+        const int qmax = is_s8 ? 127 : 255;
+
+        primitive_attr attr;
+        attr.set_src_dynamic_quantization(q_dt);
+        attr.set_scales_mask(DNNL_ARG_WEIGHTS, 1 << 1);
+        matmul::primitive_desc pd(eng, src_md, wei_md, dst_md, attr);
+
+        memory src(src_md, eng), wei(wei_md, eng), sc(sc_md, eng);
+        std::vector<int> s_q(M * K), w_i(K * N);
+        std::vector<float> s_sc(M);
+        {
+            // Every row holds a multiple of its power of two scale with the
+            // magnitude of the largest quantized value, so the quantization
+            // is exact.
+            auto s = map_memory<float>(src);
+            for (memory::dim m = 0; m < M; m++) {
+                s_sc[m] = 1.f / (1 << (m % 3));
+                for (memory::dim k = 0; k < K; k++) {
+                    int v = static_cast<int>((k * 7 + m) % (qmax + 1));
+                    if (is_s8) v -= 64;
+                    if (k == 0) v = m % 2 && is_s8 ? -qmax : qmax;
+                    s_q[m * K + k] = v;
+                    s[m * K + k] = v * s_sc[m];
+                }
+            }
+            auto w = map_memory<int8_t>(wei);
+            for (memory::dim i = 0; i < K * N; i++) {
+                w_i[i] = static_cast<int>(i % 9 - 4);
+                w[i] = static_cast<int8_t>(w_i[i]);
+            }
+            auto c = map_memory<float>(sc);
+            for (memory::dim n = 0; n < N; n++)
+                c[n] = n % 2 ? 0.25f : 2.f;
+        }
+
+        // Every implementation available for the problem is checked.
+        do {
+            memory dst(dst_md, eng);
+            matmul(pd).execute(strm,
+                    {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                            {DNNL_ARG_DST, dst},
+                            {DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS, sc}});
+            strm.wait();
+
+            auto c = map_memory<float>(sc);
+            auto d = map_memory<float>(dst);
+            for_(memory::dim m = 0; m < M; m++)
+            for (memory::dim n = 0; n < N; n++) {
+                int acc = 0;
+                for (memory::dim k = 0; k < K; k++)
+                    acc += s_q[m * K + k] * w_i[k * N + n];
+                ASSERT_EQ(d[m * N + n], acc * s_sc[m] * c[n])
+                        << pd.impl_info_str();
+            }
+        } while (pd.next_impl());
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(matmul_dropout_test_t, TestsDropout) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Dropout is supported on CPU only.");
+
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    const memory::dim M = 20, K = 32, N = 40;
+    const float p = 0.5f;
+    const uint32_t seed = 12345;
+
+    memory::desc src_md({M, K}, data_type::f32, tag::ab);
+    memory::desc wei_md({K, N}, data_type::f32, tag::ab);
+    memory::desc dst_md({M, N}, data_type::f32, tag::ab);
+    memory::desc mask_md({M, N}, data_type::u8, tag::ab);
+    memory::desc p_md({1}, data_type::f32, tag::a);
+    memory::desc seed_md({1}, data_type::s32, tag::a);
+
+    // The linear post-op makes the dropped elements distinguishable from
+    // zero results, as the dropout goes before the post-ops.
+    post_ops ops;
+    ops.append_eltwise(algorithm::eltwise_linear, 1.f, 1.f);
+    primitive_attr attr;
+    attr.set_dropout(mask_md);
+    attr.set_post_ops(ops);
+    matmul::primitive_desc pd(eng, src_md, wei_md, dst_md, attr);
+
+    memory src(src_md, eng), wei(wei_md, eng);
+    memory p_mem(p_md, eng), seed_mem(seed_md, eng);
+    {
+        auto s = map_memory<float>(src);
+        for (memory::dim i = 0; i < M * K; i++)
+            s[i] = static_cast<float>(i % 7 - 3);
+        auto w = map_memory<float>(wei);
+        for (memory::dim i = 0; i < K * N; i++)
+            w[i] = static_cast<float>(i % 5 - 2);
+        map_memory<float>(p_mem)[0] = p;
+        map_memory<uint32_t>(seed_mem)[0] = seed;
+    }
+
+    // Every implementation available for the problem is checked, and must
+    // produce the same mask.
+    std::vector<uint8_t> first_mask;
+    do {
+        memory dst(dst_md, eng), mask(mask_md, eng);
+        matmul(pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst}, {DNNL_ARG_ATTR_DROPOUT_MASK, mask},
+                        {DNNL_ARG_ATTR_DROPOUT_PROBABILITY, p_mem},
+                        {DNNL_ARG_ATTR_DROPOUT_SEED, seed_mem}});
+        strm.wait();
+
+        auto s = map_memory<float>(src);
+        auto w = map_memory<float>(wei);
+        auto d = map_memory<float>(dst);
+        auto k = map_memory<uint8_t>(mask);
+        if (first_mask.empty()) {
+            const uint8_t *k_ptr = k;
+            first_mask.assign(k_ptr, k_ptr + M * N);
+            const auto nkept = std::count(
+                    first_mask.begin(), first_mask.end(), uint8_t(1));
+            ASSERT_GT(nkept, M * N / 4);
+            ASSERT_LT(nkept, M * N * 3 / 4);
+        }
+        for_(memory::dim m = 0; m < M; m++)
+        for (memory::dim n = 0; n < N; n++) {
+            float acc = 0.f;
+            for (memory::dim i = 0; i < K; i++)
+                acc += s[m * K + i] * w[i * N + n];
+            const uint8_t keep = k[m * N + n];
+            ASSERT_EQ(keep, first_mask[m * N + n]) << pd.impl_info_str();
+            ASSERT_EQ(d[m * N + n], (keep ? acc / (1.f - p) : 0.f) + 1.f)
+                    << pd.impl_info_str();
+        }
+    } while (pd.next_impl());
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(
+        matmul_stochastic_round_test_t, TestsStochasticRound) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Stochastic rounding is supported on CPU only.");
+    SKIP_IF(unsupported_data_type(data_type::bf16),
+            "Engine does not support this data type.");
+
+    engine eng = get_test_engine();
+    stream strm(eng);
+
+    const memory::dim M = 20, K = 32, N = 40;
+    const uint32_t seed = 12345;
+
+    memory::desc src_md({M, K}, data_type::bf16, tag::ab);
+    memory::desc wei_md({K, N}, data_type::bf16, tag::ab);
+    memory::desc dst_md({M, N}, data_type::bf16, tag::ab);
+    memory::desc seed_md({1}, data_type::s32, tag::a);
+
+    primitive_attr attr;
+    attr.set_rounding_mode(DNNL_ARG_DST, rounding_mode::stochastic);
+    matmul::primitive_desc pd(eng, src_md, wei_md, dst_md, attr);
+
+    // The inputs are exact in bf16. The results are exact in f32 and need
+    // more bits than bf16 has.
+    memory src(src_md, eng), wei(wei_md, eng), seed_mem(seed_md, eng);
+    std::vector<float> s_f(M * K), w_f(K * N);
+    {
+        auto s = map_memory<bfloat16_t>(src);
+        for (memory::dim i = 0; i < M * K; i++) {
+            s_f[i] = static_cast<float>(i % 97 + 100);
+            s[i] = s_f[i];
+        }
+        auto w = map_memory<bfloat16_t>(wei);
+        for (memory::dim i = 0; i < K * N; i++) {
+            w_f[i] = static_cast<float>(i % 89 + 50);
+            w[i] = w_f[i];
+        }
+        map_memory<uint32_t>(seed_mem)[0] = seed;
+    }
+
+    // The random bias only depends on the seed and on the offset of the
+    // element, so every implementation must give the same results.
+    std::vector<uint16_t> first_dst;
+    do {
+        memory dst(dst_md, eng);
+        matmul(pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst},
+                        {DNNL_ARG_ATTR_ROUNDING_SEED, seed_mem}});
+        strm.wait();
+
+        auto d = map_memory<uint16_t>(dst);
+        if (first_dst.empty()) {
+            const uint16_t *d_ptr = d;
+            first_dst.assign(d_ptr, d_ptr + M * N);
+        }
+        for_(memory::dim m = 0; m < M; m++)
+        for (memory::dim n = 0; n < N; n++) {
+            float acc = 0.f;
+            for (memory::dim i = 0; i < K; i++)
+                acc += s_f[m * K + i] * w_f[i * N + n];
+            uint32_t acc_bits;
+            std::memcpy(&acc_bits, &acc, sizeof(acc));
+            // The result is one of the two closest bf16 values.
+            const uint16_t lo = static_cast<uint16_t>(acc_bits >> 16);
+            const uint16_t r = d[m * N + n];
+            ASSERT_TRUE(r == lo || r == lo + 1) << pd.impl_info_str();
+            ASSERT_EQ(r, first_dst[m * N + n]) << pd.impl_info_str();
+        }
+    } while (pd.next_impl());
+}
+
 INSTANTIATE_TEST_SUITE_P(TensorDims, attr_test_t,
         ::testing::Values(
                 // {{src0, src1, dst same_dim}, { binary post-op dim }},
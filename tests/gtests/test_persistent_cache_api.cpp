@@ -45,13 +45,24 @@ HANDLE_EXCEPTIONS_FOR_TEST(
     ASSERT_NO_THROW(cache_blob_id = pd.get_cache_blob_id());
     ASSERT_EQ(cache_blob_id, pd.get_cache_blob_id());
 
-    if (get_test_engine_kind() != engine::kind::gpu
-            || (get_test_engine_kind() == engine::kind::gpu
-                    && DNNL_GPU_RUNTIME != DNNL_RUNTIME_OCL)) {
+    if (get_test_engine_kind() == engine::kind::gpu
+            && DNNL_GPU_RUNTIME != DNNL_RUNTIME_OCL) {
         ASSERT_EQ(cache_blob_id.empty(), true);
         EXPECT_ANY_THROW(cache_blob = p.get_cache_blob());
         ASSERT_EQ(cache_blob.empty(), true);
         EXPECT_ANY_THROW(convolution_forward(pd, cache_blob));
+    } else if (get_test_engine_kind() == engine::kind::cpu) {
+        ASSERT_EQ(cache_blob_id.empty(), false);
+        // Only some CPU implementations support cache blobs.
+        try {
+            cache_blob = p.get_cache_blob();
+        } catch (const error &err) {
+            ASSERT_EQ(err.status, dnnl_unimplemented);
+            return;
+        }
+        ASSERT_EQ(cache_blob.empty(), false);
+        ASSERT_NO_THROW(p = convolution_forward(pd, cache_blob));
+        ASSERT_EQ(cache_blob, p.get_cache_blob());
     } else {
         ASSERT_EQ(cache_blob_id.empty(), false);
         ASSERT_NO_THROW(cache_blob = p.get_cache_blob());
@@ -61,6 +72,64 @@ HANDLE_EXCEPTIONS_FOR_TEST(
     }
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST(
+        persistent_cache_api_test_t, TestPersistentCacheAPIMatmulCPU) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu, "CPU-only test.");
+
+    using dt = memory::data_type;
+    using tag = memory::format_tag;
+
+    engine e = get_test_engine();
+    stream s(e);
+
+    const memory::dim M = 64, K = 96, N = 48;
+    memory::desc src_md({M, K}, dt::f32, tag::ab);
+    memory::desc wei_md({K, N}, dt::f32, tag::ab);
+    memory::desc dst_md({M, N}, dt::f32, tag::ab);
+    auto pd = matmul::primitive_desc(e, src_md, wei_md, dst_md);
+    auto p = matmul(pd);
+
+    std::vector<uint8_t> cache_blob;
+    try {
+        cache_blob = p.get_cache_blob();
+    } catch (const error &err) {
+        ASSERT_EQ(err.status, dnnl_unimplemented);
+        return;
+    }
+    ASSERT_EQ(cache_blob.empty(), false);
+
+    // Bypass the primitive cache to make sure the jit code is restored from
+    // the cache blob.
+    const int capacity = get_primitive_cache_capacity();
+    set_primitive_cache_capacity(0);
+    matmul p_from_blob;
+    ASSERT_NO_THROW(p_from_blob = matmul(pd, cache_blob));
+    // The kernels of a problem with other blocking don't match the blob.
+    memory::desc other_src_md({M / 2 + 1, K}, dt::f32, tag::ab);
+    memory::desc other_dst_md({M / 2 + 1, N}, dt::f32, tag::ab);
+    auto other_pd
+            = matmul::primitive_desc(e, other_src_md, wei_md, other_dst_md);
+    if (std::string(other_pd.impl_info_str()) == pd.impl_info_str())
+        EXPECT_ANY_THROW(matmul(other_pd, cache_blob));
+    set_primitive_cache_capacity(capacity);
+    ASSERT_EQ(cache_blob, p_from_blob.get_cache_blob());
+
+    memory src(src_md, e), wei(wei_md, e), dst(dst_md, e),
+            dst_from_blob(dst_md, e);
+    fill_data<float>(M * K, src, 1.f, 0.5f);
+    fill_data<float>(K * N, wei, 1.f, 0.5f);
+
+    p.execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst}});
+    p_from_blob.execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst_from_blob}});
+    s.wait();
+
+    compare_data<float>(dst, dst_from_blob);
+}
+
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
 HANDLE_EXCEPTIONS_FOR_TEST(
         persistent_cache_api_test_t, TestPersistentCacheAPIEngine) {